@@ -0,0 +1,295 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// Host-native replay benchmark of the receive-to-publish path.
+//
+// Recorded pulse trains are fed pulse by pulse into the receiver interrupt
+// handler and processed by RfHandler::loop().  For every published code the time from the ESPiLight
+// callback to RfHandler handing the code over (onRfCode), from there to the
+// PubSubClient::publish() call (publishCode) and the whole path (total) are
+// taken and reported as p50/p99 per protocol.  Heap allocations between the
+// ESPiLight callback and the publish are counted to verify that the path is
+// allocation free in steady state.
+//
+// Usage: program [capture file or recording (.bin)] [passes]
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <ArduinoSimpleLogging.h>
+#include <BenchProbe.h>
+#include <ESPiLight.h>
+#include <PubSubClient.h>
+
+#include <MqttClient.h>
+#include <PulseCapture.h>
+#include <PulseStream.h>
+#include <RfHandler.h>
+#include <Settings.h>
+
+using Clock = std::chrono::steady_clock;
+
+const char DEFAULT_CAPTURE[] = "bench/captures/default.txt";
+const int DEFAULT_PASSES = 2000;
+
+struct Frame {
+  std::string protocol;
+  std::vector<uint16_t> pulses;
+};
+
+struct Samples {
+  std::vector<double> onRfCode;
+  std::vector<double> publishCode;
+  std::vector<double> total;
+  double loopTime = 0;
+  unsigned long frames = 0;
+  unsigned long allocations = 0;
+};
+
+static Clock::time_point probes[_HOP_END];
+static unsigned long probedAllocations[_HOP_END];
+static bool probed[_HOP_END];
+static unsigned long allocations = 0;
+
+void *operator new(size_t size) {
+  allocations++;
+  void *ptr = malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+
+void benchProbe(BenchHop hop) {
+  probes[hop] = Clock::now();
+  probedAllocations[hop] = allocations;
+  probed[hop] = true;
+}
+
+static double elapsedMicros(BenchHop from, BenchHop to) {
+  return std::chrono::duration<double, std::micro>(probes[to] - probes[from])
+      .count();
+}
+
+static std::vector<std::string> splitTabs(const std::string &line) {
+  std::vector<std::string> fields;
+  size_t start = 0;
+  size_t end;
+  while ((end = line.find('\t', start)) != std::string::npos) {
+    fields.push_back(line.substr(start, end - start));
+    start = end + 1;
+  }
+  fields.push_back(line.substr(start));
+  return fields;
+}
+
+static String optionalField(const std::string &field) {
+  return field == "-" ? String() : String(field.c_str());
+}
+
+// Recordings downloaded from /rfrecord, no codes are known for them
+static bool loadRecording(const char *path, std::vector<Frame> &frames) {
+  std::ifstream recording(path, std::ios::binary);
+  if (!recording) {
+    fprintf(stderr, "Cannot open recording %s\n", path);
+    return false;
+  }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(recording)),
+                            std::istreambuf_iterator<char>());
+  PulseStreamDecoder decoder(data.data(), data.size());
+  uint32_t gap;
+  uint16_t pulses[MAXPULSESTREAMLENGTH];
+  int length;
+  while ((length = decoder.nextRecord(gap, pulses, MAXPULSESTREAMLENGTH)) >
+         0) {
+    ESPiLight::registerUnknownPulseTrain(pulses, length);
+    frames.push_back({"-", std::vector<uint16_t>(pulses, pulses + length)});
+  }
+  if (length < 0) {
+    fprintf(stderr, "%s: corrupted record at offset %zu\n", path,
+            decoder.position());
+    return false;
+  }
+  return true;
+}
+
+static bool loadCapture(const char *path, std::vector<Frame> &frames) {
+  size_t pathLength = strlen(path);
+  if (pathLength > 4 && strcmp(path + pathLength - 4, ".bin") == 0) {
+    return loadRecording(path, frames);
+  }
+
+  std::ifstream capture(path);
+  if (!capture) {
+    fprintf(stderr, "Cannot open capture file %s\n", path);
+    return false;
+  }
+  std::string line;
+  unsigned int lineNumber = 0;
+  while (std::getline(capture, line)) {
+    lineNumber++;
+    if (line.empty() || line[0] == '#') continue;
+    std::vector<std::string> fields = splitTabs(line);
+    if (fields.size() != 4) {
+      fprintf(stderr, "%s:%u: expected 4 fields\n", path, lineNumber);
+      return false;
+    }
+    uint16_t pulses[MAXPULSESTREAMLENGTH];
+    int length = ESPiLight::stringToPulseTrain(fields[3].c_str(), pulses,
+                                               MAXPULSESTREAMLENGTH);
+    if (length <= 0) {
+      fprintf(stderr, "%s:%u: invalid pulse train (%d)\n", path, lineNumber,
+              length);
+      return false;
+    }
+    if (fields[0] != "-") {
+      ESPiLight::registerRecordedCode(pulses, length, fields[0].c_str(),
+                                      fields[2].c_str(),
+                                      optionalField(fields[1]));
+    }
+    frames.push_back(
+        {fields[0], std::vector<uint16_t>(pulses, pulses + length)});
+  }
+  return true;
+}
+
+static void feedPulseTrain(int8_t pin, const std::vector<uint16_t> &pulses) {
+  for (uint16_t pulse : pulses) {
+    stubAdvanceMicros(pulse);
+    stubTriggerInterrupt(pin);
+  }
+}
+
+static double percentile(std::vector<double> &values, double p) {
+  if (values.empty()) return 0;
+  std::sort(values.begin(), values.end());
+  size_t index = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+  return values[index];
+}
+
+static void printReport(std::map<std::string, Samples> &results) {
+  printf("%-30s %8s %10s %17s %17s %17s %12s\n", "protocol", "frames",
+         "frames/s", "onRfCode p50/p99", "publish p50/p99", "total p50/p99",
+         "allocs/frame");
+  for (auto &result : results) {
+    Samples &s = result.second;
+    printf(
+        "%-30s %8lu %10.0f %8.2f/%-8.2f %8.2f/%-8.2f %8.2f/%-8.2f %12.2f\n",
+           result.first.c_str(), s.frames,
+           s.loopTime > 0 ? s.frames / (s.loopTime / 1e6) : 0,
+           percentile(s.onRfCode, 0.5), percentile(s.onRfCode, 0.99),
+           percentile(s.publishCode, 0.5), percentile(s.publishCode, 0.99),
+           percentile(s.total, 0.5), percentile(s.total, 0.99),
+           s.frames > 0 ? static_cast<double>(s.allocations) / s.frames : 0);
+  }
+  printf("(latencies in us, frames/s based on RfHandler::loop() time)\n");
+}
+
+int main(int argc, char **argv) {
+  const char *capturePath = argc > 1 ? argv[1] : DEFAULT_CAPTURE;
+  int passes = argc > 2 ? atoi(argv[2]) : DEFAULT_PASSES;
+
+  std::vector<Frame> frames;
+  if (!loadCapture(capturePath, frames) || frames.empty()) {
+    return 1;
+  }
+
+  Settings settings;
+  settings.mqttBroker = "localhost";
+  WiFiClient wifi;
+  MqttClient mqttClient(settings, wifi);
+  mqttClient.begin();
+
+  RfHandler rf(settings);
+  char publishedProtocol[RF_TOPIC_PART_SIZE] = "";
+  rf.registerReceiveHandler([&](const char *protocol, const char *data) {
+    benchProbe(HOP_RF_HANDLER);
+    size_t length = strcspn(protocol, "/");
+    memcpy(publishedProtocol, protocol, length);
+    publishedProtocol[length] = 0;
+    mqttClient.publishCode(protocol, data);
+  });
+  rf.filterProtocols(settings.rfProtocols);
+  rf.begin();
+
+  std::map<std::string, Samples> results;
+  Clock::time_point benchStart = Clock::now();
+
+  for (int pass = 0; pass < passes; pass++) {
+    for (const Frame &frame : frames) {
+      std::fill(probed, probed + _HOP_END, false);
+      feedPulseTrain(settings.rfReceiverPin, frame.pulses);
+      Clock::time_point start = Clock::now();
+      rf.loop();
+      double loopTime =
+          std::chrono::duration<double, std::micro>(Clock::now() - start)
+              .count();
+
+      if (!probed[HOP_DONE]) {
+        // decoded repeats and unknown pulse trains are not published
+        Samples &unpublished = results[frame.protocol + " (unpublished)"];
+        unpublished.frames++;
+        unpublished.loopTime += loopTime;
+        continue;
+      }
+      Samples &s = results[publishedProtocol];
+      s.frames++;
+      s.loopTime += loopTime;
+      s.onRfCode.push_back(elapsedMicros(HOP_RF_CALLBACK, HOP_RF_HANDLER));
+      s.publishCode.push_back(elapsedMicros(HOP_RF_HANDLER, HOP_MQTT_PUBLISH));
+      s.total.push_back(elapsedMicros(HOP_RF_CALLBACK, HOP_DONE));
+      s.allocations +=
+          probedAllocations[HOP_DONE] - probedAllocations[HOP_RF_CALLBACK];
+    }
+  }
+
+  double benchTime =
+      std::chrono::duration<double>(Clock::now() - benchStart).count();
+  printReport(results);
+  PulseCapture::Stats capture = rf.captureStats();
+  printf("%lu frames in %.3f s, %lu published, %lu publish failures\n",
+         static_cast<unsigned long>(frames.size()) * passes, benchTime,
+         PubSubClient::published, PubSubClient::dropped);
+  printf("capture ring: %zu captured, %zu dropped, high water mark %zu/%zu\n",
+         capture.captured, capture.dropped, capture.highWaterMark,
+         capture.capacity);
+  printf("glitch filter: %zu short and %zu long pulses rejected\n",
+         capture.rejectedShort, capture.rejectedLong);
+  return 0;
+}
@@ -0,0 +1,321 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdio.h>
+
+#include <chrono>
+#include <thread>
+
+#include "Arduino.h"
+
+static const std::chrono::steady_clock::time_point startTime =
+    std::chrono::steady_clock::now();
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now() - startTime)
+      .count();
+}
+
+static unsigned long virtualMicros = 0;
+static void (*interruptHandlers[16])(void);
+static void (*interruptArgHandlers[16])(void *);
+static void *interruptArgs[16];
+
+static void (*timer1Handler)(void);
+static bool timer1Enabled = false;
+static bool timer1Armed = false;
+static unsigned long timer1Deadline;
+static uint32_t timer1Divider = 1;
+
+unsigned long micros() { return virtualMicros; }
+
+void stubAdvanceMicros(unsigned long us) {
+  const unsigned long target = virtualMicros + us;
+  while (timer1Armed && static_cast<long>(timer1Deadline - target) <= 0) {
+    virtualMicros = timer1Deadline;
+    timer1Armed = false;
+    if (timer1Handler) timer1Handler();
+  }
+  virtualMicros = target;
+}
+
+void timer1_attachInterrupt(void (*handler)(void)) { timer1Handler = handler; }
+
+void timer1_detachInterrupt() { timer1Handler = nullptr; }
+
+void timer1_enable(uint8_t divider, uint8_t, uint8_t) {
+  // timer1 counts 80 MHz divided by 1, 16 or 256
+  timer1Divider = divider == TIM_DIV16 ? 16 : divider == TIM_DIV256 ? 256 : 1;
+  timer1Enabled = true;
+}
+
+void timer1_disable() {
+  timer1Enabled = false;
+  timer1Armed = false;
+}
+
+// single shot only, like the transmitter uses it
+void timer1_write(uint32_t ticks) {
+  if (!timer1Enabled) return;
+  timer1Deadline = virtualMicros + ticks * timer1Divider / 80;
+  timer1Armed = true;
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return howsmall + rand() % (howbig - howsmall);
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t) { return LOW; }
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int) {
+  if (pin < 16) {
+    interruptHandlers[pin] = handler;
+    interruptArgHandlers[pin] = nullptr;
+  }
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg,
+                        int) {
+  if (pin < 16) {
+    interruptHandlers[pin] = nullptr;
+    interruptArgHandlers[pin] = handler;
+    interruptArgs[pin] = arg;
+  }
+}
+
+void detachInterrupt(uint8_t pin) {
+  if (pin < 16) {
+    interruptHandlers[pin] = nullptr;
+    interruptArgHandlers[pin] = nullptr;
+  }
+}
+
+void interrupts() {}
+
+void noInterrupts() {}
+
+void stubTriggerInterrupt(uint8_t pin) {
+  if (pin >= 16) return;
+  if (interruptHandlers[pin]) interruptHandlers[pin]();
+  if (interruptArgHandlers[pin]) interruptArgHandlers[pin](interruptArgs[pin]);
+}
+
+static String formatNumber(const char *format, long long value,
+                           unsigned char base) {
+  char buffer[72];
+  if (base == 16) {
+    snprintf(buffer, sizeof(buffer), "%llx",
+             static_cast<unsigned long long>(value));
+  } else {
+    snprintf(buffer, sizeof(buffer), format, value);
+  }
+  return String(buffer);
+}
+
+String::String(int value, unsigned char base)
+    : String(formatNumber("%lld", value, base)) {}
+
+String::String(unsigned int value, unsigned char base)
+    : String(formatNumber("%llu", value, base)) {}
+
+String::String(long value, unsigned char base)
+    : String(formatNumber("%lld", value, base)) {}
+
+String::String(unsigned long value, unsigned char base)
+    : String(formatNumber("%llu", value, base)) {}
+
+String::String(double value, unsigned char decimalPlaces) {
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces, value);
+  copy(buffer, strlen(buffer));
+}
+
+unsigned char String::reserve(unsigned int size) {
+  if (size <= capacity) return 1;
+  char *grown = new char[size + 1];
+  memcpy(grown, buffer(), len + 1);
+  delete[] heap;
+  heap = grown;
+  capacity = size;
+  return 1;
+}
+
+unsigned char String::concat(const char *cstr, unsigned int length) {
+  if (!cstr) return 0;
+  reserve(len + length);
+  memmove(wbuffer() + len, cstr, length);
+  setLen(len + length);
+  return 1;
+}
+
+String String::substring(unsigned int beginIndex,
+                         unsigned int endIndex) const {
+  if (beginIndex > endIndex) std::swap(beginIndex, endIndex);
+  if (beginIndex > len) return String();
+  if (endIndex > len) endIndex = len;
+  String result;
+  result.concat(buffer() + beginIndex, endIndex - beginIndex);
+  return result;
+}
+
+void String::invalidate() {
+  delete[] heap;
+  heap = nullptr;
+  capacity = SSO_SIZE - 1;
+  len = 0;
+  sso[0] = 0;
+}
+
+void String::copy(const char *cstr, unsigned int length) {
+  reserve(length);
+  memmove(wbuffer(), cstr ? cstr : "", length);
+  setLen(length);
+}
+
+void String::move(String &other) {
+  memcpy(sso, other.sso, SSO_SIZE);
+  heap = other.heap;
+  capacity = other.capacity;
+  len = other.len;
+  other.heap = nullptr;
+  other.invalidate();
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::write(const char *str) {
+  return str ? write(str, strlen(str)) : 0;
+}
+
+size_t Print::print(const __FlashStringHelper *pstr) {
+  return write(reinterpret_cast<const char *>(pstr));
+}
+
+size_t Print::print(const String &s) { return write(s.c_str(), s.length()); }
+
+size_t Print::print(const char str[]) { return write(str); }
+
+size_t Print::print(char c) { return write(static_cast<uint8_t>(c)); }
+
+size_t Print::print(unsigned char b, int base) {
+  return print(static_cast<unsigned long>(b), base);
+}
+
+size_t Print::print(int n, int base) {
+  return print(static_cast<long>(n), base);
+}
+
+size_t Print::print(unsigned int n, int base) {
+  return print(static_cast<unsigned long>(n), base);
+}
+
+size_t Print::print(long n, int base) { return print(String(n, base)); }
+
+size_t Print::print(unsigned long n, int base) {
+  return print(String(n, base));
+}
+
+size_t Print::print(double n, int digits) { return print(String(n, digits)); }
+
+size_t Print::println() { return write("\r\n"); }
+
+template <typename T>
+static size_t printlnImpl(Print &p, const T &value) {
+  size_t n = p.print(value);
+  return n + p.println();
+}
+
+template <typename T>
+static size_t printlnImpl(Print &p, const T &value, int base) {
+  size_t n = p.print(value, base);
+  return n + p.println();
+}
+
+size_t Print::println(const __FlashStringHelper *s) {
+  return printlnImpl(*this, s);
+}
+
+size_t Print::println(const String &s) { return printlnImpl(*this, s); }
+
+size_t Print::println(const char c[]) { return printlnImpl(*this, c); }
+
+size_t Print::println(char c) { return printlnImpl(*this, c); }
+
+size_t Print::println(unsigned char b, int base) {
+  return printlnImpl(*this, b, base);
+}
+
+size_t Print::println(int n, int base) { return printlnImpl(*this, n, base); }
+
+size_t Print::println(unsigned int n, int base) {
+  return printlnImpl(*this, n, base);
+}
+
+size_t Print::println(long n, int base) { return printlnImpl(*this, n, base); }
+
+size_t Print::println(unsigned long n, int base) {
+  return printlnImpl(*this, n, base);
+}
+
+size_t Print::println(double n, int digits) {
+  return printlnImpl(*this, n, digits);
+}
+
+size_t Stream::readBytes(char *buffer, size_t length) {
+  size_t count = 0;
+  while (count < length) {
+    int c = read();
+    if (c < 0) break;
+    *buffer++ = static_cast<char>(c);
+    count++;
+  }
+  return count;
+}
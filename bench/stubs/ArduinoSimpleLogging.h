@@ -0,0 +1,67 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef BENCH_ARDUINOSIMPLELOGGING_H
+#define BENCH_ARDUINOSIMPLELOGGING_H
+
+#include "Arduino.h"
+
+// Log sink that only counts the formatted bytes.  The formatting work of the
+// logging calls stays part of the measured path, the output is dropped.
+class NullLogTarget : public Print {
+ public:
+  size_t write(uint8_t) override {
+    written++;
+    return 1;
+  }
+  size_t write(const uint8_t *, size_t size) override {
+    written += size;
+    return size;
+  }
+
+  unsigned long written = 0;
+};
+
+class SimpleLogger {
+ public:
+  enum Level { ERROR, WARNING, INFO, DEBUG };
+
+  Level stringToLevel(const String &) { return DEBUG; }
+  void addHandler(Level, Print &) {}
+  void removeHandler(Print &) {}
+
+  NullLogTarget error;
+  NullLogTarget warning;
+  NullLogTarget info;
+  NullLogTarget debug;
+};
+
+extern SimpleLogger Logger;
+
+#endif  // BENCH_ARDUINOSIMPLELOGGING_H
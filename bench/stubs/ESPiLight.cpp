@@ -0,0 +1,342 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "BenchProbe.h"
+#include "ESPiLight.h"
+
+namespace {
+
+struct RecordedCode {
+  String protocol;
+  String message;
+  String deviceID;
+};
+
+struct RepeatState {
+  String message;
+  unsigned long lastReceived;
+  size_t repeats;
+};
+
+using PulseTrain = std::vector<uint16_t>;
+
+std::map<PulseTrain, std::vector<RecordedCode>> recordedCodes;
+std::set<std::string> knownProtocols;
+std::set<std::string> enabledProtocolSet;
+std::map<std::string, RepeatState> repeatStates;
+
+// Same message of the same protocol within this time counts as repeat.
+const unsigned long REPEAT_WINDOW = 500;
+
+PilightRepeatStatus_t repeatStatus(const RecordedCode &code, size_t &repeats) {
+  RepeatState &state = repeatStates[code.protocol.c_str()];
+  unsigned long now = millis();
+  if (state.message == code.message &&
+      now - state.lastReceived < REPEAT_WINDOW) {
+    state.repeats++;
+  } else {
+    state.message = code.message;
+    state.repeats = 0;
+  }
+  state.lastReceived = now;
+  repeats = state.repeats + 1;
+  switch (state.repeats) {
+    case 0:
+      return FIRST;
+    case 1:
+      return VALID;
+    default:
+      return KNOWN;
+  }
+}
+
+bool isEnabled(const String &protocol) {
+  return enabledProtocolSet.empty() ||
+         enabledProtocolSet.count(protocol.c_str()) > 0;
+}
+
+// Derive the pulse train limits of the enabled protocols from the recorded
+// pulse trains, the library takes them from the protocol definitions.
+void updateLimits() {
+  ESPiLight::minrawlen = MAXPULSESTREAMLENGTH;
+  ESPiLight::maxrawlen = 0;
+  ESPiLight::mingaplen = 10000;
+  ESPiLight::maxgaplen = 0;
+  for (const auto &entry : recordedCodes) {
+    const PulseTrain &pulses = entry.first;
+    // pulse trains without codes are always received, see
+    // registerUnknownPulseTrain()
+    bool receivable = entry.second.empty();
+    for (const auto &code : entry.second) {
+      if (isEnabled(code.protocol)) receivable = true;
+    }
+    if (receivable) {
+      ESPiLight::minrawlen =
+          std::min<unsigned>(ESPiLight::minrawlen, pulses.size());
+      ESPiLight::maxrawlen =
+          std::max<unsigned>(ESPiLight::maxrawlen, pulses.size());
+      ESPiLight::mingaplen =
+          std::min<unsigned>(ESPiLight::mingaplen, pulses.back() * 9 / 10);
+      ESPiLight::maxgaplen =
+          std::max<unsigned>(ESPiLight::maxgaplen, pulses.back() * 11 / 10);
+    }
+  }
+}
+
+String protocolList(const std::set<std::string> &protocols) {
+  String result('[');
+  for (const auto &protocol : protocols) {
+    if (result.length() > 1) result += ',';
+    result += '"';
+    result += protocol.c_str();
+    result += '"';
+  }
+  result += ']';
+  return result;
+}
+
+}  // namespace
+
+unsigned long ESPiLight::sentPulses = 0;
+unsigned int ESPiLight::minrawlen = 0;
+unsigned int ESPiLight::maxrawlen = 0;
+unsigned int ESPiLight::mingaplen = 0;
+unsigned int ESPiLight::maxgaplen = 0;
+
+ESPiLight::ESPiLight(int8_t outputPin)
+    : _callback(nullptr),
+      _rawCallback(nullptr),
+      _outputPin(outputPin),
+      _echoEnabled(false) {}
+
+int ESPiLight::send(const String &protocol, const String &json, int repeats) {
+  if (_outputPin < 0) {
+    return ERROR_NO_OUTPUT_PIN;
+  }
+  uint16_t pulses[MAXPULSESTREAMLENGTH];
+  int length = createPulseTrain(pulses, protocol, json);
+  if (length > 0) {
+    sendPulseTrain(pulses, length, repeats);
+  }
+  return length;
+}
+
+int ESPiLight::createPulseTrain(uint16_t *pulses, const String &protocol_id,
+                                const String &json) {
+  if (knownProtocols.count(protocol_id.c_str()) == 0) {
+    return ERROR_UNAVAILABLE_PROTOCOL;
+  }
+  if (json.length() == 0 || json[0] != '{') {
+    return ERROR_INVALID_JSON;
+  }
+  for (const auto &entry : recordedCodes) {
+    for (const auto &code : entry.second) {
+      if (code.protocol == protocol_id && code.message == json) {
+        std::copy(entry.first.begin(), entry.first.end(), pulses);
+        return entry.first.size();
+      }
+    }
+  }
+  return ERROR_INVALID_PILIGHT_MSG;
+}
+
+void ESPiLight::sendPulseTrain(const uint16_t *pulses, size_t length,
+                               int repeats) {
+  if (_outputPin < 0) return;
+  sentPulses += length * repeats;
+  if (_echoEnabled) {
+    uint16_t echo[MAXPULSESTREAMLENGTH];
+    std::copy(pulses, pulses + length, echo);
+    parsePulseTrain(echo, length);
+  }
+}
+
+int ESPiLight::parsePulseTrain(uint16_t *pulses, uint8_t length) {
+  if (_rawCallback) {
+    _rawCallback(pulses, length);
+  }
+  if (!_callback) return 0;
+
+  auto found = recordedCodes.find(PulseTrain(pulses, pulses + length));
+  if (found == recordedCodes.end()) return 0;
+
+  int matches = 0;
+  for (const auto &code : found->second) {
+    if (!isEnabled(code.protocol)) continue;
+    size_t repeats;
+    PilightRepeatStatus_t status = repeatStatus(code, repeats);
+    benchProbe(HOP_RF_CALLBACK);
+    _callback(code.protocol, code.message, status, repeats, code.deviceID);
+    matches++;
+  }
+  return matches;
+}
+
+void ESPiLight::loop() {
+  uint16_t pulses[MAXPULSESTREAMLENGTH];
+  int length = receivePulseTrain(pulses);
+  if (length > 0) {
+    parsePulseTrain(pulses, length);
+  }
+}
+
+void ESPiLight::setCallback(ESPiLightCallBack callback) {
+  _callback = callback;
+}
+
+void ESPiLight::setPulseTrainCallBack(PulseTrainCallBack rawCallback) {
+  _rawCallback = rawCallback;
+}
+
+void ESPiLight::setEchoEnabled(bool enabled) { _echoEnabled = enabled; }
+
+void ESPiLight::setErrorOutput(Print &) {}
+
+void ESPiLight::initReceiver(byte) {}
+
+uint16_t ESPiLight::nextPulseTrainLength() { return 0; }
+
+int ESPiLight::receivePulseTrain(uint16_t *) { return 0; }
+
+void ESPiLight::enableReceiver() {}
+
+void ESPiLight::disableReceiver() {}
+
+void ESPiLight::resetReceiver() {}
+
+void ESPiLight::interruptHandler() {}
+
+String ESPiLight::pulseTrainToString(const uint16_t *codes, size_t length) {
+  int plstrs[MAX_PULSE_TYPES] = {0};
+  int types = 0;
+  String data("c:");
+  data.reserve(length + 64);
+
+  for (size_t i = 0; i < length; i++) {
+    int j;
+    for (j = 0; j < types; j++) {
+      // compare with a tolerance of 100us, like the library does
+      int diff = (plstrs[j] / 50) - (codes[i] / 50);
+      if (diff >= -2 && diff <= 2) break;
+    }
+    if (j == types) {
+      if (types == MAX_PULSE_TYPES) return String();
+      plstrs[types++] = codes[i];
+    }
+    data += static_cast<char>('0' + j);
+  }
+  data += F(";p:");
+  for (int j = 0; j < types; j++) {
+    if (j > 0) data += ',';
+    data += plstrs[j];
+  }
+  data += '@';
+  return data;
+}
+
+int ESPiLight::stringToPulseTrain(const String &data, uint16_t *codes,
+                                  size_t maxlength) {
+  int start = data.indexOf(F("c:"));
+  if (start < 0 || data.length() <= static_cast<unsigned>(start) + 2) {
+    return ERROR_INVALID_PULSETRAIN_MSG_C;
+  }
+  int end = data.indexOf(';', start);
+  if (end < 0) return ERROR_INVALID_PULSETRAIN_MSG_END;
+
+  int pstart = data.indexOf(F("p:"));
+  if (pstart < 0 || data.length() <= static_cast<unsigned>(pstart) + 2) {
+    return ERROR_INVALID_PULSETRAIN_MSG_P;
+  }
+  uint16_t plstrs[MAX_PULSE_TYPES];
+  int types = 0;
+  const char *pos = data.c_str() + pstart + 2;
+  while (*pos && *pos != '@' && *pos != ';' && types < MAX_PULSE_TYPES) {
+    char *next;
+    plstrs[types++] = strtoul(pos, &next, 10);
+    pos = (*next == ',') ? next + 1 : next;
+  }
+  if (*pos != '@' && *pos != ';') return ERROR_INVALID_PULSETRAIN_MSG_END;
+
+  size_t length = 0;
+  for (int i = start + 2; i < end && length < maxlength; i++) {
+    int type = data[i] - '0';
+    if (type < 0 || type >= types) return ERROR_INVALID_PULSETRAIN_MSG_TYPE;
+    codes[length++] = plstrs[type];
+  }
+  return length;
+}
+
+int ESPiLight::stringToRepeats(const String &data) {
+  int start = data.indexOf(F("r:"));
+  if (start < 0) return -1;
+  return data.substring(start + 2).toInt();
+}
+
+String ESPiLight::availableProtocols() { return protocolList(knownProtocols); }
+
+String ESPiLight::enabledProtocols() {
+  return protocolList(enabledProtocolSet.empty() ? knownProtocols
+                                                 : enabledProtocolSet);
+}
+
+void ESPiLight::limitProtocols(const String &protos) {
+  enabledProtocolSet.clear();
+  const char *pos = protos.c_str();
+  while ((pos = strchr(pos, '"')) != nullptr) {
+    const char *end = strchr(pos + 1, '"');
+    if (end == nullptr) break;
+    enabledProtocolSet.insert(std::string(pos + 1, end));
+    pos = end + 1;
+  }
+  updateLimits();
+}
+
+void ESPiLight::registerRecordedCode(const uint16_t *pulses, size_t length,
+                                     const String &protocol,
+                                     const String &message,
+                                     const String &deviceID) {
+  knownProtocols.insert(protocol.c_str());
+  auto &codes = recordedCodes[PulseTrain(pulses, pulses + length)];
+  for (const auto &code : codes) {
+    if (code.protocol == protocol) return;
+  }
+  codes.push_back({protocol, message, deviceID});
+  updateLimits();
+}
+
+void ESPiLight::registerUnknownPulseTrain(const uint16_t *pulses,
+                                          size_t length) {
+  recordedCodes[PulseTrain(pulses, pulses + length)];
+  updateLimits();
+}
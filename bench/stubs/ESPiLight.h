@@ -0,0 +1,123 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef BENCH_ESPILIGHT_H
+#define BENCH_ESPILIGHT_H
+
+#include <functional>
+
+#include "Arduino.h"
+
+#define RECEIVER_BUFFER_SIZE 10
+#define MAXPULSESTREAMLENGTH 255
+#define MAX_PULSE_TYPES 10
+
+enum PilightRepeatStatus_t { FIRST, INVALID, VALID, KNOWN, UNKNOWN };
+
+typedef std::function<void(const String &protocol, const String &message,
+                           int status, size_t repeats,
+                           const String &deviceID)>
+    ESPiLightCallBack;
+typedef std::function<void(const uint16_t *pulses, size_t length)>
+    PulseTrainCallBack;
+
+// Replacement of the ESPiLight surface used by RfHandler.  Instead of running
+// the pilight protocol decoders, pulse trains are looked up in a table of
+// recorded decode results (see registerRecordedCode).  The receiver of the
+// library is not used by RfHandler and therefore not emulated.
+class ESPiLight {
+ public:
+  static const int ERROR_UNAVAILABLE_PROTOCOL = -1;
+  static const int ERROR_INVALID_PILIGHT_MSG = -2;
+  static const int ERROR_INVALID_JSON = -3;
+  static const int ERROR_NO_OUTPUT_PIN = -4;
+
+  static const int ERROR_INVALID_PULSETRAIN_MSG_C = -1;
+  static const int ERROR_INVALID_PULSETRAIN_MSG_P = -2;
+  static const int ERROR_INVALID_PULSETRAIN_MSG_END = -3;
+  static const int ERROR_INVALID_PULSETRAIN_MSG_TYPE = -4;
+
+  explicit ESPiLight(int8_t outputPin);
+
+  int send(const String &protocol, const String &json, int repeats = 10);
+  int createPulseTrain(uint16_t *pulses, const String &protocol_id,
+                       const String &json);
+  void sendPulseTrain(const uint16_t *pulses, size_t length,
+                      int repeats = 10);
+  int parsePulseTrain(uint16_t *pulses, uint8_t length);
+  void loop();
+
+  void setCallback(ESPiLightCallBack callback);
+  void setPulseTrainCallBack(PulseTrainCallBack rawCallback);
+  void setEchoEnabled(bool enabled);
+  void setErrorOutput(Print &output);
+  void initReceiver(byte inputPin);
+
+  static uint16_t nextPulseTrainLength();
+  static int receivePulseTrain(uint16_t *pulses);
+  static void enableReceiver();
+  static void disableReceiver();
+  static void resetReceiver();
+  static void interruptHandler();
+
+  static String pulseTrainToString(const uint16_t *pulses, size_t length);
+  static int stringToPulseTrain(const String &data, uint16_t *codes,
+                                size_t maxlength);
+  static int stringToRepeats(const String &data);
+
+  static String availableProtocols();
+  static String enabledProtocols();
+  static void limitProtocols(const String &protos);
+
+  // Benchmark only: make parsePulseTrain() report the given code for an
+  // identical pulse train.  The repeat status is derived like the library
+  // does from identical messages received in short succession.
+  static void registerRecordedCode(const uint16_t *pulses, size_t length,
+                                   const String &protocol,
+                                   const String &message,
+                                   const String &deviceID);
+  // Benchmark only: make the receiver accept the given pulse train without
+  // reporting any code for it, e.g., for replayed recordings.
+  static void registerUnknownPulseTrain(const uint16_t *pulses, size_t length);
+
+  static unsigned int minrawlen;
+  static unsigned int maxrawlen;
+  static unsigned int mingaplen;
+  static unsigned int maxgaplen;
+
+  static unsigned long sentPulses;
+
+ private:
+  ESPiLightCallBack _callback;
+  PulseTrainCallBack _rawCallback;
+  int8_t _outputPin;
+  bool _echoEnabled;
+};
+
+#endif  // BENCH_ESPILIGHT_H
@@ -0,0 +1,85 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef BENCH_FS_H
+#define BENCH_FS_H
+
+#include "Arduino.h"
+
+// The benchmark never touches the flash file system, this only satisfies the
+// Settings library, the pulse recorder and the transmit macros.
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+ public:
+  size_t write(uint8_t) override { return 0; }
+  size_t write(const uint8_t *, size_t) override { return 0; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  size_t read(uint8_t *, size_t) { return 0; }
+  size_t size() const { return 0; }
+  bool seek(uint32_t, SeekMode) { return false; }
+  int peek() override { return -1; }
+  void close() {}
+  explicit operator bool() const { return false; }
+};
+
+class Dir {
+ public:
+  bool next() { return false; }
+  String fileName() { return String(); }
+};
+
+class FS {
+ public:
+  bool begin() { return true; }
+  bool exists(const char *) { return false; }
+  bool exists(const String &) { return false; }
+  bool exists(const __FlashStringHelper *) { return false; }
+  template <typename T>
+  File open(const T &, const char *) {
+    return File();
+  }
+  template <typename T>
+  Dir openDir(const T &) {
+    return Dir();
+  }
+  template <typename T>
+  bool remove(const T &) {
+    return false;
+  }
+  template <typename T>
+  bool rename(const T &, const T &) {
+    return false;
+  }
+};
+
+extern FS SPIFFS;
+
+#endif  // BENCH_FS_H
@@ -0,0 +1,72 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "PubSubClient.h"
+
+unsigned long PubSubClient::published = 0;
+unsigned long PubSubClient::dropped = 0;
+
+bool PubSubClient::publish(const char *topic, const char *payload,
+                           bool retained) {
+  return publish(topic, reinterpret_cast<const uint8_t *>(payload),
+                 payload ? strlen(payload) : 0, retained);
+}
+
+bool PubSubClient::publish(const char *topic, const uint8_t *payload,
+                           unsigned int plength, bool retained) {
+  benchProbe(HOP_MQTT_PUBLISH);
+  size_t topicLength = strlen(topic);
+  // fixed header (max 5 bytes) + topic length field + topic + payload
+  if (!isConnected || 5 + 2 + topicLength + plength > sizeof(buffer)) {
+    dropped++;
+    benchProbe(HOP_DONE);
+    return false;
+  }
+  uint8_t *pos = buffer + 5;
+  *pos++ = topicLength >> 8;
+  *pos++ = topicLength & 0xff;
+  memcpy(pos, topic, topicLength);
+  memcpy(pos + topicLength, payload, plength);
+  buffer[0] = retained ? 0x31 : 0x30;
+  published++;
+  benchProbe(HOP_DONE);
+  return true;
+}
+
+void PubSubClient::deliver(const char *topic, const uint8_t *payload,
+                           unsigned int length) {
+  if (!callback) return;
+  char topicBuffer[MQTT_MAX_PACKET_SIZE];
+  strncpy(topicBuffer, topic, sizeof(topicBuffer) - 1);
+  topicBuffer[sizeof(topicBuffer) - 1] = 0;
+  uint8_t payloadBuffer[MQTT_MAX_PACKET_SIZE];
+  if (length > sizeof(payloadBuffer)) length = sizeof(payloadBuffer);
+  memcpy(payloadBuffer, payload, length);
+  callback(topicBuffer, payloadBuffer, length);
+}
@@ -0,0 +1,132 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef BENCH_PUBSUBCLIENT_H
+#define BENCH_PUBSUBCLIENT_H
+
+#include <functional>
+
+#include "Arduino.h"
+#include "BenchProbe.h"
+#include "WiFiClient.h"
+
+#ifndef MQTT_MAX_PACKET_SIZE
+#define MQTT_MAX_PACKET_SIZE 128
+#endif
+
+#ifndef MQTT_KEEPALIVE
+#define MQTT_KEEPALIVE 15
+#endif
+
+#define MQTTCONNECT 1 << 4
+#define MQTTCONNACK 2 << 4
+#define MQTTPUBLISH 3 << 4
+#define MQTTPUBACK 4 << 4
+#define MQTTSUBSCRIBE 8 << 4
+
+#define MQTTQOS1 (1 << 1)
+
+// Broker-less PubSubClient.  Publishes are accepted and counted, the packet
+// is serialized into the client buffer like the real library does.
+class PubSubClient {
+ public:
+  using Callback = std::function<void(char *, uint8_t *, unsigned int)>;
+
+  explicit PubSubClient(Client &client) : client(&client) {}
+
+  PubSubClient &setServer(const char *, uint16_t) { return *this; }
+  PubSubClient &setCallback(const Callback &cb) {
+    callback = cb;
+    return *this;
+  }
+
+  // Like the real library, an established socket is used as is and only the
+  // CONNACK is read back.
+  bool connect(const char *, const char *, uint8_t, bool, const char *) {
+    return handshake();
+  }
+  bool connect(const char *, const char *, const char *, const char *,
+               uint8_t, bool, const char *) {
+    return handshake();
+  }
+  void disconnect() {
+    isConnected = false;
+    client->stop();
+  }
+
+  bool publish(const char *topic, const char *payload, bool retained);
+  bool publish(const char *topic, const uint8_t *payload,
+               unsigned int plength, bool retained);
+  // Streamed publish, written to the socket without the buffer.
+  bool beginPublish(const char *, unsigned int, bool) {
+    benchProbe(HOP_MQTT_PUBLISH);
+    if (!connected()) {
+      dropped++;
+      benchProbe(HOP_DONE);
+    }
+    return connected();
+  }
+  size_t write(const uint8_t *, size_t size) { return size; }
+  int endPublish() {
+    published++;
+    benchProbe(HOP_DONE);
+    return 1;
+  }
+  bool subscribe(const char *) { return isConnected; }
+  // Reads the received packets like the real library, without handling
+  // them.
+  bool loop() {
+    while (connected() && client->available() > 0) client->read();
+    return connected();
+  }
+  bool connected() { return isConnected && client->connected(); }
+
+  // Inject an inbound message as if it was received from the broker.
+  void deliver(const char *topic, const uint8_t *payload,
+               unsigned int length);
+
+  static unsigned long published;
+  static unsigned long dropped;
+
+ private:
+  bool handshake() {
+    uint8_t connack[4];
+    isConnected = client->connected() &&
+                  client->read(connack, sizeof(connack)) == 4 &&
+                  connack[3] == 0;
+    return isConnected;
+  }
+
+  Client *client;
+  Callback callback;
+  bool isConnected = false;
+  uint8_t buffer[MQTT_MAX_PACKET_SIZE];
+};
+
+#endif  // BENCH_PUBSUBCLIENT_H
@@ -0,0 +1,185 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef BENCH_WSTRING_H
+#define BENCH_WSTRING_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arduino.h"
+
+// Minimal replacement of the ESP8266 core String.  Only the members used by
+// the gateway libraries are provided.  Like the core (2.5 and later), strings
+// of up to 11 characters are stored inline and longer ones on the heap, so
+// the benchmark sees the same heap allocations as the device.
+class String {
+ public:
+  String(const char *cstr = "") { copy(cstr, cstr ? strlen(cstr) : 0); }
+  String(const __FlashStringHelper *pstr)
+      : String(reinterpret_cast<const char *>(pstr)) {}
+  String(const String &other) { copy(other.buffer(), other.len); }
+  String(String &&other) { move(other); }
+  explicit String(char c) { copy(&c, 1); }
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(double value, unsigned char decimalPlaces = 2);
+  ~String() { invalidate(); }
+
+  String &operator=(const String &rhs) {
+    if (this != &rhs) copy(rhs.buffer(), rhs.len);
+    return *this;
+  }
+  String &operator=(String &&rhs) {
+    if (this != &rhs) {
+      invalidate();
+      move(rhs);
+    }
+    return *this;
+  }
+  String &operator=(const char *cstr) {
+    copy(cstr, cstr ? strlen(cstr) : 0);
+    return *this;
+  }
+  String &operator=(const __FlashStringHelper *pstr) {
+    return *this = reinterpret_cast<const char *>(pstr);
+  }
+
+  unsigned char reserve(unsigned int size);
+  unsigned int length() const { return len; }
+  const char *c_str() const { return buffer(); }
+  char operator[](unsigned int index) const { return buffer()[index]; }
+  char &operator[](unsigned int index) { return wbuffer()[index]; }
+  char charAt(unsigned int index) const { return buffer()[index]; }
+
+  unsigned char concat(const String &s) { return concat(s.buffer(), s.len); }
+  unsigned char concat(const char *cstr) {
+    return cstr ? concat(cstr, strlen(cstr)) : 0;
+  }
+  unsigned char concat(const char *cstr, unsigned int length);
+  unsigned char concat(const __FlashStringHelper *pstr) {
+    return concat(reinterpret_cast<const char *>(pstr));
+  }
+  unsigned char concat(char c) { return concat(&c, 1); }
+  unsigned char concat(int num) { return concat(String(num)); }
+  unsigned char concat(unsigned int num) { return concat(String(num)); }
+  unsigned char concat(long num) { return concat(String(num)); }
+  unsigned char concat(unsigned long num) { return concat(String(num)); }
+
+  template <typename T>
+  String &operator+=(const T &rhs) {
+    concat(rhs);
+    return *this;
+  }
+
+  unsigned char equals(const String &s) const {
+    return len == s.len && memcmp(buffer(), s.buffer(), len) == 0;
+  }
+  unsigned char equals(const char *cstr) const {
+    if (len == 0) return cstr == nullptr || *cstr == 0;
+    if (cstr == nullptr) return false;
+    return strcmp(buffer(), cstr) == 0;
+  }
+  unsigned char operator==(const String &rhs) const { return equals(rhs); }
+  unsigned char operator==(const char *cstr) const { return equals(cstr); }
+  unsigned char operator!=(const String &rhs) const { return !equals(rhs); }
+  unsigned char operator!=(const char *cstr) const { return !equals(cstr); }
+  bool operator<(const String &rhs) const {
+    return strcmp(buffer(), rhs.buffer()) < 0;
+  }
+
+  unsigned char startsWith(const String &prefix) const {
+    return len >= prefix.len &&
+           memcmp(buffer(), prefix.buffer(), prefix.len) == 0;
+  }
+  unsigned char endsWith(const String &suffix) const {
+    return len >= suffix.len &&
+           memcmp(buffer() + len - suffix.len, suffix.buffer(), suffix.len) ==
+               0;
+  }
+  int indexOf(char ch, unsigned int fromIndex = 0) const {
+    if (fromIndex >= len) return -1;
+    const char *found = strchr(buffer() + fromIndex, ch);
+    return found ? found - buffer() : -1;
+  }
+  int indexOf(const String &s, unsigned int fromIndex = 0) const {
+    if (fromIndex > len) return -1;
+    const char *found = strstr(buffer() + fromIndex, s.buffer());
+    return found ? found - buffer() : -1;
+  }
+  String substring(unsigned int beginIndex) const {
+    return substring(beginIndex, length());
+  }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+  long toInt() const { return strtol(buffer(), nullptr, 10); }
+
+ protected:
+  void setLen(int length) {
+    len = length;
+    wbuffer()[len] = 0;
+  }
+  char *wbuffer() { return heap ? heap : sso; }
+
+ private:
+  static const unsigned int SSO_SIZE = 12;
+
+  const char *buffer() const { return heap ? heap : sso; }
+  void invalidate();
+  void copy(const char *cstr, unsigned int length);
+  void move(String &other);
+
+  char sso[SSO_SIZE] = "";
+  char *heap = nullptr;
+  unsigned int capacity = SSO_SIZE - 1;
+  unsigned int len = 0;
+};
+
+template <typename T>
+String operator+(const String &lhs, const T &rhs) {
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+inline String operator+(const char *lhs, const String &rhs) {
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+inline String operator+(const __FlashStringHelper *lhs, const String &rhs) {
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+#endif  // BENCH_WSTRING_H
@@ -0,0 +1,115 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef BENCH_WIFICLIENT_H
+#define BENCH_WIFICLIENT_H
+
+#include "Arduino.h"
+#include "Stream.h"
+
+class IPAddress {};
+
+class Client : public Stream {
+ public:
+  virtual int connect(IPAddress ip, uint16_t port) = 0;
+  virtual int connect(const char *host, uint16_t port) = 0;
+  using Print::write;
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) = 0;
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int read(uint8_t *buffer, size_t size) = 0;
+  virtual int peek() = 0;
+  virtual void flush() = 0;
+  virtual void stop() = 0;
+  virtual uint8_t connected() = 0;
+  virtual operator bool() = 0;
+};
+
+// Loopback broker connection: connecting always succeeds, a CONNECT packet
+// is answered with an accepting CONNACK and a QoS 1 PUBLISH with its PUBACK.
+// Everything else written is discarded.
+class WiFiClient : public Client {
+ public:
+  int connect(IPAddress, uint16_t) override { return isOpen = true; }
+  int connect(const char *, uint16_t) override { return isOpen = true; }
+  size_t write(uint8_t data) override { return write(&data, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override {
+    if (!isOpen) return 0;
+    if (size > 0 && buffer[0] == 0x10) {
+      const uint8_t connack[] = {0x20, 0x02, 0x00, 0x00};
+      answer(connack);
+    } else if (size > 0 && (buffer[0] & 0xf6) == 0x32) {
+      size_t pos = 1;
+      while (pos < size && buffer[pos] & 0x80) pos++;
+      pos++;
+      if (pos + 1 < size) pos += 2 + (buffer[pos] << 8 | buffer[pos + 1]);
+      if (pos + 1 < size) {
+        const uint8_t puback[] = {0x40, 0x02, buffer[pos], buffer[pos + 1]};
+        answer(puback);
+      }
+    }
+    return size;
+  }
+  int available() override { return replyEnd - replyStart; }
+  int read() override {
+    if (replyStart == replyEnd) return -1;
+    return replies[replyStart++];
+  }
+  int read(uint8_t *buffer, size_t size) override {
+    size_t count = 0;
+    while (count < size && replyStart < replyEnd) buffer[count++] = read();
+    return count;
+  }
+  int peek() override {
+    return replyStart < replyEnd ? replies[replyStart] : -1;
+  }
+  void flush() override {}
+  void stop() override {
+    isOpen = false;
+    replyStart = replyEnd = 0;
+  }
+  uint8_t connected() override { return isOpen; }
+  operator bool() override { return isOpen; }
+
+ private:
+  void answer(const uint8_t (&packet)[4]) {
+    if (replyStart == replyEnd) replyStart = replyEnd = 0;
+    if (replyEnd + sizeof(packet) > sizeof(replies)) return;
+    memcpy(replies + replyEnd, packet, sizeof(packet));
+    replyEnd += sizeof(packet);
+  }
+
+  bool isOpen = false;
+  uint8_t replies[64];
+  size_t replyStart = 0;
+  size_t replyEnd = 0;
+};
+
+#endif  // BENCH_WIFICLIENT_H
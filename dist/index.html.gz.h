@@ -1,1527 +1,1672 @@
-static const unsigned int index_html_gz_len = 18296;
+static const unsigned int index_html_gz_len = 20032;
 static const char index_html_gz[] PROGMEM = {
     0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d,
-    0x6b, 0x77, 0xdb, 0x36, 0xb6, 0xe8, 0xf7, 0xf9, 0x15, 0x34, 0x9b, 0xf1,
-    0x90, 0x35, 0x25, 0xcb, 0xf2, 0x23, 0x09, 0x65, 0x5a, 0xb7, 0x49, 0xdc,
-    0x69, 0x66, 0xa5, 0x69, 0x6e, 0x93, 0x76, 0xda, 0x3a, 0x9e, 0x2c, 0x5a,
-    0x82, 0x2d, 0x3a, 0x12, 0xa9, 0x92, 0x94, 0x65, 0xd7, 0xd2, 0xfd, 0xed,
-    0x77, 0xef, 0x0d, 0x80, 0x04, 0x40, 0x50, 0x76, 0x3a, 0xe7, 0xac, 0x39,
-    0x77, 0xad, 0x7b, 0x7a, 0x26, 0x26, 0xde, 0xc0, 0xc6, 0x7e, 0x63, 0x03,
-    0x3a, 0xde, 0x1a, 0x67, 0xa3, 0xf2, 0x6e, 0xce, 0x9c, 0x49, 0x39, 0x9b,
-    0x9e, 0x1c, 0xe3, 0xbf, 0xce, 0x34, 0x4e, 0xaf, 0x22, 0x97, 0xa5, 0x2e,
-    0xa4, 0x59, 0x3c, 0x3e, 0x39, 0x9e, 0xb1, 0x32, 0x76, 0x46, 0x93, 0x38,
-    0x2f, 0x58, 0x19, 0xb9, 0x8b, 0xf2, 0xb2, 0xf3, 0xcc, 0x15, 0xb9, 0x69,
-    0x3c, 0x63, 0x91, 0x7b, 0x93, 0xb0, 0xe5, 0x3c, 0xcb, 0x4b, 0xd7, 0x19,
-    0x65, 0x69, 0xc9, 0x52, 0xa8, 0xb5, 0x4c, 0xc6, 0xe5, 0x24, 0x1a, 0xb3,
-    0x9b, 0x64, 0xc4, 0x3a, 0x94, 0x08, 0x92, 0x34, 0x29, 0x93, 0x78, 0xda,
-    0x29, 0x46, 0xf1, 0x94, 0x45, 0x7b, 0xd0, 0x45, 0x99, 0x94, 0x53, 0x76,
-    0xf2, 0xfd, 0xef, 0x65, 0x79, 0xb0, 0xbf, 0x7f, 0x15, 0x97, 0x6c, 0x19,
-    0xdf, 0x1d, 0xef, 0xf2, 0xdc, 0xe3, 0xa2, 0xbc, 0x83, 0x3f, 0xbb, 0x5f,
-    0x6f, 0xfd, 0xe5, 0xdd, 0x22, 0x67, 0xce, 0xcd, 0x5e, 0xb7, 0xd7, 0xdd,
-    0xfb, 0xcb, 0xcb, 0x6c, 0x7e, 0x97, 0x27, 0x57, 0x93, 0xd2, 0xe9, 0xf7,
-    0xf6, 0xf6, 0x9d, 0x5f, 0xe3, 0x49, 0x96, 0x6d, 0xfd, 0xe5, 0x0d, 0x8c,
-    0x92, 0x16, 0x6c, 0xec, 0x2c, 0xd2, 0x31, 0xcb, 0x9d, 0x72, 0xc2, 0x9c,
-    0x17, 0xef, 0x5f, 0x39, 0x22, 0xbb, 0xfb, 0x97, 0x49, 0x59, 0xce, 0x8b,
-    0x70, 0x77, 0xf7, 0x2a, 0x29, 0x27, 0x8b, 0x8b, 0xee, 0x28, 0x9b, 0xed,
-    0xce, 0xa1, 0xd3, 0xce, 0xa8, 0x28, 0xe8, 0x63, 0xf7, 0x62, 0x9a, 0x5d,
-    0xec, 0xce, 0xe2, 0xa2, 0x64, 0xf9, 0xee, 0x9b, 0xd7, 0x2f, 0x4f, 0xdf,
-    0xbe, 0x3f, 0xed, 0xce, 0xc6, 0x7f, 0xf9, 0x7a, 0x17, 0xc7, 0x4f, 0xb3,
-    0x7c, 0x16, 0x4f, 0x93, 0x3f, 0x58, 0x17, 0xea, 0x3b, 0x37, 0xff, 0xda,
-    0xef, 0xf6, 0x9c, 0x95, 0xf3, 0xfd, 0xeb, 0x0f, 0x72, 0x00, 0x48, 0x41,
-    0xcf, 0xdd, 0x24, 0xdb, 0xad, 0xaa, 0x2a, 0x13, 0xf5, 0x46, 0xbe, 0xf3,
-    0x36, 0x19, 0x65, 0xd3, 0xb8, 0x70, 0xfe, 0x1e, 0x4f, 0xa7, 0xf1, 0xd5,
-    0x04, 0xe6, 0x18, 0xa7, 0x63, 0xe7, 0x1f, 0x59, 0x1a, 0x97, 0x93, 0x38,
-    0x75, 0xde, 0xb2, 0x78, 0xca, 0x07, 0x73, 0x8c, 0xc1, 0x60, 0xac, 0xee,
-    0xbe, 0x6d, 0x34, 0xb9, 0x8e, 0x94, 0x51, 0xcf, 0xbb, 0x7a, 0xbb, 0xaf,
-    0x77, 0x71, 0x2b, 0xef, 0x2f, 0x61, 0x3b, 0x3a, 0x97, 0xf1, 0x2c, 0x99,
-    0xde, 0x85, 0x45, 0x9c, 0x16, 0x9d, 0x82, 0xe5, 0xc9, 0xe5, 0xa0, 0x33,
-    0x2b, 0x3a, 0x25, 0xbb, 0x2d, 0x3b, 0x05, 0xd4, 0xef, 0xc4, 0xe3, 0xeb,
-    0x45, 0x51, 0x86, 0x7b, 0xbd, 0xde, 0x5f, 0x07, 0x9d, 0x25, 0xbb, 0xf8,
-    0x9c, 0x94, 0xf6, 0xd2, 0xf5, 0x45, 0x36, 0xbe, 0xbb, 0x9f, 0xc5, 0xf9,
-    0x55, 0x92, 0x86, 0xbd, 0x75, 0x9c, 0x97, 0xc9, 0x68, 0xca, 0x82, 0xb8,
-    0x48, 0xc6, 0x2c, 0x18, 0x03, 0x3a, 0x24, 0xd3, 0x22, 0xb8, 0x4c, 0xae,
-    0x46, 0xf1, 0xbc, 0x4c, 0xb2, 0x14, 0x3f, 0x01, 0xb6, 0xc1, 0x65, 0x96,
-    0x01, 0x58, 0x03, 0xc4, 0x25, 0xfc, 0x73, 0x95, 0x67, 0x8b, 0x79, 0x30,
-    0x8b, 0x93, 0x34, 0x98, 0xb1, 0x74, 0x11, 0xa4, 0xf1, 0x4d, 0x50, 0xb0,
-    0x11, 0xb5, 0x28, 0x16, 0x33, 0xe8, 0xfe, 0xee, 0x7e, 0x9c, 0x14, 0xf3,
-    0x69, 0x7c, 0x17, 0xc2, 0xb6, 0x8c, 0x3e, 0xaf, 0xe3, 0xc5, 0x38, 0xc9,
-    0x82, 0x51, 0x9c, 0xde, 0xc4, 0x45, 0x30, 0xcf, 0xb3, 0xab, 0x9c, 0x15,
-    0x45, 0x70, 0x03, 0xa3, 0x66, 0x55, 0xcd, 0x24, 0x9d, 0x26, 0x29, 0xeb,
-    0x50, 0x83, 0xc1, 0x0d, 0xc3, 0xa9, 0x01, 0xaa, 0x01, 0x40, 0xae, 0xd2,
-    0xf0, 0x22, 0x2e, 0x18, 0x96, 0xf2, 0x8e, 0xc2, 0x34, 0x2b, 0xbd, 0x33,
-    0x44, 0xd4, 0x3c, 0x9b, 0x16, 0xe7, 0x7e, 0xd5, 0x45, 0x9a, 0xa5, 0x6c,
-    0x30, 0x61, 0xb8, 0x67, 0xb0, 0xba, 0xb3, 0x49, 0x32, 0x1e, 0xb3, 0xf4,
-    0x3c, 0x28, 0xd9, 0x0c, 0x8a, 0x4b, 0xa6, 0xd5, 0x5b, 0xc7, 0xf7, 0x17,
-    0xf1, 0xe8, 0x33, 0xae, 0x25, 0x1d, 0x77, 0x60, 0x07, 0xb2, 0x3c, 0x2c,
-    0x73, 0x80, 0xf0, 0x3c, 0xce, 0x01, 0xff, 0xd7, 0x71, 0x18, 0xc3, 0x8a,
-    0x6e, 0x00, 0x38, 0xe1, 0x24, 0x83, 0xe9, 0xdc, 0x67, 0x8b, 0x12, 0xa7,
-    0x80, 0x60, 0xbb, 0xb8, 0xc8, 0xcf, 0x08, 0xc7, 0xcf, 0xef, 0x2f, 0xb2,
-    0x1c, 0x60, 0xd2, 0xb9, 0xc8, 0xca, 0x32, 0x9b, 0x85, 0x7b, 0xf3, 0x5b,
-    0x67, 0x0c, 0x9f, 0x6c, 0xbc, 0xbe, 0x08, 0x0a, 0x98, 0x5e, 0x7a, 0xc5,
-    0x77, 0x70, 0xc9, 0x27, 0xf5, 0xb4, 0xd7, 0x5b, 0x8f, 0x2f, 0x53, 0x9e,
-    0x47, 0xe4, 0x11, 0x26, 0x25, 0x2c, 0x71, 0xb4, 0x9e, 0xec, 0x89, 0x4c,
-    0xd8, 0xb1, 0xb0, 0xcf, 0x66, 0x03, 0xb1, 0x49, 0xdd, 0xa3, 0xa7, 0x6c,
-    0xe6, 0xf4, 0xd6, 0x90, 0xfc, 0xac, 0x4c, 0x38, 0xfc, 0xea, 0xf2, 0xb2,
-    0x37, 0xe0, 0xb3, 0xfe, 0xaa, 0x07, 0xbd, 0x16, 0x80, 0x3a, 0x53, 0xa5,
-    0x8b, 0x67, 0xb0, 0xd9, 0xc5, 0x02, 0x26, 0xb1, 0x98, 0x2b, 0xb9, 0x4f,
-    0x0f, 0xff, 0x3a, 0x20, 0x28, 0x4b, 0x20, 0x0d, 0xe6, 0x59, 0x91, 0xe0,
-    0xc6, 0x85, 0x39, 0x03, 0x10, 0xc1, 0x7a, 0x5b, 0x41, 0x8f, 0x3d, 0x95,
-    0xd9, 0x3c, 0xec, 0x74, 0x0f, 0xd9, 0x0c, 0xfb, 0xbe, 0x17, 0x8b, 0xee,
-    0x74, 0xfb, 0x98, 0x93, 0xcc, 0xae, 0x04, 0x34, 0x00, 0x44, 0xc5, 0xcd,
-    0x15, 0xed, 0x52, 0x98, 0x03, 0xea, 0xf8, 0xf7, 0x08, 0xc0, 0xcb, 0x69,
-    0xb6, 0x0c, 0xf9, 0x96, 0xac, 0x39, 0x5e, 0x49, 0x44, 0xdc, 0x83, 0x15,
-    0x1e, 0xf4, 0xe6, 0xb7, 0xeb, 0x49, 0x7e, 0x2f, 0xd1, 0xf7, 0x22, 0xbb,
-    0xc5, 0x29, 0x27, 0xe9, 0x55, 0x28, 0x38, 0x12, 0x66, 0x0d, 0x5a, 0xb2,
-    0xab, 0x3d, 0x9f, 0x43, 0xaf, 0xd5, 0x60, 0xf1, 0xa2, 0xcc, 0xd6, 0xa3,
-    0x0c, 0x50, 0xfb, 0xf3, 0xc5, 0x18, 0xd0, 0x8e, 0x05, 0x45, 0x3c, 0x9b,
-    0x6b, 0x24, 0x35, 0xcb, 0xd2, 0x0c, 0x76, 0x7c, 0xc4, 0x82, 0xea, 0x6b,
-    0x50, 0x83, 0x0b, 0x26, 0xb6, 0xbe, 0x58, 0xc0, 0x22, 0x53, 0x60, 0x7d,
-    0xf3, 0x45, 0x19, 0x64, 0xf3, 0x92, 0x23, 0x3f, 0xc0, 0x04, 0x10, 0x3e,
-    0x40, 0x22, 0x03, 0x74, 0x89, 0xef, 0xf9, 0x4e, 0x24, 0x29, 0xf0, 0x85,
-    0xa4, 0xa4, 0x1e, 0xaa, 0x44, 0x45, 0x6d, 0xbc, 0xa7, 0x7a, 0x7a, 0x37,
-    0x49, 0x91, 0x5c, 0x4c, 0x99, 0x1c, 0x81, 0x77, 0x79, 0x4f, 0x74, 0x4b,
-    0x88, 0x78, 0x09, 0xfc, 0x80, 0xa3, 0xaa, 0xa8, 0x41, 0xbc, 0x9d, 0x26,
-    0x72, 0x86, 0x1c, 0x3f, 0xe2, 0xd9, 0xe7, 0x81, 0x92, 0x05, 0x74, 0xc5,
-    0x4a, 0x2d, 0x07, 0x36, 0x6a, 0x96, 0x94, 0xe7, 0x15, 0x60, 0xe3, 0xf9,
-    0x9c, 0xc5, 0xd0, 0xfd, 0x88, 0x85, 0xbc, 0xfd, 0x60, 0xb4, 0xc8, 0x0b,
-    0x98, 0xfc, 0x3c, 0x4b, 0x00, 0xa0, 0xb9, 0x18, 0xec, 0x0c, 0x68, 0x25,
-    0x86, 0xd9, 0x8d, 0xcf, 0xd5, 0x61, 0xab, 0xcc, 0x7b, 0xd1, 0x68, 0xcc,
-    0x2e, 0xe3, 0xc5, 0xb4, 0x14, 0x8d, 0xc2, 0xb0, 0x33, 0xcb, 0xfe, 0xe8,
-    0x5c, 0x66, 0xa3, 0x45, 0xd1, 0x49, 0xd2, 0x14, 0x98, 0x05, 0xb5, 0x6b,
-    0xe6, 0x57, 0x98, 0x32, 0x98, 0xc7, 0xe3, 0x31, 0x6e, 0x67, 0x6f, 0x4d,
-    0x55, 0xef, 0x55, 0xf4, 0xe4, 0x1c, 0x71, 0xad, 0xac, 0x66, 0x34, 0x61,
-    0xa3, 0xcf, 0xb0, 0xe3, 0xfa, 0xa2, 0x63, 0x60, 0x0a, 0xe7, 0x36, 0xd4,
-    0xa9, 0xa8, 0x53, 0xc3, 0x1c, 0x25, 0xd7, 0x18, 0x9d, 0xf7, 0x97, 0x2e,
-    0x66, 0x17, 0x2c, 0x3f, 0x87, 0x59, 0x8b, 0x1e, 0x69, 0xca, 0x9d, 0x62,
-    0x9e, 0xa4, 0x1d, 0x15, 0x1d, 0x5a, 0x6a, 0x03, 0xa3, 0xd0, 0x6b, 0xdf,
-    0x8b, 0xe5, 0x10, 0x3e, 0xaa, 0x5b, 0x03, 0x1b, 0x31, 0x9a, 0x58, 0xb7,
-    0x06, 0xb1, 0xe0, 0x32, 0x61, 0xd3, 0xf1, 0xe0, 0x4f, 0x11, 0x84, 0x65,
-    0x94, 0x7a, 0x7e, 0x3c, 0xa3, 0x33, 0xc2, 0x81, 0xa6, 0x96, 0x05, 0xb5,
-    0x35, 0x18, 0x83, 0x9c, 0xca, 0x63, 0x64, 0x16, 0xb6, 0x19, 0x13, 0xa2,
-    0xd2, 0x94, 0x01, 0x03, 0xe5, 0xf6, 0x22, 0x3f, 0x2c, 0xb2, 0x69, 0x32,
-    0x76, 0x8a, 0x64, 0x0a, 0x78, 0x5f, 0x11, 0x83, 0xd3, 0x9f, 0xd7, 0xc0,
-    0xef, 0xee, 0x03, 0xff, 0x70, 0xba, 0x47, 0x7d, 0xfa, 0xf3, 0x14, 0x99,
-    0xc9, 0x94, 0x5d, 0xb1, 0x74, 0x6c, 0xc3, 0x92, 0x8a, 0xe4, 0x74, 0x32,
-    0x97, 0x94, 0xd9, 0x60, 0xb7, 0x25, 0x22, 0xac, 0x64, 0xd3, 0x40, 0xa6,
-    0xd3, 0x78, 0x5e, 0xb0, 0x50, 0x7e, 0x0c, 0x44, 0x01, 0x52, 0xbe, 0xe8,
-    0x7f, 0x1c, 0x94, 0x93, 0xfb, 0x7a, 0xbc, 0x2e, 0x67, 0x59, 0x81, 0x94,
-    0x26, 0x9a, 0x10, 0xd9, 0x4a, 0x66, 0xa8, 0x35, 0xc5, 0x20, 0x2f, 0xba,
-    0xa4, 0x8e, 0x20, 0x13, 0x9c, 0xc5, 0xb7, 0x5c, 0x5f, 0xe2, 0x02, 0x59,
-    0xd9, 0xfc, 0x81, 0x2e, 0x15, 0x79, 0x93, 0xab, 0xfb, 0x29, 0x2b, 0x4b,
-    0x65, 0x0e, 0x9d, 0xee, 0x3e, 0x30, 0x9e, 0x01, 0x31, 0x02, 0x10, 0x45,
-    0x30, 0x3d, 0xcc, 0x85, 0x05, 0x26, 0x33, 0x60, 0x4a, 0xc5, 0x9c, 0xb1,
-    0xf1, 0x40, 0xe5, 0x61, 0xdf, 0xe6, 0x8c, 0xbd, 0x07, 0x7e, 0x11, 0x7c,
-    0x93, 0x27, 0xb3, 0x2c, 0x70, 0x5f, 0xe5, 0x19, 0x00, 0x1c, 0x73, 0xdc,
-    0xe0, 0x3b, 0x06, 0x60, 0x47, 0x76, 0x8e, 0x85, 0xf1, 0x34, 0x50, 0x54,
-    0x08, 0x39, 0x17, 0x05, 0xc1, 0x1a, 0x79, 0x97, 0x53, 0xa6, 0x64, 0x82,
-    0xce, 0x81, 0x19, 0x6a, 0x45, 0xaa, 0xa0, 0xa2, 0x68, 0x96, 0x27, 0x80,
-    0x83, 0x20, 0x32, 0xf3, 0xe4, 0x0f, 0x98, 0x63, 0x3c, 0xd5, 0x4a, 0xc7,
-    0x49, 0xce, 0xf5, 0x04, 0x41, 0xda, 0x03, 0x75, 0xa0, 0x0e, 0xed, 0x66,
-    0x9e, 0x2d, 0x9d, 0x65, 0x1e, 0xcf, 0x07, 0x72, 0x38, 0x23, 0xdb, 0x56,
-    0x53, 0x62, 0x23, 0x0a, 0xac, 0x8e, 0x20, 0x03, 0x9a, 0x1a, 0xc8, 0x58,
-    0xd0, 0x71, 0xea, 0xae, 0x88, 0xb9, 0x00, 0x98, 0x3f, 0x87, 0xbc, 0xa0,
-    0xad, 0xc5, 0xfa, 0x7f, 0xcd, 0xd8, 0x38, 0x89, 0x1d, 0x90, 0xa9, 0xa4,
-    0xe6, 0x79, 0xd8, 0xc3, 0x04, 0xf6, 0x91, 0xea, 0xe6, 0xa0, 0x65, 0xd2,
-    0xf6, 0xfb, 0x81, 0xa5, 0x80, 0xab, 0x0d, 0xfe, 0x3d, 0x21, 0x9e, 0x23,
-    0xf7, 0x58, 0xdf, 0xf9, 0x75, 0x37, 0x9b, 0xb3, 0x3c, 0xee, 0x64, 0xe9,
-    0xf4, 0xce, 0x09, 0x3b, 0x59, 0x07, 0x84, 0x13, 0x71, 0xc7, 0x40, 0xd6,
-    0x5f, 0x02, 0x5e, 0x2a, 0x18, 0x71, 0xb0, 0x0f, 0x44, 0xc1, 0xcb, 0x16,
-    0x76, 0x8d, 0xe9, 0x8f, 0x0c, 0xf5, 0x8f, 0x81, 0x81, 0x4b, 0x02, 0xcc,
-    0x5a, 0x6f, 0x22, 0xcf, 0x90, 0xf3, 0x20, 0xda, 0x4d, 0x94, 0x23, 0xc2,
-    0x12, 0x13, 0x72, 0xce, 0x46, 0xa0, 0xa3, 0x16, 0x5f, 0x47, 0x7c, 0x0e,
-    0xe7, 0x2d, 0x8a, 0xa9, 0x9c, 0x63, 0x67, 0x2f, 0xa8, 0xbe, 0xf4, 0xef,
-    0xbe, 0x92, 0xd0, 0xbe, 0x0f, 0x94, 0xc4, 0xbe, 0xf2, 0xad, 0xe6, 0x1f,
-    0x2a, 0xdf, 0x47, 0xca, 0xf7, 0xb3, 0xfa, 0xbb, 0xa7, 0xf5, 0xa4, 0x0f,
-    0xa8, 0x8f, 0xd2, 0xd7, 0x52, 0xfb, 0x5a, 0xea, 0x40, 0x4b, 0x1d, 0x6a,
-    0xa9, 0x23, 0x2d, 0xf5, 0x54, 0x4b, 0x3d, 0xd3, 0x52, 0xcf, 0xd5, 0x54,
-    0x5f, 0x4f, 0xec, 0x2b, 0xdf, 0xf5, 0xb2, 0xfa, 0xda, 0xf4, 0xfb, 0xda,
-    0x84, 0xfb, 0x7a, 0x0f, 0xda, 0x84, 0xfb, 0xda, 0x84, 0xf7, 0xf5, 0x84,
-    0xfa, 0x7d, 0xa8, 0x7c, 0xd7, 0x50, 0xd3, 0x5a, 0x1f, 0x28, 0x95, 0x0e,
-    0x55, 0xf8, 0x69, 0x60, 0x38, 0xd4, 0x6a, 0x1d, 0x29, 0xdf, 0x75, 0xb7,
-    0x1a, 0xa4, 0x9e, 0xaa, 0x5d, 0x3d, 0xd5, 0x4b, 0xea, 0x26, 0x1a, 0x00,
-    0x11, 0x7e, 0xff, 0x09, 0x6c, 0xe7, 0xf8, 0x78, 0xcf, 0x99, 0xf8, 0x41,
-    0x77, 0xef, 0xe8, 0xe8, 0xe9, 0x5f, 0xd7, 0x56, 0x1c, 0xee, 0xd7, 0xf5,
-    0x9e, 0x75, 0xf7, 0xe1, 0xff, 0xd4, 0x7a, 0xcf, 0xb4, 0x0d, 0x11, 0xd5,
-    0xf6, 0xfa, 0xdd, 0x43, 0xb5, 0xd2, 0x91, 0xb6, 0x09, 0xb2, 0xd2, 0x51,
-    0xf7, 0xc8, 0x18, 0xf4, 0x50, 0x14, 0xf5, 0x7b, 0x75, 0xee, 0x61, 0xdd,
-    0xa2, 0xdf, 0xeb, 0x3e, 0x33, 0x86, 0x3f, 0xd0, 0xf6, 0x41, 0xd6, 0x53,
-    0x06, 0x7f, 0xaa, 0x64, 0x3f, 0x6f, 0xac, 0x72, 0x5f, 0xdb, 0x13, 0x51,
-    0x6f, 0x7f, 0xdf, 0x58, 0xa5, 0x8a, 0x45, 0xcf, 0x95, 0x7a, 0x4f, 0xd5,
-    0x55, 0xf6, 0xab, 0xd9, 0x1f, 0x28, 0xb3, 0xd7, 0x49, 0x15, 0x31, 0x4d,
-    0x56, 0xda, 0x33, 0x57, 0xaf, 0x6e, 0xc7, 0x61, 0x63, 0xa1, 0x7d, 0x9d,
-    0xa6, 0x45, 0xc5, 0x43, 0x75, 0x28, 0x65, 0x03, 0x0e, 0x1b, 0x1b, 0x7a,
-    0x60, 0xa2, 0xa9, 0xac, 0xf9, 0xac, 0xb1, 0x58, 0xb9, 0x8e, 0x23, 0xb5,
-    0x73, 0x83, 0x2e, 0x9e, 0xc9, 0x3a, 0xfa, 0x4e, 0x1f, 0x19, 0xf4, 0x2f,
-    0x6b, 0x35, 0xb6, 0x5a, 0xd9, 0x96, 0xa7, 0x8d, 0x5d, 0x7d, 0x66, 0x90,
-    0xb6, 0xac, 0xa8, 0x8e, 0xa4, 0xec, 0xc3, 0x53, 0x73, 0x5f, 0x0f, 0xaa,
-    0x25, 0x3c, 0x53, 0x96, 0xd0, 0x37, 0xb6, 0xe2, 0x48, 0xd6, 0x31, 0xb7,
-    0x5b, 0xe7, 0x48, 0x4f, 0xab, 0xb5, 0x3e, 0xd3, 0xf6, 0x5b, 0x67, 0xbb,
-    0x7d, 0x65, 0x53, 0x9e, 0x9b, 0x5b, 0xdb, 0x57, 0x76, 0xe6, 0x79, 0x63,
-    0x6b, 0xad, 0x42, 0x44, 0xe7, 0x75, 0x87, 0xd5, 0x82, 0xc8, 0xc1, 0xc1,
-    0xb3, 0x85, 0xde, 0xbd, 0x91, 0x75, 0x34, 0xec, 0x8c, 0xc1, 0x72, 0x92,
-    0x94, 0x8c, 0x18, 0x07, 0xaa, 0xb3, 0xa4, 0x5a, 0x18, 0x6c, 0x63, 0x06,
-    0x3a, 0xe0, 0x94, 0x71, 0xce, 0xc1, 0x73, 0x46, 0x0c, 0x8d, 0x26, 0xc3,
-    0x86, 0xaa, 0x34, 0x92, 0x05, 0x08, 0xc5, 0xce, 0x38, 0x8f, 0xaf, 0xb8,
-    0x6b, 0x42, 0xcb, 0xe6, 0xf6, 0x9e, 0x28, 0x40, 0xf3, 0xc8, 0x92, 0x5b,
-    0x34, 0x33, 0x9b, 0xb5, 0xbe, 0xdc, 0xec, 0xd1, 0xa0, 0x64, 0x31, 0xce,
-    0x2a, 0xed, 0x77, 0x50, 0x19, 0xf4, 0x6a, 0x8b, 0x0e, 0xd7, 0xb4, 0xbf,
-    0x5c, 0x6d, 0x7d, 0x48, 0xed, 0xd1, 0xba, 0x6f, 0xd7, 0x80, 0xd4, 0x6a,
-    0x8e, 0xb6, 0xe1, 0xff, 0x4d, 0xf2, 0x40, 0xf4, 0xae, 0xaa, 0x3c, 0xaa,
-    0xa9, 0x2f, 0x9c, 0x05, 0xa8, 0xec, 0x57, 0x26, 0x0d, 0x9a, 0x32, 0x08,
-    0x0e, 0xe1, 0xa2, 0x39, 0x38, 0x38, 0x10, 0x9f, 0xf9, 0xd5, 0x45, 0xec,
-    0xf5, 0x02, 0xfc, 0xaf, 0xfb, 0xcc, 0x1f, 0x34, 0x0c, 0xa5, 0xaf, 0x9e,
-    0x3f, 0x7f, 0x2e, 0x73, 0x71, 0x7f, 0x1d, 0xc5, 0x29, 0x35, 0x68, 0x78,
-    0xac, 0xbe, 0x62, 0x47, 0xf8, 0x1f, 0x9f, 0x7b, 0x6d, 0xa0, 0x71, 0xcc,
-    0x10, 0x1b, 0x8e, 0xe6, 0xf1, 0xa2, 0x08, 0xc1, 0xe2, 0xd2, 0xe1, 0x47,
-    0x6e, 0x2d, 0x0d, 0xf2, 0x61, 0x73, 0x33, 0x84, 0xf3, 0x4b, 0x19, 0x38,
-    0x99, 0xc5, 0x57, 0xac, 0xb2, 0x10, 0xae, 0xb0, 0x77, 0x98, 0x9a, 0x87,
-    0xf4, 0x14, 0xe7, 0xc1, 0x94, 0x5d, 0x96, 0x0e, 0x40, 0x93, 0x7f, 0x70,
-    0x0f, 0x51, 0x70, 0x99, 0x67, 0x33, 0x4f, 0x59, 0x87, 0x1f, 0xd0, 0xec,
-    0x41, 0xd7, 0xce, 0xe6, 0x1e, 0x88, 0x84, 0x40, 0x05, 0x4a, 0xef, 0xd0,
-    0xf7, 0x83, 0x32, 0xf3, 0xd4, 0xbc, 0x3d, 0xdf, 0xf7, 0x07, 0xad, 0x73,
-    0xe0, 0x43, 0xd7, 0x53, 0x51, 0x46, 0x32, 0x7b, 0x76, 0xcc, 0xd1, 0xf6,
-    0x6c, 0x1d, 0xff, 0x9b, 0x1d, 0xae, 0x9b, 0x30, 0x55, 0xbc, 0x87, 0xda,
-    0x1e, 0x08, 0x1f, 0xa3, 0xd6, 0x80, 0xe7, 0xe9, 0xee, 0x8c, 0x49, 0x3c,
-    0x06, 0x8b, 0xa7, 0xe7, 0xe0, 0x7f, 0x88, 0x2b, 0xda, 0x88, 0x30, 0x8b,
-    0x24, 0x05, 0xab, 0x3b, 0xc0, 0xd2, 0x23, 0xa3, 0xb4, 0x2f, 0x0a, 0x07,
-    0xff, 0x75, 0xfd, 0x48, 0x53, 0x5a, 0xfa, 0x1e, 0xb5, 0x15, 0x49, 0x17,
-    0x51, 0x60, 0xcd, 0x0d, 0x2d, 0x0b, 0xae, 0x0b, 0x2d, 0xbc, 0xa0, 0x2a,
-    0x6b, 0x62, 0xab, 0xe2, 0x8d, 0x52, 0xe8, 0xa5, 0xb9, 0x9b, 0x94, 0x9b,
-    0x21, 0xf9, 0x97, 0x77, 0x61, 0xf7, 0x40, 0xf2, 0xea, 0x34, 0x43, 0x1e,
-    0x0e, 0x86, 0x24, 0x33, 0x9c, 0x2c, 0x1c, 0x46, 0x82, 0x82, 0xf4, 0xb4,
-    0xe0, 0xef, 0x1d, 0x76, 0x03, 0xa8, 0x50, 0x70, 0x9f, 0x87, 0x4e, 0x53,
-    0xe4, 0x24, 0xd0, 0x1d, 0xcd, 0x5a, 0x85, 0x39, 0xd8, 0xe8, 0x71, 0x7e,
-    0xa7, 0x2f, 0x92, 0xb3, 0x73, 0x80, 0x59, 0x6c, 0xad, 0x1b, 0x5b, 0x2b,
-    0x37, 0xdd, 0xd7, 0xb0, 0x19, 0x4f, 0x9f, 0xb1, 0xa7, 0x92, 0xe7, 0x5c,
-    0x5e, 0x5e, 0x3e, 0xc8, 0x30, 0xa5, 0x3f, 0xc6, 0xe0, 0x15, 0x75, 0x9a,
-    0xe4, 0xa3, 0xc2, 0x9d, 0xf6, 0xf6, 0xf6, 0xda, 0xca, 0x74, 0x6c, 0x79,
-    0x68, 0xe8, 0xf0, 0x32, 0xc9, 0x8b, 0xb2, 0x33, 0x9a, 0x24, 0x53, 0xe9,
-    0xe7, 0xe9, 0x00, 0x3b, 0xe8, 0x20, 0xdf, 0x50, 0x58, 0xd6, 0x40, 0x73,
-    0xb0, 0x9b, 0xa5, 0x0f, 0x0e, 0x02, 0x36, 0xab, 0x65, 0x0c, 0x9a, 0x79,
-    0xfb, 0x20, 0x6d, 0xc5, 0xb9, 0x50, 0x16, 0xaa, 0x3d, 0x45, 0x0f, 0xad,
-    0xea, 0x90, 0x25, 0xc0, 0x9f, 0x07, 0xf6, 0xc2, 0x71, 0x5c, 0xb2, 0x4d,
-    0x65, 0x20, 0x27, 0x59, 0x07, 0x34, 0x94, 0x78, 0xfa, 0x50, 0xad, 0xb6,
-    0x72, 0x36, 0x8b, 0x93, 0xd6, 0xc6, 0x33, 0x10, 0x54, 0x93, 0xb6, 0x42,
-    0xe1, 0xc3, 0x6c, 0x29, 0x9d, 0x83, 0xe1, 0x8f, 0x32, 0xb4, 0xad, 0x5c,
-    0x38, 0x0c, 0x5b, 0x4a, 0x4b, 0x36, 0x6d, 0x2f, 0xba, 0x2d, 0x5b, 0xcb,
-    0x36, 0x2c, 0x74, 0x91, 0xb7, 0x76, 0xb9, 0x64, 0xec, 0xb3, 0x56, 0x26,
-    0x3c, 0xf5, 0x4a, 0x4e, 0xe5, 0x41, 0xd4, 0x84, 0x75, 0xf7, 0x08, 0xa4,
-    0xb5, 0x55, 0x61, 0x6c, 0x8a, 0xe8, 0xd1, 0x68, 0x64, 0x63, 0x19, 0xc4,
-    0x1f, 0x05, 0x63, 0xdd, 0x87, 0xff, 0x7d, 0x35, 0x1e, 0x8f, 0x07, 0x0f,
-    0x97, 0xab, 0x84, 0x77, 0x00, 0xd8, 0x66, 0xd7, 0x39, 0xff, 0xbc, 0x9a,
-    0x57, 0x83, 0x88, 0x1f, 0x9c, 0x21, 0x9c, 0xce, 0xfd, 0xff, 0xa9, 0xab,
-    0xff, 0xaf, 0x58, 0xa7, 0x4a, 0x8d, 0xf5, 0x3a, 0xfb, 0xb8, 0xce, 0xc3,
-    0x4a, 0x8b, 0xb4, 0x57, 0xd7, 0x64, 0x90, 0x95, 0x84, 0x1f, 0xac, 0xa1,
-    0x10, 0xf2, 0xa3, 0xea, 0x6e, 0xae, 0xc5, 0x89, 0x7a, 0x63, 0x15, 0x4e,
-    0xda, 0x1b, 0xab, 0xc8, 0x43, 0x8a, 0x4d, 0x75, 0x2a, 0x32, 0xdf, 0x58,
-    0x4b, 0x9e, 0x0e, 0x6c, 0xaa, 0x83, 0x24, 0xff, 0x40, 0x05, 0x20, 0xfc,
-    0xcd, 0x35, 0x1e, 0x04, 0x0c, 0x32, 0x81, 0x8d, 0x15, 0x88, 0x15, 0x34,
-    0x6b, 0x08, 0xdb, 0xa9, 0x91, 0x2f, 0xd9, 0x82, 0xa9, 0xb0, 0x19, 0x0a,
-    0xcf, 0x5e, 0xff, 0xf9, 0x25, 0x8b, 0x37, 0x92, 0xd6, 0x9f, 0xeb, 0xc1,
-    0x38, 0xe0, 0xda, 0xb8, 0xb4, 0xcb, 0x64, 0xfa, 0x00, 0x74, 0xf8, 0x99,
-    0x98, 0x31, 0x93, 0x72, 0x92, 0xa4, 0x95, 0x20, 0xa7, 0x59, 0x0c, 0x64,
-    0x11, 0x52, 0x25, 0x5a, 0x3c, 0x8e, 0x65, 0x7a, 0xfc, 0x53, 0xce, 0x2c,
-    0x68, 0x94, 0xd0, 0x58, 0x52, 0x95, 0x20, 0x76, 0xd2, 0xb3, 0x9e, 0x74,
-    0xd8, 0x29, 0x4e, 0x39, 0x69, 0xdc, 0x40, 0x75, 0x8f, 0xaa, 0xa5, 0x50,
-    0xde, 0xa3, 0xeb, 0x3f, 0x5c, 0x93, 0x53, 0xe0, 0x83, 0xd5, 0x38, 0x15,
-    0x3e, 0x58, 0x4d, 0x50, 0xe2, 0x83, 0xf5, 0x2a, 0x6a, 0x7c, 0xb0, 0xa6,
-    0xa0, 0xc8, 0x07, 0xeb, 0x21, 0x55, 0x3e, 0xa2, 0x12, 0x50, 0xe6, 0xc3,
-    0xb5, 0x1e, 0x05, 0x38, 0xa4, 0xd0, 0x07, 0x2b, 0x11, 0x95, 0xda, 0x6b,
-    0x71, 0x4a, 0xb5, 0x97, 0x49, 0x6a, 0x6d, 0x1e, 0x49, 0xab, 0x7a, 0xbd,
-    0xc5, 0x5e, 0x8e, 0xd9, 0x18, 0x0a, 0x44, 0x6a, 0x14, 0x8f, 0xfb, 0xe3,
-    0xfd, 0x8d, 0xc4, 0xfc, 0xdf, 0x32, 0xc0, 0x19, 0xcc, 0x7c, 0x8c, 0x5e,
-    0x10, 0xdb, 0x7a, 0xad, 0x65, 0xd5, 0x7a, 0xab, 0x52, 0x8b, 0xfe, 0xcf,
-    0x18, 0x93, 0x03, 0x3f, 0x7d, 0xfa, 0xd4, 0x60, 0x3b, 0x20, 0xb6, 0x9b,
-    0x0b, 0x25, 0xfe, 0x00, 0xa2, 0xf9, 0x06, 0x74, 0x8d, 0x71, 0x1b, 0x97,
-    0xb4, 0x95, 0xeb, 0xdc, 0x52, 0xd6, 0x10, 0x71, 0x10, 0x5f, 0x5d, 0x3c,
-    0x3f, 0x88, 0x0f, 0x9e, 0x19, 0x13, 0x60, 0xcf, 0xf7, 0xfb, 0xfd, 0xf1,
-    0xe3, 0xf8, 0x9e, 0xec, 0xf0, 0xb1, 0x5c, 0xf0, 0x51, 0xf5, 0x55, 0x9e,
-    0xa8, 0x37, 0x90, 0x1c, 0xb2, 0x7d, 0xaa, 0x22, 0x3a, 0x43, 0x38, 0x0c,
-    0xfb, 0x14, 0xf2, 0xd2, 0xa2, 0x1b, 0x35, 0xf7, 0xa5, 0xb6, 0xc4, 0xd4,
-    0x7d, 0x9e, 0x2d, 0xa6, 0x65, 0x32, 0xc7, 0x20, 0x22, 0x35, 0x3e, 0x40,
-    0xa9, 0x37, 0x8d, 0x2f, 0xd8, 0x54, 0xe7, 0xab, 0x0e, 0x6a, 0x31, 0x6a,
-    0x9d, 0xea, 0xc4, 0xbd, 0xb2, 0xe4, 0xf4, 0x53, 0xf5, 0x1e, 0x3f, 0x50,
-    0x37, 0x1d, 0x79, 0xbc, 0x7f, 0x7e, 0xc8, 0xae, 0xb1, 0xea, 0x81, 0x72,
-    0x72, 0x5d, 0xf7, 0x44, 0x2c, 0x9d, 0x8f, 0x20, 0x43, 0x9d, 0x30, 0x53,
-    0x22, 0xdb, 0xfe, 0xfe, 0xfe, 0xa0, 0x19, 0x08, 0x25, 0x40, 0xc2, 0x0e,
-    0xf1, 0x3f, 0x65, 0x5c, 0x3c, 0x62, 0x1d, 0x7d, 0x66, 0xe3, 0x8d, 0x96,
-    0x93, 0xad, 0x92, 0x69, 0x41, 0xb5, 0xd5, 0xb1, 0x5b, 0x52, 0x9b, 0x6a,
-    0x3f, 0x54, 0xaf, 0x61, 0x59, 0xd9, 0x2a, 0x11, 0x3a, 0x3e, 0x50, 0xa7,
-    0x61, 0x85, 0xd9, 0x2a, 0x35, 0xad, 0x31, 0x5b, 0x2d, 0x9b, 0x55, 0x66,
-    0xab, 0xd7, 0xb4, 0xce, 0x6c, 0xb5, 0x0c, 0x2b, 0xcd, 0x5e, 0x45, 0xb7,
-    0xd6, 0xac, 0x75, 0x1e, 0x01, 0x4c, 0xc3, 0x7a, 0xb3, 0x55, 0x31, 0xad,
-    0xb8, 0xaa, 0x0e, 0x91, 0x84, 0xad, 0xa0, 0x61, 0xe6, 0x55, 0x25, 0x95,
-    0xb9, 0xa7, 0xe3, 0xb9, 0x24, 0x2b, 0x0a, 0x3a, 0xe9, 0xb5, 0xa2, 0xa7,
-    0x66, 0x32, 0x3d, 0xb6, 0x07, 0x32, 0xdc, 0xa0, 0x07, 0x9e, 0x35, 0x61,
-    0xd3, 0x79, 0x87, 0xdb, 0x54, 0x81, 0xa5, 0x12, 0x8f, 0x2c, 0xb3, 0x14,
-    0x34, 0x97, 0x24, 0x4b, 0xe4, 0x92, 0xd4, 0xb2, 0x19, 0x2b, 0x8a, 0xf8,
-    0x8a, 0x89, 0x81, 0x1e, 0x15, 0x55, 0xc9, 0x2d, 0xcb, 0xf5, 0x86, 0x01,
-    0xee, 0x9b, 0x6e, 0xf2, 0xf6, 0x75, 0x8a, 0x80, 0x4c, 0xe1, 0xbe, 0x37,
-    0xb8, 0x85, 0x6e, 0x77, 0x6d, 0x6a, 0x29, 0xd8, 0x9e, 0x72, 0xc6, 0x42,
-    0x7e, 0x97, 0xc1, 0xe3, 0x57, 0x54, 0xf1, 0xb0, 0x3a, 0x8c, 0xb2, 0x87,
-    0xce, 0x78, 0xf4, 0x7a, 0x3e, 0x38, 0x89, 0xa2, 0x8a, 0x4a, 0x14, 0x1c,
-    0x17, 0x9a, 0xee, 0xe9, 0x3c, 0x57, 0x84, 0xfa, 0xe0, 0xbe, 0x75, 0x88,
-    0xcf, 0xb3, 0x71, 0x43, 0xe2, 0x58, 0xea, 0xdc, 0x1b, 0xfe, 0x78, 0x98,
-    0x9d, 0x79, 0x5c, 0xd0, 0x1c, 0x85, 0x83, 0xc4, 0xe0, 0xf2, 0x15, 0x97,
-    0xed, 0xcd, 0x6f, 0xdb, 0x9a, 0x98, 0x68, 0xa5, 0x15, 0xb6, 0xd0, 0x84,
-    0x9c, 0x0e, 0xf6, 0x5b, 0x43, 0xae, 0xe7, 0x74, 0xf6, 0x14, 0x27, 0x98,
-    0xf4, 0x10, 0x36, 0x23, 0x47, 0x29, 0x3a, 0x74, 0xef, 0x81, 0x29, 0x35,
-    0x25, 0xb4, 0x6d, 0x62, 0x42, 0x2c, 0xff, 0x01, 0x10, 0x1c, 0xb3, 0xdb,
-    0x70, 0xff, 0x81, 0x2e, 0x6b, 0x57, 0xe2, 0xc3, 0x1d, 0x2b, 0x6e, 0x47,
-    0x9c, 0x70, 0x73, 0x69, 0x07, 0x20, 0xbb, 0xf0, 0x7f, 0xbd, 0x4a, 0xe6,
-    0xe9, 0x62, 0x73, 0xe3, 0xf8, 0x8a, 0xc7, 0xf1, 0x4b, 0xa6, 0xa2, 0x3a,
-    0x2a, 0x5b, 0x67, 0xf5, 0xc8, 0xd9, 0x7c, 0xc1, 0x0c, 0x8c, 0x51, 0x3b,
-    0xfd, 0xe6, 0x3e, 0x03, 0x18, 0x04, 0x40, 0x1e, 0x1c, 0x5e, 0xf7, 0x29,
-    0x0b, 0xfd, 0xa3, 0x8d, 0x70, 0xf6, 0x9a, 0xa7, 0xb6, 0x8d, 0x3a, 0xb6,
-    0xf3, 0xed, 0x46, 0x25, 0xf5, 0x28, 0xbd, 0xb5, 0xd2, 0x5e, 0xa7, 0xdf,
-    0x08, 0x0b, 0xb0, 0x54, 0xda, 0xaf, 0xc2, 0x1c, 0x36, 0x54, 0x6a, 0x86,
-    0x52, 0x28, 0x95, 0x5a, 0x98, 0xfd, 0x63, 0xb8, 0xb3, 0xa0, 0x3e, 0xf2,
-    0x71, 0x6b, 0xea, 0xd5, 0xd1, 0xd1, 0x51, 0x0b, 0xa3, 0xab, 0x4f, 0x1f,
-    0xbb, 0xcf, 0x9e, 0x1a, 0x2c, 0x56, 0x0c, 0x69, 0x90, 0xb8, 0xd2, 0x65,
-    0xa3, 0xb1, 0x08, 0x7a, 0xa3, 0xd3, 0xd9, 0x62, 0x94, 0x33, 0x96, 0xf2,
-    0xe0, 0xb7, 0x2a, 0xa0, 0xd1, 0x09, 0x0f, 0x9e, 0x01, 0x6b, 0xf0, 0xef,
-    0x95, 0x65, 0x8b, 0xb3, 0x18, 0x2d, 0xd6, 0x58, 0x62, 0xc0, 0xd3, 0x06,
-    0xcf, 0x6d, 0x0a, 0xd5, 0xe0, 0xff, 0xbb, 0xd2, 0xff, 0x5f, 0x71, 0xa5,
-    0xab, 0xf6, 0x88, 0x66, 0x06, 0x58, 0xc3, 0x5a, 0x15, 0x8e, 0xd4, 0xdc,
-    0x6e, 0xa5, 0xd4, 0xb2, 0xdf, 0x8d, 0x52, 0x75, 0xc3, 0xad, 0x85, 0xcd,
-    0x1d, 0x6f, 0xad, 0xd6, 0x5a, 0x41, 0xdb, 0xf3, 0x46, 0xa9, 0xb6, 0xe9,
-    0x8d, 0x52, 0x7d, 0xd7, 0x1b, 0xc5, 0xe6, 0xb6, 0x37, 0x2a, 0xe8, 0xfb,
-    0xde, 0x28, 0x56, 0x36, 0xde, 0x52, 0x56, 0xef, 0x7c, 0xb3, 0x70, 0xd3,
-    0x82, 0x95, 0xbd, 0x6f, 0x94, 0xd1, 0xe6, 0x1b, 0x7b, 0xdd, 0xfb, 0x32,
-    0x0d, 0xce, 0x82, 0x28, 0x8a, 0x52, 0x87, 0x5c, 0x6e, 0xd0, 0x66, 0x7a,
-    0xfe, 0x19, 0x2d, 0xad, 0xf7, 0xa5, 0xcc, 0xf8, 0x11, 0xfc, 0x99, 0xcf,
-    0x4b, 0x61, 0x94, 0x64, 0x4b, 0x6b, 0x27, 0x0a, 0x60, 0x60, 0x3f, 0x03,
-    0xde, 0x29, 0x06, 0xc7, 0xfb, 0x50, 0xf7, 0x7f, 0xfe, 0x08, 0x03, 0x9b,
-    0x77, 0x2e, 0x93, 0x5b, 0x50, 0x16, 0x2b, 0xf5, 0x8a, 0x92, 0x03, 0x12,
-    0x0a, 0x3d, 0x52, 0xb1, 0x7a, 0x03, 0x53, 0x2d, 0xa2, 0x66, 0x49, 0xc9,
-    0x66, 0x81, 0x92, 0x9e, 0x26, 0x45, 0x79, 0xdf, 0x50, 0xd2, 0xd6, 0x66,
-    0x0d, 0xfc, 0x47, 0x5c, 0x45, 0xa2, 0x23, 0xee, 0x86, 0x1f, 0xa1, 0x67,
-    0x0e, 0xa2, 0x84, 0x07, 0x55, 0x95, 0x85, 0x07, 0x43, 0xd9, 0x3b, 0xaa,
-    0x8e, 0x37, 0xc6, 0xa0, 0xa6, 0x3e, 0xad, 0xf4, 0xb3, 0x01, 0x5f, 0x6b,
-    0xf0, 0x4a, 0x33, 0x18, 0x4b, 0xeb, 0xb8, 0x8a, 0x2f, 0x57, 0xd4, 0x88,
-    0x47, 0xb7, 0x71, 0x4c, 0x20, 0xd8, 0xe4, 0xf1, 0xc3, 0x4d, 0x2d, 0xab,
-    0xb3, 0x57, 0x34, 0xb7, 0xc6, 0x5e, 0xab, 0x60, 0xf3, 0x18, 0x20, 0x90,
-    0xe5, 0x1b, 0xe3, 0xd6, 0x36, 0xd9, 0x70, 0xd5, 0x60, 0xe6, 0xe0, 0xf7,
-    0x36, 0x0e, 0x4d, 0xa5, 0xa4, 0xfc, 0xe5, 0x46, 0xc8, 0x42, 0xad, 0xdb,
-    0xc7, 0x17, 0x45, 0x36, 0x5d, 0x94, 0x8c, 0xe3, 0x1f, 0x01, 0x99, 0xa3,
-    0x60, 0x13, 0x4d, 0xec, 0x58, 0x69, 0x5f, 0x6a, 0x35, 0xaa, 0x82, 0xd6,
-    0x74, 0x41, 0x82, 0x6f, 0xa6, 0x08, 0xae, 0x52, 0xfb, 0xe1, 0x71, 0x23,
-    0x27, 0x96, 0x3e, 0x54, 0xc0, 0x92, 0x5b, 0x96, 0x07, 0x36, 0xf1, 0x80,
-    0x91, 0x93, 0x4d, 0x4b, 0x15, 0x6a, 0x97, 0xb9, 0x56, 0x6d, 0xfa, 0x71,
-    0x51, 0xb5, 0x3b, 0x31, 0xb0, 0x38, 0x8c, 0x2f, 0xcb, 0x3a, 0x58, 0x4e,
-    0xa8, 0x6d, 0x87, 0xa4, 0xb6, 0xf1, 0xfb, 0x04, 0xee, 0xc7, 0xfe, 0xe1,
-    0x8b, 0x67, 0xae, 0xc2, 0x3f, 0xe8, 0x96, 0xde, 0x23, 0x10, 0xeb, 0xe1,
-    0x51, 0xb5, 0x31, 0x4e, 0x5d, 0xb5, 0x4f, 0x50, 0xdd, 0xf0, 0x76, 0x0b,
-    0x5e, 0x7b, 0x91, 0x77, 0x64, 0x3a, 0x77, 0x21, 0xcf, 0x1d, 0x54, 0x39,
-    0xb7, 0xf2, 0x2e, 0x9e, 0xb5, 0x65, 0x2b, 0x85, 0x6c, 0x20, 0x8d, 0x2f,
-    0xeb, 0xe8, 0x61, 0x52, 0xb3, 0x2f, 0xc9, 0x12, 0xa4, 0xa9, 0xac, 0x92,
-    0xaf, 0x49, 0x5d, 0x25, 0xa1, 0x55, 0x75, 0x35, 0x4b, 0xe6, 0xf3, 0x0e,
-    0x11, 0x6f, 0xcb, 0x6c, 0x31, 0x9a, 0xe8, 0x86, 0x78, 0xef, 0xf1, 0x08,
-    0x6c, 0xa5, 0xdf, 0xc0, 0x4a, 0xd4, 0x4d, 0xb7, 0x30, 0x3a, 0x8b, 0x25,
-    0xe3, 0xac, 0xcd, 0x2b, 0xee, 0x6d, 0x5d, 0x7f, 0x01, 0xbb, 0x10, 0x1c,
-    0x70, 0x5e, 0xdd, 0x83, 0xdc, 0x23, 0x61, 0x5b, 0x19, 0xf0, 0xdd, 0x3a,
-    0x74, 0xf2, 0xcf, 0x2e, 0xc9, 0xea, 0x24, 0x56, 0xfc, 0xd5, 0x2a, 0x3f,
-    0x34, 0xaf, 0x30, 0x2e, 0xe6, 0x73, 0x96, 0x8f, 0xe2, 0xa2, 0x3a, 0x9b,
-    0x38, 0x3c, 0x3a, 0x1c, 0x1f, 0x1d, 0xac, 0x4d, 0xa1, 0x50, 0x9f, 0x5c,
-    0x58, 0x19, 0xd4, 0x26, 0xb7, 0x3a, 0xd5, 0x34, 0x22, 0xcf, 0x36, 0x0a,
-    0xa0, 0x16, 0xc7, 0x8b, 0xd6, 0xcf, 0x7d, 0x15, 0x33, 0x76, 0x68, 0x2b,
-    0x76, 0x4c, 0xc2, 0x6c, 0x44, 0x4a, 0x36, 0x2f, 0x15, 0x6f, 0x64, 0x68,
-    0xd8, 0x89, 0x39, 0x51, 0xcd, 0x5b, 0xf2, 0xe0, 0x50, 0x78, 0x00, 0xa4,
-    0xd1, 0xb3, 0x08, 0x15, 0xdb, 0x34, 0x4a, 0x5b, 0x1d, 0xba, 0x9e, 0x8a,
-    0x61, 0x66, 0x8d, 0x40, 0xbf, 0x2f, 0xbc, 0x51, 0x37, 0x60, 0xb3, 0x79,
-    0x79, 0xd7, 0x19, 0xb1, 0xe9, 0xb4, 0x08, 0x8b, 0x49, 0xb6, 0xb4, 0x1d,
-    0x9b, 0x5c, 0xe0, 0x7f, 0x6a, 0xff, 0x8e, 0xb8, 0x82, 0xae, 0x0c, 0x2f,
-    0xae, 0xd5, 0xd2, 0x7d, 0x69, 0xe7, 0xd9, 0xe1, 0x5f, 0x77, 0xf7, 0x9c,
-    0xd8, 0xbc, 0xd4, 0x56, 0x79, 0xb0, 0xe8, 0xc4, 0xa2, 0x11, 0xa7, 0xad,
-    0x8d, 0x50, 0x4a, 0x4c, 0x11, 0xc9, 0x89, 0x5c, 0x13, 0x97, 0x75, 0xe6,
-    0xec, 0xe4, 0xc2, 0x38, 0xee, 0x57, 0x21, 0x94, 0x0a, 0x77, 0x37, 0x6f,
-    0xfc, 0x0e, 0xcc, 0xab, 0xbe, 0x6d, 0xfe, 0x3e, 0x39, 0x01, 0x40, 0x56,
-    0xdb, 0xa6, 0xf6, 0xf0, 0x3f, 0xe5, 0xb2, 0x77, 0x43, 0x8d, 0x36, 0xaf,
-    0x6c, 0x93, 0xc6, 0x6d, 0xac, 0xf5, 0x31, 0x88, 0x49, 0x75, 0x3b, 0xd9,
-    0x78, 0x6c, 0xad, 0xff, 0xd5, 0x65, 0x1f, 0xff, 0xd3, 0xea, 0x16, 0x65,
-    0x9e, 0xcc, 0xd1, 0x61, 0x9c, 0x87, 0x60, 0x1e, 0x71, 0x62, 0xf5, 0xfa,
-    0x69, 0x67, 0xcf, 0x7f, 0x74, 0x17, 0x1c, 0xac, 0x8c, 0x8f, 0xd9, 0x76,
-    0x88, 0xd4, 0x44, 0x10, 0xa5, 0x1d, 0x3e, 0x6a, 0x70, 0x02, 0x33, 0xa8,
-    0xbd, 0x59, 0x27, 0x66, 0x5f, 0x72, 0xd7, 0xb4, 0x1e, 0x14, 0x3e, 0xa8,
-    0xe3, 0x82, 0x56, 0x52, 0xa1, 0x45, 0xbd, 0xf1, 0x38, 0xb1, 0xde, 0xe0,
-    0x4b, 0x26, 0xab, 0x76, 0xf8, 0x25, 0xd3, 0x3d, 0xde, 0xe5, 0x8f, 0x68,
-    0xfc, 0x0f, 0x79, 0x4b, 0x43, 0x78, 0x88, 0x34, 0xe7, 0x10, 0x98, 0x78,
-    0xc2, 0x69, 0x76, 0x88, 0x68, 0x2d, 0x9d, 0x43, 0xc0, 0x59, 0x66, 0xca,
-    0xa5, 0x0d, 0x4c, 0x34, 0x92, 0x7d, 0x3d, 0x6d, 0x26, 0x0f, 0xf4, 0xf4,
-    0xbe, 0x9e, 0x34, 0x4a, 0x0f, 0xf5, 0xe4, 0x91, 0x9e, 0x7c, 0xa6, 0x25,
-    0x7b, 0x66, 0xdf, 0x8d, 0xb9, 0x34, 0x46, 0xef, 0x9b, 0x19, 0xfb, 0x66,
-    0xc6, 0x81, 0x99, 0x71, 0x68, 0x66, 0x1c, 0x99, 0x19, 0x4f, 0xcd, 0x8c,
-    0x67, 0x66, 0xc6, 0x73, 0x23, 0xa3, 0xdf, 0x48, 0xef, 0xeb, 0x49, 0x0d,
-    0x0c, 0x7d, 0x73, 0xa1, 0x7d, 0x73, 0x5d, 0xfd, 0x46, 0x87, 0xe6, 0xba,
-    0xfa, 0xe6, 0xba, 0xf6, 0x1b, 0x69, 0x23, 0x79, 0xa8, 0x27, 0x35, 0xd0,
-    0x9b, 0x9d, 0x1d, 0xe8, 0xb5, 0x0f, 0x8d, 0x7d, 0x30, 0x41, 0x78, 0x68,
-    0x56, 0x3f, 0xd2, 0x93, 0xda, 0x58, 0x26, 0xb8, 0x9f, 0x1a, 0x9d, 0x3f,
-    0x6d, 0x94, 0x6b, 0xcd, 0xcd, 0xbd, 0xf8, 0xcf, 0x5d, 0x46, 0x14, 0xd4,
-    0xd0, 0x72, 0x1f, 0xd1, 0x42, 0x4a, 0x1b, 0x6e, 0x25, 0x36, 0xa9, 0xa1,
-    0xf5, 0x6e, 0x62, 0x93, 0x8e, 0x36, 0xdd, 0x50, 0xe4, 0x44, 0x68, 0xb9,
-    0xa4, 0x28, 0xb6, 0xb1, 0xed, 0x9e, 0x62, 0x93, 0x96, 0x5b, 0x6e, 0x2b,
-    0x8a, 0x1d, 0x6b, 0xbb, 0xb0, 0xd8, 0x64, 0x11, 0x9b, 0xae, 0x2d, 0x36,
-    0x31, 0xb3, 0xf5, 0xf2, 0x22, 0x27, 0x2b, 0xcb, 0xfd, 0x45, 0x1b, 0x27,
-    0xd9, 0x74, 0x8b, 0x51, 0xf2, 0x95, 0xb6, 0x8b, 0x8c, 0x16, 0x1e, 0xd8,
-    0x72, 0x9d, 0x51, 0xf2, 0x9f, 0xb6, 0x1b, 0x8d, 0x36, 0x76, 0xb4, 0xe9,
-    0x5e, 0x23, 0x27, 0x5b, 0xcb, 0xd5, 0x46, 0x1b, 0x1b, 0x6b, 0xbb, 0xe0,
-    0x68, 0xe3, 0x70, 0x1b, 0xae, 0x39, 0x4a, 0xfe, 0xd7, 0x76, 0xd3, 0xd1,
-    0xc6, 0x0e, 0xed, 0xf7, 0x1d, 0x25, 0x9f, 0x6c, 0xbb, 0xf2, 0xc8, 0xd9,
-    0x8c, 0xe5, 0xd6, 0xa3, 0x8d, 0x43, 0x6e, 0xb8, 0xfb, 0x68, 0xe3, 0x9f,
-    0x6d, 0x37, 0x20, 0x6d, 0x42, 0x65, 0xe3, 0x3d, 0x48, 0xc9, 0x7a, 0xdb,
-    0xae, 0x42, 0x3e, 0x20, 0x4c, 0x1b, 0x5c, 0xda, 0xb8, 0x16, 0xb9, 0xde,
-    0x28, 0xb9, 0x0f, 0x9e, 0xa9, 0x72, 0x7b, 0x36, 0x56, 0xfa, 0xc6, 0x44,
-    0x23, 0xd9, 0xd7, 0xd3, 0x66, 0xf2, 0x40, 0x4f, 0xef, 0xeb, 0x49, 0xa3,
-    0xf4, 0x50, 0x4f, 0x1e, 0xe9, 0xc9, 0x67, 0x5a, 0xb2, 0x67, 0xf6, 0xdd,
-    0x98, 0x4b, 0x63, 0xf4, 0xbe, 0x99, 0xb1, 0x6f, 0x66, 0x1c, 0x98, 0x19,
-    0x87, 0x66, 0xc6, 0x91, 0x99, 0xf1, 0xd4, 0xcc, 0x78, 0x66, 0x66, 0x3c,
-    0x37, 0x32, 0xfa, 0x8d, 0xf4, 0xbe, 0x9e, 0xd4, 0xc0, 0xd0, 0x37, 0x17,
-    0xda, 0x37, 0xd7, 0xd5, 0x6f, 0x74, 0x68, 0xae, 0xab, 0x6f, 0xae, 0x6b,
-    0xbf, 0x91, 0x36, 0x92, 0x87, 0x7a, 0x52, 0x03, 0xbd, 0xd9, 0xd9, 0x81,
-    0x5e, 0xfb, 0xd0, 0xd8, 0x07, 0x13, 0x84, 0x87, 0x66, 0xf5, 0x23, 0x3d,
-    0xa9, 0x8d, 0x65, 0x82, 0xfb, 0xa9, 0xd1, 0xf9, 0xd3, 0x46, 0xb9, 0xd6,
-    0xdc, 0xdc, 0x8b, 0xff, 0x9c, 0xdc, 0x16, 0xd4, 0xd0, 0x22, 0xb7, 0x2d,
-    0xa4, 0xb4, 0x41, 0x6e, 0x37, 0xa9, 0xa1, 0x55, 0x6e, 0x37, 0xe9, 0x68,
-    0x93, 0xdc, 0xe6, 0x44, 0x68, 0x91, 0xdb, 0x62, 0x1b, 0xdb, 0xe4, 0x76,
-    0x93, 0x96, 0x5b, 0xe4, 0xb6, 0xd8, 0xb1, 0x36, 0xb9, 0xdd, 0x64, 0x11,
-    0x9b, 0xe4, 0x76, 0x13, 0x33, 0x5b, 0xe5, 0x36, 0x27, 0x2b, 0x8b, 0xdc,
-    0xb6, 0x71, 0x92, 0x4d, 0x72, 0x5b, 0xf2, 0x95, 0x36, 0xb9, 0x6d, 0xe1,
-    0x81, 0x2d, 0x72, 0x5b, 0xf2, 0x9f, 0x36, 0xb9, 0x6d, 0x63, 0x47, 0x9b,
-    0xe4, 0x36, 0x27, 0x5b, 0x8b, 0xdc, 0xb6, 0xb1, 0xb1, 0x36, 0xb9, 0x6d,
-    0xe3, 0x70, 0x1b, 0xe4, 0xb6, 0xe4, 0x7f, 0x6d, 0x72, 0xdb, 0xc6, 0x0e,
-    0xed, 0x72, 0x5b, 0xf2, 0xc9, 0x36, 0xb9, 0xcd, 0xd9, 0x8c, 0x45, 0x6e,
-    0xdb, 0x38, 0xe4, 0x06, 0xb9, 0x6d, 0xe3, 0x9f, 0x6d, 0x72, 0xdb, 0x26,
-    0x54, 0x36, 0xca, 0x6d, 0xc9, 0x7a, 0xdb, 0xe4, 0xf6, 0x03, 0xc2, 0xb4,
-    0xc1, 0xa5, 0xbf, 0x48, 0x6e, 0x1f, 0x1d, 0xa8, 0x72, 0x7b, 0x7a, 0xa5,
-    0xf4, 0x8d, 0x89, 0x46, 0xb2, 0xaf, 0xa7, 0xcd, 0xe4, 0x81, 0x9e, 0xde,
-    0xd7, 0x93, 0x46, 0xe9, 0xa1, 0x9e, 0x3c, 0xd2, 0x93, 0xcf, 0xb4, 0x64,
-    0xcf, 0xec, 0xbb, 0x31, 0x97, 0xc6, 0xe8, 0x7d, 0x33, 0x63, 0xdf, 0xcc,
-    0x38, 0x30, 0x33, 0x0e, 0xcd, 0x8c, 0x23, 0x33, 0xe3, 0xa9, 0x99, 0xf1,
-    0xcc, 0xcc, 0x78, 0x6e, 0x64, 0xf4, 0x1b, 0xe9, 0x7d, 0x3d, 0xa9, 0x81,
-    0xa1, 0x6f, 0x2e, 0xb4, 0x6f, 0xae, 0xab, 0xdf, 0xe8, 0xd0, 0x5c, 0x57,
-    0xdf, 0x5c, 0xd7, 0x7e, 0x23, 0x6d, 0x24, 0x0f, 0xf5, 0xa4, 0x06, 0x7a,
-    0xb3, 0xb3, 0x03, 0xbd, 0xf6, 0xa1, 0xb1, 0x0f, 0x26, 0x08, 0x0f, 0xcd,
-    0xea, 0x47, 0x7a, 0x52, 0x1b, 0xcb, 0x04, 0xf7, 0x53, 0xa3, 0xf3, 0xa7,
-    0x8d, 0x72, 0xad, 0xb9, 0xb9, 0x17, 0xff, 0x39, 0xb9, 0x2d, 0xa8, 0xa1,
-    0x45, 0x6e, 0x5b, 0x48, 0x69, 0x83, 0xdc, 0x6e, 0x52, 0x43, 0xab, 0xdc,
-    0x6e, 0xd2, 0xd1, 0x26, 0xb9, 0xcd, 0x89, 0xd0, 0x22, 0xb7, 0xc5, 0x36,
-    0xb6, 0xc9, 0xed, 0x26, 0x2d, 0xb7, 0xc8, 0x6d, 0xb1, 0x63, 0x6d, 0x72,
-    0xbb, 0xc9, 0x22, 0x36, 0xc9, 0xed, 0x26, 0x66, 0xb6, 0xca, 0x6d, 0x4e,
-    0x56, 0x16, 0xb9, 0x6d, 0xe3, 0x24, 0x9b, 0xe4, 0xb6, 0xe4, 0x2b, 0x6d,
-    0x72, 0xdb, 0xc2, 0x03, 0x5b, 0xe4, 0xb6, 0xe4, 0x3f, 0x6d, 0x72, 0xdb,
-    0xc6, 0x8e, 0x36, 0xc9, 0x6d, 0x4e, 0xb6, 0x16, 0xb9, 0x6d, 0x63, 0x63,
-    0x6d, 0x72, 0xdb, 0xc6, 0xe1, 0x36, 0xc8, 0x6d, 0xc9, 0xff, 0xda, 0xe4,
-    0xb6, 0x8d, 0x1d, 0xda, 0xe5, 0xb6, 0xe4, 0x93, 0x6d, 0x72, 0x9b, 0xb3,
-    0x19, 0x8b, 0xdc, 0xb6, 0x71, 0xc8, 0x0d, 0x72, 0xdb, 0xc6, 0x3f, 0xdb,
-    0xe4, 0xb6, 0x4d, 0xa8, 0x6c, 0x94, 0xdb, 0x92, 0xf5, 0xb6, 0xc9, 0xed,
-    0x07, 0x84, 0x69, 0x83, 0x4b, 0x7f, 0x91, 0xdc, 0x7e, 0xd6, 0x53, 0xe5,
-    0xf6, 0xed, 0x54, 0xe9, 0x1b, 0x13, 0x8d, 0x64, 0x5f, 0x4f, 0x9b, 0xc9,
-    0x03, 0x3d, 0xbd, 0xaf, 0x27, 0x8d, 0xd2, 0x43, 0x3d, 0x79, 0xa4, 0x27,
-    0x9f, 0x69, 0xc9, 0x9e, 0xd9, 0x77, 0x63, 0x2e, 0x8d, 0xd1, 0xfb, 0x66,
-    0xc6, 0xbe, 0x99, 0x71, 0x60, 0x66, 0x1c, 0x9a, 0x19, 0x47, 0x66, 0xc6,
-    0x53, 0x33, 0xe3, 0x99, 0x99, 0xf1, 0xdc, 0xc8, 0xe8, 0x37, 0xd2, 0xfb,
-    0x7a, 0x52, 0x03, 0x43, 0xdf, 0x5c, 0x68, 0xdf, 0x5c, 0x57, 0xbf, 0xd1,
-    0xa1, 0xb9, 0xae, 0xbe, 0xb9, 0xae, 0xfd, 0x46, 0xda, 0x48, 0x1e, 0xea,
-    0x49, 0x0d, 0xf4, 0x66, 0x67, 0x07, 0x7a, 0xed, 0x43, 0x63, 0x1f, 0x4c,
-    0x10, 0x1e, 0x9a, 0xd5, 0x8f, 0xf4, 0xa4, 0x36, 0x96, 0x09, 0xee, 0xa7,
-    0x46, 0xe7, 0x4f, 0x1b, 0xe5, 0x5a, 0x73, 0x73, 0x2f, 0xfe, 0x73, 0x72,
-    0x5b, 0x50, 0x43, 0x8b, 0xdc, 0xb6, 0x90, 0xd2, 0x06, 0xb9, 0xdd, 0xa4,
-    0x86, 0x56, 0xb9, 0xdd, 0xa4, 0xa3, 0x4d, 0x72, 0x9b, 0x13, 0xa1, 0x45,
-    0x6e, 0x8b, 0x6d, 0x6c, 0x93, 0xdb, 0x4d, 0x5a, 0x6e, 0x91, 0xdb, 0x62,
-    0xc7, 0xda, 0xe4, 0x76, 0x93, 0x45, 0x6c, 0x92, 0xdb, 0x4d, 0xcc, 0x6c,
-    0x95, 0xdb, 0x9c, 0xac, 0x2c, 0x72, 0xdb, 0xc6, 0x49, 0x36, 0xc9, 0x6d,
-    0xc9, 0x57, 0xda, 0xe4, 0xb6, 0x85, 0x07, 0xb6, 0xc8, 0x6d, 0xc9, 0x7f,
-    0xda, 0xe4, 0xb6, 0x8d, 0x1d, 0x6d, 0x92, 0xdb, 0x9c, 0x6c, 0x2d, 0x72,
-    0xdb, 0xc6, 0xc6, 0xda, 0xe4, 0xb6, 0x8d, 0xc3, 0x6d, 0x90, 0xdb, 0x92,
-    0xff, 0xb5, 0xc9, 0x6d, 0x1b, 0x3b, 0xb4, 0xcb, 0x6d, 0xc9, 0x27, 0xdb,
-    0xe4, 0x36, 0x67, 0x33, 0x16, 0xb9, 0x6d, 0xe3, 0x90, 0x1b, 0xe4, 0xb6,
-    0x8d, 0x7f, 0xb6, 0xc9, 0x6d, 0x9b, 0x50, 0xd9, 0x28, 0xb7, 0x25, 0xeb,
-    0x6d, 0x93, 0xdb, 0x0f, 0x08, 0xd3, 0x06, 0x97, 0x36, 0xe5, 0xb6, 0x71,
-    0xe0, 0x3e, 0xe9, 0xcb, 0x30, 0x66, 0x0c, 0x51, 0xc4, 0xbb, 0xb7, 0x93,
-    0x3d, 0x4b, 0x60, 0xb3, 0x7c, 0xaf, 0x5a, 0xa9, 0x4b, 0xd1, 0x1d, 0x18,
-    0xa5, 0x17, 0x27, 0xf8, 0xa4, 0x5e, 0xfd, 0xd4, 0xfd, 0xba, 0x3b, 0xcd,
-    0xae, 0x3a, 0x75, 0x89, 0xfa, 0xa8, 0xff, 0xe8, 0x12, 0xff, 0x93, 0x61,
-    0x5c, 0x07, 0x78, 0x81, 0x2d, 0x67, 0x14, 0x5b, 0x22, 0x59, 0x61, 0x1d,
-    0x42, 0x02, 0xb6, 0xbf, 0x16, 0xf0, 0x3a, 0x87, 0x25, 0x69, 0xe1, 0x70,
-    0x96, 0x17, 0xec, 0x9a, 0x57, 0x8a, 0xf8, 0xcf, 0x44, 0xc8, 0x67, 0xc1,
-    0x30, 0x88, 0x61, 0xaf, 0xf1, 0xf0, 0xd7, 0xba, 0x5b, 0xdc, 0x15, 0x25,
-    0x9b, 0x75, 0x2e, 0xca, 0x54, 0x9f, 0x6e, 0xbc, 0x3f, 0xda, 0x1f, 0xa9,
-    0xef, 0x4d, 0x55, 0xe0, 0xdb, 0xe5, 0x3f, 0x3c, 0x42, 0xb1, 0x0e, 0xc7,
-    0xa0, 0x05, 0x25, 0xf3, 0xf2, 0x64, 0xeb, 0x72, 0x91, 0xd2, 0xeb, 0xcf,
-    0x5e, 0x19, 0x30, 0xff, 0xde, 0x95, 0x49, 0x37, 0x8a, 0x30, 0xe6, 0x3c,
-    0xbb, 0x74, 0xc6, 0xec, 0x12, 0x60, 0xb2, 0xbd, 0xcd, 0xff, 0x76, 0xe3,
-    0xd9, 0x78, 0xc8, 0x3f, 0xbd, 0xaa, 0xa9, 0x7f, 0x9f, 0xb3, 0x72, 0x91,
-    0xa7, 0x0e, 0xf3, 0x4a, 0x7f, 0xed, 0x87, 0xf4, 0xc7, 0x2b, 0x27, 0x49,
-    0x11, 0x54, 0x75, 0x46, 0xfe, 0xfd, 0x4d, 0x9c, 0x3b, 0x3f, 0x5d, 0x07,
-    0xe3, 0x48, 0x69, 0x28, 0x3f, 0x9d, 0x05, 0xb4, 0x91, 0xdd, 0xa4, 0x8b,
-    0xe9, 0x14, 0xc6, 0x1f, 0xbe, 0x2f, 0x51, 0xa0, 0x40, 0x41, 0xf8, 0xc7,
-    0xd9, 0x77, 0x5d, 0x80, 0xf4, 0x14, 0xbe, 0xcf, 0x57, 0x2b, 0x37, 0xbb,
-    0xb8, 0x66, 0xa3, 0xd2, 0x5d, 0x57, 0xad, 0xe3, 0xba, 0xb5, 0xba, 0x04,
-    0xec, 0xb4, 0xae, 0x94, 0x19, 0x43, 0x6c, 0x45, 0xe5, 0xf6, 0x76, 0x09,
-    0x03, 0x75, 0x97, 0x49, 0x0a, 0xc0, 0xae, 0x6b, 0x16, 0xd6, 0x9a, 0xdd,
-    0x34, 0x1b, 0xb3, 0x0f, 0x18, 0x89, 0x0f, 0x4d, 0x5e, 0xfd, 0xf0, 0xf2,
-    0xa7, 0xef, 0x4f, 0xdf, 0x7e, 0xf8, 0xf4, 0xf6, 0x87, 0x57, 0xa7, 0x75,
-    0xcb, 0x44, 0x99, 0x88, 0x98, 0xa5, 0x39, 0x8d, 0xa9, 0xd2, 0x39, 0x56,
-    0xdf, 0xde, 0xde, 0xca, 0xe8, 0xcf, 0x0f, 0x54, 0xbf, 0x7b, 0xc5, 0xca,
-    0x77, 0x79, 0x56, 0x66, 0x08, 0xff, 0x1f, 0x2e, 0xa1, 0x24, 0x8a, 0x44,
-    0xc9, 0x5c, 0x66, 0xd7, 0x9d, 0x4d, 0xb0, 0x33, 0x04, 0x2c, 0x8b, 0xb6,
-    0xb6, 0x60, 0x92, 0xee, 0x94, 0xa5, 0x57, 0xe5, 0xc4, 0x4d, 0x52, 0x87,
-    0xa6, 0xcc, 0x93, 0x41, 0x1a, 0x2d, 0xbb, 0xd8, 0x10, 0x6a, 0x0f, 0x4c,
-    0x30, 0x6d, 0x45, 0x69, 0x35, 0x05, 0xcf, 0x8d, 0xf3, 0x3c, 0xbe, 0x83,
-    0x39, 0xa7, 0xab, 0x55, 0x2f, 0x8a, 0x22, 0x06, 0xd0, 0xe6, 0x17, 0x29,
-    0x6a, 0x8c, 0x00, 0x64, 0xe8, 0x1d, 0xc3, 0x3f, 0xac, 0xb3, 0xe7, 0xe0,
-    0x38, 0xca, 0xda, 0x2e, 0x95, 0xb5, 0x95, 0xdd, 0x9c, 0x81, 0xc2, 0x31,
-    0x62, 0xde, 0x6e, 0x18, 0xee, 0x5e, 0x05, 0xee, 0xae, 0xeb, 0xd7, 0x59,
-    0xde, 0xd9, 0x37, 0x9d, 0xdf, 0xce, 0x77, 0x7c, 0xfe, 0xf7, 0x2c, 0xee,
-    0xfc, 0x71, 0xee, 0x63, 0xa5, 0x27, 0x7b, 0x9f, 0x9e, 0xf4, 0xf5, 0x8a,
-    0x50, 0xf6, 0x71, 0x7c, 0x2e, 0x6a, 0xda, 0x2b, 0x7d, 0xc2, 0xdc, 0x0e,
-    0xe4, 0x94, 0xd9, 0x9b, 0x6c, 0xc9, 0xf2, 0x97, 0x71, 0xc1, 0x3c, 0x65,
-    0x5e, 0xa9, 0x3a, 0x2f, 0x9c, 0x34, 0x1b, 0xb2, 0xb3, 0xf2, 0x3c, 0xc4,
-    0x7f, 0xa2, 0x94, 0x2d, 0x9d, 0x1f, 0xd9, 0xd5, 0xe9, 0xed, 0xdc, 0x73,
-    0xbd, 0x7f, 0xad, 0x3e, 0x7e, 0x2c, 0x7c, 0x77, 0xa7, 0xdc, 0x71, 0x3d,
-    0xf8, 0x5a, 0x3d, 0xf1, 0x5d, 0xa5, 0x9f, 0x39, 0x27, 0x13, 0x01, 0x42,
-    0x01, 0x98, 0xad, 0x0a, 0x30, 0xab, 0xd5, 0xab, 0x33, 0x04, 0xc1, 0xf9,
-    0x90, 0x85, 0x6c, 0xc7, 0x9d, 0xdf, 0x2a, 0x28, 0x9a, 0x2b, 0x98, 0x21,
-    0x03, 0x28, 0x69, 0x9b, 0x86, 0x6f, 0x04, 0x6a, 0x77, 0x65, 0xb6, 0x1f,
-    0x2e, 0xbb, 0xb3, 0x78, 0x2e, 0x73, 0xde, 0x02, 0xda, 0x29, 0x94, 0x54,
-    0xaf, 0x64, 0x0f, 0x11, 0x51, 0x22, 0xe5, 0xb0, 0x0c, 0x6f, 0xf0, 0x91,
-    0xf9, 0xde, 0x5a, 0x99, 0xef, 0x98, 0xcf, 0x17, 0x11, 0x24, 0x0d, 0x72,
-    0x20, 0x29, 0x89, 0x11, 0x21, 0x86, 0xee, 0xe5, 0x5e, 0x1a, 0xf5, 0x06,
-    0xe9, 0x71, 0x3e, 0x48, 0x77, 0x76, 0x7c, 0xa4, 0xd7, 0xb3, 0xf4, 0x3c,
-    0x2a, 0xe1, 0x9f, 0x01, 0x26, 0x44, 0xd5, 0x28, 0x0f, 0x28, 0xc5, 0xa3,
-    0x12, 0xb3, 0x9c, 0x70, 0x42, 0x59, 0xd8, 0xb5, 0x0a, 0x13, 0x41, 0xbb,
-    0x6c, 0xb8, 0x44, 0xb2, 0xc5, 0x7f, 0xba, 0x97, 0xc9, 0x14, 0x74, 0x4b,
-    0x8f, 0x29, 0xd3, 0x9a, 0x61, 0x93, 0x00, 0x66, 0x54, 0x35, 0x8b, 0xa1,
-    0x7c, 0xc8, 0x04, 0x20, 0xa8, 0x24, 0x54, 0xb0, 0xfc, 0x86, 0xd7, 0xf7,
-    0xef, 0x79, 0xef, 0xe9, 0x10, 0x71, 0x6b, 0x06, 0x4c, 0xf5, 0x9b, 0x12,
-    0x58, 0x04, 0x30, 0x52, 0x06, 0xcd, 0xc3, 0x12, 0xa6, 0x58, 0x2a, 0x39,
-    0xd0, 0xa0, 0xee, 0xe2, 0x4a, 0x81, 0x04, 0x40, 0x8d, 0x5e, 0x4e, 0x7f,
-    0x1b, 0xcf, 0x68, 0x2d, 0x00, 0x19, 0x20, 0x81, 0xb4, 0x8b, 0xbf, 0xab,
-    0xf2, 0x73, 0x0c, 0xd4, 0x1e, 0xdd, 0x0e, 0x24, 0x47, 0x03, 0x1a, 0xb8,
-    0x1d, 0xe6, 0xc3, 0xaa, 0x30, 0x4c, 0x09, 0xcc, 0x9e, 0x92, 0x15, 0xb1,
-    0x50, 0xe9, 0x30, 0x52, 0x17, 0x7a, 0xe7, 0xe1, 0xab, 0xf3, 0xf9, 0x5d,
-    0xc5, 0x20, 0x87, 0x6e, 0x99, 0x2f, 0x98, 0xcb, 0x09, 0xeb, 0x32, 0x9e,
-    0x16, 0x0c, 0xd0, 0x87, 0x21, 0xe1, 0xe1, 0xd2, 0x30, 0x7f, 0x88, 0x1f,
-    0xe1, 0x0e, 0xa0, 0x0f, 0xa5, 0x76, 0x58, 0xb8, 0xfb, 0xaf, 0xb3, 0x8f,
-    0x67, 0x1f, 0xef, 0xcf, 0x77, 0xbb, 0x25, 0x2b, 0x4a, 0x04, 0xd4, 0xb2,
-    0x3b, 0xc7, 0xdf, 0x8d, 0xfa, 0xc7, 0xfb, 0x1f, 0xde, 0xe2, 0xc2, 0xf1,
-    0xff, 0xd7, 0xa3, 0xb8, 0x1c, 0x4d, 0x14, 0xe4, 0x60, 0xeb, 0x35, 0x2e,
-    0xf6, 0x36, 0xb8, 0x08, 0x96, 0xc1, 0x69, 0xf0, 0x22, 0x78, 0x1f, 0x7c,
-    0x88, 0xce, 0xce, 0x83, 0x97, 0xd1, 0x07, 0x94, 0x81, 0x50, 0x3d, 0x78,
-    0x0b, 0x9f, 0x7c, 0x77, 0x82, 0x37, 0xf0, 0x59, 0x4c, 0x93, 0x11, 0x0b,
-    0xde, 0x45, 0xa3, 0xee, 0x38, 0x1b, 0x2d, 0x66, 0xf8, 0xb2, 0xe6, 0x0f,
-    0xd1, 0xfd, 0x3a, 0x60, 0xf8, 0xcf, 0xab, 0xe8, 0xde, 0x05, 0xa1, 0xb2,
-    0x98, 0xe1, 0xdb, 0xfc, 0x8b, 0xb4, 0x74, 0xc3, 0xbd, 0x80, 0xa7, 0x0b,
-    0xf8, 0x72, 0x95, 0x9f, 0x78, 0xc0, 0x12, 0x57, 0x79, 0xca, 0x17, 0xd3,
-    0x32, 0x6c, 0x17, 0x4a, 0xc4, 0x95, 0x04, 0xcc, 0xe5, 0xc6, 0xc7, 0x3a,
-    0xf8, 0x26, 0xda, 0xfd, 0xd7, 0xc7, 0xe2, 0xeb, 0x63, 0xef, 0xe3, 0x72,
-    0x67, 0xb5, 0xe5, 0x9f, 0xfd, 0xeb, 0xe4, 0xfc, 0xeb, 0x93, 0xdd, 0xe0,
-    0x35, 0x64, 0x53, 0x9e, 0x0f, 0x85, 0x1f, 0x77, 0x87, 0x27, 0xde, 0x30,
-    0x3c, 0xfe, 0xb8, 0xfb, 0x71, 0xef, 0x64, 0xe5, 0x3f, 0xd9, 0x0d, 0x9e,
-    0x44, 0xbb, 0xc7, 0xde, 0x70, 0x0b, 0x2f, 0xcd, 0xae, 0x2e, 0xf2, 0x15,
-    0x4c, 0x66, 0xc5, 0x80, 0x1e, 0xc7, 0xab, 0x49, 0xbe, 0x4a, 0x66, 0x57,
-    0x2b, 0xba, 0x39, 0xb5, 0xc2, 0xb8, 0xd9, 0x15, 0xfe, 0xaa, 0xd6, 0x0a,
-    0xc3, 0xa6, 0x67, 0xbe, 0xe7, 0x9d, 0x7d, 0x5c, 0x86, 0xc0, 0x78, 0x68,
-    0x14, 0xff, 0xe3, 0xee, 0xc9, 0xee, 0x55, 0x12, 0x7c, 0x86, 0xa1, 0xa0,
-    0x77, 0x14, 0x8d, 0x2b, 0xfc, 0x6d, 0x15, 0xe8, 0x3f, 0x09, 0x7e, 0x8c,
-    0x76, 0x6b, 0x9e, 0xf3, 0x53, 0x74, 0xe6, 0xde, 0xc4, 0x53, 0x37, 0x70,
-    0x47, 0x45, 0x01, 0xff, 0x62, 0x2d, 0xf8, 0x83, 0xb2, 0x1a, 0xfe, 0x8c,
-    0xe3, 0x32, 0x86, 0x3f, 0xa4, 0xb5, 0x60, 0x21, 0x5f, 0x78, 0xe0, 0x66,
-    0x97, 0x97, 0x80, 0x93, 0xee, 0x79, 0x50, 0x46, 0xef, 0xba, 0x23, 0x98,
-    0x69, 0xc9, 0x4e, 0xa7, 0x0c, 0x41, 0xeb, 0xb9, 0x14, 0x85, 0xe8, 0xfa,
-    0xc1, 0xb7, 0x96, 0xa2, 0x1c, 0xf2, 0x7f, 0x8b, 0x00, 0x73, 0xc2, 0x66,
-    0x19, 0x4e, 0x12, 0x8a, 0xe9, 0x6f, 0x58, 0x06, 0x14, 0xa2, 0x8a, 0x7f,
-    0xf1, 0x17, 0xa1, 0xf0, 0xef, 0x38, 0xfc, 0x16, 0x32, 0xe1, 0x1f, 0xf7,
-    0x6b, 0xb7, 0xd9, 0x7c, 0x9c, 0xdc, 0x00, 0x43, 0x0b, 0xbe, 0x8f, 0x76,
-    0x47, 0xd9, 0x6c, 0x0e, 0x76, 0x1f, 0x5b, 0x4d, 0xb3, 0x78, 0x0c, 0x60,
-    0xa3, 0x67, 0x34, 0x79, 0x08, 0xf4, 0x6e, 0xf0, 0x7b, 0x84, 0x58, 0xb7,
-    0xec, 0x9c, 0x7f, 0x0d, 0x90, 0xfe, 0x03, 0x11, 0xe0, 0xbb, 0xe8, 0x0f,
-    0xe0, 0xae, 0x5c, 0x24, 0x07, 0x9f, 0x30, 0xe7, 0xe7, 0xc8, 0xde, 0x7b,
-    0xf0, 0x8f, 0x08, 0x7f, 0x69, 0x81, 0xdf, 0x3c, 0xc1, 0x65, 0xbe, 0xa6,
-    0x0d, 0x0f, 0xe4, 0x33, 0x39, 0xa1, 0x8b, 0x5f, 0x3f, 0xc0, 0x97, 0x1b,
-    0x00, 0x13, 0x0a, 0x09, 0x96, 0xdf, 0x66, 0xb9, 0x1b, 0x10, 0x11, 0x85,
-    0x6e, 0x45, 0x4b, 0x6e, 0x30, 0x8b, 0x6f, 0x05, 0xc3, 0x72, 0xe1, 0xf3,
-    0x0d, 0x17, 0x6e, 0x01, 0x05, 0x2e, 0x0b, 0xbb, 0xd4, 0xc5, 0xc4, 0x7b,
-    0x9e, 0xe0, 0x25, 0x52, 0x1d, 0xa3, 0x92, 0x77, 0x3c, 0x01, 0xa3, 0x67,
-    0x4b, 0x68, 0x92, 0xc2, 0xe0, 0xd9, 0x12, 0xaa, 0xa7, 0x2e, 0xa2, 0x2f,
-    0xcf, 0x81, 0x0f, 0x9e, 0xb3, 0x28, 0x18, 0xf0, 0xdd, 0xd0, 0x85, 0xbf,
-    0xdf, 0xc7, 0x73, 0x98, 0x1d, 0x60, 0x0c, 0x13, 0xa1, 0xd1, 0x2e, 0x25,
-    0x5e, 0x50, 0x02, 0xdb, 0xd2, 0x5d, 0x0f, 0x36, 0x4e, 0x68, 0x1b, 0xb1,
-    0x0f, 0xca, 0x38, 0x15, 0x19, 0xee, 0x3a, 0xf8, 0x25, 0xfa, 0x06, 0x65,
-    0x69, 0x37, 0x29, 0xe8, 0xef, 0x6a, 0x65, 0xe1, 0xe0, 0x28, 0x8b, 0x8a,
-    0x12, 0x7f, 0xac, 0x05, 0xc4, 0x07, 0x55, 0x5b, 0x4b, 0xce, 0xf3, 0x09,
-    0x44, 0x00, 0x50, 0x34, 0x2b, 0x22, 0x5d, 0x45, 0x4b, 0x2e, 0xbd, 0x2d,
-    0x60, 0x1e, 0x5b, 0xe5, 0x6a, 0xb5, 0xb7, 0xa5, 0x0a, 0x00, 0x9f, 0x37,
-    0xdc, 0xda, 0x1b, 0x48, 0x26, 0x27, 0x3a, 0x58, 0xad, 0x40, 0xc3, 0xa1,
-    0xcb, 0x16, 0xdf, 0xf3, 0x8c, 0xf7, 0x82, 0x93, 0x63, 0xc1, 0x2c, 0xfb,
-    0xc3, 0x92, 0x9b, 0xd9, 0x6a, 0xea, 0x59, 0x03, 0x98, 0x48, 0xea, 0x4b,
-    0xae, 0x2f, 0x39, 0x37, 0xf3, 0x69, 0xf4, 0x3c, 0x48, 0x60, 0x7c, 0x1e,
-    0xc8, 0x8c, 0xe2, 0x2b, 0xc8, 0xa2, 0xad, 0x44, 0xae, 0x2c, 0x03, 0x76,
-    0x97, 0x44, 0x3f, 0xfb, 0x5d, 0xfc, 0xa9, 0x9a, 0x74, 0xfc, 0x92, 0x02,
-    0x94, 0x4b, 0x1f, 0xb8, 0xf0, 0xff, 0xf9, 0xd4, 0xfd, 0xbd, 0x88, 0xbd,
-    0x04, 0xba, 0xe9, 0x12, 0xfa, 0x90, 0xfe, 0x13, 0x40, 0x83, 0x9f, 0x05,
-    0xc3, 0xaf, 0x2b, 0xaf, 0x83, 0x17, 0x91, 0x0d, 0xa2, 0xb5, 0x52, 0xd0,
-    0xd9, 0xf1, 0xba, 0xfe, 0x10, 0x68, 0x57, 0x07, 0x60, 0xc5, 0x8a, 0x19,
-    0xe0, 0xf3, 0x4f, 0x78, 0x11, 0x82, 0x6b, 0x0b, 0x21, 0x08, 0x35, 0xa0,
-    0x8c, 0xf7, 0x75, 0xaf, 0x69, 0x55, 0xf9, 0x2d, 0x5f, 0x5f, 0x6a, 0xef,
-    0x2a, 0x55, 0x26, 0x0b, 0x3c, 0x1b, 0x7b, 0xf9, 0xd4, 0x05, 0x74, 0xb9,
-    0x42, 0xa2, 0xd0, 0xb6, 0x0f, 0x65, 0x98, 0x80, 0x4f, 0x90, 0x49, 0x78,
-    0xbc, 0xe6, 0x7c, 0x9d, 0xf4, 0xaf, 0x3c, 0x5a, 0x7a, 0x26, 0x55, 0x71,
-    0xdd, 0xa4, 0xfb, 0x04, 0x5f, 0x5c, 0x0e, 0x60, 0x2b, 0xbc, 0x6a, 0x8d,
-    0xd0, 0xa0, 0x8c, 0xea, 0x15, 0x3f, 0x09, 0xdc, 0xe3, 0x27, 0x7b, 0xa0,
-    0xe8, 0x3f, 0xe9, 0x9f, 0xb8, 0x50, 0x97, 0x84, 0x17, 0xd4, 0x61, 0xd1,
-    0x37, 0xf5, 0x10, 0x75, 0x6f, 0x01, 0x43, 0x4d, 0xe8, 0x37, 0xe8, 0x90,
-    0x45, 0xc0, 0x2b, 0xfc, 0xc0, 0xcb, 0xa2, 0xdf, 0xce, 0xd8, 0x39, 0xc2,
-    0x1e, 0xac, 0xa0, 0xef, 0x3e, 0x7c, 0xff, 0x26, 0x72, 0x41, 0x13, 0x82,
-    0x8d, 0x59, 0x76, 0x59, 0x0c, 0xd2, 0x45, 0x68, 0x2a, 0x99, 0xa2, 0x97,
-    0xf8, 0x81, 0xa2, 0xcd, 0x67, 0xfa, 0x2e, 0x81, 0xd6, 0x00, 0xe6, 0x80,
-    0x1f, 0x00, 0xe0, 0x7c, 0xda, 0xf3, 0xa5, 0x97, 0xfb, 0x81, 0xe8, 0xcb,
-    0x84, 0x65, 0x67, 0xef, 0xf8, 0x27, 0x05, 0x8e, 0xc3, 0x04, 0x54, 0x33,
-    0x14, 0x6e, 0x49, 0x37, 0x06, 0x91, 0x4e, 0x75, 0xb0, 0xaf, 0x1c, 0x61,
-    0xfb, 0x5b, 0x64, 0xdf, 0x07, 0x50, 0xe4, 0xb8, 0xc6, 0x83, 0x95, 0x92,
-    0xe2, 0xb7, 0xe8, 0x21, 0x92, 0x83, 0xae, 0xa8, 0x6a, 0x9a, 0x94, 0x46,
-    0x97, 0x42, 0x65, 0x42, 0x2c, 0xdf, 0x2a, 0xfd, 0x8a, 0x26, 0x7f, 0xf3,
-    0x7c, 0xcc, 0x72, 0x0b, 0xe2, 0x83, 0xb5, 0x4e, 0x5c, 0xfa, 0x98, 0x7b,
-    0x0c, 0x19, 0xb4, 0x23, 0x50, 0x3a, 0xf3, 0x7c, 0xff, 0xac, 0x77, 0xbe,
-    0xbd, 0x5d, 0xc1, 0xde, 0x4f, 0xa3, 0x1a, 0x2d, 0x60, 0x94, 0x6a, 0x27,
-    0x60, 0x3c, 0x10, 0x10, 0x28, 0xf7, 0x07, 0x0c, 0x34, 0x02, 0x24, 0x71,
-    0x86, 0x4a, 0x88, 0x1c, 0x76, 0x09, 0x70, 0x00, 0x41, 0x9d, 0x22, 0xe2,
-    0x0f, 0xb0, 0x13, 0x24, 0x92, 0x77, 0x01, 0x28, 0xde, 0xb2, 0x3a, 0xda,
-    0x3f, 0x75, 0xed, 0x77, 0xa8, 0x19, 0xc7, 0xe3, 0x3b, 0xac, 0x0e, 0x85,
-    0x04, 0x0a, 0xa5, 0x42, 0x89, 0x99, 0xbf, 0x50, 0x46, 0x04, 0xba, 0x56,
-    0x24, 0x90, 0x3b, 0xb7, 0xa9, 0x98, 0xc2, 0xfa, 0x59, 0xfb, 0x34, 0x33,
-    0x07, 0x1a, 0x26, 0x7c, 0x25, 0xb0, 0x3b, 0xea, 0x9c, 0xb1, 0xa4, 0x6d,
-    0xa1, 0x02, 0x1a, 0xff, 0x15, 0xeb, 0x5d, 0x2b, 0x1b, 0x91, 0x62, 0x46,
-    0xe0, 0x2d, 0xed, 0xb8, 0xc0, 0x37, 0x55, 0xa0, 0x4d, 0x17, 0xa4, 0x34,
-    0x70, 0x9a, 0xba, 0x66, 0xb5, 0xc1, 0x65, 0x24, 0x70, 0x3a, 0xce, 0xaf,
-    0x48, 0xe5, 0x29, 0x82, 0xbd, 0xca, 0x44, 0xba, 0xc8, 0xb2, 0x29, 0x8b,
-    0x53, 0xcd, 0xf2, 0x01, 0x95, 0x99, 0x01, 0x61, 0x81, 0xae, 0x39, 0x49,
-    0x2e, 0x4b, 0x0f, 0xdf, 0x45, 0xef, 0x82, 0x10, 0x3b, 0x45, 0x94, 0x56,
-    0xe1, 0x57, 0x19, 0xd6, 0x4e, 0xe9, 0x09, 0x55, 0x17, 0x15, 0xee, 0x0b,
-    0x24, 0x39, 0x60, 0x9b, 0xd0, 0x11, 0x50, 0xc5, 0xd9, 0xc5, 0xb9, 0xbf,
-    0x5a, 0xfd, 0xc2, 0x3f, 0xfc, 0xa1, 0xcc, 0x02, 0x73, 0x6c, 0xea, 0x31,
-    0xfe, 0x45, 0x7f, 0x41, 0xda, 0xfa, 0xc1, 0x2f, 0x55, 0xe1, 0x2f, 0x7a,
-    0xe1, 0xd9, 0x39, 0x4c, 0x82, 0x3e, 0x03, 0xac, 0x01, 0x43, 0xf9, 0x21,
-    0x7e, 0x6c, 0x09, 0xea, 0xc7, 0x3a, 0xd4, 0x74, 0x0d, 0x33, 0x29, 0x51,
-    0x2b, 0x06, 0xd2, 0x47, 0xb4, 0x07, 0xb0, 0xda, 0xb1, 0x3e, 0x72, 0xbf,
-    0x42, 0xe5, 0x13, 0xd0, 0x17, 0xf8, 0xf8, 0x16, 0x4c, 0xd6, 0xed, 0xca,
-    0x74, 0x16, 0x01, 0x07, 0x4a, 0x80, 0x77, 0x92, 0xb6, 0xe8, 0xed, 0x81,
-    0xea, 0x19, 0xc4, 0xd1, 0xef, 0x7c, 0xeb, 0x33, 0x09, 0x3a, 0x87, 0xcc,
-    0x58, 0xc1, 0xc0, 0x5e, 0xdc, 0xbd, 0x1e, 0x6f, 0x6f, 0xc7, 0xdb, 0xdb,
-    0xf9, 0xd0, 0x43, 0xb1, 0xa4, 0x97, 0x40, 0x23, 0x7f, 0x08, 0x26, 0x47,
-    0x78, 0x76, 0x1e, 0xea, 0x02, 0x6d, 0x7b, 0xfb, 0xb9, 0x91, 0xde, 0xd3,
-    0x2b, 0x0c, 0xa1, 0x89, 0xdc, 0x3e, 0x00, 0x4b, 0x8e, 0x06, 0x6f, 0xdd,
-    0x79, 0xf1, 0xe2, 0xee, 0xa5, 0x54, 0x24, 0x86, 0xc9, 0xb0, 0xad, 0x08,
-    0xc6, 0x0f, 0x8d, 0xb2, 0x0f, 0xf1, 0x15, 0x95, 0x90, 0x4d, 0xf1, 0xfb,
-    0x82, 0xe5, 0x77, 0x52, 0xe8, 0x7d, 0x03, 0x43, 0x31, 0x1f, 0xd0, 0x6e,
-    0x29, 0xfd, 0x48, 0x05, 0x28, 0x41, 0x52, 0x5d, 0x16, 0x3d, 0x54, 0x45,
-    0x43, 0x2b, 0x66, 0x96, 0xb0, 0x06, 0x86, 0x53, 0x95, 0xd5, 0xd0, 0x34,
-    0x0a, 0xf5, 0xaa, 0x88, 0x2a, 0x03, 0x46, 0xac, 0x9b, 0x29, 0x62, 0xd4,
-    0x1f, 0x20, 0x9b, 0x41, 0xb6, 0x2e, 0x59, 0xd2, 0x56, 0x6f, 0x20, 0xc5,
-    0x3e, 0x4e, 0x8a, 0xbf, 0x21, 0x00, 0x1f, 0x49, 0xf1, 0xad, 0xe8, 0x30,
-    0x8a, 0x29, 0xf9, 0x4f, 0x72, 0x71, 0x44, 0x19, 0x25, 0x48, 0xd3, 0x88,
-    0x7e, 0xa1, 0xef, 0x77, 0x53, 0x98, 0x03, 0x77, 0x30, 0x44, 0x53, 0xca,
-    0x39, 0xc5, 0xcb, 0x61, 0x22, 0x47, 0x45, 0x69, 0x72, 0x33, 0x90, 0xd9,
-    0xc8, 0xb8, 0xdd, 0x5f, 0x29, 0x1c, 0x72, 0x2e, 0x6b, 0x6a, 0xff, 0x16,
-    0x80, 0x91, 0x27, 0xa3, 0x66, 0xdb, 0xe8, 0x2d, 0x19, 0xcc, 0x28, 0xbe,
-    0xd3, 0x8a, 0x71, 0x0e, 0x4c, 0x3f, 0x4b, 0x45, 0x76, 0xe4, 0x98, 0xa8,
-    0x58, 0xed, 0x16, 0xba, 0x24, 0xa4, 0xf9, 0x8a, 0x54, 0x00, 0x03, 0xc5,
-    0x68, 0xfe, 0x6c, 0x6f, 0xc3, 0x62, 0x91, 0xd8, 0x71, 0xc3, 0x40, 0x31,
-    0x22, 0x40, 0x24, 0x29, 0x5f, 0xa3, 0x29, 0x7c, 0xc5, 0x60, 0x1f, 0xa4,
-    0xa4, 0xe1, 0xd8, 0x23, 0xc8, 0x02, 0x77, 0x15, 0xf6, 0x7d, 0x8a, 0xfa,
-    0x40, 0xf4, 0x02, 0xc1, 0x09, 0x8c, 0x2b, 0x6a, 0xe1, 0x8a, 0xe8, 0xa0,
-    0x72, 0xdd, 0x90, 0x2b, 0xc4, 0xb5, 0x6b, 0x86, 0xda, 0x48, 0x5f, 0x15,
-    0xf6, 0xb8, 0x58, 0x24, 0xe3, 0xa8, 0x07, 0x1f, 0xc5, 0x62, 0x8e, 0x3f,
-    0x4c, 0x87, 0x9a, 0x33, 0x88, 0xc0, 0xdb, 0x79, 0xce, 0xbf, 0xd2, 0x2c,
-    0x9b, 0xab, 0x1e, 0x31, 0xcc, 0x03, 0x25, 0xd4, 0x4e, 0x98, 0xa8, 0x36,
-    0x00, 0xb9, 0x9d, 0x9d, 0x23, 0x0b, 0x47, 0x6b, 0xcf, 0xc7, 0xed, 0xc8,
-    0xc1, 0x8a, 0xcf, 0x8f, 0x25, 0x6c, 0x06, 0x39, 0x18, 0xf3, 0x1c, 0x9a,
-    0xc8, 0xac, 0xbc, 0xf2, 0x2c, 0x27, 0x9e, 0x00, 0x24, 0xd8, 0x9d, 0x2f,
-    0x0a, 0x90, 0xbc, 0x82, 0x99, 0x63, 0xd3, 0x84, 0xef, 0xa4, 0x56, 0x3d,
-    0x01, 0xaa, 0xd7, 0xab, 0x8b, 0x65, 0xf7, 0x8e, 0x41, 0x43, 0x88, 0x7d,
-    0x31, 0x0e, 0x58, 0xa1, 0x97, 0xa9, 0x30, 0x25, 0x51, 0x95, 0x9b, 0xde,
-    0x79, 0x60, 0x5e, 0x02, 0x35, 0x65, 0x6b, 0x21, 0xe3, 0xdb, 0x45, 0x2a,
-    0x4d, 0xfd, 0xbe, 0xf6, 0x40, 0x54, 0x73, 0x47, 0x47, 0x04, 0x8a, 0xdc,
-    0x3d, 0xf4, 0x3d, 0x09, 0x30, 0x02, 0x73, 0x00, 0x06, 0x8a, 0x7f, 0x6a,
-    0x11, 0xb6, 0xae, 0x56, 0x90, 0xf3, 0x15, 0x34, 0x1a, 0xe1, 0xa2, 0x03,
-    0xfc, 0xa3, 0xc8, 0xbd, 0xaa, 0x35, 0x4c, 0xf0, 0x0a, 0xb4, 0x26, 0xbb,
-    0xe8, 0x78, 0x5b, 0x2b, 0xb3, 0xeb, 0x60, 0xd4, 0x45, 0x2b, 0x1b, 0xf0,
-    0x50, 0xb1, 0xb9, 0x23, 0xfc, 0x87, 0x27, 0x2b, 0x75, 0xc6, 0x7d, 0xc1,
-    0xb1, 0xd6, 0xe1, 0x38, 0xee, 0x70, 0xbc, 0x70, 0x24, 0x15, 0x72, 0xe5,
-    0xde, 0x79, 0x05, 0x6a, 0x9d, 0xf0, 0x35, 0x39, 0x9c, 0xc2, 0x9c, 0xd3,
-    0x3c, 0x07, 0xd3, 0xa7, 0x5b, 0xcc, 0xa7, 0x20, 0xae, 0x5c, 0xc7, 0xf5,
-    0x0d, 0xbd, 0xe8, 0x8f, 0x33, 0xf7, 0x8c, 0x7b, 0x12, 0x1d, 0x17, 0xbd,
-    0x02, 0xe7, 0xee, 0x79, 0xc4, 0x0c, 0x3f, 0x17, 0xce, 0xe2, 0x32, 0x8d,
-    0xf0, 0x06, 0x3a, 0x50, 0xcb, 0x02, 0x39, 0x55, 0x08, 0x22, 0x32, 0x90,
-    0xbe, 0x9e, 0x40, 0x48, 0xa8, 0xf0, 0x83, 0x94, 0x55, 0x60, 0x8c, 0x8d,
-    0x17, 0x23, 0x06, 0x19, 0xfc, 0x23, 0xc0, 0xad, 0x86, 0x14, 0xfe, 0x09,
-    0x0a, 0x40, 0x53, 0xf8, 0xc6, 0x3f, 0x01, 0xce, 0x8b, 0xea, 0xf1, 0x8f,
-    0x40, 0xd0, 0x4d, 0x58, 0x51, 0x50, 0xc0, 0x31, 0x20, 0x54, 0x50, 0x18,
-    0x37, 0x9a, 0xe8, 0x0d, 0x11, 0x15, 0xf7, 0xa8, 0x84, 0x4d, 0x2e, 0x8f,
-    0x2b, 0x11, 0x2b, 0x37, 0xbb, 0x84, 0xcd, 0x66, 0x51, 0x95, 0x8d, 0x2a,
-    0x45, 0x8a, 0x0e, 0x39, 0xae, 0xb0, 0x90, 0x43, 0xa8, 0xcc, 0x08, 0x70,
-    0xa0, 0x9d, 0x33, 0xb9, 0x7b, 0x2f, 0x05, 0xb2, 0x09, 0xb5, 0x06, 0x95,
-    0xcc, 0x21, 0x39, 0xa8, 0xea, 0xba, 0xe4, 0x7a, 0x46, 0x82, 0x46, 0x6b,
-    0xce, 0xa2, 0xce, 0x2f, 0x3d, 0xe1, 0x60, 0xd3, 0x5c, 0xd4, 0xba, 0x4a,
-    0x2f, 0x71, 0x00, 0xb5, 0x0c, 0xe4, 0xf8, 0x24, 0xef, 0xc2, 0xa6, 0xcf,
-    0x7b, 0x09, 0x5a, 0x31, 0x9f, 0x10, 0xf5, 0x56, 0xad, 0x06, 0xdb, 0x90,
-    0x16, 0x16, 0x5a, 0x18, 0xc8, 0xf7, 0x5c, 0x5e, 0xbe, 0xe3, 0x7a, 0xda,
-    0xfb, 0x12, 0xd0, 0x02, 0x08, 0xee, 0x5d, 0x17, 0x6d, 0xfa, 0x61, 0xe9,
-    0x2d, 0x7d, 0x30, 0xdc, 0xc1, 0x70, 0x3d, 0xc5, 0xdf, 0xb4, 0x78, 0x93,
-    0x14, 0xa0, 0xbc, 0x00, 0xdb, 0x74, 0x5f, 0xfd, 0xf0, 0xfd, 0x4b, 0x6e,
-    0x66, 0xbe, 0x21, 0x93, 0xdd, 0x55, 0x75, 0x6f, 0x6c, 0xb5, 0x0e, 0xb6,
-    0x40, 0xad, 0xc7, 0x79, 0xac, 0x03, 0x90, 0x68, 0xb6, 0x91, 0x4b, 0x72,
-    0x68, 0x49, 0x97, 0x23, 0x02, 0x8f, 0xa0, 0x75, 0xd6, 0x3b, 0x46, 0xef,
-    0x60, 0x58, 0xee, 0x28, 0x9e, 0xbf, 0xf3, 0x75, 0x20, 0x60, 0x6a, 0x59,
-    0x37, 0xd5, 0x83, 0x41, 0x3c, 0x84, 0x0d, 0x1e, 0x87, 0xb4, 0x54, 0xe1,
-    0x5d, 0x21, 0x2c, 0xd0, 0x32, 0x68, 0xab, 0xc5, 0x34, 0xfd, 0x89, 0x3b,
-    0xfa, 0x40, 0x1a, 0x60, 0x51, 0x2d, 0xfe, 0x40, 0x68, 0xea, 0x19, 0x36,
-    0x73, 0x63, 0x1d, 0x60, 0x5f, 0xb6, 0x5d, 0xff, 0xd0, 0x65, 0x37, 0x20,
-    0xcb, 0xeb, 0xa5, 0x5b, 0xb7, 0x7e, 0x0b, 0x75, 0x0c, 0x63, 0xfb, 0x05,
-    0x48, 0xb9, 0xaf, 0x2c, 0x54, 0xb5, 0x48, 0xd5, 0x7d, 0x49, 0x93, 0xc3,
-    0x77, 0x95, 0xaa, 0x0f, 0x50, 0x15, 0xc2, 0xa5, 0xf7, 0xd6, 0x3a, 0xa2,
-    0xa2, 0xa9, 0x0a, 0xcb, 0x5a, 0xda, 0x38, 0xeb, 0x00, 0xb6, 0x3e, 0xb4,
-    0xa2, 0xe5, 0xd2, 0x7b, 0xcf, 0x7b, 0xe7, 0x44, 0xe7, 0x2d, 0xa9, 0xd4,
-    0xc7, 0x36, 0x49, 0x61, 0xdb, 0xee, 0xde, 0xb1, 0xb2, 0x09, 0xdb, 0xdb,
-    0xca, 0x58, 0xb4, 0xe9, 0xe7, 0xa4, 0x43, 0xc3, 0x54, 0xc3, 0x86, 0x6a,
-    0x2c, 0x84, 0x4c, 0x4c, 0x12, 0x96, 0x73, 0x55, 0xd2, 0xd1, 0x2d, 0xdb,
-    0x05, 0xc3, 0x31, 0x65, 0x8d, 0x25, 0x48, 0xe1, 0x94, 0xcb, 0x0e, 0xb1,
-    0x27, 0x5c, 0xcd, 0x27, 0xc3, 0x37, 0x6a, 0x98, 0x4e, 0x8c, 0x03, 0xae,
-    0x72, 0x13, 0x87, 0x13, 0x1a, 0x12, 0x06, 0xee, 0xe2, 0x3b, 0x29, 0xbe,
-    0x44, 0x56, 0x86, 0xb0, 0x04, 0x15, 0x88, 0xd7, 0xb6, 0xa8, 0xdc, 0xb9,
-    0x62, 0x3e, 0x1e, 0xf7, 0xd0, 0xa1, 0xcb, 0xe7, 0x80, 0x48, 0x51, 0xc1,
-    0x0f, 0xb9, 0xc2, 0x24, 0xb6, 0xc2, 0x4a, 0x9d, 0x46, 0x13, 0x4d, 0xd1,
-    0xee, 0x19, 0xd6, 0x6a, 0x9f, 0x5c, 0x2a, 0xfa, 0xb8, 0x71, 0x91, 0xd2,
-    0x5e, 0xe9, 0x22, 0x2d, 0x78, 0x1c, 0x0f, 0x7f, 0xb7, 0x8c, 0xd2, 0x41,
-    0x21, 0x55, 0xf2, 0x25, 0x73, 0x15, 0xba, 0xe4, 0x14, 0x28, 0x53, 0xc1,
-    0x4e, 0xb9, 0xb3, 0xe7, 0x23, 0xb2, 0xe5, 0x45, 0x93, 0xab, 0x46, 0x62,
-    0xdf, 0x2a, 0x51, 0x86, 0x8a, 0x10, 0xce, 0xac, 0x24, 0x67, 0xfb, 0x3a,
-    0xc0, 0x1b, 0xcc, 0x2d, 0xad, 0x14, 0x4c, 0xe8, 0xec, 0xb5, 0xf7, 0x80,
-    0x0b, 0x09, 0x4d, 0xdd, 0x2d, 0xa5, 0x2e, 0xaa, 0x36, 0xc3, 0xfa, 0x70,
-    0x4b, 0xea, 0x71, 0x43, 0xd5, 0xd9, 0x6f, 0x4c, 0x80, 0x69, 0xad, 0x51,
-    0xb2, 0xcc, 0x58, 0xd3, 0xa3, 0x52, 0x63, 0xb9, 0x02, 0x65, 0x22, 0x89,
-    0xb5, 0x1f, 0xe2, 0x59, 0x47, 0x3d, 0x7f, 0x18, 0x8c, 0x5b, 0x85, 0x35,
-    0x1a, 0x0b, 0x28, 0x22, 0x5b, 0x6f, 0x6e, 0x5e, 0x5d, 0x99, 0xe8, 0x19,
-    0x56, 0x8a, 0xa2, 0x7d, 0x9a, 0x15, 0x4c, 0x85, 0x16, 0x59, 0x69, 0x38,
-    0xdf, 0x04, 0x1d, 0xe5, 0x59, 0xd4, 0x58, 0x24, 0xe8, 0xa3, 0x4b, 0x45,
-    0x1f, 0xb2, 0x91, 0x82, 0xaa, 0xbd, 0x6f, 0x79, 0xd9, 0x10, 0xf8, 0x6a,
-    0x56, 0xe1, 0x25, 0xa0, 0x70, 0x4d, 0x81, 0xa8, 0x8f, 0x82, 0x42, 0x0f,
-    0x1a, 0x3e, 0xd0, 0x15, 0xd8, 0x2e, 0x5b, 0x85, 0x20, 0xb5, 0x9a, 0xbf,
-    0x61, 0x27, 0x89, 0xd2, 0x1a, 0xb1, 0x3a, 0xe1, 0x58, 0xcd, 0x48, 0xea,
-    0x7b, 0x09, 0xac, 0x83, 0xd7, 0xd7, 0x51, 0x1a, 0xa7, 0xc0, 0x21, 0x0f,
-    0x2b, 0x11, 0x9b, 0xd7, 0x3b, 0x4e, 0xa5, 0xe4, 0xf5, 0xf1, 0x40, 0x10,
-    0x41, 0x65, 0x83, 0x3f, 0x79, 0x30, 0x14, 0xa3, 0x83, 0xa6, 0x56, 0xd2,
-    0xd4, 0x54, 0x02, 0x1b, 0x02, 0x81, 0x0a, 0x02, 0x43, 0x3a, 0x90, 0x87,
-    0x4f, 0x12, 0x38, 0xd7, 0x1e, 0xf1, 0x4e, 0x31, 0x3b, 0x1b, 0xbd, 0x5d,
-    0x4b, 0x66, 0x36, 0x9f, 0x2e, 0x46, 0x9f, 0x3d, 0xb7, 0x1e, 0x12, 0x9d,
-    0x57, 0xd8, 0x56, 0x1e, 0x88, 0xd9, 0x5b, 0x6f, 0xd8, 0xef, 0x5c, 0x72,
-    0x1e, 0xde, 0x0d, 0x17, 0x9a, 0x45, 0x9b, 0xf0, 0xb1, 0xf7, 0x21, 0xf9,
-    0x2c, 0x36, 0x7d, 0x25, 0x2c, 0xbc, 0xd5, 0x4a, 0x91, 0x9c, 0xaa, 0x17,
-    0x6c, 0x4d, 0x52, 0xf0, 0x02, 0x9f, 0xaf, 0x29, 0x1e, 0x3b, 0x5b, 0x8b,
-    0xce, 0x99, 0x7b, 0x9a, 0xb9, 0x67, 0x23, 0x0e, 0x32, 0x1f, 0xd7, 0x72,
-    0x69, 0xf4, 0x90, 0xc7, 0x63, 0x85, 0x2a, 0x65, 0xaa, 0xbe, 0x3d, 0x9c,
-    0x35, 0x01, 0xdf, 0x26, 0xd3, 0xac, 0x2a, 0x52, 0x3d, 0xc0, 0x19, 0x3b,
-    0xa7, 0x45, 0x4f, 0xb2, 0xe5, 0x63, 0xc7, 0xaf, 0xf4, 0xc2, 0x81, 0x8b,
-    0x4f, 0x5a, 0xb9, 0x82, 0xa4, 0x29, 0x3c, 0xa1, 0x2b, 0xc2, 0xd3, 0xd0,
-    0xa5, 0xd9, 0xc8, 0x84, 0xa9, 0xfa, 0x81, 0x6c, 0x03, 0x3a, 0xc7, 0xcb,
-    0x6c, 0x36, 0x5f, 0x94, 0x6c, 0xfc, 0x1e, 0x2b, 0xf1, 0x29, 0x42, 0x0d,
-    0x71, 0x72, 0x3e, 0x67, 0x79, 0x79, 0xf7, 0x73, 0x3c, 0x5d, 0x30, 0x3c,
-    0x8f, 0xa0, 0xf6, 0xae, 0x6f, 0xef, 0xd6, 0xe3, 0x9c, 0x91, 0x1c, 0x0a,
-    0x68, 0xf1, 0x07, 0x3f, 0x80, 0xfa, 0x49, 0xfe, 0x50, 0xd3, 0x07, 0x0b,
-    0x38, 0xce, 0xb5, 0x33, 0xcd, 0x69, 0xcd, 0xd0, 0x90, 0x6d, 0xcc, 0x87,
-    0x3d, 0x34, 0x99, 0x80, 0xb5, 0xe9, 0x30, 0xac, 0x5e, 0x66, 0x4a, 0xbe,
-    0x26, 0x97, 0xc2, 0xf4, 0xa0, 0xc9, 0x0f, 0x74, 0x52, 0xcd, 0xff, 0xfa,
-    0x84, 0x6e, 0xc2, 0xeb, 0xfb, 0xcf, 0xa4, 0x9c, 0xb4, 0x4a, 0xb3, 0x0b,
-    0x06, 0x8c, 0x00, 0x45, 0x8c, 0x18, 0x05, 0xd9, 0x1e, 0x06, 0xa4, 0x58,
-    0xc4, 0x3d, 0x0a, 0x7a, 0x14, 0xf8, 0x82, 0xa3, 0x02, 0xd1, 0xa7, 0x3e,
-    0x97, 0xd8, 0xe4, 0x8e, 0x43, 0x4d, 0xaf, 0xe7, 0x07, 0x49, 0x94, 0x2b,
-    0x73, 0x5f, 0xad, 0xf6, 0x54, 0xfd, 0x62, 0x13, 0x5f, 0xf4, 0xef, 0xa5,
-    0xa0, 0xc4, 0xf1, 0xd1, 0x8f, 0x92, 0x0e, 0x75, 0xa5, 0x21, 0x4c, 0x86,
-    0x79, 0x17, 0x78, 0x72, 0xca, 0xb0, 0x6b, 0x6f, 0xab, 0xe7, 0x87, 0x39,
-    0x2d, 0x54, 0x34, 0xd0, 0x16, 0x59, 0x4f, 0x54, 0x76, 0x8c, 0x9f, 0xd5,
-    0x7a, 0x23, 0x14, 0x46, 0xfe, 0xa0, 0xe2, 0x82, 0x03, 0x0f, 0x5d, 0x76,
-    0x92, 0x9d, 0x78, 0xbe, 0x5f, 0x31, 0xc2, 0x12, 0x8c, 0x29, 0x12, 0xb5,
-    0x9e, 0x3f, 0x20, 0x09, 0xc6, 0xf7, 0x57, 0xf0, 0x0f, 0x65, 0x41, 0x7c,
-    0x1e, 0xaf, 0x91, 0x7a, 0xea, 0x99, 0x24, 0x1c, 0x7a, 0x60, 0x15, 0xc3,
-    0xe7, 0xe6, 0xe5, 0x73, 0x6e, 0x2c, 0x80, 0x00, 0x68, 0xc3, 0x24, 0x6f,
-    0x29, 0x3c, 0x3c, 0xfa, 0xc8, 0x86, 0x89, 0x01, 0x8d, 0x81, 0xe4, 0xd6,
-    0xc3, 0xb4, 0x82, 0x19, 0x1e, 0x8b, 0xcb, 0x19, 0x72, 0xe0, 0x2c, 0x52,
-    0x7d, 0x3f, 0xf5, 0xfd, 0xe7, 0x5b, 0xe5, 0xf9, 0x0d, 0x52, 0x94, 0x9b,
-    0xa1, 0x20, 0x91, 0x27, 0xf3, 0x14, 0x30, 0x55, 0xaa, 0x2f, 0xed, 0xcb,
-    0x9f, 0xe1, 0x9f, 0xea, 0x7e, 0xe2, 0x7c, 0x27, 0xc9, 0xb8, 0xb5, 0x9f,
-    0x51, 0x51, 0xd4, 0x54, 0x22, 0x08, 0xc1, 0x47, 0x1b, 0xe4, 0xea, 0x6a,
-    0xca, 0x6c, 0x2c, 0xaa, 0x9d, 0xcb, 0x48, 0x40, 0x0f, 0x3c, 0x7e, 0x82,
-    0x5f, 0x31, 0x1c, 0x7d, 0x10, 0x3c, 0x3b, 0x1f, 0xa2, 0x2f, 0x37, 0x5b,
-    0xa2, 0xd9, 0xd8, 0xc5, 0xd9, 0x71, 0xe5, 0x6d, 0x9e, 0xb3, 0x1b, 0x1b,
-    0x59, 0x2d, 0x75, 0x91, 0x05, 0xb5, 0x92, 0x6c, 0x51, 0x08, 0x36, 0xf1,
-    0x9e, 0x4b, 0x00, 0x10, 0x5f, 0x52, 0x11, 0x02, 0x89, 0x81, 0x47, 0x2b,
-    0xa0, 0x63, 0xb3, 0xdb, 0xf2, 0xe1, 0xfe, 0xb0, 0xd6, 0xc3, 0x7d, 0xe1,
-    0x79, 0xa9, 0xcd, 0xc0, 0xe9, 0xa1, 0x2b, 0xa4, 0x32, 0x40, 0x87, 0x9b,
-    0xf0, 0x50, 0x17, 0x05, 0x03, 0xb9, 0xf5, 0x24, 0x4e, 0xbc, 0x8a, 0x08,
-    0x66, 0x1c, 0x1b, 0xd3, 0x80, 0xac, 0x0c, 0xd0, 0x9b, 0x68, 0x04, 0xcc,
-    0x1b, 0x0a, 0x92, 0xab, 0xfb, 0x08, 0xd1, 0x64, 0x83, 0xcd, 0xd2, 0xd6,
-    0xf9, 0xa7, 0xe6, 0xa6, 0x8c, 0xca, 0xed, 0x7a, 0xe8, 0x52, 0xd8, 0xbd,
-    0x42, 0xfb, 0x57, 0x72, 0x22, 0x19, 0x70, 0xe2, 0xba, 0xa1, 0xeb, 0xee,
-    0xb0, 0xc6, 0x24, 0x25, 0x68, 0x95, 0x36, 0xc0, 0x9d, 0xaf, 0xb3, 0x24,
-    0xf5, 0x80, 0x4d, 0x8b, 0x59, 0xe3, 0x11, 0x93, 0x82, 0x60, 0xf2, 0x98,
-    0x4e, 0x7a, 0x8c, 0x6a, 0x1f, 0x64, 0x1d, 0xe9, 0xb3, 0xf7, 0x98, 0x05,
-    0x01, 0x9b, 0x22, 0x7d, 0x5f, 0x0a, 0x19, 0x3a, 0xa7, 0xa5, 0x43, 0x14,
-    0xc6, 0x5d, 0x77, 0x74, 0x1e, 0xc0, 0xfc, 0x1b, 0xbe, 0xe4, 0x8b, 0x80,
-    0x1c, 0xfb, 0xdc, 0x3d, 0x27, 0xf2, 0x58, 0x60, 0xc2, 0xe3, 0x4a, 0x8b,
-    0x72, 0xf1, 0xf5, 0x8d, 0xd9, 0xde, 0x16, 0x9a, 0x32, 0x6e, 0x4e, 0xed,
-    0x39, 0x17, 0x0e, 0xbe, 0xca, 0x7e, 0x68, 0x74, 0x02, 0xea, 0xff, 0xad,
-    0x34, 0xd2, 0xbf, 0xd1, 0xa0, 0x51, 0x6e, 0x26, 0xb7, 0xc6, 0xfa, 0xd0,
-    0xb5, 0x5d, 0x7b, 0xb3, 0xac, 0x96, 0xda, 0x4d, 0xa5, 0x8a, 0x07, 0x95,
-    0xd5, 0x3e, 0x07, 0x61, 0x69, 0x6c, 0x41, 0x15, 0x83, 0xf3, 0x0f, 0x50,
-    0x36, 0x56, 0x2b, 0x16, 0x3c, 0x0a, 0xe6, 0xb4, 0x42, 0x76, 0x6e, 0xa2,
-    0x11, 0x1e, 0x6c, 0xae, 0xa5, 0xb3, 0xe3, 0x9c, 0xbb, 0x12, 0xe0, 0x03,
-    0xd5, 0x18, 0xb1, 0xec, 0x77, 0xda, 0x0c, 0x54, 0x97, 0xc9, 0x3f, 0x48,
-    0x2d, 0x10, 0xe0, 0x37, 0x01, 0x30, 0x66, 0x18, 0x45, 0xe1, 0x70, 0x13,
-    0x8b, 0x74, 0x22, 0x8c, 0x06, 0x09, 0x2d, 0xbe, 0xcf, 0x88, 0xe2, 0x44,
-    0x3a, 0xee, 0x4e, 0x7d, 0x64, 0xfb, 0x63, 0xe0, 0x76, 0x9e, 0xec, 0x99,
-    0x81, 0x6b, 0x20, 0x0f, 0x6c, 0x4b, 0xa5, 0x83, 0xd0, 0x34, 0x60, 0xc2,
-    0xd4, 0xe1, 0x49, 0x5f, 0x77, 0xa0, 0x47, 0xf9, 0xf0, 0x0e, 0xc5, 0x04,
-    0x6c, 0xe6, 0x4d, 0x3c, 0xb5, 0x31, 0x4d, 0x83, 0x12, 0x3d, 0x41, 0x40,
-    0x74, 0xd8, 0x80, 0x7a, 0x56, 0x3b, 0x54, 0xbb, 0x37, 0xa8, 0xc8, 0x48,
-    0xc0, 0x32, 0x89, 0x8f, 0x94, 0x8b, 0x8e, 0x8b, 0x1a, 0xb8, 0x52, 0x22,
-    0x77, 0xe5, 0x0f, 0xea, 0x0c, 0x15, 0x21, 0x4d, 0x96, 0xb2, 0x9b, 0xd1,
-    0x5b, 0x72, 0xae, 0xdf, 0x6e, 0x71, 0x2b, 0x51, 0x67, 0x6c, 0xbc, 0xf6,
-    0x25, 0x21, 0xd3, 0x70, 0x6e, 0x35, 0x98, 0x1c, 0x3e, 0xe0, 0xb1, 0x36,
-    0xf5, 0x8a, 0x33, 0x22, 0xbf, 0xcc, 0xff, 0x22, 0xa9, 0x2c, 0xd6, 0x96,
-    0x21, 0xc7, 0xeb, 0xf2, 0x1e, 0xf1, 0x8c, 0x2f, 0x8f, 0x64, 0xea, 0x9d,
-    0x94, 0xa8, 0xb2, 0x10, 0x54, 0x22, 0x7a, 0xa8, 0x3f, 0xed, 0xd2, 0xcf,
-    0x98, 0x76, 0xe5, 0x0f, 0x2d, 0x87, 0x28, 0xbe, 0xf1, 0x97, 0x51, 0xe9,
-    0xcf, 0x7a, 0x00, 0x3c, 0x24, 0x2e, 0x93, 0x91, 0x4b, 0x2e, 0x6a, 0x94,
-    0x41, 0xf2, 0x91, 0x53, 0x52, 0x4e, 0xc1, 0xaa, 0x13, 0xc9, 0xc8, 0x95,
-    0xef, 0x02, 0x93, 0xa2, 0x88, 0x55, 0x13, 0x74, 0xa1, 0xd0, 0x41, 0x74,
-    0xad, 0x6b, 0xf9, 0xca, 0xae, 0x63, 0x59, 0xe3, 0x14, 0x6a, 0xab, 0x62,
-    0x03, 0xa0, 0xca, 0x29, 0x16, 0x75, 0xa3, 0x62, 0x20, 0x37, 0x46, 0x74,
-    0x49, 0xab, 0xe9, 0xf1, 0x35, 0xf4, 0xd6, 0x03, 0xcd, 0xed, 0x80, 0x6c,
-    0xe3, 0x05, 0x06, 0x1a, 0x03, 0x37, 0x7c, 0x39, 0xc5, 0x1f, 0x62, 0xfe,
-    0x11, 0x76, 0xc7, 0x93, 0x38, 0xc8, 0xdf, 0x8e, 0x2d, 0x69, 0xc5, 0x3b,
-    0x23, 0xd0, 0x3e, 0xae, 0xd8, 0x2f, 0x3f, 0x10, 0x9c, 0x02, 0xec, 0xb4,
-    0x44, 0xe0, 0x88, 0xfc, 0x5f, 0x45, 0x3e, 0x0f, 0xf4, 0xfe, 0x3e, 0x2e,
-    0x27, 0x5d, 0x8a, 0x60, 0xf6, 0x30, 0x1a, 0x17, 0xb2, 0xfc, 0x40, 0x44,
-    0x5c, 0x6b, 0x45, 0x3c, 0xcf, 0x5f, 0x83, 0x42, 0x52, 0x14, 0x61, 0x23,
-    0x30, 0xc6, 0xf4, 0x30, 0x1f, 0xf7, 0x55, 0xef, 0x05, 0xba, 0x4d, 0xec,
-    0x67, 0xf7, 0x14, 0x54, 0x23, 0x83, 0x59, 0x2a, 0x7a, 0xe2, 0xc6, 0xc2,
-    0xd9, 0x0b, 0x1e, 0x74, 0xdc, 0x50, 0xf3, 0x53, 0xbb, 0x9a, 0x0f, 0xb3,
-    0x93, 0xc7, 0xeb, 0x7a, 0xb7, 0x5c, 0x99, 0xbe, 0x5f, 0x03, 0xc2, 0xd8,
-    0xfb, 0x1a, 0x54, 0x86, 0x17, 0xa1, 0x69, 0x69, 0xba, 0x27, 0x91, 0xa9,
-    0xd5, 0x93, 0x62, 0x38, 0xa9, 0xa4, 0x39, 0x3e, 0x39, 0x06, 0x72, 0x1e,
-    0xfc, 0x97, 0x01, 0x41, 0xeb, 0x4b, 0xc6, 0x50, 0x64, 0x9f, 0x89, 0xd8,
-    0xde, 0x61, 0x16, 0xa1, 0x29, 0xbf, 0x03, 0x92, 0x73, 0x87, 0x47, 0xb6,
-    0x86, 0xed, 0x76, 0x23, 0xb7, 0x9c, 0x6a, 0x4e, 0x89, 0x23, 0x7a, 0xd8,
-    0x5c, 0xfa, 0xf7, 0x9c, 0x4a, 0x9e, 0x95, 0x7e, 0x09, 0x62, 0x8c, 0x0f,
-    0x82, 0x5f, 0xc3, 0x6c, 0x07, 0x06, 0xba, 0x90, 0x03, 0x5d, 0x04, 0x98,
-    0x09, 0xa9, 0x81, 0xfb, 0xe5, 0xe3, 0x5d, 0xd0, 0x78, 0x0f, 0x5a, 0xb9,
-    0xbc, 0x35, 0x20, 0xc9, 0x07, 0x10, 0xfb, 0x3b, 0x11, 0x0c, 0xb5, 0x93,
-    0x21, 0x6b, 0xe6, 0x41, 0x69, 0x36, 0x26, 0x3f, 0x14, 0x2a, 0x11, 0x77,
-    0x70, 0xa0, 0x29, 0x80, 0x34, 0x11, 0xea, 0x6a, 0x74, 0xad, 0x1a, 0xd7,
-    0xae, 0x10, 0x41, 0x3d, 0xe4, 0x56, 0xa4, 0x53, 0x65, 0x4b, 0xf7, 0x14,
-    0x9b, 0xad, 0xfa, 0xbd, 0x5a, 0xcd, 0x6a, 0xae, 0xde, 0x80, 0x39, 0x72,
-    0x45, 0xa0, 0x0d, 0x52, 0xfe, 0x27, 0x1e, 0x8f, 0x8d, 0xbe, 0x6b, 0xf9,
-    0x98, 0xb6, 0x2b, 0x1f, 0x4a, 0x28, 0x9d, 0xd0, 0x0f, 0xfc, 0xfb, 0x53,
-    0xf4, 0xec, 0x72, 0xbe, 0x77, 0x25, 0x94, 0x64, 0x4d, 0xcf, 0x13, 0xc2,
-    0x7b, 0xf7, 0x63, 0xb1, 0xb3, 0x7b, 0x65, 0x97, 0xdf, 0x52, 0x5d, 0x94,
-    0x2b, 0xf6, 0xd0, 0xe5, 0x7b, 0x5a, 0xb9, 0x5b, 0xb9, 0x50, 0x0f, 0x4e,
-    0x2b, 0xb7, 0xf3, 0x95, 0x90, 0x18, 0x3b, 0x1e, 0xe8, 0x69, 0x0e, 0x2a,
-    0x6a, 0xfe, 0xce, 0xa9, 0xd0, 0xc1, 0x40, 0x47, 0x00, 0x7a, 0xe6, 0x80,
-    0x96, 0x92, 0xd8, 0x58, 0xea, 0x46, 0x85, 0xbf, 0x7d, 0xa1, 0xe2, 0xa8,
-    0xbc, 0x0a, 0x2b, 0xb9, 0xaa, 0x3c, 0x05, 0x83, 0x53, 0xb9, 0xf4, 0x40,
-    0x11, 0x66, 0xa7, 0x8f, 0x59, 0xfa, 0x69, 0x74, 0x5a, 0x09, 0x6f, 0xcc,
-    0x08, 0x70, 0x01, 0x40, 0x71, 0xa2, 0xf3, 0x53, 0x19, 0xfa, 0xb3, 0x5e,
-    0x57, 0x96, 0x8b, 0xb9, 0x71, 0x4a, 0xd8, 0x73, 0x3a, 0x7c, 0x84, 0x58,
-    0x52, 0xb7, 0x47, 0x4c, 0xfb, 0x31, 0x33, 0xf5, 0x72, 0xb2, 0x7c, 0xb6,
-    0x98, 0xba, 0x4d, 0x60, 0x52, 0x83, 0xd9, 0x2d, 0xb1, 0x09, 0x33, 0x2a,
-    0x07, 0x84, 0xc8, 0x58, 0xfb, 0xd5, 0x66, 0xf0, 0x17, 0x99, 0x3f, 0x18,
-    0x5a, 0x91, 0x30, 0xbd, 0xa5, 0x1c, 0x12, 0x73, 0x75, 0xab, 0xca, 0x72,
-    0x03, 0x54, 0x2f, 0x35, 0xcd, 0x84, 0x55, 0x46, 0x43, 0xdd, 0xb1, 0xcc,
-    0x51, 0x44, 0x82, 0xc2, 0x13, 0xd8, 0xb0, 0x41, 0xd7, 0xb2, 0x65, 0x54,
-    0xae, 0xc3, 0xb6, 0x42, 0x4f, 0x49, 0xfd, 0x42, 0x0e, 0xdf, 0xb5, 0x5c,
-    0xcc, 0x1b, 0x14, 0x50, 0x8f, 0x5e, 0x0d, 0xd6, 0x7e, 0xf4, 0x72, 0xa8,
-    0x6b, 0x75, 0x3d, 0xbf, 0x3c, 0x7a, 0x3d, 0xd8, 0x74, 0xf3, 0x82, 0x02,
-    0x25, 0xfd, 0x2b, 0x5f, 0x50, 0xfd, 0x6b, 0x04, 0x75, 0x2b, 0xdb, 0x6a,
-    0x2a, 0xe1, 0x1d, 0x08, 0xb3, 0x4f, 0x57, 0x64, 0x84, 0x77, 0xb8, 0xd6,
-    0x67, 0xf2, 0xe8, 0xb3, 0x08, 0x34, 0x97, 0x26, 0x04, 0x92, 0x95, 0x3f,
-    0xd4, 0xf5, 0x82, 0xb0, 0x56, 0x8f, 0x6a, 0x81, 0x89, 0x1a, 0x50, 0x44,
-    0xe7, 0xe2, 0xdf, 0x4e, 0x33, 0x7e, 0x3c, 0xe5, 0x73, 0x65, 0xa7, 0xbe,
-    0x85, 0x05, 0xe4, 0x0e, 0x92, 0x21, 0x10, 0xda, 0xd1, 0xc6, 0xda, 0x58,
-    0x43, 0x54, 0x27, 0xbd, 0x6a, 0x47, 0xaf, 0xcd, 0x48, 0x9b, 0xa4, 0x06,
-    0xca, 0x0f, 0xc9, 0xf3, 0x18, 0x6c, 0xd9, 0x8a, 0x34, 0x91, 0x87, 0x9a,
-    0xd1, 0x4c, 0xd4, 0x76, 0x8f, 0x51, 0xe8, 0xd6, 0x52, 0xe3, 0x7c, 0x67,
-    0x38, 0xb8, 0x37, 0xfa, 0x46, 0xa4, 0x47, 0xaa, 0x6c, 0x6e, 0xc5, 0x6a,
-    0xc5, 0x3d, 0x8c, 0x03, 0x3c, 0x91, 0x11, 0x5b, 0x50, 0xd6, 0xf0, 0xdf,
-    0xde, 0xae, 0x35, 0xc8, 0x1a, 0x52, 0xb5, 0x12, 0x89, 0xae, 0xac, 0x52,
-    0xeb, 0xb0, 0x0e, 0x77, 0x40, 0x74, 0xa1, 0x68, 0x8d, 0x31, 0x2b, 0x31,
-    0x2e, 0x83, 0xbe, 0x39, 0xd9, 0x07, 0x67, 0x66, 0xd4, 0xfa, 0x79, 0x93,
-    0x9b, 0x54, 0xc7, 0x22, 0x79, 0x1d, 0x5d, 0xdb, 0xdd, 0xb5, 0xbb, 0x85,
-    0x01, 0x67, 0xb4, 0xb0, 0x5a, 0x90, 0xd6, 0x38, 0xdc, 0x59, 0x7e, 0xde,
-    0x08, 0xbf, 0x2b, 0x83, 0xd4, 0x3c, 0xcf, 0xe2, 0xde, 0x9a, 0x0c, 0xa4,
-    0xdb, 0x30, 0x3d, 0x73, 0xc9, 0xb9, 0xe0, 0xee, 0x24, 0xe7, 0x61, 0x41,
-    0x39, 0xa6, 0xea, 0x7a, 0x26, 0xe8, 0x94, 0xaa, 0x78, 0xa5, 0x8e, 0xc8,
-    0x00, 0x31, 0x0c, 0xff, 0x08, 0xed, 0x1c, 0xd6, 0x4b, 0x25, 0x7b, 0xe5,
-    0x90, 0xcc, 0x55, 0x49, 0x80, 0xb3, 0xf5, 0xc8, 0xb0, 0x06, 0x36, 0x0e,
-    0x10, 0xa2, 0xf7, 0xfd, 0x01, 0x42, 0x73, 0x58, 0x3d, 0x4b, 0xc7, 0xf0,
-    0xc5, 0x1d, 0x8d, 0xf0, 0xc1, 0x3d, 0x25, 0x36, 0xa0, 0xb1, 0x20, 0xe6,
-    0xcb, 0x2c, 0xa2, 0xf8, 0xaf, 0x7d, 0x0e, 0x04, 0x76, 0x1e, 0x19, 0x9e,
-    0x2a, 0x0a, 0xea, 0x11, 0x87, 0x31, 0x75, 0x0c, 0x62, 0x53, 0x16, 0x9c,
-    0x49, 0x10, 0x55, 0x37, 0xb4, 0x60, 0x05, 0xa4, 0xcd, 0x0d, 0x3d, 0x7b,
-    0x04, 0x62, 0x15, 0x89, 0x27, 0x0d, 0xf3, 0x2d, 0xe2, 0x5a, 0x52, 0x4a,
-    0x87, 0xcb, 0xee, 0x1f, 0x6c, 0x5e, 0x66, 0x22, 0x38, 0x74, 0xc8, 0xb8,
-    0x47, 0x12, 0x4f, 0x95, 0x4b, 0x7e, 0xae, 0xcf, 0xcf, 0x74, 0x3c, 0xa5,
-    0x40, 0x8d, 0xea, 0x24, 0xf0, 0xa0, 0xca, 0x58, 0x9f, 0x92, 0xa5, 0xab,
-    0x95, 0x8c, 0x8c, 0x2a, 0x43, 0xad, 0x2e, 0xd4, 0xcc, 0x22, 0xab, 0xaf,
-    0x38, 0x91, 0xaa, 0xfa, 0x1e, 0xb1, 0xd3, 0xb0, 0xed, 0x4c, 0x2d, 0x8f,
-    0x0a, 0xbc, 0x54, 0xa5, 0xc6, 0x94, 0xb3, 0x08, 0x14, 0xcc, 0x18, 0x56,
-    0x84, 0x5e, 0x33, 0xe1, 0x2e, 0xc3, 0x73, 0x42, 0xcc, 0x22, 0x97, 0x2e,
-    0xf9, 0xd4, 0xc3, 0x3e, 0xe5, 0x90, 0xa3, 0x47, 0x44, 0xc6, 0x6f, 0xb4,
-    0x86, 0x72, 0x30, 0xb5, 0xac, 0xf0, 0x24, 0x63, 0xb2, 0xa4, 0xbb, 0x43,
-    0x8a, 0x4f, 0xb3, 0x8a, 0x7e, 0xdd, 0xca, 0xeb, 0xf0, 0x55, 0xc5, 0xdf,
-    0x3e, 0xc0, 0x53, 0xe9, 0x02, 0x94, 0xd7, 0x17, 0xc2, 0x35, 0x8d, 0xc1,
-    0xaf, 0xe9, 0xf6, 0xb6, 0x1e, 0x1e, 0xea, 0xdf, 0x23, 0x51, 0x54, 0xfe,
-    0xea, 0x3c, 0xea, 0x01, 0x52, 0x30, 0xe5, 0x80, 0xa9, 0x82, 0xda, 0x71,
-    0x42, 0xf1, 0x5d, 0xd0, 0x4a, 0x29, 0xc5, 0x60, 0xa7, 0x14, 0xaf, 0x5c,
-    0x06, 0xc6, 0x84, 0xb7, 0x84, 0x75, 0x5f, 0xf3, 0x91, 0xd5, 0xca, 0x7d,
-    0xff, 0xf2, 0xc7, 0xd7, 0xef, 0x3e, 0xb8, 0x5b, 0x6a, 0xb6, 0x4e, 0xb3,
-    0x18, 0x68, 0x57, 0x92, 0x2b, 0x87, 0xdc, 0x66, 0xbb, 0xd7, 0xf1, 0x4d,
-    0xcc, 0x2f, 0x8c, 0xf2, 0x56, 0x58, 0x86, 0x75, 0x8a, 0x7c, 0xe4, 0x57,
-    0x1e, 0xc5, 0x6e, 0xb6, 0x04, 0x6a, 0x95, 0x27, 0x65, 0x43, 0x23, 0x0d,
-    0xac, 0xe7, 0x32, 0x5e, 0x4c, 0xcb, 0x9f, 0x13, 0xb6, 0x0c, 0x47, 0x03,
-    0xd6, 0x65, 0x60, 0xb7, 0x57, 0xd1, 0x77, 0xb5, 0x1b, 0x91, 0x14, 0x27,
-    0xee, 0xf6, 0x47, 0x82, 0x81, 0x4d, 0xdf, 0x71, 0x3f, 0x64, 0xa0, 0x32,
-    0x72, 0x28, 0xba, 0x3b, 0x5e, 0x3c, 0x74, 0x39, 0x2c, 0x21, 0xf3, 0x1b,
-    0x22, 0x4c, 0xff, 0x3c, 0xb2, 0x7b, 0x56, 0x7d, 0x20, 0x38, 0xa1, 0xe7,
-    0x91, 0x46, 0x03, 0x68, 0xf8, 0xa9, 0xfb, 0x5b, 0x1d, 0xac, 0x17, 0x8d,
-    0x95, 0x6f, 0x1c, 0x0f, 0x8a, 0x17, 0x69, 0xf2, 0x7b, 0xf4, 0x1e, 0x3e,
-    0x00, 0xae, 0x0c, 0xdf, 0xb2, 0x4f, 0xfe, 0x60, 0x64, 0x59, 0x45, 0x77,
-    0x81, 0x20, 0x99, 0xe8, 0x53, 0xb0, 0x5c, 0xd7, 0x72, 0x6f, 0xd4, 0xfd,
-    0x8d, 0x72, 0xc7, 0x01, 0x3f, 0x03, 0x05, 0x16, 0x36, 0xea, 0x3e, 0x01,
-    0xa3, 0x1e, 0xfe, 0x8d, 0xc6, 0xca, 0x21, 0xde, 0x54, 0xb9, 0xef, 0x3a,
-    0xd1, 0x48, 0xf4, 0xd3, 0x1f, 0xc9, 0x98, 0x02, 0xfb, 0xf1, 0x23, 0x62,
-    0xb0, 0xc1, 0xda, 0xdd, 0x56, 0x79, 0x59, 0x0e, 0x76, 0x14, 0xc8, 0x11,
-    0x4f, 0x82, 0xfd, 0x6e, 0x5a, 0xf8, 0x9c, 0x27, 0x7b, 0x19, 0x60, 0x4a,
-    0x0a, 0xea, 0xa1, 0x7a, 0x8d, 0x71, 0x18, 0xfe, 0x6b, 0xe5, 0xf8, 0x60,
-    0xf4, 0x54, 0x0c, 0x1b, 0xf4, 0x54, 0xd0, 0x55, 0xbb, 0x5f, 0x3b, 0x43,
-    0x50, 0xbe, 0xb1, 0x82, 0x43, 0x77, 0x1b, 0xf9, 0x7d, 0x0d, 0x79, 0x17,
-    0xc1, 0x3b, 0x3d, 0x9b, 0x70, 0x73, 0xf7, 0xec, 0xbc, 0xe9, 0x99, 0x51,
-    0x66, 0x0c, 0xab, 0x03, 0xc5, 0x92, 0x90, 0x80, 0xa1, 0x47, 0x03, 0xe5,
-    0x13, 0xe6, 0xa4, 0x05, 0x1a, 0xa5, 0x52, 0x76, 0x15, 0x3e, 0x65, 0x03,
-    0x5f, 0x98, 0x20, 0x93, 0x4a, 0x7d, 0x00, 0x0d, 0x06, 0x14, 0x52, 0x2e,
-    0x5d, 0x2a, 0x29, 0x18, 0x60, 0x27, 0x9d, 0x64, 0xe8, 0x77, 0x48, 0x39,
-    0x4e, 0x79, 0x78, 0xfd, 0x40, 0xea, 0xba, 0x6e, 0xb7, 0x32, 0x91, 0xef,
-    0x81, 0x13, 0xa0, 0x42, 0x93, 0x16, 0x61, 0x1d, 0x88, 0x4c, 0xf1, 0x6a,
-    0x9e, 0x5f, 0x9b, 0x15, 0xeb, 0x96, 0x7b, 0x9b, 0x0e, 0x22, 0xe3, 0x14,
-    0x0f, 0xb8, 0xd0, 0x55, 0x49, 0xb1, 0xac, 0x30, 0x97, 0xad, 0x2d, 0xa6,
-    0xdd, 0x9b, 0xac, 0x6a, 0xbf, 0x20, 0xe7, 0x1f, 0xd4, 0xcd, 0xb9, 0x17,
-    0x50, 0xbd, 0xf9, 0x98, 0xa0, 0xc5, 0x84, 0x21, 0x99, 0x41, 0x11, 0x2c,
-    0xa4, 0xaf, 0x61, 0xe2, 0x25, 0x7e, 0x30, 0x8a, 0x4e, 0xcf, 0x52, 0x3c,
-    0x4b, 0xc4, 0x3f, 0x18, 0xa2, 0x3d, 0x28, 0x6b, 0x9d, 0x7d, 0xd7, 0x6f,
-    0xe3, 0x30, 0x74, 0x35, 0x0a, 0xb9, 0x7b, 0x75, 0xe7, 0x60, 0xea, 0x49,
-    0x0e, 0x25, 0xa3, 0xfa, 0xc5, 0x1d, 0x9b, 0x94, 0x8c, 0xf7, 0x41, 0x8a,
-    0x91, 0x7f, 0x80, 0x1f, 0x04, 0xca, 0x18, 0xfe, 0xd2, 0x82, 0x5e, 0x90,
-    0x3b, 0xcf, 0xe2, 0xf7, 0xef, 0x92, 0x77, 0x89, 0x8d, 0x3f, 0x80, 0xb0,
-    0x61, 0x52, 0x45, 0xc0, 0x0b, 0x45, 0x4c, 0x38, 0x8c, 0x30, 0xf8, 0xdc,
-    0x88, 0x72, 0x61, 0x28, 0x7a, 0x41, 0x63, 0xb0, 0x86, 0xb9, 0xd5, 0x07,
-    0xff, 0x9c, 0x73, 0x79, 0xa8, 0x65, 0x4c, 0xa3, 0x02, 0x98, 0x08, 0x83,
-    0xc9, 0x01, 0x7d, 0xdd, 0xde, 0x45, 0x0d, 0xb6, 0x54, 0x46, 0x37, 0x28,
-    0x42, 0x40, 0xf8, 0xbc, 0x9e, 0xd1, 0xb3, 0x3c, 0x25, 0x19, 0xf9, 0xf1,
-    0x15, 0xfd, 0xdc, 0xd4, 0x7b, 0xd0, 0xb9, 0xe6, 0x6c, 0x0c, 0x22, 0xe8,
-    0x1e, 0xf6, 0x2a, 0x2e, 0xe3, 0x28, 0x13, 0x16, 0x6b, 0x2e, 0x26, 0x01,
-    0x80, 0xef, 0x7e, 0x82, 0x49, 0x14, 0x51, 0x74, 0x37, 0xc4, 0x9b, 0xbc,
-    0xf0, 0xbf, 0x5a, 0x7c, 0x51, 0x89, 0xef, 0x57, 0xa1, 0xd1, 0x11, 0xf7,
-    0x6f, 0xe2, 0x0d, 0x6a, 0x86, 0x21, 0x75, 0xaf, 0x38, 0x2f, 0xf2, 0x30,
-    0x78, 0xbf, 0x80, 0xb1, 0x94, 0xa1, 0xd1, 0xdb, 0xc7, 0x40, 0x5d, 0x4a,
-    0xbb, 0x09, 0x50, 0xb1, 0xb8, 0x3e, 0x3d, 0x92, 0x91, 0xb0, 0x20, 0xef,
-    0x8d, 0xa8, 0x3c, 0x34, 0x0f, 0x12, 0x8c, 0xca, 0x68, 0x84, 0xeb, 0x8d,
-    0x01, 0x12, 0xc8, 0xeb, 0x39, 0x08, 0x02, 0x8c, 0xb5, 0x58, 0xf8, 0x1a,
-    0xa6, 0xcf, 0x78, 0xe0, 0x31, 0x6a, 0x00, 0xf2, 0x1c, 0x11, 0x03, 0x3b,
-    0x06, 0x74, 0xd2, 0xe3, 0xfa, 0x0f, 0xe2, 0x4b, 0x2c, 0xdb, 0xdb, 0x8b,
-    0x85, 0x63, 0xfa, 0xf4, 0x2c, 0x3b, 0x3f, 0x03, 0x0e, 0x7b, 0x1e, 0xb8,
-    0x5c, 0x28, 0x35, 0xe6, 0x8f, 0x77, 0xb9, 0xbb, 0x96, 0x32, 0x0f, 0x5d,
-    0x6e, 0x78, 0x57, 0xa3, 0x5a, 0x42, 0x89, 0x91, 0xc1, 0x6b, 0x6d, 0x11,
-    0x37, 0x1e, 0x4d, 0x5f, 0xf0, 0x8f, 0x04, 0x08, 0x09, 0x24, 0x5e, 0x21,
-    0x20, 0xfc, 0x8e, 0xc3, 0x9b, 0x8d, 0xc9, 0xc7, 0x09, 0xd4, 0x00, 0x2a,
-    0xa4, 0x1f, 0x4c, 0xed, 0x0e, 0x2e, 0x8e, 0xd4, 0x78, 0xef, 0x67, 0x80,
-    0xa4, 0x16, 0xd9, 0x35, 0x6a, 0xd4, 0xa1, 0x8a, 0x80, 0xee, 0xeb, 0x4a,
-    0x54, 0xa8, 0x91, 0x71, 0x1d, 0x90, 0x97, 0xec, 0x3d, 0xba, 0xc0, 0xba,
-    0xf8, 0x43, 0x7b, 0xef, 0xcb, 0x78, 0x36, 0x87, 0x71, 0x95, 0x54, 0x84,
-    0x41, 0xb8, 0x20, 0xf8, 0x96, 0xb8, 0xd5, 0x5e, 0x22, 0x05, 0x53, 0x35,
-    0xd5, 0x2d, 0x44, 0xa9, 0x66, 0x36, 0xde, 0x5a, 0xc4, 0x49, 0x90, 0x2c,
-    0xa0, 0x5d, 0x1f, 0x12, 0x62, 0x25, 0x5d, 0x25, 0x3f, 0x14, 0x0e, 0x39,
-    0x15, 0xcb, 0x10, 0x39, 0x1a, 0x99, 0xa4, 0x9e, 0x7a, 0x36, 0x48, 0x01,
-    0xe5, 0xa0, 0xff, 0x4e, 0xbd, 0xb8, 0x2c, 0x88, 0x17, 0xb4, 0xe5, 0xfb,
-    0x2c, 0x4f, 0xc0, 0x32, 0x8a, 0xa7, 0xb4, 0x4f, 0x61, 0xb9, 0x56, 0xc3,
-    0xf1, 0x13, 0x79, 0x3f, 0x18, 0x98, 0x14, 0x42, 0x01, 0xd6, 0x01, 0x2b,
-    0x27, 0xa5, 0x13, 0xd3, 0x95, 0xbc, 0xba, 0xe1, 0x57, 0x67, 0xb0, 0xcf,
-    0x3b, 0x50, 0xa2, 0xf6, 0x82, 0x5b, 0x71, 0x53, 0xb1, 0x0e, 0x62, 0xe7,
-    0x57, 0x81, 0x2f, 0xa2, 0xa9, 0x72, 0x91, 0x20, 0x58, 0x5a, 0xa4, 0x6c,
-    0xd3, 0x99, 0xba, 0x0e, 0x4e, 0xd1, 0xc9, 0x99, 0xe1, 0x3f, 0x69, 0xe4,
-    0x66, 0x29, 0xfd, 0x5c, 0x4e, 0x42, 0x77, 0xdd, 0x47, 0x60, 0x5c, 0xde,
-    0x53, 0x3a, 0x74, 0x65, 0x76, 0x70, 0x31, 0x5d, 0xe4, 0x22, 0x99, 0x2d,
-    0x4a, 0x17, 0xef, 0xf5, 0xdd, 0xcf, 0xb2, 0x45, 0xc1, 0xe8, 0xe7, 0x61,
-    0x42, 0x97, 0xbe, 0xf1, 0x01, 0x0d, 0x37, 0xa0, 0xcf, 0x29, 0x8b, 0x6f,
-    0x98, 0xcc, 0xc6, 0x06, 0x83, 0x0c, 0x54, 0xb2, 0x64, 0xf4, 0x39, 0xca,
-    0xba, 0x94, 0x39, 0x06, 0xc5, 0x43, 0x7e, 0x2f, 0xe6, 0xf2, 0x0b, 0xb1,
-    0x3b, 0x72, 0xbf, 0xc7, 0x4f, 0x02, 0x5e, 0xe1, 0x22, 0x1e, 0xe2, 0x57,
-    0x74, 0x8f, 0xf1, 0x96, 0xd7, 0x32, 0x42, 0x75, 0xb6, 0x86, 0x02, 0x93,
-    0x6d, 0xd5, 0xf8, 0xd9, 0xd7, 0x8e, 0x4f, 0xb6, 0xb7, 0x6f, 0xcd, 0xfb,
-    0x43, 0x7d, 0xf2, 0xd5, 0x5f, 0x90, 0x03, 0x98, 0xb3, 0x44, 0x0b, 0x22,
-    0x0b, 0xdc, 0x85, 0x3d, 0x1d, 0xca, 0x18, 0x7a, 0xcf, 0xec, 0x09, 0x14,
-    0x70, 0x05, 0xb3, 0xe5, 0xee, 0xe5, 0x5c, 0x47, 0x98, 0xf0, 0x4b, 0x90,
-    0x09, 0xba, 0x2a, 0x59, 0x15, 0xe2, 0x9e, 0x0e, 0x81, 0xe9, 0x2c, 0x52,
-    0x7e, 0x37, 0x09, 0x37, 0x1d, 0x36, 0x5a, 0xae, 0x46, 0x0c, 0x89, 0x0a,
-    0x21, 0x46, 0x9e, 0x85, 0x22, 0x5b, 0x56, 0x1b, 0x94, 0x93, 0x3c, 0x5b,
-    0xd2, 0x1d, 0x3a, 0x34, 0x16, 0x28, 0x2c, 0xdd, 0x73, 0xd9, 0xed, 0x9c,
-    0x8e, 0x5f, 0x9c, 0xea, 0xb9, 0x08, 0x8c, 0x31, 0x44, 0x61, 0x80, 0xf7,
-    0x7b, 0xdb, 0xae, 0x57, 0x70, 0x3b, 0x4c, 0xe6, 0x8a, 0x06, 0x8b, 0xb4,
-    0xd1, 0xc4, 0x68, 0x70, 0x79, 0x29, 0x82, 0xee, 0xa9, 0x3e, 0x28, 0xd9,
-    0x46, 0xff, 0x8a, 0xe3, 0x4c, 0x1b, 0x01, 0x18, 0xe8, 0x9e, 0xcf, 0x4f,
-    0x2a, 0x8a, 0x26, 0xb0, 0xf1, 0x5a, 0xca, 0x7b, 0x4b, 0xf6, 0x1e, 0x7a,
-    0xe2, 0x77, 0xff, 0xc5, 0xaf, 0x78, 0xaf, 0x14, 0x22, 0x7e, 0xb2, 0x9a,
-    0xc6, 0x77, 0x2c, 0x3f, 0xfb, 0xe5, 0xd7, 0xf3, 0x27, 0x2b, 0x71, 0x71,
-    0x16, 0x10, 0x83, 0x0c, 0x4e, 0xcc, 0xf3, 0x77, 0x03, 0xc0, 0x19, 0x5d,
-    0x94, 0x80, 0x7e, 0xda, 0xa0, 0x64, 0x37, 0x40, 0xd9, 0x62, 0x93, 0x6f,
-    0x58, 0x7b, 0x83, 0xdc, 0xe3, 0x0d, 0x8d, 0xfa, 0x96, 0x6a, 0xeb, 0xc1,
-    0x94, 0x1b, 0xf5, 0x53, 0x06, 0x05, 0xec, 0xa1, 0xdd, 0x90, 0xb7, 0x5c,
-    0xc4, 0x6e, 0x3c, 0xae, 0x19, 0xec, 0x89, 0xd6, 0x6e, 0x9a, 0xdc, 0x30,
-    0xfb, 0x1e, 0xd6, 0x8a, 0x0a, 0xb9, 0x31, 0xfc, 0x6a, 0x5e, 0x9e, 0xf6,
-    0x7c, 0x04, 0xf9, 0x98, 0x45, 0x54, 0x09, 0x9f, 0x7e, 0xf2, 0xd8, 0x0e,
-    0xeb, 0x39, 0x3f, 0xd0, 0x65, 0x96, 0x2a, 0xbe, 0x86, 0x20, 0x01, 0x0c,
-    0xc9, 0x2a, 0x63, 0x3c, 0x58, 0xe0, 0x43, 0x18, 0x4a, 0x38, 0x2a, 0x06,
-    0x6a, 0x22, 0x0d, 0x0d, 0x3d, 0x21, 0x97, 0x98, 0x79, 0xf0, 0xc2, 0x11,
-    0x0d, 0xbb, 0x41, 0x9b, 0x1e, 0x65, 0x8b, 0x1f, 0x7a, 0x18, 0x7b, 0xb9,
-    0x5a, 0x5d, 0x80, 0x4d, 0x88, 0x77, 0x8e, 0x80, 0xd9, 0x66, 0xc0, 0x6c,
-    0xb3, 0x28, 0x05, 0xa6, 0x97, 0x00, 0x62, 0xdd, 0xd1, 0x75, 0x5a, 0x62,
-    0xc1, 0x54, 0x4a, 0x37, 0x60, 0x79, 0x31, 0x14, 0xf1, 0x06, 0x94, 0xf3,
-    0x1e, 0x45, 0x95, 0x69, 0xf0, 0x02, 0xa2, 0xc7, 0x50, 0x5a, 0xd8, 0xec,
-    0x9a, 0x19, 0x08, 0x5c, 0x6e, 0x82, 0x05, 0x19, 0x98, 0xd5, 0x76, 0xad,
-    0x0c, 0x26, 0x09, 0x5a, 0x89, 0xb7, 0x68, 0xaa, 0x80, 0x30, 0x01, 0x7c,
-    0x6b, 0xa4, 0x24, 0xfd, 0xcf, 0xef, 0x8a, 0x20, 0x58, 0x90, 0xa2, 0xb9,
-    0x0c, 0xf2, 0xaa, 0xfc, 0x79, 0x20, 0x63, 0xe9, 0x40, 0x19, 0x34, 0xc9,
-    0xa9, 0xb8, 0x42, 0x49, 0xc7, 0x12, 0xc1, 0xfd, 0x68, 0x91, 0xa3, 0x19,
-    0xce, 0x95, 0xc8, 0x30, 0x0d, 0x10, 0x2b, 0xbe, 0x4d, 0x72, 0x90, 0x92,
-    0x39, 0x8c, 0xec, 0x81, 0x11, 0x90, 0xf9, 0x92, 0xdf, 0x04, 0xc0, 0x5f,
-    0xda, 0x58, 0x5c, 0x80, 0x77, 0x9a, 0x6b, 0x15, 0x32, 0xb8, 0x86, 0xb5,
-    0xa1, 0x3e, 0x9d, 0x02, 0xb4, 0x17, 0xab, 0x55, 0xc1, 0xc3, 0xe1, 0xf9,
-    0x9e, 0x5e, 0x5e, 0xaa, 0x68, 0x92, 0x4a, 0x8e, 0xac, 0x6f, 0x66, 0x49,
-    0x9b, 0x59, 0xd6, 0x9b, 0x59, 0x36, 0x37, 0x93, 0xd8, 0x4c, 0x1a, 0xb0,
-    0x7a, 0x27, 0x53, 0xda, 0x49, 0x26, 0x77, 0x92, 0x51, 0x08, 0xa0, 0xba,
-    0x55, 0xfc, 0x74, 0xdc, 0xb2, 0x55, 0xfe, 0xbd, 0x70, 0x1b, 0x09, 0x56,
-    0x57, 0x4d, 0x17, 0xc4, 0xe2, 0xd5, 0x15, 0xcb, 0xad, 0x98, 0x2d, 0xe2,
-    0xd3, 0x56, 0xab, 0xa9, 0x7e, 0xff, 0x0e, 0xe7, 0x3d, 0xed, 0x92, 0x74,
-    0x42, 0x07, 0x0d, 0xd7, 0x90, 0xb9, 0x96, 0xcb, 0xec, 0xb1, 0x07, 0x1c,
-    0x0f, 0xc8, 0x82, 0x01, 0x5b, 0xbd, 0xf9, 0x78, 0x13, 0x0f, 0x4a, 0xa0,
-    0x4a, 0xe7, 0x43, 0x35, 0x81, 0xd7, 0xdd, 0x31, 0x08, 0x0a, 0x63, 0x91,
-    0x69, 0x40, 0x57, 0x8b, 0x99, 0xd1, 0x8a, 0x70, 0x2e, 0xe2, 0xae, 0x88,
-    0x5c, 0xd6, 0x77, 0x71, 0x3a, 0x9e, 0x32, 0x79, 0x2b, 0x5b, 0x5f, 0xb2,
-    0x28, 0x8b, 0x2c, 0x61, 0xd5, 0xf5, 0x9d, 0xf7, 0x36, 0x37, 0x0f, 0x28,
-    0x88, 0x57, 0xb4, 0x21, 0x15, 0x20, 0x52, 0x3f, 0x4c, 0x2b, 0x30, 0x80,
-    0xaa, 0x29, 0x30, 0x17, 0x20, 0x22, 0x76, 0x18, 0xb5, 0xe0, 0x54, 0xb8,
-    0x24, 0x52, 0xdf, 0x7e, 0x9d, 0x07, 0x4d, 0x64, 0x2e, 0xed, 0xc0, 0x34,
-    0xdb, 0x4a, 0x1e, 0x32, 0x3b, 0xb6, 0xb7, 0xab, 0xa7, 0x74, 0x80, 0xc2,
-    0xd6, 0x81, 0x54, 0x56, 0x1c, 0xa9, 0xa5, 0xf0, 0x0f, 0x07, 0x55, 0x17,
-    0x07, 0x9f, 0xcf, 0x70, 0xf8, 0x93, 0x60, 0x0e, 0x77, 0x47, 0x3a, 0x8b,
-    0x94, 0x32, 0x49, 0x2b, 0x71, 0xc6, 0x17, 0x53, 0xfe, 0x51, 0x29, 0x27,
-    0x8e, 0x50, 0x4d, 0x9c, 0x4a, 0x31, 0x71, 0x2a, 0x25, 0xc7, 0x91, 0x7a,
-    0x8d, 0x53, 0xeb, 0x40, 0x4e, 0xad, 0xf7, 0x38, 0xa3, 0x49, 0x9c, 0x5e,
-    0xc1, 0x40, 0xc4, 0xfa, 0x9c, 0xcf, 0xec, 0x8e, 0x3a, 0x84, 0xbf, 0x20,
-    0x8f, 0x8a, 0x02, 0x3f, 0xa0, 0x5f, 0x66, 0xde, 0x29, 0xb3, 0x78, 0x27,
-    0xfd, 0xfb, 0xa9, 0xe9, 0x91, 0x2c, 0x37, 0x46, 0x6b, 0xa1, 0xf4, 0xa6,
-    0x98, 0x6e, 0xee, 0xa3, 0x13, 0xbb, 0x8d, 0xe7, 0xcd, 0x6b, 0xd4, 0x31,
-    0x68, 0xb7, 0x0c, 0x74, 0xe7, 0x58, 0x0e, 0xe8, 0x8e, 0xe1, 0x97, 0x3e,
-    0xed, 0x91, 0xb4, 0x5d, 0x2b, 0xd6, 0x2e, 0xe2, 0x6c, 0x69, 0xaf, 0x33,
-    0xb2, 0xb0, 0x5d, 0xa1, 0x9f, 0xe1, 0x51, 0xc4, 0x56, 0x0f, 0x95, 0x29,
-    0xe6, 0x4b, 0xcf, 0x58, 0xc2, 0xe3, 0xa5, 0xdc, 0x8b, 0xc5, 0xc5, 0xc5,
-    0x94, 0x15, 0x80, 0xe9, 0xc9, 0x10, 0x6a, 0x6d, 0xb1, 0xb3, 0xe4, 0x3c,
-    0x4c, 0xe1, 0x9f, 0x08, 0xbf, 0x06, 0xca, 0xc3, 0x0c, 0x49, 0x29, 0x90,
-    0x18, 0xb4, 0x84, 0xad, 0x9e, 0x1f, 0xdc, 0xe0, 0x15, 0x90, 0xb5, 0xa7,
-    0xfa, 0x65, 0x5e, 0x4c, 0x14, 0xc7, 0xcc, 0xab, 0x49, 0x53, 0xd9, 0xe8,
-    0x5e, 0x4d, 0xb3, 0x8b, 0x78, 0x3a, 0x04, 0xec, 0x04, 0x24, 0xfb, 0x69,
-    0x12, 0x20, 0x23, 0x8f, 0x01, 0x1b, 0x8b, 0xe8, 0xc5, 0x44, 0xe0, 0x29,
-    0xf0, 0xe2, 0x17, 0x68, 0xf9, 0x57, 0x80, 0x01, 0x76, 0x0c, 0xb8, 0x56,
-    0x58, 0x54, 0x7c, 0xaf, 0x62, 0x79, 0x03, 0x41, 0x16, 0xe8, 0x40, 0xa8,
-    0x55, 0xfe, 0xbf, 0x4f, 0x54, 0x85, 0x53, 0x04, 0x8a, 0xde, 0x56, 0xc6,
-    0x3a, 0x5e, 0x50, 0x62, 0x22, 0xd4, 0xf5, 0x3d, 0xf0, 0x64, 0x79, 0x93,
-    0x02, 0xdb, 0x00, 0xfb, 0xc3, 0xe2, 0x57, 0x13, 0xba, 0x74, 0xee, 0xc6,
-    0xd7, 0xf1, 0xed, 0x8b, 0xaa, 0xa2, 0x1b, 0x9c, 0x41, 0x9d, 0x73, 0x89,
-    0xde, 0x6a, 0x25, 0xb5, 0xb8, 0x9e, 0xc8, 0x77, 0x0a, 0x2c, 0xb8, 0xb3,
-    0x29, 0x95, 0x93, 0xc1, 0xeb, 0x11, 0xc5, 0x62, 0x34, 0x02, 0xa4, 0x73,
-    0xc1, 0xcc, 0x17, 0x9f, 0x7c, 0x2a, 0xe8, 0x15, 0xc9, 0x50, 0x24, 0x03,
-    0x53, 0xc2, 0x13, 0x83, 0x22, 0x9b, 0xde, 0xf0, 0x10, 0xd3, 0x04, 0x87,
-    0xc8, 0x70, 0x90, 0xe0, 0x15, 0x3e, 0x01, 0x91, 0x88, 0xd1, 0x45, 0x47,
-    0x20, 0x2a, 0xf0, 0x94, 0x13, 0x4a, 0xff, 0x31, 0xf1, 0xb2, 0x40, 0x7f,
-    0xc1, 0xe9, 0x75, 0x35, 0x99, 0xda, 0x5c, 0xce, 0x6b, 0xd8, 0x74, 0x09,
-    0xe9, 0xc5, 0x03, 0x15, 0x24, 0xaa, 0x4b, 0x92, 0x81, 0x68, 0x9f, 0x21,
-    0x73, 0xa5, 0xf1, 0xb3, 0xe0, 0x8c, 0x4a, 0xf8, 0xf8, 0x39, 0x4c, 0x85,
-    0xc6, 0xe7, 0x77, 0x30, 0xb1, 0x0c, 0x44, 0xeb, 0x6a, 0xc5, 0xf8, 0x04,
-    0xf8, 0xc2, 0xeb, 0x09, 0xfc, 0x63, 0x62, 0x3c, 0xe1, 0x51, 0x43, 0x63,
-    0x80, 0x5f, 0xfc, 0x39, 0x1d, 0x09, 0x02, 0x1a, 0x5f, 0x5d, 0xe4, 0x4b,
-    0x51, 0x81, 0xaf, 0x12, 0x86, 0xf0, 0x72, 0xd0, 0x0a, 0x04, 0x6a, 0xc1,
-    0xbe, 0x75, 0x3a, 0x80, 0x4b, 0xfc, 0xfd, 0x9d, 0xed, 0x6d, 0x9a, 0x1d,
-    0xa9, 0xea, 0x1c, 0x40, 0x74, 0x70, 0x56, 0x4f, 0xe5, 0xcd, 0x04, 0x6f,
-    0x0a, 0x57, 0xc9, 0xb7, 0x13, 0xed, 0x5d, 0x32, 0x7a, 0x38, 0xaa, 0x0c,
-    0xbd, 0x72, 0xc7, 0xdd, 0x76, 0x77, 0x98, 0xf2, 0x4e, 0xda, 0xd9, 0xf6,
-    0xf0, 0xfc, 0x7e, 0x2f, 0xe8, 0xaf, 0x77, 0x03, 0x77, 0xa8, 0x76, 0xf8,
-    0xae, 0x89, 0xf5, 0x30, 0x9b, 0xda, 0xf8, 0xa3, 0xab, 0x29, 0x38, 0xe1,
-    0x80, 0xbf, 0x7f, 0xc0, 0xd1, 0x17, 0x51, 0x5e, 0xad, 0x84, 0x72, 0x54,
-    0x54, 0x92, 0x15, 0xee, 0x17, 0xf9, 0x34, 0x2c, 0x79, 0x48, 0x1c, 0x0b,
-    0x04, 0x9a, 0x80, 0xc6, 0x80, 0x19, 0x68, 0x67, 0x84, 0x22, 0x54, 0xe5,
-    0xc7, 0x49, 0xf0, 0x7e, 0x12, 0x7c, 0x98, 0x44, 0x3b, 0x68, 0x81, 0xa0,
-    0x89, 0x1e, 0xfc, 0x34, 0x51, 0x9f, 0xa2, 0xfa, 0x79, 0x12, 0xed, 0x8a,
-    0x57, 0x0b, 0x3f, 0x5e, 0x9c, 0xfd, 0xeb, 0xf8, 0xfc, 0x6b, 0x6f, 0x18,
-    0x7a, 0xc3, 0xad, 0xe3, 0x8f, 0xbb, 0xe2, 0x2d, 0x43, 0xff, 0x98, 0xb2,
-    0xfd, 0xaf, 0xeb, 0x2c, 0x7c, 0xdb, 0xe9, 0x9f, 0x13, 0xfe, 0xb8, 0x13,
-    0xee, 0xd3, 0x0a, 0x75, 0x92, 0x64, 0x44, 0xdc, 0xde, 0xff, 0xa8, 0xf8,
-    0xb5, 0x77, 0x93, 0xe0, 0x97, 0xf6, 0x7a, 0xb7, 0xb3, 0x29, 0x54, 0xf8,
-    0x75, 0x12, 0xb9, 0x4a, 0xfe, 0xee, 0x75, 0x01, 0xa2, 0x36, 0xf8, 0x0d,
-    0x72, 0xc9, 0x49, 0xce, 0x5f, 0x84, 0x7a, 0x32, 0xe1, 0x8f, 0x59, 0x3d,
-    0xd9, 0x0d, 0x3e, 0x4d, 0xa2, 0x9f, 0x26, 0xe6, 0x0b, 0x49, 0xb1, 0xeb,
-    0x0f, 0x3e, 0x4d, 0xba, 0x93, 0x9c, 0x5d, 0xa2, 0x7f, 0x29, 0xe3, 0x7d,
-    0x51, 0x3a, 0xa8, 0xf6, 0x3f, 0xea, 0xd1, 0x37, 0x6c, 0x3c, 0xde, 0x34,
-    0x7e, 0x67, 0x88, 0x52, 0x72, 0xa0, 0xb9, 0xc8, 0x4c, 0x5d, 0x7a, 0x4c,
-    0xc2, 0xaf, 0x37, 0x0c, 0x9b, 0x60, 0x48, 0xa0, 0x64, 0x2b, 0x25, 0xa0,
-    0x28, 0x4e, 0x73, 0xfe, 0x12, 0x90, 0x12, 0x9f, 0x89, 0x04, 0xae, 0xe5,
-    0xe9, 0x7b, 0x86, 0x37, 0xbf, 0x30, 0xf6, 0x19, 0xb6, 0xce, 0x25, 0x3f,
-    0xb6, 0xbb, 0xf3, 0x61, 0xb2, 0xb3, 0x03, 0xac, 0xad, 0x39, 0x79, 0x71,
-    0x06, 0xe0, 0x07, 0x8b, 0x68, 0x74, 0x16, 0xe3, 0x81, 0xb2, 0x2a, 0x3b,
-    0x80, 0xfd, 0x35, 0x35, 0x04, 0x97, 0xcb, 0x22, 0x24, 0x2b, 0x37, 0xbe,
-    0xc8, 0xf2, 0x92, 0x0c, 0x48, 0x30, 0xb9, 0xf1, 0x3b, 0x64, 0xb5, 0x59,
-    0x8b, 0xac, 0x02, 0x44, 0xf4, 0x2c, 0x29, 0x98, 0x37, 0x25, 0x5e, 0x0a,
-    0x9d, 0x41, 0xc7, 0x2e, 0x89, 0x52, 0xd1, 0x8b, 0x2e, 0x5e, 0x46, 0x20,
-    0x12, 0xf3, 0x0f, 0xc9, 0x0c, 0xc5, 0xa5, 0xe0, 0xbf, 0x05, 0x05, 0xe6,
-    0x79, 0xf5, 0xf9, 0x4b, 0x20, 0x26, 0xb0, 0x15, 0xc9, 0x23, 0x8d, 0x64,
-    0x08, 0x6c, 0x2d, 0x41, 0xf7, 0xf1, 0x94, 0x3f, 0x34, 0x07, 0x8c, 0x85,
-    0x28, 0x0d, 0xcf, 0x46, 0xc4, 0x38, 0xbc, 0x24, 0xc0, 0x45, 0x46, 0x0b,
-    0xe4, 0x22, 0x3a, 0xcc, 0x16, 0x40, 0x0c, 0x0b, 0xea, 0x03, 0x41, 0x91,
-    0x44, 0x95, 0xfe, 0x4a, 0xca, 0x22, 0xb0, 0x6f, 0xb4, 0xb0, 0x87, 0xcc,
-    0x93, 0x2b, 0x0e, 0x3d, 0xea, 0x49, 0x3d, 0xa8, 0xaf, 0xaf, 0x3d, 0xaf,
-    0x83, 0x02, 0x0f, 0x52, 0x60, 0xa7, 0x80, 0x54, 0x6a, 0x52, 0xfd, 0x38,
-    0xf4, 0xba, 0x3b, 0x7e, 0xf4, 0x71, 0x88, 0xa4, 0xfa, 0x64, 0x2f, 0x72,
-    0x77, 0x40, 0x9c, 0xc0, 0x96, 0xe0, 0x73, 0x5f, 0xda, 0x25, 0x94, 0xc2,
-    0x0f, 0xf0, 0x66, 0x57, 0xc9, 0xe1, 0x40, 0x36, 0x45, 0xc1, 0x4a, 0x09,
-    0x16, 0x65, 0x4c, 0x98, 0x8f, 0xa8, 0x44, 0x01, 0xe9, 0xb2, 0x05, 0xbe,
-    0x2a, 0x34, 0x5d, 0x4b, 0x84, 0x7b, 0xcf, 0xca, 0x12, 0x2f, 0x31, 0x45,
-    0xf7, 0x08, 0xad, 0xd0, 0xfd, 0xfb, 0xe9, 0x07, 0x37, 0xa8, 0x65, 0x4d,
-    0xf8, 0x66, 0x52, 0x11, 0x31, 0x7c, 0x12, 0xb8, 0xf0, 0x43, 0x72, 0x3f,
-    0xfe, 0x4d, 0x3c, 0x91, 0x4e, 0xdc, 0x02, 0xce, 0xde, 0xc2, 0xad, 0x5e,
-    0x70, 0x3b, 0xc9, 0x2d, 0x87, 0xe4, 0x48, 0xed, 0xa3, 0xee, 0x2f, 0xdf,
-    0xbf, 0xf9, 0xae, 0x2c, 0xe7, 0x3f, 0xb2, 0xdf, 0x17, 0x60, 0x8c, 0xac,
-    0x83, 0x18, 0x46, 0x98, 0x97, 0x45, 0x78, 0xcf, 0x31, 0x2e, 0x34, 0x8f,
-    0xa1, 0x02, 0x47, 0x23, 0xc4, 0x96, 0xfc, 0xdb, 0x8e, 0x72, 0x70, 0x15,
-    0x20, 0x1d, 0x84, 0xbf, 0x4e, 0x02, 0x20, 0xe6, 0x50, 0xa3, 0x63, 0xc8,
-    0x08, 0x1c, 0x1a, 0xe0, 0x16, 0x29, 0x98, 0xa2, 0xeb, 0x7f, 0x9b, 0xf0,
-    0x48, 0x76, 0x3e, 0xf0, 0x1c, 0x75, 0x74, 0x77, 0x1d, 0x80, 0x76, 0x57,
-    0x14, 0xaf, 0xb2, 0x19, 0xa4, 0xc2, 0xad, 0xbd, 0x40, 0x00, 0x30, 0xec,
-    0x61, 0xf0, 0x32, 0x82, 0xe4, 0x15, 0x72, 0x39, 0x58, 0xea, 0x08, 0x54,
-    0x2d, 0x86, 0x1f, 0xc8, 0xe5, 0xbe, 0xe5, 0xb7, 0x86, 0xdf, 0x4c, 0x2a,
-    0x18, 0xd7, 0x88, 0xf0, 0xf9, 0x9a, 0x0b, 0x93, 0xe9, 0x75, 0x30, 0xbb,
-    0x0e, 0xde, 0x24, 0xc1, 0x35, 0x58, 0x99, 0xd7, 0xa8, 0x54, 0x08, 0x73,
-    0xeb, 0x7e, 0x1d, 0x7c, 0xbe, 0x5e, 0xad, 0xf0, 0xfd, 0x97, 0x8c, 0xf2,
-    0x41, 0x97, 0x00, 0xa0, 0xb3, 0x31, 0xa1, 0xa4, 0x4c, 0x78, 0xfc, 0xe8,
-    0xf0, 0xc7, 0x09, 0xb9, 0xfe, 0xf5, 0x8d, 0xf4, 0xab, 0x43, 0xa9, 0xf4,
-    0xfa, 0xec, 0xc7, 0x09, 0x06, 0xe7, 0xf2, 0x8f, 0xc8, 0xa8, 0x88, 0x79,
-    0xfe, 0xc0, 0xbb, 0x06, 0xb1, 0x76, 0x5d, 0x8b, 0x25, 0x68, 0x58, 0xb1,
-    0xa5, 0x9d, 0x1d, 0x12, 0x4c, 0x38, 0x47, 0x45, 0x32, 0xc5, 0x88, 0xe1,
-    0x30, 0xeb, 0xae, 0x02, 0x1d, 0x10, 0x03, 0xde, 0xf4, 0xda, 0xce, 0xfe,
-    0x7c, 0xce, 0xfc, 0xa0, 0x01, 0xe0, 0x7b, 0x30, 0xbd, 0xe6, 0x49, 0xf1,
-    0xd7, 0xe8, 0x27, 0x02, 0x56, 0x49, 0x5e, 0xc9, 0x51, 0x36, 0xdd, 0x71,
-    0x77, 0x77, 0xdd, 0x1d, 0xe4, 0x9d, 0x59, 0x51, 0x6e, 0x61, 0x03, 0xbd,
-    0x04, 0x7b, 0x80, 0x12, 0x9a, 0x0a, 0xf4, 0x8c, 0xae, 0x4f, 0xfa, 0x50,
-    0xd9, 0xac, 0x7c, 0xc0, 0x0e, 0x5d, 0xbf, 0x9d, 0xbd, 0x63, 0x6f, 0x76,
-    0x2d, 0xe6, 0x51, 0x85, 0xf3, 0xb9, 0x5f, 0xb9, 0xe4, 0x9a, 0x15, 0x6d,
-    0x45, 0x29, 0x3f, 0x63, 0xea, 0xc1, 0x26, 0xa1, 0xcf, 0xf8, 0x0d, 0x07,
-    0x91, 0xb2, 0xe9, 0xdb, 0xdb, 0x6f, 0x12, 0x3a, 0xa8, 0xa0, 0x28, 0x0d,
-    0x71, 0x57, 0x00, 0xe0, 0x46, 0x6f, 0xae, 0x8a, 0x22, 0xec, 0x55, 0x7c,
-    0x62, 0x11, 0x3d, 0x47, 0x28, 0x33, 0x60, 0xeb, 0x81, 0x71, 0xc6, 0x63,
-    0x8a, 0xe5, 0x88, 0xa7, 0x30, 0xc8, 0x96, 0x28, 0x59, 0xad, 0xb0, 0x88,
-    0x9f, 0xc5, 0x22, 0x2d, 0x6e, 0x45, 0x22, 0xad, 0x9f, 0xd8, 0x42, 0x29,
-    0xf1, 0x79, 0x5e, 0x2e, 0x85, 0x2b, 0xc0, 0x00, 0x52, 0xb8, 0x0e, 0xd0,
-    0x10, 0xf8, 0x57, 0x20, 0x67, 0x23, 0x3f, 0xa4, 0xa4, 0x26, 0x99, 0x31,
-    0x27, 0x78, 0xc8, 0xe6, 0xc1, 0xef, 0xd7, 0x11, 0xf0, 0xa1, 0xee, 0x0e,
-    0x72, 0x21, 0xee, 0x5c, 0xe6, 0xf0, 0x20, 0x0f, 0xe7, 0xef, 0xd7, 0xb0,
-    0x20, 0x68, 0x20, 0x06, 0x46, 0xe6, 0x87, 0x37, 0xe7, 0x61, 0xff, 0x10,
-    0xfb, 0xa1, 0xec, 0x33, 0x54, 0xd8, 0x42, 0xc4, 0xfb, 0x2c, 0xf2, 0x80,
-    0xbf, 0x56, 0xa7, 0xc8, 0xf3, 0x6b, 0x65, 0xca, 0xf3, 0x6b, 0xbf, 0xde,
-    0x2e, 0x98, 0xaa, 0xc0, 0x0d, 0xf7, 0x13, 0x70, 0x3d, 0xc5, 0x5b, 0x0f,
-    0xcc, 0x9c, 0xb7, 0x88, 0xb0, 0x85, 0x60, 0x20, 0xbf, 0x5f, 0xdb, 0x9a,
-    0xc2, 0x1f, 0xaa, 0x3a, 0x94, 0x1f, 0x3b, 0x6e, 0x34, 0x74, 0x43, 0xee,
-    0x8a, 0x91, 0x65, 0x78, 0x65, 0x64, 0x24, 0x04, 0x23, 0x94, 0xfa, 0xbe,
-    0x26, 0x75, 0xa1, 0x2b, 0xa0, 0x39, 0x71, 0xac, 0x75, 0x1d, 0x14, 0x04,
-    0x1a, 0xc1, 0x98, 0xce, 0xe6, 0xd7, 0xe7, 0x41, 0x79, 0x8d, 0x3e, 0xee,
-    0xc5, 0xb5, 0x61, 0xf4, 0x94, 0xd7, 0x68, 0x64, 0xab, 0xe1, 0xfc, 0xe7,
-    0x11, 0x29, 0xd6, 0xeb, 0xe0, 0xe6, 0x9a, 0x1c, 0x8e, 0xf8, 0xae, 0xe2,
-    0x4e, 0x08, 0x7a, 0xc5, 0xc7, 0x5d, 0x1d, 0xac, 0xc3, 0xea, 0x89, 0xac,
-    0x50, 0x41, 0x5a, 0x89, 0xe6, 0xc1, 0x92, 0xa6, 0x00, 0x7c, 0x14, 0xc4,
-    0xda, 0xed, 0x75, 0xb4, 0xbc, 0xc6, 0x07, 0x4f, 0x05, 0xcf, 0xfc, 0x0e,
-    0xc4, 0x02, 0xa3, 0xb7, 0x55, 0x32, 0x80, 0x6c, 0x76, 0x5d, 0xc9, 0xd2,
-    0xe5, 0x75, 0x93, 0x38, 0x17, 0xd7, 0x9e, 0xfb, 0x4b, 0x47, 0xb4, 0x64,
-    0xe3, 0x0e, 0xea, 0xc6, 0x6e, 0xe0, 0xea, 0x5c, 0x18, 0xc5, 0x3c, 0xd4,
-    0xfb, 0x86, 0x56, 0xec, 0xc2, 0xfa, 0xf1, 0xfa, 0xd1, 0x2e, 0xbd, 0x13,
-    0xc7, 0x61, 0x31, 0x03, 0xf6, 0xc7, 0xb1, 0xac, 0xb8, 0x46, 0xe4, 0x06,
-    0x82, 0x2a, 0xae, 0x6b, 0x42, 0x0a, 0x28, 0xb0, 0x1d, 0xaa, 0x42, 0xa6,
-    0xb0, 0x44, 0x03, 0x37, 0xe8, 0x53, 0x58, 0x2d, 0x2c, 0xa5, 0x8b, 0xd6,
-    0x6e, 0x9e, 0x8c, 0xd9, 0xf7, 0xa2, 0x9b, 0xed, 0x6d, 0x4b, 0x26, 0xb4,
-    0x47, 0x8a, 0xc3, 0x05, 0xf0, 0xbb, 0x3b, 0x7c, 0xc0, 0x0a, 0xd5, 0xea,
-    0xcc, 0xed, 0x6d, 0x81, 0xb9, 0x15, 0xa1, 0x40, 0xba, 0x49, 0x28, 0x28,
-    0xb9, 0x61, 0x55, 0xe2, 0x26, 0x50, 0x07, 0x5b, 0xba, 0x81, 0xd9, 0xbd,
-    0x2e, 0x1e, 0x3a, 0xcb, 0xe5, 0xb2, 0x03, 0xfc, 0x75, 0xd6, 0x81, 0x3d,
-    0x62, 0xe9, 0x28, 0xc3, 0xa7, 0x37, 0x08, 0xa8, 0x13, 0x02, 0x7a, 0x41,
-    0xd6, 0xe9, 0x7b, 0x62, 0xbe, 0x4a, 0x26, 0x0c, 0x03, 0x1a, 0x6d, 0x9d,
-    0x71, 0xf6, 0x1e, 0xf9, 0x2b, 0x3a, 0xec, 0x9b, 0xfb, 0x16, 0x2d, 0xae,
-    0x09, 0x24, 0x29, 0x9d, 0xf0, 0x62, 0x9c, 0x17, 0xe3, 0x86, 0x7e, 0xa4,
-    0x07, 0xf7, 0x1d, 0x44, 0xb8, 0xeb, 0xca, 0xa3, 0x21, 0xf7, 0xf6, 0x56,
-    0x28, 0x85, 0x55, 0xe5, 0x28, 0x17, 0x78, 0xfc, 0xe2, 0x3a, 0x78, 0x79,
-    0x1d, 0x6d, 0xed, 0xe1, 0x34, 0xfa, 0xbd, 0xde, 0x31, 0xe1, 0x10, 0xb4,
-    0x5b, 0x14, 0x04, 0x7d, 0xfe, 0x79, 0xbc, 0xdf, 0xeb, 0xad, 0x56, 0xfb,
-    0x3d, 0x3e, 0x18, 0xcf, 0xa3, 0x60, 0x6e, 0xa5, 0xb2, 0x7b, 0x99, 0xe0,
-    0xab, 0x97, 0x51, 0x74, 0x73, 0x4d, 0x13, 0x03, 0x3e, 0x30, 0x47, 0x42,
-    0xf4, 0x5e, 0x27, 0x3a, 0x6a, 0x40, 0x9b, 0x2b, 0x5c, 0x6c, 0x31, 0xcf,
-    0xd2, 0x82, 0xf1, 0xd5, 0x7a, 0xf2, 0xb5, 0xcc, 0x0e, 0x29, 0xb1, 0xc4,
-    0x6f, 0xa1, 0xdd, 0xeb, 0x44, 0xe2, 0xc9, 0xa0, 0xc2, 0x93, 0xd7, 0x09,
-    0x2f, 0x8b, 0x7e, 0x9b, 0x0c, 0xf9, 0x9b, 0xab, 0x21, 0xa6, 0x7e, 0x85,
-    0x14, 0xa9, 0xdf, 0xe1, 0x3f, 0x27, 0x9c, 0x82, 0x5e, 0x27, 0xfe, 0x50,
-    0x72, 0x97, 0xf0, 0x97, 0x3a, 0x13, 0xa6, 0x8a, 0x52, 0x1d, 0xb5, 0x5b,
-    0x7a, 0xab, 0x15, 0x8f, 0x70, 0xf1, 0xb0, 0xeb, 0x62, 0x71, 0x79, 0x49,
-    0x8f, 0x5a, 0x13, 0x3c, 0xf9, 0xec, 0xc4, 0xe6, 0xe3, 0x4f, 0xad, 0x37,
-    0x0b, 0xfc, 0x17, 0xd7, 0x6a, 0x16, 0x7f, 0xd2, 0x42, 0xcf, 0xc3, 0x58,
-    0xf3, 0x01, 0xbe, 0xf6, 0xfb, 0xe2, 0xba, 0xe1, 0x54, 0xc7, 0xd7, 0x32,
-    0xbb, 0xb5, 0x3a, 0x10, 0xc1, 0x16, 0xd5, 0xef, 0x12, 0x71, 0x3f, 0x66,
-    0x6a, 0x18, 0xfa, 0x8e, 0xda, 0x40, 0xbe, 0xd1, 0x47, 0x1e, 0x37, 0x0f,
-    0xf6, 0x71, 0x7e, 0x0d, 0xb8, 0x05, 0xab, 0x11, 0x6b, 0x46, 0x96, 0x38,
-    0xc4, 0x98, 0x1a, 0x28, 0xf3, 0x43, 0x5a, 0x33, 0x65, 0xe9, 0x33, 0x04,
-    0x0a, 0x0f, 0x39, 0xe0, 0x22, 0xe2, 0xc0, 0x50, 0x39, 0x7a, 0x22, 0x80,
-    0x05, 0xed, 0xf8, 0xdb, 0xc3, 0x5c, 0x38, 0x89, 0xe7, 0x85, 0x21, 0xd7,
-    0xaf, 0xdf, 0x16, 0x06, 0xe4, 0x29, 0xf1, 0xcc, 0xe9, 0x65, 0xc5, 0x7e,
-    0x41, 0x79, 0x7e, 0x79, 0x1d, 0xb8, 0xd4, 0x20, 0x17, 0xda, 0xf3, 0x12,
-    0xa7, 0x86, 0xbc, 0x73, 0x0d, 0x9a, 0xf6, 0x8b, 0x6b, 0x25, 0x4d, 0xc1,
-    0x52, 0xd0, 0xa4, 0xc2, 0x24, 0x04, 0x19, 0x8f, 0x1a, 0x0b, 0xaa, 0xbc,
-    0xa1, 0xd0, 0xc2, 0x43, 0xa1, 0x3e, 0x2b, 0xed, 0x11, 0x50, 0xaf, 0x93,
-    0x75, 0xa5, 0x67, 0x53, 0x49, 0xfd, 0xf2, 0x21, 0xf0, 0xe7, 0x0b, 0x0a,
-    0x02, 0x09, 0xa4, 0x4e, 0xdf, 0xe8, 0x02, 0xbe, 0x08, 0xdc, 0x77, 0x40,
-    0x06, 0xa0, 0x8e, 0x14, 0x77, 0xe9, 0x88, 0xac, 0x28, 0x94, 0x40, 0xc8,
-    0xdf, 0x31, 0x43, 0x10, 0x69, 0x06, 0x3a, 0xb6, 0x27, 0x98, 0x88, 0x50,
-    0x2a, 0x82, 0xbb, 0x6b, 0xfa, 0x82, 0xb5, 0xa6, 0x78, 0x5f, 0x1c, 0xbe,
-    0xe7, 0x71, 0x51, 0xe0, 0x0f, 0xa5, 0x10, 0x43, 0x00, 0xde, 0xfc, 0x6d,
-    0xc2, 0xa6, 0x63, 0x83, 0x25, 0xd4, 0xd9, 0xcb, 0x6b, 0x64, 0x03, 0x91,
-    0x9a, 0x87, 0x19, 0x83, 0xba, 0x7a, 0x79, 0xed, 0xdf, 0x5e, 0x0b, 0xdf,
-    0x39, 0xcc, 0xba, 0xbc, 0xe6, 0x7c, 0xa3, 0x7a, 0xcf, 0x05, 0x27, 0x54,
-    0xa9, 0xfa, 0xf9, 0x75, 0x8b, 0xae, 0xdf, 0xca, 0x16, 0x6c, 0x30, 0x92,
-    0x56, 0x81, 0x02, 0xe8, 0xa0, 0x1e, 0xc6, 0x27, 0x6e, 0x5d, 0xa0, 0x36,
-    0x2a, 0x38, 0xec, 0x50, 0xfc, 0x25, 0x0d, 0x1f, 0x4b, 0x49, 0xb3, 0x45,
-    0xa7, 0x6c, 0x53, 0xbf, 0x97, 0x46, 0xe9, 0xbb, 0x89, 0x7a, 0xfe, 0xa8,
-    0xbd, 0x92, 0x84, 0xf8, 0x06, 0x8a, 0x5b, 0xd4, 0xb8, 0xc3, 0xdb, 0xd6,
-    0xa6, 0x7e, 0x64, 0x90, 0x02, 0xb7, 0xdc, 0x77, 0x3f, 0xbc, 0x07, 0x23,
-    0x45, 0x8e, 0x54, 0xfa, 0x72, 0x3a, 0xf4, 0x56, 0xd7, 0x9f, 0xe8, 0x55,
-    0xea, 0x3f, 0x5c, 0xb5, 0x69, 0xf4, 0x8c, 0xa7, 0x60, 0x60, 0x93, 0xda,
-    0x48, 0xdc, 0x76, 0x43, 0x8b, 0x8e, 0x27, 0xaa, 0x47, 0x71, 0xe9, 0x76,
-    0x59, 0xa4, 0xc5, 0x02, 0x81, 0x4d, 0x2e, 0xdd, 0x2f, 0x3e, 0x98, 0xdd,
-    0xb1, 0x74, 0xa6, 0xc9, 0x09, 0xed, 0x1d, 0x67, 0xd5, 0x4d, 0x0a, 0x2f,
-    0x26, 0x45, 0x27, 0x43, 0xf3, 0x35, 0x87, 0x3f, 0x7b, 0xc0, 0x23, 0xab,
-    0x06, 0x7a, 0x98, 0x4d, 0x17, 0xd9, 0xa5, 0x97, 0x0f, 0xc1, 0x2a, 0x76,
-    0x8f, 0xc7, 0xc9, 0xcd, 0x89, 0xeb, 0xf3, 0xac, 0xfa, 0xf6, 0xe1, 0xcf,
-    0x13, 0xbc, 0x0d, 0x21, 0x6e, 0xe4, 0xe5, 0xe8, 0x04, 0x08, 0x80, 0xb7,
-    0x17, 0xd6, 0xc0, 0x0a, 0x09, 0x84, 0x58, 0x9c, 0xb4, 0xd1, 0x92, 0xe2,
-    0x24, 0xe2, 0x02, 0xf1, 0xa7, 0x1f, 0x5f, 0xa3, 0x7f, 0x2b, 0x4b, 0x31,
-    0xee, 0x58, 0x6a, 0xb7, 0xd6, 0xf3, 0xf3, 0x33, 0xc5, 0x3b, 0x1b, 0x8f,
-    0xcd, 0xf3, 0x60, 0x8b, 0xd3, 0x89, 0x45, 0x28, 0xb6, 0x03, 0xeb, 0x35,
-    0x45, 0x0a, 0xcb, 0x89, 0x13, 0xba, 0xc4, 0x84, 0x16, 0x72, 0xc2, 0x5f,
-    0x67, 0x54, 0xde, 0xfd, 0x47, 0x8e, 0x99, 0x04, 0x19, 0x1f, 0x3d, 0xe6,
-    0x0e, 0x5b, 0xf1, 0x00, 0x22, 0x9e, 0x64, 0x2d, 0x78, 0x5a, 0x3f, 0x84,
-    0xc1, 0x05, 0x58, 0x0f, 0x8f, 0xe2, 0x4a, 0xa7, 0x67, 0xf4, 0x2a, 0xb1,
-    0x57, 0x46, 0xc9, 0x30, 0x0b, 0xb3, 0x1d, 0xf7, 0xcc, 0xdd, 0xf1, 0x16,
-    0xf5, 0x2f, 0x53, 0x44, 0x51, 0x8c, 0x5a, 0x84, 0x88, 0xd4, 0x8d, 0x87,
-    0x25, 0x5d, 0x79, 0x71, 0xcf, 0x51, 0x4b, 0x86, 0x76, 0xc5, 0x30, 0xc7,
-    0xb5, 0x7b, 0xa0, 0xd8, 0x22, 0x17, 0x61, 0xe2, 0x0e, 0x63, 0x58, 0xb7,
-    0x00, 0x15, 0x07, 0x24, 0x9f, 0xd2, 0xdd, 0x30, 0xa5, 0xa3, 0xb1, 0x04,
-    0xfd, 0xef, 0xbc, 0xb1, 0x38, 0x7b, 0x11, 0x8e, 0x5f, 0xb0, 0xe7, 0x79,
-    0xe0, 0xdb, 0xb6, 0xfa, 0xbb, 0x08, 0x7f, 0xed, 0xf7, 0xf0, 0x97, 0x11,
-    0x76, 0x5c, 0xe1, 0xf2, 0xf6, 0x7e, 0xba, 0x8e, 0xc6, 0x3e, 0x62, 0x70,
-    0x15, 0xdb, 0x68, 0xbc, 0x93, 0x58, 0x47, 0x25, 0xd3, 0xd3, 0x31, 0x89,
-    0xfd, 0x8d, 0x65, 0x71, 0x9c, 0x30, 0xac, 0x23, 0x8f, 0x13, 0xe1, 0xd2,
-    0x16, 0xf1, 0xc5, 0xf7, 0xb8, 0xb0, 0x30, 0x0d, 0x68, 0x61, 0x21, 0x46,
-    0xa0, 0xab, 0x27, 0x3f, 0x74, 0x29, 0xf1, 0xa7, 0x6b, 0x01, 0x64, 0x71,
-    0x65, 0x82, 0x89, 0xf7, 0x37, 0xcd, 0x13, 0x1c, 0x7c, 0xed, 0x0e, 0x39,
-    0x30, 0xbe, 0x4e, 0x48, 0xf0, 0xf2, 0x49, 0xfd, 0x40, 0xd6, 0xc9, 0xd0,
-    0x92, 0x60, 0x6a, 0x10, 0xab, 0xa2, 0x75, 0x83, 0xf1, 0x41, 0x2f, 0x7d,
-    0xe0, 0x73, 0xdc, 0x63, 0xb4, 0xcb, 0x16, 0x17, 0xb3, 0x04, 0x1b, 0xe0,
-    0x51, 0x19, 0x08, 0x44, 0x26, 0xbf, 0xf9, 0x0f, 0xb1, 0x88, 0x04, 0xea,
-    0x35, 0xfc, 0xd3, 0x73, 0xd1, 0x20, 0xcb, 0x44, 0x3e, 0x98, 0x2f, 0xa3,
-    0xcf, 0x17, 0xd9, 0x2d, 0x26, 0x57, 0x2b, 0x0c, 0xbe, 0x85, 0x34, 0xc5,
-    0x35, 0x25, 0x00, 0x54, 0x7c, 0x21, 0x03, 0x65, 0xaf, 0x2f, 0xde, 0x56,
-    0x85, 0xb5, 0xa9, 0x30, 0x8e, 0x1a, 0xef, 0x21, 0xd5, 0x54, 0x20, 0x4e,
-    0xb2, 0xd5, 0xdd, 0xf0, 0xec, 0xf1, 0x5c, 0x02, 0xb4, 0x4d, 0x82, 0xc3,
-    0x50, 0x4b, 0x84, 0x0b, 0xd1, 0x80, 0xb5, 0x98, 0xe3, 0x17, 0x4d, 0xae,
-    0x46, 0x93, 0x6a, 0x9a, 0x04, 0x18, 0x33, 0x46, 0x4f, 0x3f, 0x02, 0xf2,
-    0xeb, 0x23, 0x20, 0x09, 0x48, 0x8c, 0x19, 0x91, 0xc1, 0xcf, 0x96, 0x2b,
-    0x34, 0xd0, 0x37, 0x3f, 0x18, 0x91, 0xf5, 0xc5, 0xdd, 0x7d, 0xf6, 0xbb,
-    0xd7, 0xf3, 0x95, 0xd3, 0x23, 0x98, 0x91, 0xed, 0x84, 0x64, 0xb5, 0xaa,
-    0x1e, 0x98, 0x83, 0xea, 0xbc, 0x0b, 0xcf, 0x78, 0x90, 0x43, 0x3d, 0x08,
-    0x05, 0xad, 0xab, 0x71, 0xab, 0x52, 0x58, 0xb6, 0xb5, 0xfa, 0xc2, 0x39,
-    0x90, 0x59, 0x6f, 0x30, 0xea, 0x9a, 0x59, 0xa6, 0x49, 0x57, 0xff, 0x82,
-    0x03, 0xcf, 0x69, 0xfc, 0xda, 0x02, 0x3d, 0x23, 0x00, 0xff, 0x07, 0x62,
-    0x75, 0xbc, 0xf6, 0x8f, 0xa5, 0xff, 0x59, 0x38, 0xac, 0x9d, 0x29, 0x88,
-    0xdf, 0xa8, 0x11, 0x4b, 0x7d, 0xf2, 0xc4, 0x7c, 0xb7, 0x22, 0x41, 0xaa,
-    0x43, 0x97, 0x58, 0xe6, 0xb9, 0x7f, 0xc7, 0x10, 0xbc, 0x78, 0xea, 0x80,
-    0xa9, 0x72, 0x99, 0x5c, 0xb9, 0xc1, 0x95, 0x4f, 0x21, 0xbe, 0xf8, 0xca,
-    0x3e, 0xbb, 0x49, 0x46, 0x8c, 0x3f, 0x90, 0x6f, 0xb9, 0x24, 0x87, 0x4f,
-    0x4b, 0xb9, 0x67, 0xdd, 0xce, 0xa7, 0x6f, 0x3a, 0xbf, 0xc5, 0x9d, 0x3f,
-    0x7a, 0x9d, 0xe7, 0xe7, 0x3b, 0x2e, 0x9e, 0x7d, 0xad, 0x03, 0x90, 0xff,
-    0x81, 0xfb, 0x61, 0xc2, 0x9c, 0x2b, 0xd1, 0x39, 0xe2, 0x8d, 0x43, 0x07,
-    0xc5, 0xcc, 0xe1, 0xdd, 0xba, 0xd5, 0x30, 0x23, 0x1a, 0xf8, 0x9d, 0xd0,
-    0x6f, 0xf4, 0xa1, 0x38, 0x24, 0x85, 0x8f, 0x70, 0x5e, 0x55, 0x11, 0x0f,
-    0xf8, 0xd3, 0xef, 0x1b, 0xd1, 0xef, 0x2f, 0x74, 0xf6, 0x1c, 0xde, 0x4d,
-    0x07, 0xdf, 0x72, 0x73, 0x83, 0x59, 0x92, 0x8a, 0x47, 0x29, 0x9f, 0xad,
-    0x83, 0x32, 0x7a, 0x02, 0xa2, 0x89, 0xea, 0x9d, 0xb8, 0xc1, 0x13, 0xe9,
-    0xf3, 0x4a, 0x83, 0xfb, 0x64, 0x0c, 0x96, 0xf9, 0xe5, 0x55, 0x07, 0xd0,
-    0x99, 0xb3, 0x48, 0x62, 0x27, 0xfc, 0x1b, 0x5f, 0x01, 0xcf, 0x1e, 0xdd,
-    0x72, 0xc7, 0xed, 0xd0, 0x04, 0x72, 0x18, 0x5c, 0xe9, 0x44, 0xc9, 0x5e,
-    0xe3, 0x43, 0x31, 0xf5, 0xef, 0xf7, 0xd4, 0x97, 0xf5, 0xdd, 0x41, 0xc9,
-    0x89, 0x7a, 0x2b, 0xca, 0xf8, 0x07, 0x7f, 0x92, 0x47, 0x42, 0xa4, 0x70,
-    0xc6, 0x59, 0xfa, 0xb7, 0xd2, 0xa1, 0x07, 0xbd, 0xb6, 0x50, 0x24, 0x55,
-    0xe8, 0x0a, 0xe8, 0xb4, 0x28, 0xca, 0x6c, 0xf6, 0x33, 0x10, 0xf5, 0x38,
-    0x29, 0xef, 0x30, 0x74, 0x34, 0xdb, 0x54, 0x2a, 0x11, 0xfb, 0x33, 0xbf,
-    0x20, 0xf0, 0xd9, 0xa3, 0xf3, 0xb3, 0x92, 0x1c, 0xe0, 0xb4, 0x4c, 0x37,
-    0x48, 0xb0, 0x0b, 0x3d, 0x7d, 0x86, 0x8f, 0xf6, 0x00, 0xfb, 0x8f, 0x05,
-    0xbf, 0x95, 0x6b, 0x73, 0x3c, 0xb1, 0x38, 0xdf, 0x45, 0xc7, 0x61, 0x30,
-    0xc2, 0xdb, 0xc2, 0x0a, 0xbd, 0x90, 0xba, 0x02, 0x10, 0xfc, 0x4a, 0x40,
-    0x8a, 0x33, 0x2f, 0x98, 0xa3, 0x92, 0xa7, 0x40, 0x48, 0x16, 0xaf, 0x25,
-    0xf6, 0xc4, 0x63, 0xd8, 0x47, 0x47, 0x6e, 0x3b, 0x5e, 0xfc, 0x25, 0x04,
-    0x5a, 0xb2, 0x0b, 0xe7, 0xa7, 0xd7, 0xf4, 0xab, 0x9a, 0x5d, 0xe7, 0x19,
-    0x1e, 0x55, 0xe3, 0xef, 0x49, 0xa0, 0x2d, 0x2c, 0x90, 0x0a, 0xb0, 0xfa,
-    0xfb, 0xff, 0xfd, 0xe1, 0x83, 0x05, 0xa5, 0x67, 0xbf, 0x97, 0xe5, 0x8b,
-    0x3c, 0xfb, 0x8c, 0x51, 0x7e, 0x73, 0x8e, 0xa6, 0x54, 0x93, 0xe7, 0x39,
-    0xe8, 0xd8, 0x73, 0x2d, 0x95, 0xdf, 0x91, 0x72, 0x7f, 0x09, 0x0d, 0xee,
-    0xf4, 0x06, 0xf3, 0x2c, 0x37, 0x1a, 0xfc, 0x54, 0x60, 0xdf, 0x85, 0xd2,
-    0xb7, 0xd4, 0xe2, 0x1d, 0x8f, 0xbf, 0x45, 0x10, 0x4f, 0x7d, 0xbd, 0x89,
-    0x0d, 0xf5, 0xab, 0xa7, 0x41, 0x34, 0x0c, 0xfc, 0x72, 0x42, 0xd8, 0x84,
-    0xe1, 0x0a, 0x95, 0xa4, 0xf5, 0x65, 0x67, 0x81, 0x1a, 0x72, 0xcf, 0xc5,
-    0x9e, 0xd6, 0xcb, 0xa9, 0xb6, 0xa3, 0x6d, 0x39, 0x3f, 0x32, 0x8c, 0xe9,
-    0x06, 0x1a, 0x0c, 0x6e, 0x82, 0x0f, 0x81, 0xcb, 0x93, 0x0e, 0xb5, 0x9d,
-    0x81, 0xf6, 0x18, 0x5f, 0xb1, 0xc2, 0xd8, 0xa7, 0x0f, 0xd9, 0x3c, 0x19,
-    0xb5, 0xec, 0xd6, 0x8f, 0x6c, 0xc4, 0x92, 0x1b, 0x46, 0x55, 0xdc, 0x60,
-    0x21, 0x58, 0x0b, 0x35, 0x28, 0x33, 0x67, 0xbe, 0xb8, 0x98, 0x26, 0xc5,
-    0xc4, 0xc9, 0x79, 0xad, 0xb1, 0x53, 0x24, 0x57, 0x30, 0x23, 0x7d, 0x42,
-    0x78, 0xa0, 0xd0, 0xd2, 0x1e, 0x48, 0x45, 0x34, 0x29, 0x30, 0x89, 0xd6,
-    0x87, 0x73, 0x99, 0x67, 0x33, 0xa3, 0x03, 0xb4, 0x6d, 0x1e, 0x98, 0x41,
-    0xcd, 0xd9, 0x1c, 0x32, 0x85, 0xf4, 0x1e, 0x7e, 0x06, 0xec, 0x04, 0x58,
-    0x3d, 0xa2, 0x0f, 0x11, 0xf2, 0x24, 0xfb, 0xba, 0xe1, 0x0d, 0x6b, 0x80,
-    0x1d, 0xec, 0xef, 0x7f, 0xff, 0xdd, 0x1f, 0xce, 0x8f, 0xdf, 0x5a, 0xe0,
-    0x95, 0x5f, 0x9e, 0x8e, 0x26, 0xd9, 0xf7, 0x12, 0xc8, 0x72, 0x07, 0x30,
-    0x13, 0x97, 0x56, 0x3a, 0xf9, 0x65, 0xb5, 0x05, 0x0e, 0x7a, 0x23, 0x5d,
-    0xa5, 0xa9, 0x00, 0x74, 0xfe, 0x0e, 0xf7, 0x6e, 0xcc, 0x51, 0x1d, 0x89,
-    0xf0, 0xef, 0xef, 0x5e, 0xff, 0xe0, 0xcc, 0x61, 0x07, 0x31, 0xaa, 0xa4,
-    0xa2, 0x41, 0xe8, 0x49, 0xc0, 0x3c, 0x6f, 0xe9, 0xe4, 0x1d, 0x88, 0xaa,
-    0x9f, 0xe6, 0xd5, 0x24, 0xbe, 0x41, 0xd7, 0x3e, 0x3e, 0x4b, 0x3c, 0x87,
-    0xfc, 0xc5, 0xdc, 0xc1, 0x9f, 0xaa, 0xaa, 0xfb, 0xa0, 0x01, 0xbc, 0x9c,
-    0xfd, 0xbe, 0xc0, 0xe8, 0x2e, 0x1a, 0xe5, 0xf0, 0x67, 0x07, 0x3d, 0x92,
-    0x8c, 0x33, 0xcc, 0x65, 0x52, 0xe2, 0x2e, 0x23, 0x38, 0x00, 0xce, 0x09,
-    0xbe, 0x5a, 0xa7, 0x8e, 0xfb, 0x21, 0x8f, 0xd3, 0x02, 0x44, 0x77, 0xf9,
-    0xd8, 0xf9, 0x03, 0xfc, 0xca, 0xba, 0x4d, 0x0d, 0xde, 0xd3, 0x94, 0xf4,
-    0x38, 0x2c, 0x97, 0xfe, 0xd0, 0x42, 0x07, 0xf1, 0xbb, 0x3a, 0xdb, 0x0c,
-    0x7a, 0xe3, 0xe2, 0x82, 0x6c, 0x20, 0x55, 0x42, 0x70, 0xb5, 0x49, 0xa3,
-    0xd5, 0x2b, 0x57, 0x25, 0xb8, 0x0c, 0xcf, 0xf0, 0x9f, 0x70, 0xbb, 0x87,
-    0x0e, 0xb2, 0xdd, 0x5d, 0x65, 0x70, 0xe5, 0x80, 0x4c, 0xf1, 0x1e, 0x86,
-    0x96, 0x33, 0x62, 0x79, 0x62, 0xa6, 0x4a, 0x50, 0x66, 0x8d, 0xc9, 0xe1,
-    0xa2, 0xc7, 0xc2, 0x5a, 0x2a, 0xfd, 0xb3, 0xfa, 0x91, 0x9c, 0x9a, 0x9b,
-    0xd4, 0x10, 0x69, 0x30, 0x97, 0x52, 0x4a, 0x3b, 0xe0, 0x33, 0x9c, 0xc5,
-    0x88, 0x45, 0x73, 0xc5, 0x1c, 0x84, 0xe9, 0x20, 0x93, 0xaf, 0x3d, 0x29,
-    0x30, 0x52, 0x41, 0xb2, 0x00, 0xd6, 0x25, 0x3e, 0x66, 0x63, 0xfc, 0x99,
-    0x4f, 0x47, 0xfb, 0xb9, 0x71, 0x47, 0xfb, 0x31, 0x54, 0x00, 0x9f, 0xda,
-    0xdd, 0x34, 0xbe, 0x60, 0x53, 0xb3, 0xc3, 0x6a, 0x29, 0x75, 0xdd, 0xb3,
-    0x34, 0x70, 0x1d, 0xb9, 0x81, 0xf8, 0xce, 0xf5, 0x39, 0xbf, 0x5e, 0x08,
-    0xe6, 0xe5, 0x9a, 0x87, 0x60, 0x55, 0x12, 0x9a, 0x51, 0xf4, 0xfa, 0x3d,
-    0xd7, 0xed, 0xb6, 0x30, 0xfe, 0xc7, 0xeb, 0xe1, 0x9d, 0xb4, 0xca, 0x42,
-    0x06, 0x9b, 0xcc, 0xfa, 0xa3, 0x0c, 0x4c, 0x15, 0x79, 0x29, 0x07, 0x09,
-    0x1d, 0xe2, 0xcc, 0x3d, 0x57, 0x68, 0xf3, 0x5c, 0x4b, 0xf2, 0xfd, 0x50,
-    0x71, 0xaa, 0xf0, 0xf1, 0x82, 0xbd, 0x5e, 0xcf, 0x5f, 0x07, 0xd6, 0xad,
-    0xea, 0xea, 0xe0, 0x0f, 0x65, 0x67, 0x15, 0x22, 0x35, 0xeb, 0xb8, 0xf2,
-    0x01, 0x3a, 0x7a, 0x6b, 0x58, 0x3c, 0xf3, 0xf6, 0xc4, 0x7c, 0x91, 0xb3,
-    0x56, 0xe9, 0x9e, 0x54, 0x06, 0xc6, 0xda, 0x0f, 0xcf, 0x80, 0xed, 0xbb,
-    0x35, 0x65, 0xbc, 0xc9, 0xae, 0x2c, 0x2c, 0x87, 0x5b, 0x14, 0x50, 0xf6,
-    0x06, 0x68, 0x73, 0xea, 0x82, 0x3d, 0x47, 0xac, 0x8d, 0x52, 0x44, 0x6c,
-    0xbc, 0x82, 0x33, 0xcd, 0xae, 0xae, 0xe8, 0x99, 0x31, 0xd9, 0x10, 0x84,
-    0xf8, 0x86, 0x56, 0xa2, 0x3a, 0x32, 0xc7, 0x5a, 0xe2, 0xd7, 0x8d, 0x8b,
-    0xbb, 0x62, 0xba, 0x61, 0x48, 0x2a, 0x6d, 0x0e, 0xc9, 0xf3, 0xbf, 0x43,
-    0x19, 0x2f, 0x85, 0xff, 0x7b, 0x5e, 0x15, 0x26, 0x89, 0x4c, 0xc8, 0x26,
-    0xd1, 0x78, 0x23, 0x4d, 0x01, 0x10, 0x8d, 0x50, 0xf6, 0x37, 0x9b, 0x00,
-    0xa4, 0xde, 0x93, 0x7b, 0xd1, 0x79, 0x73, 0xfa, 0x4a, 0x85, 0x14, 0x70,
-    0x95, 0xc7, 0xb1, 0xa6, 0xa2, 0x6e, 0xae, 0x36, 0x26, 0x06, 0xca, 0xbe,
-    0x4b, 0xae, 0x26, 0x15, 0x4f, 0xc5, 0x3e, 0x96, 0xf1, 0x1d, 0xa8, 0x2d,
-    0x4b, 0x6a, 0x09, 0x4d, 0x9c, 0xa4, 0x40, 0x05, 0x20, 0xe5, 0xd1, 0xf4,
-    0x02, 0x7c, 0xc4, 0x5c, 0xe9, 0x57, 0xe0, 0x68, 0x90, 0x8b, 0x45, 0x32,
-    0x2d, 0x41, 0x5d, 0x70, 0xa0, 0x57, 0x98, 0x36, 0x3e, 0xdc, 0x0a, 0x08,
-    0x50, 0xe0, 0x09, 0x6b, 0xd8, 0xb0, 0x20, 0x9f, 0xe0, 0xf5, 0x75, 0xfc,
-    0x25, 0x30, 0xbc, 0x4b, 0xc9, 0x9f, 0x6d, 0x0b, 0xaa, 0xb7, 0x01, 0xdd,
-    0xe3, 0xf9, 0xc9, 0x2b, 0x2e, 0xa8, 0x96, 0xc9, 0x74, 0x0a, 0x0c, 0xfa,
-    0x22, 0xcb, 0xca, 0xad, 0xe3, 0xdd, 0xf9, 0x09, 0x94, 0x7c, 0xc8, 0xef,
-    0x70, 0x06, 0xc0, 0xe3, 0xf9, 0x84, 0xd0, 0xd2, 0xdb, 0x3b, 0x04, 0x60,
-    0x43, 0x7a, 0x5c, 0x74, 0xb1, 0x16, 0xac, 0xb0, 0xc5, 0xb1, 0x48, 0xbf,
-    0x23, 0x51, 0x1f, 0x4e, 0xe5, 0x0c, 0x7d, 0x61, 0xf4, 0xba, 0x5f, 0xb0,
-    0x77, 0xc8, 0xf6, 0xe9, 0x61, 0x4a, 0x68, 0xfa, 0x69, 0x99, 0x5c, 0x26,
-    0x7f, 0x7a, 0xd6, 0x85, 0xf3, 0xcf, 0xd7, 0xdf, 0xbe, 0x86, 0x19, 0xf1,
-    0xa3, 0x69, 0x67, 0x39, 0x61, 0x39, 0x88, 0x60, 0x3c, 0xd2, 0x60, 0x63,
-    0xb9, 0x8c, 0x77, 0x90, 0x04, 0xc8, 0xd1, 0x32, 0x00, 0xfb, 0x81, 0xb5,
-    0x38, 0x49, 0x29, 0x66, 0x2f, 0x67, 0xc1, 0x8b, 0xfe, 0x8d, 0x79, 0x70,
-    0xca, 0x82, 0xdd, 0x2c, 0x1c, 0xea, 0xd1, 0xe9, 0x08, 0x60, 0x0a, 0x45,
-    0x40, 0x4e, 0xe6, 0xd7, 0x6c, 0xe1, 0xcc, 0xf0, 0xfe, 0xbc, 0x33, 0xc1,
-    0x30, 0x4d, 0x09, 0x5e, 0x31, 0x2f, 0xa2, 0x15, 0x00, 0x88, 0xac, 0xfd,
-    0x23, 0x41, 0xcd, 0xc1, 0x57, 0x22, 0x08, 0xf8, 0xbd, 0x0a, 0xf8, 0xdd,
-    0x7f, 0x03, 0xfc, 0xec, 0xc0, 0x5f, 0xaf, 0x07, 0xc6, 0x0f, 0xcf, 0x60,
-    0xbc, 0x5d, 0x22, 0xde, 0x93, 0x48, 0xe9, 0xf7, 0x09, 0xb9, 0xeb, 0xec,
-    0x32, 0xc6, 0xd0, 0xf9, 0xbb, 0x28, 0xe5, 0x49, 0x72, 0xf9, 0x45, 0xe2,
-    0x9d, 0x89, 0x4b, 0x06, 0x16, 0x4d, 0x94, 0xf1, 0xc4, 0x84, 0x4d, 0xe7,
-    0x51, 0xa2, 0xfe, 0x8c, 0x2a, 0x29, 0xc1, 0x8d, 0x0e, 0xab, 0x9f, 0xcf,
-    0x8d, 0xb6, 0x7a, 0xc6, 0x10, 0xea, 0x65, 0x56, 0x95, 0xa9, 0x29, 0x02,
-    0x82, 0xa2, 0x2d, 0x84, 0xfa, 0x4b, 0x3f, 0x0a, 0xa7, 0x2a, 0xc7, 0xea,
-    0x7d, 0xb3, 0x91, 0xd1, 0x03, 0xfe, 0x84, 0x9b, 0x29, 0x61, 0xe8, 0xb0,
-    0x4e, 0x28, 0x54, 0x6e, 0x20, 0xba, 0xc6, 0x75, 0xa8, 0x1d, 0xe5, 0xba,
-    0xbc, 0xe5, 0x11, 0xb5, 0x4a, 0x4f, 0x8f, 0x56, 0xd7, 0x15, 0x31, 0x86,
-    0x1d, 0x71, 0xc6, 0x83, 0x1d, 0x71, 0x19, 0xeb, 0x8a, 0x19, 0xb8, 0x6f,
-    0xf1, 0x09, 0xca, 0x35, 0x19, 0x59, 0xcd, 0x4a, 0x32, 0x4c, 0x8a, 0x6a,
-    0xf2, 0x78, 0xc4, 0xb6, 0xaa, 0xcb, 0x38, 0x4f, 0xe9, 0x27, 0xed, 0x78,
-    0xe5, 0x7f, 0x8a, 0x64, 0x5b, 0xf5, 0x24, 0xbd, 0xcc, 0x64, 0xdd, 0xd7,
-    0xf8, 0xdd, 0x56, 0x71, 0xcc, 0x2e, 0x16, 0x55, 0xaf, 0xaf, 0x28, 0xb1,
-    0xf6, 0xcf, 0x15, 0x75, 0x28, 0xad, 0xed, 0x8f, 0x54, 0xd8, 0x1f, 0xca,
-    0x4f, 0xe6, 0x12, 0xb2, 0xa9, 0xfa, 0x96, 0xa1, 0xc1, 0xf0, 0x9f, 0x4a,
-    0xfc, 0x72, 0xc3, 0x68, 0x1e, 0xa3, 0x26, 0x98, 0x86, 0x69, 0x20, 0xd5,
-    0xd0, 0xb0, 0xd4, 0xc1, 0xaf, 0x2a, 0x6c, 0xd5, 0x0c, 0x33, 0x73, 0x86,
-    0xf3, 0xcd, 0x2e, 0x92, 0xaf, 0xd5, 0x70, 0xc8, 0x85, 0x51, 0x97, 0x6b,
-    0x1b, 0xa4, 0x1d, 0x28, 0xbf, 0xe3, 0xfb, 0xd0, 0x8a, 0xc5, 0xef, 0xc3,
-    0xfe, 0xfb, 0xc6, 0x20, 0xac, 0x7d, 0x16, 0xdf, 0xa2, 0x1b, 0xf5, 0x71,
-    0x4b, 0xbd, 0xf4, 0xd4, 0x5b, 0x34, 0x2c, 0xd8, 0x0b, 0x8e, 0x0e, 0x0f,
-    0xf7, 0x0f, 0xb5, 0x1f, 0x86, 0xd5, 0x6b, 0xf4, 0x82, 0xbd, 0x23, 0xfd,
-    0x66, 0xea, 0x9f, 0xd4, 0x45, 0x1f, 0x22, 0x15, 0x03, 0x9b, 0xbe, 0x58,
-    0x49, 0xac, 0x7a, 0xa5, 0x25, 0x6b, 0x3f, 0xf0, 0xaa, 0xf3, 0x05, 0xe9,
-    0x21, 0x6e, 0x52, 0x34, 0xfe, 0x54, 0xf6, 0xdc, 0x54, 0x54, 0xe9, 0xc7,
-    0xc2, 0x0d, 0x46, 0x84, 0xb7, 0x39, 0x94, 0x0b, 0xfb, 0x6d, 0x5e, 0x13,
-    0xf5, 0x2e, 0x6c, 0xb3, 0x8e, 0xa1, 0x60, 0xaa, 0xd5, 0xf1, 0xd6, 0x11,
-    0xbd, 0x52, 0x25, 0x3d, 0x43, 0x54, 0xab, 0xf2, 0x0a, 0x55, 0xe7, 0x9a,
-    0x4c, 0xa8, 0x7e, 0xfa, 0xcf, 0xca, 0x8a, 0x42, 0x3a, 0x79, 0x7d, 0x9d,
-    0x96, 0xfc, 0x1e, 0x60, 0x5d, 0xe7, 0x83, 0x52, 0x87, 0x19, 0xb3, 0xe0,
-    0x07, 0xa9, 0x17, 0x18, 0xbe, 0x72, 0x0b, 0xff, 0xd4, 0x22, 0x03, 0x7d,
-    0x0c, 0x19, 0x5e, 0x2b, 0xe1, 0x07, 0x86, 0x16, 0xd3, 0x24, 0xe3, 0xc2,
-    0x01, 0x4f, 0x49, 0x2a, 0x15, 0x1c, 0x9f, 0xaa, 0xa6, 0x9f, 0xc4, 0xe1,
-    0xa1, 0x4f, 0xc9, 0xe5, 0x9d, 0x77, 0x71, 0x96, 0x11, 0x08, 0xcf, 0x7d,
-    0x28, 0x37, 0xca, 0x52, 0x7f, 0x78, 0x2b, 0x8b, 0xa3, 0x34, 0x14, 0xd7,
-    0x94, 0xab, 0x2c, 0x3c, 0xd4, 0xc0, 0xb1, 0xde, 0x05, 0xa7, 0xc1, 0x9b,
-    0xc8, 0x7b, 0xa7, 0x3d, 0x1b, 0xa3, 0x1b, 0x63, 0xfc, 0x37, 0xd0, 0xa5,
-    0x25, 0xc6, 0x8f, 0x01, 0xe9, 0x60, 0xd2, 0x18, 0x11, 0x10, 0xed, 0x4b,
-    0x2d, 0x34, 0xff, 0x3e, 0x3d, 0xc3, 0xc8, 0xfb, 0xd9, 0x2c, 0x4e, 0xc7,
-    0xe7, 0x1e, 0x7f, 0xcf, 0xeb, 0x34, 0xda, 0xda, 0x63, 0xfb, 0xaa, 0xdf,
-    0xf9, 0x74, 0xb5, 0xf2, 0xde, 0xd9, 0xaf, 0x60, 0x61, 0xed, 0x5e, 0x8b,
-    0x18, 0xc7, 0x8e, 0x50, 0x60, 0xef, 0xd3, 0x6b, 0x76, 0x68, 0x1f, 0xd4,
-    0x3f, 0xe7, 0xee, 0xfa, 0xfc, 0x3a, 0xab, 0x06, 0xfc, 0x37, 0xde, 0xbd,
-    0x98, 0x4b, 0xf8, 0x44, 0x5c, 0xc5, 0xc1, 0x85, 0xa2, 0x93, 0x96, 0x72,
-    0x5d, 0xba, 0x95, 0x4d, 0xfe, 0x3b, 0xe8, 0xa2, 0x43, 0x9a, 0x52, 0x07,
-    0x94, 0x61, 0x6b, 0x67, 0x58, 0x4b, 0xfb, 0xc1, 0x7b, 0xb7, 0x7a, 0xf9,
-    0x77, 0xad, 0xfd, 0x9e, 0xa3, 0xa2, 0x4a, 0xa4, 0x6d, 0x16, 0x2b, 0xe3,
-    0xab, 0xc7, 0x2b, 0xe4, 0xe2, 0x4e, 0xab, 0xa0, 0xfa, 0x33, 0x56, 0xed,
-    0x27, 0x61, 0x59, 0x70, 0xa1, 0x2a, 0x02, 0x89, 0x67, 0x6e, 0xe6, 0x48,
-    0xd8, 0x30, 0x5f, 0x6e, 0x56, 0x97, 0x02, 0x63, 0xf0, 0xa7, 0xb1, 0x70,
-    0x6d, 0x52, 0x6d, 0x24, 0xed, 0xae, 0xdd, 0xca, 0x66, 0x52, 0x41, 0xc1,
-    0x3b, 0xf7, 0xac, 0xd6, 0x5f, 0xf0, 0x0e, 0x2d, 0x67, 0x0d, 0x1f, 0x32,
-    0x3c, 0xee, 0xcc, 0xa2, 0xd4, 0x0f, 0x2b, 0x2b, 0x99, 0x7e, 0x3e, 0x0f,
-    0x66, 0x1f, 0xa8, 0x23, 0x91, 0xc6, 0xe1, 0x56, 0xe7, 0x14, 0x3a, 0x7c,
-    0xcc, 0x47, 0x07, 0xe4, 0xef, 0xb3, 0xd2, 0xcb, 0x8c, 0x86, 0x93, 0x1d,
-    0x94, 0xc1, 0x5b, 0xf2, 0x32, 0x83, 0x0d, 0xab, 0xfa, 0xf9, 0x79, 0xbe,
-    0xa9, 0xfd, 0xa1, 0x5b, 0x34, 0x6d, 0x1c, 0x7c, 0x45, 0x51, 0x74, 0xd1,
-    0xad, 0xdb, 0xea, 0x85, 0x3b, 0x2e, 0x35, 0x9f, 0xba, 0x52, 0x6e, 0xa5,
-    0x83, 0x54, 0xa3, 0x30, 0x3c, 0xc5, 0x16, 0x8e, 0x5f, 0xf5, 0xa4, 0x81,
-    0x34, 0x60, 0xce, 0x15, 0xc6, 0x5d, 0xe7, 0x15, 0x50, 0xfe, 0x1d, 0x68,
-    0xbc, 0xd3, 0xe4, 0xb3, 0xd0, 0x75, 0x49, 0x9f, 0x25, 0x67, 0x10, 0xfd,
-    0x0a, 0x67, 0xd5, 0x0e, 0xc3, 0xea, 0xe4, 0x25, 0xac, 0xfa, 0xe5, 0x8a,
-    0x5b, 0x65, 0x7e, 0xd5, 0x8c, 0x82, 0x32, 0x32, 0x17, 0xa8, 0x47, 0x78,
-    0xa6, 0x83, 0xaa, 0x00, 0xe0, 0x95, 0x5c, 0xd1, 0xfb, 0x7b, 0xf4, 0x28,
-    0xbf, 0x54, 0xe1, 0x95, 0x17, 0xfa, 0xbd, 0xbf, 0x1d, 0xc7, 0x0e, 0x85,
-    0x96, 0xba, 0x7f, 0xdb, 0x29, 0x77, 0xfe, 0xe6, 0x9e, 0xfc, 0x0d, 0xad,
-    0xfe, 0xe3, 0xdd, 0x18, 0xcd, 0x03, 0xe9, 0x6f, 0xdf, 0x84, 0x82, 0xef,
-    0x7e, 0x7a, 0x18, 0x05, 0x6d, 0xdc, 0xe6, 0xd6, 0xaf, 0xef, 0x39, 0x50,
-    0x4c, 0xf8, 0xba, 0x76, 0xac, 0x93, 0x66, 0xca, 0x0f, 0x1f, 0x6d, 0x94,
-    0xa9, 0xf0, 0x6b, 0xe3, 0xa1, 0x0a, 0xc4, 0x38, 0xec, 0x09, 0x4f, 0x98,
-    0xf4, 0x27, 0xa6, 0x74, 0xcd, 0xf8, 0x49, 0xe3, 0x0e, 0x6b, 0x25, 0x92,
-    0x48, 0xbf, 0x6b, 0x13, 0x4a, 0xfe, 0x5a, 0xb4, 0xbc, 0x97, 0x30, 0xff,
-    0x31, 0x5e, 0x86, 0xc2, 0xed, 0xe6, 0xc0, 0x37, 0x7a, 0xde, 0x84, 0x4a,
-    0x5d, 0x59, 0xf0, 0x01, 0xe7, 0x5a, 0xf8, 0x6b, 0x54, 0xa1, 0xfb, 0x5e,
-    0x5a, 0xbb, 0x22, 0x2e, 0x16, 0xcc, 0xdc, 0x69, 0x06, 0xc3, 0xf8, 0x60,
-    0x95, 0xb1, 0x9c, 0x80, 0x56, 0x90, 0x99, 0x8b, 0xc3, 0x08, 0x7b, 0x07,
-    0x7f, 0x62, 0x99, 0x61, 0x54, 0xd8, 0x5c, 0x69, 0x8f, 0x59, 0xce, 0x04,
-    0xf2, 0x60, 0xbc, 0x19, 0x90, 0xa7, 0x43, 0x3f, 0xdb, 0x24, 0x5b, 0xac,
-    0x6d, 0xce, 0x78, 0xb4, 0x71, 0x06, 0xb1, 0xdc, 0x79, 0x0f, 0x6f, 0x07,
-    0xe2, 0x15, 0x2d, 0x2f, 0x79, 0x94, 0xfa, 0xc2, 0x01, 0x53, 0x6b, 0x2f,
-    0x12, 0x50, 0x42, 0xcd, 0x04, 0xf6, 0xe2, 0xb7, 0x0a, 0xc4, 0x01, 0xd0,
-    0xea, 0xfd, 0xda, 0x3f, 0xab, 0xcc, 0xa1, 0xf3, 0x48, 0xfc, 0x36, 0x08,
-    0xc1, 0xd6, 0xf0, 0x1e, 0x4a, 0x15, 0xbb, 0xc6, 0x2f, 0x1b, 0x02, 0xa5,
-    0x8f, 0x16, 0x57, 0x23, 0xc9, 0xf5, 0x1f, 0xe3, 0xb8, 0xdb, 0xff, 0xb3,
-    0xce, 0xb9, 0x84, 0xf4, 0xae, 0x32, 0xf8, 0x02, 0x73, 0x2b, 0x43, 0xcb,
-    0x81, 0xfb, 0xf0, 0x36, 0x40, 0xe0, 0x4b, 0x98, 0x3c, 0x2e, 0xd5, 0xeb,
-    0x05, 0x15, 0x22, 0x5f, 0x4e, 0x63, 0xe4, 0xf0, 0xbe, 0x1a, 0xec, 0x21,
-    0xb1, 0x81, 0xb6, 0xdd, 0x14, 0x71, 0x88, 0x11, 0xc0, 0x9a, 0xfe, 0xc9,
-    0x2e, 0xde, 0x67, 0xb0, 0x35, 0xe8, 0xea, 0x2a, 0x42, 0x0a, 0x1c, 0x37,
-    0xd9, 0xe9, 0x8e, 0x1b, 0x3e, 0xdb, 0x73, 0x95, 0x53, 0xc1, 0x58, 0x95,
-    0x9a, 0xdc, 0x0d, 0x84, 0x4f, 0x76, 0xc3, 0x42, 0xf1, 0xfa, 0xa3, 0x42,
-    0x80, 0xc6, 0x9d, 0x14, 0xfc, 0x65, 0x9c, 0x96, 0x00, 0xad, 0x8c, 0x47,
-    0x54, 0xb9, 0x9f, 0x3e, 0xbd, 0x7b, 0xfd, 0xf6, 0xef, 0x9f, 0x3e, 0xb9,
-    0xed, 0x55, 0x41, 0xca, 0xd3, 0xa9, 0x56, 0x8a, 0x67, 0x8c, 0x19, 0xbf,
-    0xb1, 0xed, 0xf1, 0xc3, 0x40, 0xb2, 0x1a, 0x45, 0x04, 0x77, 0x90, 0xe2,
-    0xaf, 0x7b, 0xf4, 0xc9, 0x05, 0x43, 0x8e, 0x18, 0xac, 0x20, 0x76, 0x25,
-    0xb2, 0x49, 0x3f, 0x44, 0x3d, 0x92, 0x41, 0x30, 0x87, 0x1f, 0x68, 0x0e,
-    0xa8, 0xcb, 0xc9, 0xe3, 0xad, 0x44, 0xfe, 0xe4, 0x07, 0x45, 0x2b, 0x55,
-    0xcf, 0x6e, 0x46, 0x55, 0xea, 0x3b, 0x7a, 0x2e, 0xb0, 0x83, 0xef, 0xa1,
-    0xe1, 0x43, 0xd0, 0x3c, 0x39, 0x48, 0x6a, 0x39, 0xc9, 0x23, 0x64, 0xd4,
-    0x27, 0x3b, 0x37, 0xb5, 0x14, 0xc1, 0x81, 0x23, 0x5c, 0x44, 0xbd, 0x34,
-    0x75, 0xde, 0xf5, 0xd2, 0xab, 0x2b, 0x0d, 0x18, 0x03, 0x07, 0xe0, 0xe1,
-    0xf6, 0xb2, 0x1f, 0xd0, 0x4f, 0x56, 0x50, 0x6b, 0x8c, 0xdd, 0xdb, 0xa0,
-    0x38, 0xa2, 0x74, 0x03, 0x33, 0x9a, 0xfd, 0xbb, 0x4e, 0x7c, 0x62, 0xeb,
-    0xfc, 0x60, 0xa8, 0x73, 0xb9, 0xec, 0x54, 0x87, 0x42, 0x02, 0x37, 0xba,
-    0x22, 0x43, 0xf0, 0xff, 0x49, 0x32, 0xef, 0x24, 0xe3, 0xba, 0x14, 0x33,
-    0x5e, 0x8f, 0xfd, 0x41, 0x75, 0x9e, 0xf8, 0x15, 0xf4, 0x81, 0x4e, 0xc0,
-    0x71, 0x07, 0x25, 0x29, 0x46, 0x4c, 0x54, 0x92, 0x4d, 0xf2, 0xf5, 0x2e,
-    0x95, 0x7f, 0xc2, 0x72, 0x83, 0x11, 0x96, 0x1a, 0x6d, 0x27, 0xb5, 0x2d,
-    0x03, 0xe8, 0x0c, 0xe4, 0x9b, 0xae, 0xe5, 0x7b, 0x86, 0x31, 0x85, 0x3f,
-    0x73, 0x4f, 0x24, 0xa2, 0x14, 0x82, 0x7c, 0x8d, 0xaa, 0x5f, 0x1d, 0xb6,
-    0x00, 0xdc, 0xc4, 0x21, 0x0a, 0x8f, 0xdc, 0x9a, 0x82, 0x4e, 0x8e, 0x27,
-    0x7b, 0x27, 0x78, 0x2e, 0x78, 0xb0, 0xbf, 0x8f, 0x8f, 0x30, 0x2c, 0xe3,
-    0xbb, 0xe3, 0x5d, 0xc8, 0x3a, 0x9e, 0xf4, 0x4f, 0x5e, 0x0a, 0x57, 0x17,
-    0x01, 0x0c, 0x72, 0xfb, 0x27, 0xc7, 0xc8, 0x15, 0x9c, 0x98, 0xff, 0x06,
-    0xad, 0xfb, 0x95, 0xeb, 0x24, 0xe3, 0xc8, 0xd5, 0xf5, 0x25, 0x39, 0x44,
-    0xc5, 0x44, 0x9c, 0x9a, 0x9d, 0x00, 0x95, 0x91, 0x6c, 0xe2, 0x73, 0x51,
-    0xdb, 0x42, 0xd6, 0x2e, 0x72, 0x3b, 0xce, 0xd6, 0x1d, 0x1e, 0x02, 0x28,
-    0x62, 0x4c, 0xb4, 0x1e, 0x79, 0x5c, 0x8f, 0xa3, 0x7c, 0x77, 0xe6, 0x79,
-    0x32, 0x8b, 0xf3, 0x3b, 0xd7, 0xe1, 0x2f, 0xd9, 0xbb, 0xef, 0x79, 0xb3,
-    0x13, 0x47, 0xeb, 0x8c, 0xcb, 0x67, 0x4b, 0x5f, 0x55, 0x3b, 0xee, 0xbf,
-    0xe3, 0x6b, 0x32, 0xc4, 0x3a, 0xcc, 0x0e, 0x53, 0x04, 0x15, 0x72, 0xa2,
-    0x90, 0xbf, 0x9c, 0xb8, 0x15, 0x87, 0x0b, 0xf7, 0x15, 0xa6, 0x8c, 0xbb,
-    0x81, 0xb9, 0xb7, 0x90, 0xbb, 0xd2, 0xa5, 0xdf, 0x1d, 0xfd, 0x9e, 0x58,
-    0x86, 0xde, 0x1a, 0x79, 0x18, 0x5a, 0xd2, 0xb1, 0xbb, 0xbc, 0x20, 0xe2,
-    0x10, 0x0b, 0xac, 0xcf, 0x0c, 0xc1, 0x86, 0xc2, 0xd3, 0xba, 0xda, 0xb3,
-    0x8c, 0x87, 0x02, 0xc0, 0x46, 0x70, 0x4d, 0x80, 0xe6, 0xb1, 0x03, 0x9c,
-    0x1e, 0xf4, 0x2a, 0xf2, 0x3e, 0xda, 0xf6, 0x65, 0x2c, 0x27, 0xfa, 0x25,
-    0x1b, 0x53, 0x59, 0xd8, 0xd5, 0x16, 0x29, 0x8c, 0x59, 0xeb, 0xe2, 0xaa,
-    0xda, 0xb3, 0xdd, 0xba, 0x51, 0x0d, 0xa6, 0x7a, 0xb2, 0x36, 0x08, 0x15,
-    0x62, 0xf5, 0xda, 0xc9, 0x84, 0x13, 0x5f, 0x64, 0xdc, 0xcd, 0x5a, 0x30,
-    0xfa, 0xed, 0x05, 0xf4, 0x12, 0xa3, 0x93, 0x98, 0x7b, 0x58, 0x69, 0xac,
-    0x39, 0x3a, 0x84, 0x61, 0x56, 0xba, 0x1c, 0x90, 0x13, 0xd3, 0x73, 0x61,
-    0x3a, 0x50, 0x5d, 0xce, 0x12, 0x7a, 0x10, 0xc8, 0xc3, 0x11, 0x42, 0xee,
-    0xbe, 0x0d, 0x23, 0x70, 0x04, 0xdd, 0xe4, 0x3a, 0x79, 0x89, 0x9f, 0xa8,
-    0x24, 0x1d, 0xef, 0xf2, 0x5a, 0x27, 0x0e, 0x3f, 0x7a, 0x08, 0x1d, 0x92,
-    0x9f, 0xd5, 0xac, 0x84, 0x28, 0x39, 0x79, 0x9b, 0x95, 0xf5, 0xe1, 0x00,
-    0xac, 0x80, 0x84, 0x2c, 0x2d, 0x04, 0xc0, 0xf1, 0x9e, 0x74, 0x2c, 0x67,
-    0x31, 0x07, 0x7e, 0xcd, 0x38, 0x80, 0x16, 0xd3, 0x13, 0xa4, 0xf0, 0x97,
-    0xe2, 0x48, 0x5a, 0x70, 0x19, 0xb5, 0x77, 0x0b, 0x53, 0x3a, 0xa9, 0xfa,
-    0x85, 0xa6, 0xd8, 0xfc, 0x05, 0x72, 0x12, 0xd2, 0xd9, 0x43, 0xe8, 0x91,
-    0x9a, 0xe9, 0xfc, 0x07, 0xaa, 0xe2, 0x48, 0xb2, 0xfe, 0x4b, 0x60, 0x57,
-    0xce, 0xeb, 0x57, 0xda, 0x30, 0x82, 0xa5, 0xe9, 0x7d, 0x53, 0x2b, 0x0d,
-    0xcd, 0x6a, 0x86, 0x0b, 0x38, 0x5b, 0x4e, 0x32, 0x68, 0x8a, 0x21, 0xbf,
-    0xae, 0xc3, 0x80, 0x83, 0x11, 0x88, 0xf9, 0x0f, 0x45, 0xc4, 0x79, 0x49,
-    0x68, 0xd1, 0x41, 0xd9, 0xc4, 0x61, 0xcb, 0xd7, 0xdd, 0x82, 0x97, 0xae,
-    0xce, 0x05, 0x28, 0x78, 0x8f, 0x62, 0x9a, 0xe4, 0x37, 0xbf, 0xaf, 0x13,
-    0xb9, 0x18, 0xba, 0x66, 0x92, 0xb9, 0xe4, 0x19, 0xbc, 0xbe, 0x4c, 0x09,
-    0x0a, 0xff, 0x69, 0x4e, 0x16, 0xcd, 0xb7, 0xd5, 0xbc, 0x1f, 0xc9, 0x59,
-    0x54, 0xbc, 0x16, 0x3b, 0xf7, 0x0d, 0x46, 0xcb, 0x48, 0xcc, 0x7e, 0x2c,
-    0x62, 0x39, 0x8a, 0x43, 0xc0, 0xa1, 0x9f, 0x0d, 0x11, 0x96, 0x3e, 0xb1,
-    0x27, 0xba, 0x74, 0x77, 0xf2, 0x23, 0xff, 0xa8, 0xb1, 0xec, 0xbf, 0xa6,
-    0x73, 0x71, 0x78, 0x43, 0xfd, 0x03, 0xed, 0xfd, 0x13, 0xbe, 0xff, 0x1b,
-    0x86, 0x10, 0xb6, 0x96, 0x18, 0x84, 0xcb, 0x8f, 0x6a, 0x18, 0xc2, 0x7d,
-    0xc1, 0x31, 0xd0, 0xa6, 0x83, 0x3f, 0x18, 0xba, 0x7c, 0xf2, 0x7f, 0x01,
-    0xaa, 0x6f, 0x33, 0x06, 0x5b, 0xf3, 0x00, 0x00};
+    0x6b, 0x77, 0xdb, 0x36, 0xb6, 0xe8, 0xf7, 0xfe, 0x0a, 0x9a, 0xcd, 0xd8,
+    0x64, 0x4d, 0xc9, 0x92, 0xfc, 0x48, 0x42, 0x99, 0xd6, 0xcd, 0xab, 0x6d,
+    0xe6, 0x26, 0x69, 0xa6, 0x4e, 0x3a, 0x9d, 0x3a, 0x9e, 0x2c, 0x5a, 0x82,
+    0x25, 0x3a, 0x12, 0xa9, 0x92, 0x94, 0x65, 0xd7, 0xd6, 0xfd, 0xed, 0x77,
+    0xef, 0x0d, 0x80, 0x04, 0x48, 0x50, 0xb6, 0xd3, 0x9e, 0x33, 0xe7, 0xae,
+    0x75, 0x27, 0x53, 0x8b, 0xc4, 0x1b, 0x1b, 0xfb, 0x8d, 0x0d, 0xf0, 0x70,
+    0x63, 0x94, 0x0c, 0xf3, 0xeb, 0x39, 0xb3, 0x26, 0xf9, 0x6c, 0x7a, 0x74,
+    0x88, 0x7f, 0xad, 0x69, 0x18, 0x8f, 0x03, 0x9b, 0xc5, 0x36, 0xbc, 0xb3,
+    0x70, 0x74, 0x74, 0x38, 0x63, 0x79, 0x68, 0x0d, 0x27, 0x61, 0x9a, 0xb1,
+    0x3c, 0xb0, 0x17, 0xf9, 0x79, 0xeb, 0x89, 0x2d, 0x52, 0xe3, 0x70, 0xc6,
+    0x02, 0xfb, 0x32, 0x62, 0xcb, 0x79, 0x92, 0xe6, 0xb6, 0x35, 0x4c, 0xe2,
+    0x9c, 0xc5, 0x50, 0x6a, 0x19, 0x8d, 0xf2, 0x49, 0x30, 0x62, 0x97, 0xd1,
+    0x90, 0xb5, 0xe8, 0xc5, 0x8b, 0xe2, 0x28, 0x8f, 0xc2, 0x69, 0x2b, 0x1b,
+    0x86, 0x53, 0x16, 0x74, 0xa1, 0x89, 0x3c, 0xca, 0xa7, 0xec, 0xe8, 0xed,
+    0xef, 0x79, 0xbe, 0xb7, 0xbb, 0x3b, 0x0e, 0x73, 0xb6, 0x0c, 0xaf, 0x0f,
+    0x77, 0x78, 0xea, 0x61, 0x96, 0x5f, 0xc3, 0xcf, 0xce, 0x77, 0x1b, 0xdf,
+    0xbc, 0x5f, 0xa4, 0xcc, 0xba, 0xec, 0xb6, 0x3b, 0xed, 0xee, 0x37, 0x2f,
+    0x92, 0xf9, 0x75, 0x1a, 0x8d, 0x27, 0xb9, 0xd5, 0xeb, 0x74, 0x77, 0xad,
+    0x7f, 0x85, 0x93, 0x24, 0xd9, 0xf8, 0xe6, 0x0d, 0xf4, 0x12, 0x67, 0x6c,
+    0x64, 0x2d, 0xe2, 0x11, 0x4b, 0xad, 0x7c, 0xc2, 0xac, 0xe7, 0xc7, 0x2f,
+    0x2d, 0x91, 0xdc, 0xfe, 0x66, 0x92, 0xe7, 0xf3, 0xcc, 0xdf, 0xd9, 0x19,
+    0x47, 0xf9, 0x64, 0x71, 0xd6, 0x1e, 0x26, 0xb3, 0x9d, 0x39, 0x34, 0xda,
+    0x1a, 0x66, 0x19, 0x3d, 0xec, 0x9c, 0x4d, 0x93, 0xb3, 0x9d, 0x59, 0x98,
+    0xe5, 0x2c, 0xdd, 0x79, 0xf3, 0xfa, 0xc5, 0xab, 0x77, 0xc7, 0xaf, 0xda,
+    0xb3, 0xd1, 0x37, 0xdf, 0xed, 0x60, 0xff, 0x71, 0x92, 0xce, 0xc2, 0x69,
+    0xf4, 0x07, 0x6b, 0x43, 0x79, 0xeb, 0xf2, 0xdf, 0xbb, 0xed, 0x8e, 0x75,
+    0x6b, 0xbd, 0x7d, 0xfd, 0x41, 0x76, 0x00, 0x6f, 0xd0, 0x72, 0x3b, 0x4a,
+    0x76, 0x8a, 0xa2, 0xca, 0x40, 0x9d, 0xa1, 0x6b, 0xbd, 0x8b, 0x86, 0xc9,
+    0x34, 0xcc, 0xac, 0x1f, 0xc2, 0xe9, 0x34, 0x1c, 0x4f, 0x60, 0x8c, 0x61,
+    0x3c, 0xb2, 0xfe, 0x9e, 0xc4, 0x61, 0x3e, 0x09, 0x63, 0xeb, 0x1d, 0x0b,
+    0xa7, 0xbc, 0x33, 0xab, 0xd2, 0x19, 0xf4, 0xd5, 0xde, 0x35, 0xf5, 0x26,
+    0xe7, 0x11, 0x33, 0x6a, 0x79, 0x47, 0xaf, 0xf7, 0xdd, 0x0e, 0x2e, 0xe5,
+    0xcd, 0x39, 0x2c, 0x47, 0xeb, 0x3c, 0x9c, 0x45, 0xd3, 0x6b, 0x3f, 0x0b,
+    0xe3, 0xac, 0x95, 0xb1, 0x34, 0x3a, 0xef, 0xb7, 0x66, 0x59, 0x2b, 0x67,
+    0x57, 0x79, 0x2b, 0x83, 0xf2, 0xad, 0x70, 0x74, 0xb1, 0xc8, 0x72, 0xbf,
+    0xdb, 0xe9, 0xfc, 0xad, 0xdf, 0x5a, 0xb2, 0xb3, 0x2f, 0x51, 0x6e, 0xce,
+    0x5d, 0x9d, 0x25, 0xa3, 0xeb, 0x9b, 0x59, 0x98, 0x8e, 0xa3, 0xd8, 0xef,
+    0xac, 0xc2, 0x34, 0x8f, 0x86, 0x53, 0xe6, 0x85, 0x59, 0x34, 0x62, 0xde,
+    0x08, 0xd0, 0x21, 0x9a, 0x66, 0xde, 0x79, 0x34, 0x1e, 0x86, 0xf3, 0x3c,
+    0x4a, 0x62, 0x7c, 0x04, 0xd8, 0x7a, 0xe7, 0x49, 0x02, 0x60, 0xf5, 0x10,
+    0x97, 0xf0, 0x67, 0x9c, 0x26, 0x8b, 0xb9, 0x37, 0x0b, 0xa3, 0xd8, 0x9b,
+    0xb1, 0x78, 0xe1, 0xc5, 0xe1, 0xa5, 0x97, 0xb1, 0x21, 0xd5, 0xc8, 0x16,
+    0x33, 0x68, 0xfe, 0xfa, 0x66, 0x14, 0x65, 0xf3, 0x69, 0x78, 0xed, 0xc3,
+    0xb2, 0x0c, 0xbf, 0xac, 0xc2, 0xc5, 0x28, 0x4a, 0xbc, 0x61, 0x18, 0x5f,
+    0x86, 0x99, 0x37, 0x4f, 0x93, 0x71, 0xca, 0xb2, 0xcc, 0xbb, 0x84, 0x5e,
+    0x93, 0xa2, 0x64, 0x14, 0x4f, 0xa3, 0x98, 0xb5, 0xa8, 0x42, 0xff, 0x92,
+    0xe1, 0xd0, 0x00, 0xd5, 0x00, 0x20, 0xe3, 0xd8, 0x3f, 0x0b, 0x33, 0x86,
+    0xb9, 0xbc, 0x21, 0x3f, 0x4e, 0x72, 0xe7, 0x04, 0x11, 0x35, 0x4d, 0xa6,
+    0xd9, 0xa9, 0x5b, 0x34, 0x11, 0x27, 0x31, 0xeb, 0x4f, 0x18, 0xae, 0x19,
+    0xcc, 0xee, 0x64, 0x12, 0x8d, 0x46, 0x2c, 0x3e, 0xf5, 0x72, 0x36, 0x83,
+    0xec, 0x9c, 0x69, 0xe5, 0x56, 0xe1, 0xcd, 0x59, 0x38, 0xfc, 0x82, 0x73,
+    0x89, 0x47, 0x2d, 0x58, 0x81, 0x24, 0xf5, 0xf3, 0x14, 0x20, 0x3c, 0x0f,
+    0x53, 0xc0, 0xff, 0x55, 0xe8, 0x87, 0x30, 0xa3, 0x4b, 0x00, 0x8e, 0x3f,
+    0x49, 0x60, 0x38, 0x37, 0xc9, 0x22, 0xc7, 0x21, 0x20, 0xd8, 0xce, 0xce,
+    0xd2, 0x13, 0xc2, 0xf1, 0xd3, 0x9b, 0xb3, 0x24, 0x05, 0x98, 0xb4, 0xce,
+    0x92, 0x3c, 0x4f, 0x66, 0x7e, 0x77, 0x7e, 0x65, 0x8d, 0xe0, 0x91, 0x8d,
+    0x56, 0x67, 0x5e, 0x06, 0xc3, 0x8b, 0xc7, 0x7c, 0x05, 0x97, 0x7c, 0x50,
+    0x8f, 0x3b, 0x9d, 0xd5, 0xe8, 0x3c, 0xe6, 0x69, 0x44, 0x1e, 0x7e, 0x94,
+    0xc3, 0x14, 0x87, 0xab, 0x49, 0x57, 0x24, 0xc2, 0x8a, 0xf9, 0x3d, 0x36,
+    0xeb, 0x8b, 0x45, 0x6a, 0x1f, 0x3c, 0x66, 0x33, 0xab, 0xb3, 0x82, 0xd7,
+    0x2f, 0xca, 0x80, 0xfd, 0x6f, 0xcf, 0xcf, 0x3b, 0x7d, 0x3e, 0xea, 0x6f,
+    0x3b, 0xd0, 0x6a, 0x06, 0xa8, 0x33, 0x55, 0x9a, 0x78, 0x02, 0x8b, 0x9d,
+    0x2d, 0x60, 0x10, 0x8b, 0xb9, 0x92, 0xfa, 0x78, 0xff, 0x6f, 0x7d, 0x82,
+    0xb2, 0x04, 0x52, 0x7f, 0x9e, 0x64, 0x11, 0x2e, 0x9c, 0x9f, 0x32, 0x00,
+    0x11, 0xcc, 0xb7, 0x11, 0xf4, 0xd8, 0x52, 0x9e, 0xcc, 0xfd, 0x56, 0x7b,
+    0x9f, 0xcd, 0xb0, 0xed, 0x1b, 0x31, 0xe9, 0x56, 0xbb, 0x87, 0x29, 0xd1,
+    0x6c, 0x2c, 0xa0, 0x01, 0x20, 0xca, 0x2e, 0xc7, 0xb4, 0x4a, 0x7e, 0x0a,
+    0xa8, 0xe3, 0xde, 0x20, 0x00, 0xcf, 0xa7, 0xc9, 0xd2, 0xe7, 0x4b, 0xb2,
+    0xe2, 0x78, 0x25, 0x11, 0xb1, 0x0b, 0x33, 0xdc, 0xeb, 0xcc, 0xaf, 0x56,
+    0x93, 0xf4, 0x46, 0xa2, 0xef, 0x59, 0x72, 0x85, 0x43, 0x8e, 0xe2, 0xb1,
+    0x2f, 0x38, 0x12, 0x26, 0xf5, 0x1b, 0x92, 0x8b, 0x35, 0x9f, 0x43, 0xab,
+    0x45, 0x67, 0xe1, 0x22, 0x4f, 0x56, 0xc3, 0x04, 0x50, 0xfb, 0xcb, 0xd9,
+    0x08, 0xd0, 0x8e, 0x79, 0x59, 0x38, 0x9b, 0x6b, 0x24, 0x35, 0x4b, 0xe2,
+    0x04, 0x56, 0x7c, 0xc8, 0xbc, 0xe2, 0xa9, 0x5f, 0x82, 0x0b, 0x06, 0xb6,
+    0x3a, 0x5b, 0xc0, 0x24, 0x63, 0x60, 0x7d, 0xf3, 0x45, 0xee, 0x25, 0xf3,
+    0x9c, 0x23, 0x3f, 0xc0, 0x04, 0x10, 0xde, 0x43, 0x22, 0x03, 0x74, 0x09,
+    0x6f, 0xf8, 0x4a, 0x44, 0x31, 0xf0, 0x85, 0x28, 0xa7, 0x16, 0x8a, 0x97,
+    0x82, 0xda, 0x78, 0x4b, 0xe5, 0xf0, 0x2e, 0xa3, 0x2c, 0x3a, 0x9b, 0x32,
+    0xd9, 0x03, 0x6f, 0xf2, 0x86, 0xe8, 0x96, 0x10, 0xf1, 0x1c, 0xf8, 0x01,
+    0x47, 0x55, 0x51, 0x82, 0x78, 0x3b, 0x0d, 0xe4, 0x04, 0x39, 0x7e, 0xc0,
+    0x93, 0x4f, 0x3d, 0x25, 0x09, 0xe8, 0x8a, 0xe5, 0x5a, 0x0a, 0x2c, 0xd4,
+    0x2c, 0xca, 0x4f, 0x0b, 0xc0, 0x86, 0xf3, 0x39, 0x0b, 0xa1, 0xf9, 0x21,
+    0xf3, 0x79, 0xfd, 0xfe, 0x70, 0x91, 0x66, 0x30, 0xf8, 0x79, 0x12, 0x01,
+    0x40, 0x53, 0xd1, 0xd9, 0x09, 0xd0, 0x4a, 0x08, 0xa3, 0x1b, 0x9d, 0xaa,
+    0xdd, 0x16, 0x89, 0x37, 0xa2, 0xd2, 0x88, 0x9d, 0x87, 0x8b, 0x69, 0x2e,
+    0x2a, 0xf9, 0x7e, 0x6b, 0x96, 0xfc, 0xd1, 0x3a, 0x4f, 0x86, 0x8b, 0xac,
+    0x15, 0xc5, 0x31, 0x30, 0x0b, 0xaa, 0x57, 0x4f, 0x2f, 0x30, 0xa5, 0x3f,
+    0x0f, 0x47, 0x23, 0x5c, 0xce, 0xce, 0x8a, 0x8a, 0xde, 0xa8, 0xe8, 0xc9,
+    0x39, 0xe2, 0x4a, 0x99, 0xcd, 0x70, 0xc2, 0x86, 0x5f, 0x60, 0xc5, 0xf5,
+    0x49, 0x87, 0xc0, 0x14, 0x4e, 0x4d, 0xa8, 0x53, 0x50, 0xa7, 0x86, 0x39,
+    0x4a, 0x6a, 0xa5, 0x77, 0xde, 0x5e, 0xbc, 0x98, 0x9d, 0xb1, 0xf4, 0x14,
+    0x46, 0x2d, 0x5a, 0xa4, 0x21, 0xb7, 0xb2, 0x79, 0x14, 0xb7, 0x54, 0x74,
+    0x68, 0x28, 0x0d, 0x8c, 0x42, 0x2f, 0x7d, 0x23, 0xa6, 0x43, 0xf8, 0xa8,
+    0x2e, 0x0d, 0x2c, 0xc4, 0x70, 0x62, 0x5c, 0x1a, 0xc4, 0x82, 0xf3, 0x88,
+    0x4d, 0x47, 0xfd, 0xaf, 0x22, 0x08, 0x43, 0x2f, 0xe5, 0xf8, 0x78, 0x42,
+    0x6b, 0x88, 0x1d, 0x4d, 0x0d, 0x13, 0x6a, 0xaa, 0x30, 0x02, 0x39, 0x95,
+    0x86, 0xc8, 0x2c, 0x4c, 0x23, 0x26, 0x44, 0xa5, 0x21, 0x03, 0x06, 0xca,
+    0xe5, 0x45, 0x7e, 0x98, 0x25, 0xd3, 0x68, 0x64, 0x65, 0xd1, 0x14, 0xf0,
+    0xbe, 0x20, 0x06, 0xab, 0x37, 0x2f, 0x81, 0xdf, 0xde, 0x05, 0xfe, 0x61,
+    0xb5, 0x0f, 0x7a, 0xf4, 0xf3, 0x18, 0x99, 0xc9, 0x94, 0x8d, 0x59, 0x3c,
+    0x32, 0x61, 0x49, 0x41, 0x72, 0x3a, 0x99, 0x4b, 0xca, 0xac, 0xb1, 0xdb,
+    0x1c, 0x11, 0x56, 0xb2, 0x69, 0x20, 0xd3, 0x69, 0x38, 0xcf, 0x98, 0x2f,
+    0x1f, 0xfa, 0x22, 0x03, 0x29, 0x5f, 0xb4, 0x3f, 0xf2, 0xf2, 0xc9, 0x4d,
+    0xd9, 0x5f, 0x9b, 0xb3, 0x2c, 0x4f, 0x4a, 0x13, 0x4d, 0x88, 0x6c, 0x44,
+    0x33, 0xd4, 0x9a, 0x42, 0x90, 0x17, 0x6d, 0x52, 0x47, 0x90, 0x09, 0xce,
+    0xc2, 0x2b, 0xae, 0x2f, 0x71, 0x81, 0xac, 0x2c, 0x7e, 0x5f, 0x97, 0x8a,
+    0xbc, 0xca, 0xf8, 0x66, 0xca, 0xf2, 0x5c, 0x19, 0x43, 0xab, 0xbd, 0x0b,
+    0x8c, 0xa7, 0x4f, 0x8c, 0x00, 0x44, 0x11, 0x0c, 0x0f, 0x53, 0x61, 0x82,
+    0xd1, 0x0c, 0x98, 0x52, 0x36, 0x67, 0x6c, 0xd4, 0x57, 0x79, 0xd8, 0xf7,
+    0x29, 0x63, 0xc7, 0xc0, 0x2f, 0xbc, 0x67, 0x69, 0x34, 0x4b, 0x3c, 0xfb,
+    0x65, 0x9a, 0x00, 0xc0, 0x31, 0xc5, 0xf6, 0x7e, 0x64, 0x00, 0x76, 0x64,
+    0xe7, 0x98, 0x19, 0x4e, 0x3d, 0x45, 0x85, 0x90, 0x63, 0x51, 0x10, 0xac,
+    0x96, 0x76, 0x3e, 0x65, 0x4a, 0x22, 0xe8, 0x1c, 0x98, 0xa0, 0x16, 0xa4,
+    0x02, 0x2a, 0x8a, 0x26, 0x69, 0x04, 0x38, 0x08, 0x22, 0x33, 0x8d, 0xfe,
+    0x80, 0x31, 0x86, 0x53, 0x2d, 0x77, 0x14, 0xa5, 0x5c, 0x4f, 0x10, 0xa4,
+    0xdd, 0x57, 0x3b, 0x6a, 0xd1, 0x6a, 0xa6, 0xc9, 0xd2, 0x5a, 0xa6, 0xe1,
+    0xbc, 0x2f, 0xbb, 0xab, 0x24, 0x9b, 0x4a, 0x4a, 0x6c, 0x44, 0x81, 0xd5,
+    0x12, 0x64, 0x40, 0x43, 0x03, 0x19, 0x0b, 0x3a, 0x4e, 0xd9, 0x14, 0x31,
+    0x17, 0x00, 0xf3, 0x17, 0x9f, 0x67, 0x34, 0xd5, 0x58, 0xfd, 0xaf, 0x19,
+    0x1b, 0x45, 0xa1, 0x05, 0x32, 0x95, 0xd4, 0x3c, 0x07, 0x5b, 0x98, 0xc0,
+    0x3a, 0x52, 0xd9, 0x14, 0xb4, 0x4c, 0x5a, 0x7e, 0xd7, 0x33, 0x64, 0x70,
+    0xb5, 0xc1, 0xbd, 0x21, 0xc4, 0xb3, 0xe4, 0x1a, 0xeb, 0x2b, 0xbf, 0x6a,
+    0x27, 0x73, 0x96, 0x86, 0xad, 0x24, 0x9e, 0x5e, 0x5b, 0x7e, 0x2b, 0x69,
+    0x81, 0x70, 0x22, 0xee, 0xe8, 0xc9, 0xf2, 0x4b, 0xc0, 0x4b, 0x05, 0x23,
+    0xf6, 0x76, 0x81, 0x28, 0x78, 0xde, 0xc2, 0xac, 0x31, 0xfd, 0x91, 0xa0,
+    0xfe, 0xd1, 0xaf, 0xe0, 0x92, 0x00, 0xb3, 0xd6, 0x9a, 0x48, 0xab, 0xc8,
+    0x79, 0x10, 0xed, 0x55, 0x94, 0x23, 0xc2, 0x12, 0x03, 0xb2, 0x4e, 0x86,
+    0xa0, 0xa3, 0x66, 0xdf, 0x05, 0x7c, 0x0c, 0xa7, 0x0d, 0x8a, 0xa9, 0x1c,
+    0x63, 0xab, 0xeb, 0x15, 0x4f, 0xfa, 0x73, 0x4f, 0x79, 0xd1, 0x9e, 0xf7,
+    0x94, 0x97, 0x5d, 0xe5, 0x59, 0x4d, 0xdf, 0x57, 0x9e, 0x0f, 0x94, 0xe7,
+    0x27, 0xe5, 0x73, 0x47, 0x6b, 0x49, 0xef, 0x50, 0xef, 0xa5, 0xa7, 0xbd,
+    0xed, 0x6a, 0x6f, 0x7b, 0xda, 0xdb, 0xbe, 0xf6, 0x76, 0xa0, 0xbd, 0x3d,
+    0xd6, 0xde, 0x9e, 0x68, 0x6f, 0x4f, 0xd5, 0xb7, 0x9e, 0xfe, 0xb2, 0xab,
+    0x3c, 0x97, 0xd3, 0xea, 0x69, 0xc3, 0xef, 0x69, 0x03, 0xee, 0xe9, 0x2d,
+    0x68, 0x03, 0xee, 0x69, 0x03, 0xde, 0xd5, 0x5f, 0xd4, 0xe7, 0x7d, 0xe5,
+    0xb9, 0x84, 0x9a, 0x56, 0x7b, 0x4f, 0x29, 0xb4, 0xaf, 0xc2, 0x4f, 0x03,
+    0xc3, 0xbe, 0x56, 0xea, 0x40, 0x79, 0x2e, 0x9b, 0xd5, 0x20, 0xf5, 0x58,
+    0x6d, 0xea, 0xb1, 0x9e, 0x53, 0x56, 0xd1, 0x00, 0x88, 0xf0, 0xfb, 0x4f,
+    0x60, 0x3b, 0xc7, 0xc7, 0x1b, 0xce, 0xc4, 0xf7, 0xda, 0xdd, 0x83, 0x83,
+    0xc7, 0x7f, 0x5b, 0x19, 0x71, 0xb8, 0x57, 0x96, 0x7b, 0xd2, 0xde, 0x85,
+    0xff, 0xa9, 0xe5, 0x9e, 0x68, 0x0b, 0x22, 0x8a, 0x75, 0x7b, 0xed, 0x7d,
+    0xb5, 0xd0, 0x81, 0xb6, 0x08, 0xb2, 0xd0, 0x41, 0xfb, 0xa0, 0xd2, 0xe9,
+    0xbe, 0xc8, 0xea, 0x75, 0xca, 0xd4, 0xfd, 0xb2, 0x46, 0xaf, 0xd3, 0x7e,
+    0x52, 0xe9, 0x7e, 0x4f, 0x5b, 0x07, 0x59, 0x4e, 0xe9, 0xfc, 0xb1, 0x92,
+    0xfc, 0xb4, 0x36, 0xcb, 0x5d, 0x6d, 0x4d, 0x44, 0xb9, 0xdd, 0xdd, 0xca,
+    0x2c, 0x55, 0x2c, 0x7a, 0xaa, 0x94, 0x7b, 0xac, 0xce, 0xb2, 0x57, 0x8c,
+    0x7e, 0x4f, 0x19, 0xbd, 0x4e, 0xaa, 0x88, 0x69, 0xb2, 0x50, 0xb7, 0x3a,
+    0x7b, 0x75, 0x39, 0xf6, 0x6b, 0x13, 0xed, 0xe9, 0x34, 0x2d, 0x0a, 0xee,
+    0xab, 0x5d, 0x29, 0x0b, 0xb0, 0x5f, 0x5b, 0xd0, 0xbd, 0x2a, 0x9a, 0xca,
+    0x92, 0x4f, 0x6a, 0x93, 0x95, 0xf3, 0x38, 0x50, 0x1b, 0xaf, 0xd0, 0xc5,
+    0x13, 0x59, 0x46, 0x5f, 0xe9, 0x83, 0x0a, 0xfd, 0xcb, 0x52, 0xb5, 0xa5,
+    0x56, 0x96, 0xe5, 0x71, 0x6d, 0x55, 0x9f, 0x54, 0x48, 0x5b, 0x16, 0x54,
+    0x7b, 0x52, 0xd6, 0xe1, 0x71, 0x75, 0x5d, 0xf7, 0x8a, 0x29, 0x3c, 0x51,
+    0xa6, 0xd0, 0xab, 0x2c, 0xc5, 0x81, 0x2c, 0x53, 0x5d, 0x6e, 0x9d, 0x23,
+    0x3d, 0x2e, 0xe6, 0xfa, 0x44, 0x5b, 0x6f, 0x9d, 0xed, 0xf6, 0x94, 0x45,
+    0x79, 0x5a, 0x5d, 0xda, 0x9e, 0xb2, 0x32, 0x4f, 0x6b, 0x4b, 0x6b, 0x14,
+    0x22, 0x3a, 0xaf, 0xdb, 0x2f, 0x26, 0x44, 0x0e, 0x0e, 0x9e, 0x2c, 0xf4,
+    0xee, 0xb5, 0xac, 0xa3, 0x66, 0x67, 0xf4, 0x97, 0x93, 0x28, 0x67, 0xc4,
+    0x38, 0x50, 0x9d, 0x25, 0xd5, 0xa2, 0xc2, 0x36, 0x66, 0xa0, 0x03, 0x4e,
+    0x19, 0xe7, 0x1c, 0x3c, 0x65, 0xc8, 0xd0, 0x68, 0xaa, 0xd8, 0x50, 0x85,
+    0x46, 0xb2, 0x00, 0xa1, 0xd8, 0x1a, 0xa5, 0xe1, 0x98, 0xbb, 0x26, 0xb4,
+    0x64, 0x6e, 0xef, 0x89, 0x0c, 0x34, 0x8f, 0x0c, 0xa9, 0x59, 0x3d, 0xb1,
+    0x5e, 0xea, 0xe1, 0x66, 0x8f, 0x06, 0x25, 0x83, 0x71, 0x56, 0x68, 0xbf,
+    0xfd, 0xc2, 0xa0, 0x57, 0x6b, 0xb4, 0xb8, 0xa6, 0xfd, 0x70, 0xb5, 0xf5,
+    0x2e, 0xb5, 0x47, 0x6b, 0xbe, 0x59, 0x03, 0x52, 0x8b, 0x59, 0xda, 0x82,
+    0xff, 0x17, 0xc9, 0x03, 0xd1, 0xba, 0xaa, 0xf2, 0xa8, 0xa6, 0xbe, 0x70,
+    0x16, 0xa0, 0xb2, 0x5f, 0x98, 0x34, 0x68, 0xca, 0x20, 0x38, 0x84, 0x8b,
+    0x66, 0x6f, 0x6f, 0x4f, 0x3c, 0xa6, 0xe3, 0xb3, 0xd0, 0xe9, 0x78, 0xf8,
+    0xaf, 0xfd, 0xc4, 0xed, 0xd7, 0x0c, 0xa5, 0x6f, 0x9f, 0x3e, 0x7d, 0x2a,
+    0x53, 0x71, 0x7d, 0x2d, 0xc5, 0x29, 0xd5, 0xaf, 0x79, 0xac, 0xbe, 0x65,
+    0x07, 0xf8, 0x8f, 0x8f, 0xbd, 0x34, 0xd0, 0x38, 0x66, 0x88, 0x05, 0x47,
+    0xf3, 0x78, 0x91, 0xf9, 0x60, 0x71, 0xe9, 0xf0, 0x23, 0xb7, 0x96, 0x06,
+    0x79, 0xbf, 0xbe, 0x18, 0xc2, 0xf9, 0xa5, 0x74, 0x1c, 0xcd, 0xc2, 0x31,
+    0x2b, 0x2c, 0x84, 0x31, 0xb6, 0x0e, 0x43, 0x73, 0x90, 0x9e, 0xc2, 0xd4,
+    0x9b, 0xb2, 0xf3, 0xdc, 0x02, 0x68, 0xf2, 0x07, 0xee, 0x21, 0xf2, 0xce,
+    0xd3, 0x64, 0xe6, 0x28, 0xf3, 0x70, 0x3d, 0x1a, 0x3d, 0xe8, 0xda, 0xc9,
+    0xdc, 0x01, 0x91, 0xe0, 0xa9, 0x40, 0xe9, 0xec, 0xbb, 0xae, 0x97, 0x27,
+    0x8e, 0x9a, 0xd6, 0x75, 0x5d, 0xb7, 0xdf, 0x38, 0x06, 0xde, 0x75, 0x39,
+    0x14, 0xa5, 0xa7, 0x6a, 0xcb, 0x56, 0xb5, 0xb7, 0xae, 0xa9, 0xe1, 0x3f,
+    0xd9, 0xe0, 0xaa, 0x0e, 0x53, 0xc5, 0x7b, 0xa8, 0xad, 0x81, 0xf0, 0x31,
+    0x6a, 0x15, 0x78, 0x9a, 0xee, 0xce, 0x98, 0x84, 0x23, 0xb0, 0x78, 0x3a,
+    0x16, 0xfe, 0x43, 0x5c, 0xd1, 0x7a, 0x84, 0x51, 0x44, 0x31, 0x58, 0xdd,
+    0x1e, 0xe6, 0x1e, 0x54, 0x72, 0x7b, 0x22, 0xb3, 0xff, 0xd7, 0xb5, 0x23,
+    0x4d, 0x69, 0xe9, 0x7b, 0xd4, 0x66, 0x24, 0x5d, 0x44, 0x9e, 0x31, 0xd5,
+    0x37, 0x4c, 0xb8, 0xcc, 0x34, 0xf0, 0x82, 0x22, 0xaf, 0x8e, 0xad, 0x8a,
+    0x37, 0x4a, 0xa1, 0x97, 0xfa, 0x6a, 0x52, 0x6a, 0x82, 0xe4, 0x9f, 0x5f,
+    0xfb, 0xed, 0x3d, 0xc9, 0xab, 0xe3, 0x04, 0x79, 0x38, 0x18, 0x92, 0xac,
+    0xe2, 0x64, 0xe1, 0x30, 0x12, 0x14, 0xa4, 0xbf, 0x0b, 0xfe, 0xde, 0x62,
+    0x97, 0x80, 0x0a, 0x19, 0xf7, 0x79, 0xe8, 0x34, 0x45, 0x4e, 0x02, 0xdd,
+    0xd1, 0xac, 0x15, 0x98, 0x83, 0x8d, 0x1e, 0xa6, 0xd7, 0xfa, 0x24, 0x39,
+    0x3b, 0x07, 0x98, 0x85, 0xc6, 0xb2, 0xa1, 0xb1, 0x70, 0xdd, 0x7d, 0x0d,
+    0x8b, 0xf1, 0xf8, 0x09, 0x7b, 0x2c, 0x79, 0xce, 0xf9, 0xf9, 0xf9, 0x9d,
+    0x0c, 0x53, 0xfa, 0x63, 0x2a, 0xbc, 0xa2, 0x7c, 0x27, 0xf9, 0xa8, 0x70,
+    0xa7, 0x6e, 0xb7, 0xdb, 0x94, 0xa7, 0x63, 0xcb, 0x5d, 0x5d, 0xfb, 0xe7,
+    0x51, 0x9a, 0xe5, 0xad, 0xe1, 0x24, 0x9a, 0x4a, 0x3f, 0x4f, 0x0b, 0xd8,
+    0x41, 0x0b, 0xf9, 0x86, 0xc2, 0xb2, 0xfa, 0x9a, 0x83, 0xbd, 0x9a, 0x7b,
+    0x67, 0x27, 0x60, 0xb3, 0x1a, 0xfa, 0xa0, 0x91, 0x37, 0x77, 0xd2, 0x94,
+    0x9d, 0x0a, 0x65, 0xa1, 0x58, 0x53, 0xf4, 0xd0, 0xaa, 0x0e, 0x59, 0x02,
+    0xfc, 0xa9, 0x67, 0xce, 0x1c, 0x85, 0x39, 0x5b, 0x97, 0x07, 0x72, 0x92,
+    0xb5, 0x40, 0x43, 0x09, 0xa7, 0x77, 0x95, 0x6a, 0xca, 0x67, 0xb3, 0x30,
+    0x6a, 0xac, 0x3c, 0x03, 0x41, 0x35, 0x69, 0xca, 0x14, 0x3e, 0xcc, 0x86,
+    0xdc, 0x39, 0x18, 0xfe, 0x28, 0x43, 0x9b, 0xf2, 0x85, 0xc3, 0xb0, 0x21,
+    0x37, 0x67, 0xd3, 0xe6, 0xac, 0xab, 0xbc, 0x31, 0x6f, 0xcd, 0x44, 0x17,
+    0x69, 0x63, 0x93, 0x4b, 0xc6, 0xbe, 0x68, 0x79, 0xc2, 0x53, 0xaf, 0xa4,
+    0x14, 0x1e, 0x44, 0x4d, 0x58, 0xb7, 0x0f, 0x40, 0x5a, 0x1b, 0x15, 0xc6,
+    0xba, 0x88, 0x1e, 0x0e, 0x87, 0x26, 0x96, 0x41, 0xfc, 0x51, 0x30, 0xd6,
+    0x5d, 0xf8, 0xef, 0xdb, 0xd1, 0x68, 0xd4, 0xbf, 0x3b, 0x5f, 0x25, 0xbc,
+    0x3d, 0xc0, 0x36, 0xb3, 0xce, 0xf9, 0xf5, 0x6a, 0x5e, 0x09, 0x22, 0xbe,
+    0x71, 0x86, 0x70, 0x3a, 0x75, 0xff, 0xa7, 0xce, 0xfe, 0xaf, 0x98, 0xa7,
+    0x4a, 0x8d, 0xe5, 0x3c, 0x7b, 0x38, 0xcf, 0xfd, 0x42, 0x8b, 0x34, 0x17,
+    0xd7, 0x64, 0x90, 0x91, 0x84, 0xef, 0x2c, 0xa1, 0x10, 0xf2, 0xbd, 0xca,
+    0xae, 0x2f, 0xc5, 0x89, 0x7a, 0x6d, 0x11, 0x4e, 0xda, 0x6b, 0x8b, 0xc8,
+    0x4d, 0x8a, 0x75, 0x65, 0x0a, 0x32, 0x5f, 0x5b, 0x4a, 0xee, 0x0e, 0xac,
+    0x2b, 0x83, 0x24, 0x7f, 0x47, 0x01, 0x20, 0xfc, 0xf5, 0x25, 0xee, 0x04,
+    0x0c, 0x32, 0x81, 0xb5, 0x05, 0x88, 0x15, 0xd4, 0x4b, 0x08, 0xdb, 0xa9,
+    0x96, 0x2e, 0xd9, 0x42, 0x55, 0x61, 0xab, 0x28, 0x3c, 0xdd, 0xde, 0xd3,
+    0x73, 0x16, 0xae, 0x25, 0xad, 0xaf, 0x6b, 0xa1, 0xb2, 0xc1, 0xb5, 0x76,
+    0x6a, 0xe7, 0xd1, 0xf4, 0x0e, 0xe8, 0xf0, 0x3d, 0xb1, 0xca, 0x48, 0xf2,
+    0x49, 0x14, 0x17, 0x82, 0x9c, 0x46, 0xd1, 0x97, 0x59, 0x48, 0x95, 0x68,
+    0xf1, 0x58, 0x86, 0xe1, 0xf1, 0x47, 0x39, 0x32, 0xaf, 0x96, 0x43, 0x7d,
+    0x49, 0x55, 0x82, 0xd8, 0x49, 0xc7, 0xb8, 0xd3, 0x61, 0xa6, 0x38, 0x65,
+    0xa7, 0x71, 0x0d, 0xd5, 0xdd, 0xab, 0x94, 0x42, 0x79, 0xf7, 0x2e, 0x7f,
+    0x77, 0x49, 0x4e, 0x81, 0x77, 0x16, 0xe3, 0x54, 0x78, 0x67, 0x31, 0x41,
+    0x89, 0x77, 0x96, 0x2b, 0xa8, 0xf1, 0xce, 0x92, 0x82, 0x22, 0xef, 0x2c,
+    0x87, 0x54, 0x79, 0x8f, 0x42, 0x40, 0x99, 0x77, 0x97, 0xba, 0x17, 0xe0,
+    0x90, 0x42, 0xef, 0x2c, 0x44, 0x54, 0x6a, 0x2e, 0xc5, 0x29, 0xd5, 0x9c,
+    0x27, 0xa9, 0xb5, 0xbe, 0x25, 0xad, 0xea, 0xf5, 0x06, 0x7b, 0x39, 0x64,
+    0x23, 0xc8, 0x10, 0x6f, 0xc3, 0x70, 0xd4, 0x1b, 0xed, 0xae, 0x25, 0xe6,
+    0xff, 0x92, 0x0e, 0x4e, 0x60, 0xe4, 0x23, 0xf4, 0x82, 0x98, 0xe6, 0x6b,
+    0xcc, 0x2b, 0xe6, 0x5b, 0xe4, 0x1a, 0xf4, 0x7f, 0xc6, 0x98, 0xec, 0xf8,
+    0xf1, 0xe3, 0xc7, 0x15, 0xb6, 0x03, 0x62, 0xbb, 0x3e, 0x51, 0xe2, 0x0f,
+    0x20, 0x9a, 0x2f, 0x41, 0xd7, 0x18, 0x35, 0x71, 0x49, 0x53, 0xbe, 0xce,
+    0x2d, 0x65, 0x09, 0x11, 0x07, 0xf1, 0xed, 0xd9, 0xd3, 0xbd, 0x70, 0xef,
+    0x49, 0x65, 0x00, 0xec, 0xe9, 0x6e, 0xaf, 0x37, 0xba, 0x1f, 0xdf, 0x93,
+    0x0d, 0xde, 0x97, 0x0b, 0xde, 0xab, 0xbc, 0xca, 0x13, 0xf5, 0x0a, 0x92,
+    0x43, 0x36, 0x0f, 0x55, 0x44, 0x67, 0x08, 0x87, 0x61, 0x8f, 0x42, 0x5e,
+    0x1a, 0x74, 0xa3, 0xfa, 0xba, 0x94, 0x96, 0x98, 0xba, 0xce, 0xb3, 0xc5,
+    0x34, 0x8f, 0xe6, 0x18, 0x44, 0xa4, 0xc6, 0x07, 0x28, 0xe5, 0xa6, 0xe1,
+    0x19, 0x9b, 0xea, 0x7c, 0xd5, 0x42, 0x2d, 0x46, 0x2d, 0x53, 0xec, 0xb8,
+    0x17, 0x96, 0x9c, 0xbe, 0xab, 0xde, 0xe1, 0x1b, 0xea, 0x55, 0x47, 0x1e,
+    0x6f, 0x9f, 0x6f, 0xb2, 0x6b, 0xac, 0xba, 0xaf, 0xec, 0x5c, 0x97, 0x2d,
+    0x11, 0x4b, 0xe7, 0x3d, 0xc8, 0x50, 0x27, 0x4c, 0x94, 0xc8, 0xb6, 0xbb,
+    0xbb, 0xdb, 0xaf, 0x07, 0x42, 0x09, 0x90, 0xb0, 0x7d, 0xfc, 0xa7, 0xf4,
+    0x8b, 0x5b, 0xac, 0xc3, 0x2f, 0x6c, 0xb4, 0xd6, 0x72, 0x32, 0x15, 0xaa,
+    0x5a, 0x50, 0x4d, 0x65, 0xcc, 0x96, 0xd4, 0xba, 0xd2, 0x77, 0x95, 0xab,
+    0x59, 0x56, 0xa6, 0x42, 0x84, 0x8e, 0x77, 0x94, 0xa9, 0x59, 0x61, 0xa6,
+    0x42, 0x75, 0x6b, 0xcc, 0x54, 0xca, 0x64, 0x95, 0x99, 0xca, 0xd5, 0xad,
+    0x33, 0x53, 0xa9, 0x8a, 0x95, 0x66, 0x2e, 0xa2, 0x5b, 0x6b, 0xc6, 0x32,
+    0xf7, 0x00, 0x66, 0xc5, 0x7a, 0x33, 0x15, 0xa9, 0x5a, 0x71, 0x45, 0x19,
+    0x22, 0x09, 0x53, 0x46, 0xcd, 0xcc, 0x2b, 0x72, 0x0a, 0x73, 0x4f, 0xc7,
+    0x73, 0x49, 0x56, 0x14, 0x74, 0xd2, 0x69, 0x44, 0x4f, 0xcd, 0x64, 0xba,
+    0x6f, 0x0b, 0x64, 0xb8, 0x41, 0x0b, 0x3c, 0x69, 0xc2, 0xa6, 0xf3, 0x16,
+    0xb7, 0xa9, 0x3c, 0x43, 0x21, 0x1e, 0x59, 0x66, 0xc8, 0xa8, 0x4f, 0x49,
+    0xe6, 0xc8, 0x29, 0xa9, 0x79, 0x33, 0x96, 0x65, 0xe1, 0x98, 0x89, 0x8e,
+    0xee, 0x15, 0x55, 0xc9, 0x2d, 0xcb, 0xd5, 0x9a, 0x0e, 0x6e, 0xea, 0x6e,
+    0xf2, 0xe6, 0x79, 0x8a, 0x80, 0x4c, 0xe1, 0xbe, 0xaf, 0x70, 0x0b, 0xdd,
+    0xee, 0x5a, 0x57, 0x53, 0xb0, 0x3d, 0x65, 0x8f, 0x85, 0xfc, 0x2e, 0xfd,
+    0xfb, 0xcf, 0xa8, 0xe0, 0x61, 0x65, 0x18, 0x65, 0x07, 0x9d, 0xf1, 0xe8,
+    0xf5, 0xbc, 0x73, 0x10, 0x59, 0x11, 0x95, 0x28, 0x38, 0x2e, 0x54, 0xed,
+    0xea, 0x3c, 0x57, 0x84, 0xfa, 0xe0, 0xba, 0xb5, 0x88, 0xcf, 0xb3, 0x51,
+    0x4d, 0xe2, 0x18, 0xca, 0xdc, 0x54, 0xfc, 0xf1, 0x30, 0xba, 0xea, 0x76,
+    0x41, 0xbd, 0x17, 0x0e, 0x92, 0x0a, 0x97, 0x2f, 0xb8, 0x6c, 0x67, 0x7e,
+    0xd5, 0x54, 0xa5, 0x8a, 0x56, 0x5a, 0x66, 0x03, 0x4d, 0xc8, 0xe1, 0x60,
+    0xbb, 0x25, 0xe4, 0x3a, 0x56, 0xab, 0xab, 0x38, 0xc1, 0xa4, 0x87, 0xb0,
+    0x1e, 0x39, 0x4a, 0xd1, 0xa1, 0xdd, 0x3b, 0x86, 0x54, 0x97, 0xd0, 0xa6,
+    0x81, 0x09, 0xb1, 0xfc, 0x07, 0x40, 0x70, 0xc4, 0xae, 0xfc, 0xdd, 0x3b,
+    0x9a, 0x2c, 0x5d, 0x89, 0x77, 0x37, 0xac, 0xb8, 0x1d, 0x71, 0xc0, 0xf5,
+    0xa9, 0xed, 0x81, 0xec, 0xc2, 0xff, 0x3a, 0x85, 0xcc, 0xd3, 0xc5, 0xe6,
+    0xda, 0xfe, 0x15, 0x8f, 0xe3, 0x43, 0x86, 0xa2, 0x3a, 0x2a, 0x1b, 0x47,
+    0x75, 0xcf, 0xd1, 0x3c, 0x60, 0x04, 0x95, 0x5e, 0x5b, 0xbd, 0xfa, 0x3a,
+    0x03, 0x18, 0x04, 0x40, 0xee, 0xec, 0x5e, 0xf7, 0x29, 0x0b, 0xfd, 0xa3,
+    0x89, 0x70, 0xba, 0xf5, 0x5d, 0xdb, 0x5a, 0x19, 0xd3, 0xfe, 0x76, 0xad,
+    0x90, 0xba, 0x95, 0xde, 0x58, 0xa8, 0xdb, 0xea, 0xd5, 0xc2, 0x02, 0x0c,
+    0x85, 0x76, 0x8b, 0x30, 0x87, 0x35, 0x85, 0xea, 0xa1, 0x14, 0x4a, 0xa1,
+    0x06, 0x66, 0x7f, 0x1f, 0xee, 0x2c, 0xa8, 0x8f, 0x7c, 0xdc, 0x9a, 0x7a,
+    0x75, 0x70, 0x70, 0xd0, 0xc0, 0xe8, 0xca, 0xdd, 0xc7, 0xf6, 0x93, 0xc7,
+    0x15, 0x16, 0x2b, 0xba, 0xac, 0x90, 0xb8, 0xd2, 0x64, 0xad, 0xb2, 0x08,
+    0x7a, 0xa3, 0xdd, 0xd9, 0x6c, 0x98, 0x32, 0x16, 0xf3, 0xe0, 0xb7, 0x22,
+    0xa0, 0xd1, 0xf2, 0xf7, 0x9e, 0x00, 0x6b, 0x70, 0x6f, 0x94, 0x69, 0x8b,
+    0xbd, 0x18, 0x2d, 0xd6, 0x58, 0x62, 0xc0, 0xe3, 0x1a, 0xcf, 0xad, 0x0b,
+    0x55, 0xef, 0xff, 0xbb, 0xd2, 0xff, 0x5f, 0x71, 0xa5, 0xab, 0xf6, 0x88,
+    0x66, 0x06, 0x18, 0xc3, 0x5a, 0x15, 0x8e, 0x54, 0x5f, 0x6e, 0x25, 0xd7,
+    0xb0, 0xde, 0xb5, 0x5c, 0x75, 0xc1, 0x8d, 0x99, 0xf5, 0x15, 0x6f, 0x2c,
+    0xd6, 0x58, 0x40, 0x5b, 0xf3, 0x5a, 0xae, 0xb6, 0xe8, 0xb5, 0x5c, 0x7d,
+    0xd5, 0x6b, 0xd9, 0xd5, 0x65, 0xaf, 0x15, 0xd0, 0xd7, 0xbd, 0x96, 0xad,
+    0x2c, 0xbc, 0x21, 0xaf, 0x5c, 0xf9, 0x7a, 0xe6, 0xba, 0x09, 0x2b, 0x6b,
+    0x5f, 0xcb, 0xa3, 0xc5, 0xaf, 0xac, 0x75, 0xe7, 0x61, 0x1a, 0x9c, 0x01,
+    0x51, 0x14, 0xa5, 0x0e, 0xb9, 0x5c, 0xbf, 0xc9, 0xf4, 0xfc, 0x1a, 0x2d,
+    0xad, 0xf3, 0x50, 0x66, 0x7c, 0x0f, 0xfe, 0xcc, 0xc7, 0xa5, 0x30, 0x4a,
+    0xb2, 0xa5, 0xb5, 0x1d, 0x05, 0x30, 0xb0, 0x9f, 0x00, 0xef, 0x14, 0x9d,
+    0xe3, 0x79, 0xa8, 0x9b, 0xaf, 0xdf, 0xc2, 0xc0, 0xea, 0xad, 0xf3, 0xe8,
+    0x0a, 0x94, 0xc5, 0x42, 0xbd, 0xa2, 0xd7, 0x3e, 0x09, 0x85, 0x0e, 0xa9,
+    0x58, 0x9d, 0x7e, 0x55, 0x2d, 0xa2, 0x6a, 0x51, 0xce, 0x66, 0x9e, 0xf2,
+    0x3e, 0x8d, 0xb2, 0xfc, 0xa6, 0xa6, 0xa4, 0xad, 0xaa, 0x25, 0xf0, 0x8f,
+    0x38, 0x8a, 0x44, 0x5b, 0xdc, 0x35, 0x3f, 0x42, 0xa7, 0xda, 0x89, 0x12,
+    0x1e, 0x54, 0x14, 0x16, 0x1e, 0x0c, 0x65, 0xed, 0xa8, 0x38, 0x9e, 0x18,
+    0x83, 0x92, 0xfa, 0xb0, 0xe2, 0x2f, 0x15, 0xf8, 0x1a, 0x83, 0x57, 0xea,
+    0xc1, 0x58, 0x5a, 0xc3, 0x45, 0x7c, 0xb9, 0xa2, 0x46, 0xdc, 0xbb, 0x8e,
+    0x55, 0x05, 0x82, 0x49, 0x1e, 0xdf, 0x5d, 0xd5, 0x30, 0x3b, 0x73, 0xc1,
+    0xea, 0xd2, 0x98, 0x4b, 0x65, 0x6c, 0x1e, 0x02, 0x04, 0x92, 0x74, 0x6d,
+    0xdc, 0xda, 0x3a, 0x1b, 0xae, 0xe8, 0xac, 0xda, 0xf9, 0x8d, 0x89, 0x43,
+    0x53, 0x2e, 0x29, 0x7f, 0x69, 0x25, 0x64, 0xa1, 0xd4, 0xed, 0xc3, 0xb3,
+    0x2c, 0x99, 0x2e, 0x72, 0xc6, 0xf1, 0x8f, 0x80, 0xcc, 0x51, 0xb0, 0x8e,
+    0x26, 0x66, 0xac, 0x34, 0x4f, 0xb5, 0xe8, 0x55, 0x41, 0x6b, 0x3a, 0x20,
+    0xc1, 0x17, 0x53, 0x04, 0x57, 0xa9, 0xed, 0xf0, 0xb8, 0x91, 0x23, 0x43,
+    0x1b, 0x2a, 0x60, 0xc9, 0x2d, 0xcb, 0x03, 0x9b, 0x78, 0xc0, 0xc8, 0xd1,
+    0xba, 0xa9, 0x0a, 0xb5, 0xab, 0x3a, 0x57, 0x6d, 0xf8, 0x61, 0x56, 0xd4,
+    0x3b, 0xaa, 0x60, 0xb1, 0x1f, 0x9e, 0xe7, 0x65, 0xb0, 0x9c, 0x50, 0xdb,
+    0xf6, 0x49, 0x6d, 0xe3, 0xe7, 0x09, 0xec, 0x4f, 0xbd, 0xfd, 0xe7, 0x4f,
+    0x6c, 0x85, 0x7f, 0xd0, 0x29, 0xbd, 0x7b, 0x20, 0xd6, 0xdd, 0xbd, 0x6a,
+    0x7d, 0xbc, 0xb2, 0xd5, 0x36, 0x41, 0x75, 0xc3, 0xd3, 0x2d, 0x78, 0xec,
+    0x45, 0x9e, 0x91, 0x69, 0x5d, 0xfb, 0x3c, 0xb5, 0x5f, 0xa4, 0x5c, 0xc9,
+    0xb3, 0x78, 0xc6, 0x9a, 0x8d, 0x14, 0xb2, 0x86, 0x34, 0x1e, 0xd6, 0xd0,
+    0xdd, 0xa4, 0x66, 0x9e, 0x92, 0x21, 0x48, 0x53, 0x99, 0x25, 0x9f, 0x93,
+    0x3a, 0x4b, 0x42, 0xab, 0xe2, 0x68, 0x96, 0x4c, 0xe7, 0x0d, 0x22, 0xde,
+    0xe6, 0xc9, 0x62, 0x38, 0xd1, 0x0d, 0xf1, 0xce, 0xfd, 0x11, 0xd8, 0x48,
+    0xbf, 0x9e, 0x91, 0xa8, 0xeb, 0x6e, 0x61, 0x74, 0x16, 0x4b, 0xc6, 0x59,
+    0x9a, 0x57, 0xdc, 0xdb, 0xba, 0x7a, 0x00, 0xbb, 0x10, 0x1c, 0x70, 0x5e,
+    0x9c, 0x83, 0xec, 0x92, 0xb0, 0x2d, 0x0c, 0xf8, 0x76, 0x19, 0x3a, 0xf9,
+    0xb5, 0x53, 0x32, 0x3a, 0x89, 0x15, 0x7f, 0xb5, 0xca, 0x0f, 0xab, 0x47,
+    0x18, 0x17, 0xf3, 0x39, 0x4b, 0x87, 0x61, 0x56, 0xec, 0x4d, 0xec, 0x1f,
+    0xec, 0x8f, 0x0e, 0xf6, 0x56, 0x55, 0xa1, 0x50, 0xee, 0x5c, 0x18, 0x19,
+    0xd4, 0x3a, 0xb7, 0x3a, 0x95, 0xac, 0x44, 0x9e, 0xad, 0x15, 0x40, 0x0d,
+    0x8e, 0x17, 0xad, 0x9d, 0x9b, 0x22, 0x66, 0x6c, 0xdf, 0x94, 0x6d, 0x55,
+    0x09, 0xb3, 0x16, 0x29, 0x59, 0x3f, 0x54, 0xbc, 0x96, 0xa1, 0x61, 0x23,
+    0xd5, 0x81, 0x6a, 0xde, 0x92, 0x3b, 0xbb, 0xc2, 0x0d, 0x20, 0x8d, 0x9e,
+    0x45, 0xa8, 0xd8, 0xba, 0x5e, 0x9a, 0xca, 0xd0, 0xf1, 0x54, 0x0c, 0x33,
+    0xab, 0x05, 0xfa, 0x3d, 0xf0, 0x44, 0x5d, 0x9f, 0xcd, 0xe6, 0xf9, 0x75,
+    0x6b, 0xc8, 0xa6, 0xd3, 0xcc, 0xcf, 0x26, 0xc9, 0xd2, 0xb4, 0x6d, 0x72,
+    0x86, 0xff, 0xd4, 0xf6, 0x2d, 0x71, 0x04, 0x5d, 0xe9, 0x5e, 0x1c, 0xab,
+    0xa5, 0xf3, 0xd2, 0xd6, 0x93, 0xfd, 0xbf, 0xed, 0x74, 0xad, 0xb0, 0x7a,
+    0xa8, 0xad, 0xf0, 0x60, 0xd1, 0x8e, 0x45, 0x2d, 0x4e, 0x5b, 0xeb, 0x21,
+    0x97, 0x98, 0x22, 0x5e, 0x27, 0x72, 0x4e, 0x5c, 0xd6, 0x55, 0x47, 0x27,
+    0x27, 0xc6, 0x71, 0xbf, 0x08, 0xa1, 0x54, 0xb8, 0x7b, 0xf5, 0xc4, 0x6f,
+    0xbf, 0x7a, 0xd4, 0xb7, 0xc9, 0xdf, 0x27, 0x07, 0x00, 0xc8, 0x6a, 0x5a,
+    0xd4, 0x0e, 0xfe, 0x53, 0x0e, 0x7b, 0xd7, 0xd4, 0xe8, 0xea, 0x91, 0x6d,
+    0xd2, 0xb8, 0x2b, 0x73, 0xbd, 0x0f, 0x62, 0x52, 0xd9, 0x56, 0x32, 0x1a,
+    0x19, 0xcb, 0x7f, 0x7b, 0xde, 0xc3, 0x7f, 0x5a, 0xd9, 0x2c, 0x4f, 0xa3,
+    0x39, 0x3a, 0x8c, 0x53, 0x1f, 0xcc, 0x23, 0x4e, 0xac, 0x4e, 0x2f, 0x6e,
+    0x75, 0xdd, 0x7b, 0x37, 0xc1, 0xc1, 0xca, 0x78, 0x9f, 0x4d, 0x9b, 0x48,
+    0x75, 0x04, 0x51, 0xea, 0xe1, 0xa5, 0x06, 0x47, 0x30, 0x82, 0xd2, 0x9b,
+    0x75, 0x54, 0x6d, 0x4b, 0xae, 0x9a, 0xd6, 0x82, 0xc2, 0x07, 0x75, 0x5c,
+    0xd0, 0x72, 0x0a, 0xb4, 0x28, 0x17, 0x1e, 0x07, 0xd6, 0xe9, 0x3f, 0x64,
+    0xb0, 0x6a, 0x83, 0x0f, 0x19, 0xee, 0xe1, 0x0e, 0xbf, 0x44, 0xe3, 0x7f,
+    0xc8, 0x5d, 0x1a, 0xc2, 0x43, 0xa4, 0x39, 0x87, 0xc0, 0xc4, 0x13, 0x4e,
+    0xb3, 0x7d, 0x44, 0x6b, 0xe9, 0x1c, 0x02, 0xce, 0x32, 0x53, 0x0e, 0x6d,
+    0xe0, 0x4b, 0xed, 0xb5, 0xa7, 0xbf, 0x57, 0x5f, 0xf7, 0xf4, 0xf7, 0x5d,
+    0xfd, 0xb5, 0x92, 0xbb, 0xaf, 0xbf, 0x1e, 0xe8, 0xaf, 0x4f, 0xb4, 0xd7,
+    0x4e, 0xb5, 0xed, 0xda, 0x58, 0x6a, 0xbd, 0xf7, 0xaa, 0x09, 0xbb, 0xd5,
+    0x84, 0xbd, 0x6a, 0xc2, 0x7e, 0x35, 0xe1, 0xa0, 0x9a, 0xf0, 0xb8, 0x9a,
+    0xf0, 0xa4, 0x9a, 0xf0, 0xb4, 0x92, 0xd0, 0xab, 0xbd, 0xef, 0xea, 0xaf,
+    0x1a, 0x18, 0x7a, 0xd5, 0x89, 0xf6, 0xaa, 0xf3, 0xea, 0xd5, 0x1a, 0xac,
+    0xce, 0xab, 0x57, 0x9d, 0xd7, 0x6e, 0xed, 0xbd, 0xf2, 0xba, 0xaf, 0xbf,
+    0x6a, 0xa0, 0xaf, 0x36, 0xb6, 0xa7, 0x97, 0xde, 0xaf, 0xac, 0x43, 0x15,
+    0x84, 0xfb, 0xd5, 0xe2, 0x07, 0xfa, 0xab, 0xd6, 0x57, 0x15, 0xdc, 0x8f,
+    0x2b, 0x8d, 0x3f, 0xae, 0xe5, 0x6b, 0xd5, 0xab, 0x6b, 0xf1, 0x9f, 0x3b,
+    0x8c, 0x28, 0xa8, 0xa1, 0xe1, 0x3c, 0xa2, 0x81, 0x94, 0xd6, 0x9c, 0x4a,
+    0xac, 0x53, 0x43, 0xe3, 0xd9, 0xc4, 0x3a, 0x1d, 0xad, 0x3b, 0xa1, 0xc8,
+    0x89, 0xd0, 0x70, 0x48, 0x51, 0x2c, 0x63, 0xd3, 0x39, 0xc5, 0x3a, 0x2d,
+    0x37, 0x9c, 0x56, 0x14, 0x2b, 0xd6, 0x74, 0x60, 0xb1, 0xce, 0x22, 0xd6,
+    0x1d, 0x5b, 0xac, 0x63, 0x66, 0xe3, 0xe1, 0x45, 0x4e, 0x56, 0x86, 0xf3,
+    0x8b, 0x26, 0x4e, 0xb2, 0xee, 0x14, 0xa3, 0xe4, 0x2b, 0x4d, 0x07, 0x19,
+    0x0d, 0x3c, 0xb0, 0xe1, 0x38, 0xa3, 0xe4, 0x3f, 0x4d, 0x27, 0x1a, 0x4d,
+    0xec, 0x68, 0xdd, 0xb9, 0x46, 0x4e, 0xb6, 0x86, 0xa3, 0x8d, 0x26, 0x36,
+    0xd6, 0x74, 0xc0, 0xd1, 0xc4, 0xe1, 0xd6, 0x1c, 0x73, 0x94, 0xfc, 0xaf,
+    0xe9, 0xa4, 0xa3, 0x89, 0x1d, 0x9a, 0xcf, 0x3b, 0x4a, 0x3e, 0xd9, 0x74,
+    0xe4, 0x91, 0xb3, 0x19, 0xc3, 0xa9, 0x47, 0x13, 0x87, 0x5c, 0x73, 0xf6,
+    0xd1, 0xc4, 0x3f, 0x9b, 0x4e, 0x40, 0x9a, 0x84, 0xca, 0xda, 0x73, 0x90,
+    0x92, 0xf5, 0x36, 0x1d, 0x85, 0xbc, 0x43, 0x98, 0xd6, 0xb8, 0x74, 0xe5,
+    0x58, 0xe4, 0x6a, 0xad, 0xe4, 0xde, 0x7b, 0xa2, 0xca, 0xed, 0xd9, 0x48,
+    0x69, 0x1b, 0x5f, 0x6a, 0xaf, 0x3d, 0xfd, 0xbd, 0xfa, 0xba, 0xa7, 0xbf,
+    0xef, 0xea, 0xaf, 0x95, 0xdc, 0x7d, 0xfd, 0xf5, 0x40, 0x7f, 0x7d, 0xa2,
+    0xbd, 0x76, 0xaa, 0x6d, 0xd7, 0xc6, 0x52, 0xeb, 0xbd, 0x57, 0x4d, 0xd8,
+    0xad, 0x26, 0xec, 0x55, 0x13, 0xf6, 0xab, 0x09, 0x07, 0xd5, 0x84, 0xc7,
+    0xd5, 0x84, 0x27, 0xd5, 0x84, 0xa7, 0x95, 0x84, 0x5e, 0xed, 0x7d, 0x57,
+    0x7f, 0xd5, 0xc0, 0xd0, 0xab, 0x4e, 0xb4, 0x57, 0x9d, 0x57, 0xaf, 0xd6,
+    0x60, 0x75, 0x5e, 0xbd, 0xea, 0xbc, 0x76, 0x6b, 0xef, 0x95, 0xd7, 0x7d,
+    0xfd, 0x55, 0x03, 0x7d, 0xb5, 0xb1, 0x3d, 0xbd, 0xf4, 0x7e, 0x65, 0x1d,
+    0xaa, 0x20, 0xdc, 0xaf, 0x16, 0x3f, 0xd0, 0x5f, 0xb5, 0xbe, 0xaa, 0xe0,
+    0x7e, 0x5c, 0x69, 0xfc, 0x71, 0x2d, 0x5f, 0xab, 0x5e, 0x5d, 0x8b, 0xff,
+    0x9c, 0xdc, 0x16, 0xd4, 0xd0, 0x20, 0xb7, 0x0d, 0xa4, 0xb4, 0x46, 0x6e,
+    0xd7, 0xa9, 0xa1, 0x51, 0x6e, 0xd7, 0xe9, 0x68, 0x9d, 0xdc, 0xe6, 0x44,
+    0x68, 0x90, 0xdb, 0x62, 0x19, 0x9b, 0xe4, 0x76, 0x9d, 0x96, 0x1b, 0xe4,
+    0xb6, 0x58, 0xb1, 0x26, 0xb9, 0x5d, 0x67, 0x11, 0xeb, 0xe4, 0x76, 0x1d,
+    0x33, 0x1b, 0xe5, 0x36, 0x27, 0x2b, 0x83, 0xdc, 0x36, 0x71, 0x92, 0x75,
+    0x72, 0x5b, 0xf2, 0x95, 0x26, 0xb9, 0x6d, 0xe0, 0x81, 0x0d, 0x72, 0x5b,
+    0xf2, 0x9f, 0x26, 0xb9, 0x6d, 0x62, 0x47, 0xeb, 0xe4, 0x36, 0x27, 0x5b,
+    0x83, 0xdc, 0x36, 0xb1, 0xb1, 0x26, 0xb9, 0x6d, 0xe2, 0x70, 0x6b, 0xe4,
+    0xb6, 0xe4, 0x7f, 0x4d, 0x72, 0xdb, 0xc4, 0x0e, 0xcd, 0x72, 0x5b, 0xf2,
+    0xc9, 0x26, 0xb9, 0xcd, 0xd9, 0x8c, 0x41, 0x6e, 0x9b, 0x38, 0xe4, 0x1a,
+    0xb9, 0x6d, 0xe2, 0x9f, 0x4d, 0x72, 0xdb, 0x24, 0x54, 0xd6, 0xca, 0x6d,
+    0xc9, 0x7a, 0x9b, 0xe4, 0xf6, 0x1d, 0xc2, 0xb4, 0xc6, 0xa5, 0x1f, 0x24,
+    0xb7, 0x0f, 0xf6, 0x54, 0xb9, 0x3d, 0x1d, 0x2b, 0x6d, 0xe3, 0x4b, 0xed,
+    0xb5, 0xa7, 0xbf, 0x57, 0x5f, 0xf7, 0xf4, 0xf7, 0x5d, 0xfd, 0xb5, 0x92,
+    0xbb, 0xaf, 0xbf, 0x1e, 0xe8, 0xaf, 0x4f, 0xb4, 0xd7, 0x4e, 0xb5, 0xed,
+    0xda, 0x58, 0x6a, 0xbd, 0xf7, 0xaa, 0x09, 0xbb, 0xd5, 0x84, 0xbd, 0x6a,
+    0xc2, 0x7e, 0x35, 0xe1, 0xa0, 0x9a, 0xf0, 0xb8, 0x9a, 0xf0, 0xa4, 0x9a,
+    0xf0, 0xb4, 0x92, 0xd0, 0xab, 0xbd, 0xef, 0xea, 0xaf, 0x1a, 0x18, 0x7a,
+    0xd5, 0x89, 0xf6, 0xaa, 0xf3, 0xea, 0xd5, 0x1a, 0xac, 0xce, 0xab, 0x57,
+    0x9d, 0xd7, 0x6e, 0xed, 0xbd, 0xf2, 0xba, 0xaf, 0xbf, 0x6a, 0xa0, 0xaf,
+    0x36, 0xb6, 0xa7, 0x97, 0xde, 0xaf, 0xac, 0x43, 0x15, 0x84, 0xfb, 0xd5,
+    0xe2, 0x07, 0xfa, 0xab, 0xd6, 0x57, 0x15, 0xdc, 0x8f, 0x2b, 0x8d, 0x3f,
+    0xae, 0xe5, 0x6b, 0xd5, 0xab, 0x6b, 0xf1, 0x9f, 0x93, 0xdb, 0x82, 0x1a,
+    0x1a, 0xe4, 0xb6, 0x81, 0x94, 0xd6, 0xc8, 0xed, 0x3a, 0x35, 0x34, 0xca,
+    0xed, 0x3a, 0x1d, 0xad, 0x93, 0xdb, 0x9c, 0x08, 0x0d, 0x72, 0x5b, 0x2c,
+    0x63, 0x93, 0xdc, 0xae, 0xd3, 0x72, 0x83, 0xdc, 0x16, 0x2b, 0xd6, 0x24,
+    0xb7, 0xeb, 0x2c, 0x62, 0x9d, 0xdc, 0xae, 0x63, 0x66, 0xa3, 0xdc, 0xe6,
+    0x64, 0x65, 0x90, 0xdb, 0x26, 0x4e, 0xb2, 0x4e, 0x6e, 0x4b, 0xbe, 0xd2,
+    0x24, 0xb7, 0x0d, 0x3c, 0xb0, 0x41, 0x6e, 0x4b, 0xfe, 0xd3, 0x24, 0xb7,
+    0x4d, 0xec, 0x68, 0x9d, 0xdc, 0xe6, 0x64, 0x6b, 0x90, 0xdb, 0x26, 0x36,
+    0xd6, 0x24, 0xb7, 0x4d, 0x1c, 0x6e, 0x8d, 0xdc, 0x96, 0xfc, 0xaf, 0x49,
+    0x6e, 0x9b, 0xd8, 0xa1, 0x59, 0x6e, 0x4b, 0x3e, 0xd9, 0x24, 0xb7, 0x39,
+    0x9b, 0x31, 0xc8, 0x6d, 0x13, 0x87, 0x5c, 0x23, 0xb7, 0x4d, 0xfc, 0xb3,
+    0x49, 0x6e, 0x9b, 0x84, 0xca, 0x5a, 0xb9, 0x2d, 0x59, 0x6f, 0x93, 0xdc,
+    0xbe, 0x43, 0x98, 0xd6, 0xb8, 0xf4, 0x83, 0xe4, 0xf6, 0x93, 0x8e, 0x2a,
+    0xb7, 0xaf, 0xa6, 0x4a, 0xdb, 0xf8, 0x52, 0x7b, 0xed, 0xe9, 0xef, 0xd5,
+    0xd7, 0x3d, 0xfd, 0x7d, 0x57, 0x7f, 0xad, 0xe4, 0xee, 0xeb, 0xaf, 0x07,
+    0xfa, 0xeb, 0x13, 0xed, 0xb5, 0x53, 0x6d, 0xbb, 0x36, 0x96, 0x5a, 0xef,
+    0xbd, 0x6a, 0xc2, 0x6e, 0x35, 0x61, 0xaf, 0x9a, 0xb0, 0x5f, 0x4d, 0x38,
+    0xa8, 0x26, 0x3c, 0xae, 0x26, 0x3c, 0xa9, 0x26, 0x3c, 0xad, 0x24, 0xf4,
+    0x6a, 0xef, 0xbb, 0xfa, 0xab, 0x06, 0x86, 0x5e, 0x75, 0xa2, 0xbd, 0xea,
+    0xbc, 0x7a, 0xb5, 0x06, 0xab, 0xf3, 0xea, 0x55, 0xe7, 0xb5, 0x5b, 0x7b,
+    0xaf, 0xbc, 0xee, 0xeb, 0xaf, 0x1a, 0xe8, 0xab, 0x8d, 0xed, 0xe9, 0xa5,
+    0xf7, 0x2b, 0xeb, 0x50, 0x05, 0xe1, 0x7e, 0xb5, 0xf8, 0x81, 0xfe, 0xaa,
+    0xf5, 0x55, 0x05, 0xf7, 0xe3, 0x4a, 0xe3, 0x8f, 0x6b, 0xf9, 0x5a, 0xf5,
+    0xea, 0x5a, 0xfc, 0xe7, 0xe4, 0xb6, 0xa0, 0x86, 0x06, 0xb9, 0x6d, 0x20,
+    0xa5, 0x35, 0x72, 0xbb, 0x4e, 0x0d, 0x8d, 0x72, 0xbb, 0x4e, 0x47, 0xeb,
+    0xe4, 0x36, 0x27, 0x42, 0x83, 0xdc, 0x16, 0xcb, 0xd8, 0x24, 0xb7, 0xeb,
+    0xb4, 0xdc, 0x20, 0xb7, 0xc5, 0x8a, 0x35, 0xc9, 0xed, 0x3a, 0x8b, 0x58,
+    0x27, 0xb7, 0xeb, 0x98, 0xd9, 0x28, 0xb7, 0x39, 0x59, 0x19, 0xe4, 0xb6,
+    0x89, 0x93, 0xac, 0x93, 0xdb, 0x92, 0xaf, 0x34, 0xc9, 0x6d, 0x03, 0x0f,
+    0x6c, 0x90, 0xdb, 0x92, 0xff, 0x34, 0xc9, 0x6d, 0x13, 0x3b, 0x5a, 0x27,
+    0xb7, 0x39, 0xd9, 0x1a, 0xe4, 0xb6, 0x89, 0x8d, 0x35, 0xc9, 0x6d, 0x13,
+    0x87, 0x5b, 0x23, 0xb7, 0x25, 0xff, 0x6b, 0x92, 0xdb, 0x26, 0x76, 0x68,
+    0x96, 0xdb, 0x92, 0x4f, 0x36, 0xc9, 0x6d, 0xce, 0x66, 0x0c, 0x72, 0xdb,
+    0xc4, 0x21, 0xd7, 0xc8, 0x6d, 0x13, 0xff, 0x6c, 0x92, 0xdb, 0x26, 0xa1,
+    0xb2, 0x56, 0x6e, 0x4b, 0xd6, 0xdb, 0x24, 0xb7, 0xef, 0x10, 0xa6, 0x35,
+    0x2e, 0x5d, 0x95, 0xdb, 0x95, 0x0d, 0xf7, 0x49, 0x4f, 0x86, 0x31, 0x63,
+    0x88, 0x22, 0x9e, 0xbd, 0x9d, 0x74, 0x0d, 0x81, 0xcd, 0xf2, 0xbe, 0x6a,
+    0xa5, 0x2c, 0x45, 0x77, 0x60, 0x94, 0x5e, 0x18, 0xe1, 0x95, 0x7a, 0xe5,
+    0x55, 0xf7, 0xab, 0xf6, 0x34, 0x19, 0xb7, 0xca, 0x1c, 0xf5, 0x52, 0xff,
+    0xe1, 0x39, 0xfe, 0x93, 0x61, 0x5c, 0x7b, 0x78, 0x80, 0x2d, 0x65, 0x14,
+    0x5b, 0x22, 0x59, 0x61, 0x19, 0x42, 0x02, 0xb6, 0xbf, 0x16, 0xf0, 0x3a,
+    0x87, 0x29, 0x69, 0xe1, 0x70, 0x86, 0x1b, 0xec, 0xea, 0x47, 0x8a, 0xf8,
+    0x67, 0x22, 0xe4, 0xb5, 0x60, 0x18, 0xc4, 0xd0, 0xad, 0x5d, 0xfc, 0xb5,
+    0x6a, 0x67, 0xd7, 0x59, 0xce, 0x66, 0xad, 0xb3, 0x3c, 0xd6, 0x87, 0x1b,
+    0xee, 0x0e, 0x77, 0x87, 0xea, 0x7d, 0x53, 0x05, 0xf8, 0x76, 0xf8, 0x87,
+    0x47, 0x28, 0xd6, 0xe1, 0x10, 0xb4, 0xa0, 0x68, 0x9e, 0x1f, 0x6d, 0x9c,
+    0x2f, 0x62, 0xba, 0xfd, 0xd9, 0xc9, 0x3d, 0xe6, 0xde, 0xd8, 0xf2, 0xd5,
+    0x0e, 0x02, 0x8c, 0x39, 0x4f, 0xce, 0xad, 0x11, 0x3b, 0x07, 0x98, 0x6c,
+    0x6e, 0xf2, 0xdf, 0x76, 0x38, 0x1b, 0x0d, 0xf8, 0xa3, 0x53, 0x54, 0x75,
+    0x6f, 0x52, 0x96, 0x2f, 0xd2, 0xd8, 0x62, 0x4e, 0xee, 0xae, 0x5c, 0x9f,
+    0x7e, 0x9c, 0x7c, 0x12, 0x65, 0x5e, 0x51, 0x66, 0xe8, 0xde, 0x5c, 0x86,
+    0xa9, 0xf5, 0xf1, 0xc2, 0x1b, 0x05, 0x4a, 0x45, 0xf9, 0x68, 0x2d, 0xa0,
+    0x8e, 0x6c, 0x26, 0x5e, 0x4c, 0xa7, 0xd0, 0xff, 0xe0, 0x38, 0x47, 0x81,
+    0x02, 0x19, 0xfe, 0x1f, 0x27, 0x3f, 0xb6, 0x01, 0xd2, 0x53, 0x78, 0x3e,
+    0xbd, 0xbd, 0xb5, 0x93, 0xb3, 0x0b, 0x36, 0xcc, 0xed, 0x55, 0x51, 0x3b,
+    0x2c, 0x6b, 0xab, 0x53, 0xc0, 0x46, 0xcb, 0x42, 0x49, 0xa5, 0x8b, 0x8d,
+    0x20, 0xdf, 0xdc, 0xcc, 0xa1, 0xa3, 0xf6, 0x32, 0x8a, 0x01, 0xd8, 0x65,
+    0xc9, 0xcc, 0x58, 0xb2, 0x1d, 0x27, 0x23, 0xf6, 0x01, 0x23, 0xf1, 0xa1,
+    0xca, 0xcb, 0x9f, 0x5e, 0x7c, 0x7c, 0xfb, 0xea, 0xdd, 0x87, 0xcf, 0xef,
+    0x7e, 0x7a, 0xf9, 0xaa, 0xac, 0x19, 0x29, 0x03, 0x11, 0xa3, 0xac, 0x0e,
+    0x63, 0xaa, 0x34, 0x8e, 0xc5, 0x37, 0x37, 0x37, 0x12, 0xfa, 0xf9, 0x89,
+    0xca, 0xb7, 0xc7, 0x2c, 0x7f, 0x9f, 0x26, 0x79, 0x82, 0xf0, 0xff, 0xe9,
+    0x1c, 0x72, 0x82, 0x40, 0xe4, 0xcc, 0x65, 0x72, 0xd9, 0xd8, 0x04, 0x1b,
+    0x43, 0xc0, 0xb2, 0x60, 0x63, 0x03, 0x06, 0x69, 0x4f, 0x59, 0x3c, 0xce,
+    0x27, 0x76, 0x14, 0x5b, 0x34, 0x64, 0xfe, 0xea, 0xc5, 0xc1, 0xb2, 0x8d,
+    0x15, 0xa1, 0x74, 0xbf, 0x0a, 0xa6, 0x8d, 0x20, 0x2e, 0x86, 0xe0, 0xd8,
+    0x61, 0x9a, 0x86, 0xd7, 0x30, 0xe6, 0xf8, 0xf6, 0xb6, 0x13, 0x04, 0x01,
+    0x03, 0x68, 0xf3, 0x83, 0x14, 0x25, 0x46, 0x00, 0x32, 0x74, 0x0e, 0xe1,
+    0x0f, 0x6b, 0x75, 0x2d, 0xec, 0x47, 0x99, 0xdb, 0xb9, 0x32, 0xb7, 0xbc,
+    0x9d, 0x32, 0x50, 0x38, 0x86, 0xcc, 0xd9, 0xf1, 0xfd, 0x9d, 0xb1, 0x67,
+    0xef, 0xd8, 0x6e, 0x99, 0xe4, 0x9c, 0x3c, 0x6b, 0xfd, 0x76, 0xba, 0xed,
+    0xf2, 0xdf, 0x93, 0xb0, 0xf5, 0xc7, 0xa9, 0x8b, 0x85, 0x1e, 0x75, 0x3f,
+    0x3f, 0xea, 0xe9, 0x05, 0x21, 0xef, 0xd3, 0xe8, 0x54, 0x94, 0x34, 0x17,
+    0xfa, 0x8c, 0xa9, 0x2d, 0x48, 0xc9, 0x93, 0x37, 0xc9, 0x92, 0xa5, 0x2f,
+    0xc2, 0x8c, 0x39, 0xca, 0xb8, 0x62, 0x75, 0x5c, 0x38, 0x68, 0x36, 0x60,
+    0x27, 0xf9, 0xa9, 0x8f, 0x7f, 0x82, 0x98, 0x2d, 0xad, 0x9f, 0xd9, 0xf8,
+    0xd5, 0xd5, 0xdc, 0xb1, 0x9d, 0x7f, 0xdf, 0x7e, 0xfa, 0x94, 0xb9, 0xf6,
+    0x76, 0xbe, 0x6d, 0x3b, 0xf0, 0x74, 0xfb, 0xc8, 0xb5, 0x95, 0x76, 0xe6,
+    0x9c, 0x4c, 0x04, 0x08, 0x05, 0x60, 0x36, 0x0a, 0xc0, 0xdc, 0xde, 0xbe,
+    0x3c, 0x41, 0x10, 0x9c, 0x0e, 0x98, 0xcf, 0xb6, 0xed, 0xf9, 0x95, 0x82,
+    0xa2, 0xa9, 0x82, 0x19, 0x32, 0x80, 0x92, 0x96, 0x69, 0xf0, 0x46, 0xa0,
+    0x76, 0x5b, 0x26, 0xbb, 0xfe, 0xb2, 0x3d, 0x0b, 0xe7, 0x32, 0xe5, 0x1d,
+    0xa0, 0x9d, 0x42, 0x49, 0xe5, 0x4c, 0xba, 0x88, 0x88, 0x12, 0x29, 0x07,
+    0xb9, 0x7f, 0x89, 0x97, 0xcc, 0x77, 0x56, 0xca, 0x78, 0x47, 0x7c, 0xbc,
+    0x88, 0x20, 0xb1, 0x97, 0x02, 0x49, 0x49, 0x8c, 0xf0, 0x31, 0x74, 0x2f,
+    0x75, 0xe2, 0xa0, 0xd3, 0x8f, 0x0f, 0xd3, 0x7e, 0xbc, 0xbd, 0xed, 0x22,
+    0xbd, 0x9e, 0xc4, 0xa7, 0x41, 0x0e, 0x7f, 0xfa, 0xf8, 0x22, 0x8a, 0x06,
+    0xa9, 0x47, 0x6f, 0x3c, 0x2a, 0x31, 0x49, 0x09, 0x27, 0x94, 0x89, 0x5d,
+    0xa8, 0x30, 0x11, 0xb4, 0xcb, 0x06, 0x4b, 0x24, 0x5b, 0xfc, 0xd3, 0x3e,
+    0x8f, 0xa6, 0xa0, 0x5b, 0x3a, 0x4c, 0x19, 0xd6, 0x0c, 0xab, 0x78, 0x30,
+    0xa2, 0xa2, 0x5a, 0x08, 0xf9, 0x03, 0x26, 0x00, 0x41, 0x39, 0xbe, 0x82,
+    0xe5, 0x97, 0xbc, 0xbc, 0x7b, 0xc3, 0x5b, 0x8f, 0x07, 0x88, 0x5b, 0x33,
+    0x60, 0xaa, 0xcf, 0x72, 0x60, 0x11, 0xc0, 0x48, 0x19, 0x54, 0xf7, 0x73,
+    0x18, 0x62, 0xae, 0xa4, 0x40, 0x85, 0xb2, 0x89, 0xb1, 0x02, 0x09, 0x80,
+    0x1a, 0xdd, 0x9c, 0xfe, 0x2e, 0x9c, 0xd1, 0x5c, 0x00, 0x32, 0x40, 0x02,
+    0x71, 0x1b, 0xbf, 0xab, 0xf2, 0x4b, 0x08, 0xd4, 0x1e, 0x5c, 0xf5, 0x25,
+    0x47, 0x03, 0x1a, 0xb8, 0x1a, 0xa4, 0x83, 0x22, 0xd3, 0x8f, 0x09, 0xcc,
+    0x8e, 0x92, 0x14, 0x30, 0x5f, 0x69, 0x30, 0x50, 0x27, 0x7a, 0xed, 0xe0,
+    0xad, 0xf3, 0xe9, 0x75, 0xc1, 0x20, 0x07, 0x76, 0x9e, 0x2e, 0x98, 0xcd,
+    0x09, 0xeb, 0x3c, 0x9c, 0x66, 0x0c, 0xd0, 0x87, 0x21, 0xe1, 0xe1, 0xd4,
+    0x30, 0x7d, 0x80, 0x0f, 0xfe, 0x36, 0xa0, 0x0f, 0xbd, 0x6d, 0x33, 0x7f,
+    0xe7, 0xdf, 0x27, 0x9f, 0x4e, 0x3e, 0xdd, 0x9c, 0xee, 0xb4, 0x73, 0x96,
+    0xe5, 0x08, 0xa8, 0x65, 0x7b, 0x8e, 0xdf, 0x8d, 0xfa, 0xfb, 0xf1, 0x4f,
+    0xef, 0x70, 0xe2, 0xf8, 0xff, 0xd5, 0x30, 0xcc, 0x87, 0x13, 0x05, 0x39,
+    0xd8, 0x6a, 0x85, 0x93, 0xbd, 0xf2, 0xce, 0xbc, 0xa5, 0xf7, 0xca, 0x7b,
+    0xee, 0x1d, 0x7b, 0x1f, 0x82, 0x93, 0x53, 0xef, 0x45, 0xf0, 0x01, 0x65,
+    0x20, 0x14, 0xf7, 0xde, 0xc1, 0x23, 0x5f, 0x1d, 0xef, 0x0d, 0x3c, 0x66,
+    0xd3, 0x68, 0xc8, 0xbc, 0xf7, 0xc1, 0xb0, 0x3d, 0x4a, 0x86, 0x8b, 0x19,
+    0xde, 0xac, 0xf9, 0x53, 0x70, 0xb3, 0xf2, 0x18, 0xfe, 0x79, 0x19, 0xdc,
+    0xd8, 0x20, 0x54, 0x16, 0x33, 0xbc, 0x9b, 0x7f, 0x11, 0xe7, 0xb6, 0xdf,
+    0xf5, 0xf8, 0x7b, 0x06, 0x4f, 0xb6, 0xf2, 0x89, 0x07, 0xcc, 0xb1, 0x95,
+    0xab, 0x7c, 0xf1, 0x5d, 0x86, 0xed, 0x42, 0x8e, 0x38, 0x92, 0x80, 0xa9,
+    0xdc, 0xf8, 0x58, 0x79, 0xcf, 0x82, 0x9d, 0x7f, 0x7f, 0xca, 0xbe, 0x3b,
+    0x74, 0x3e, 0x2d, 0xb7, 0x6f, 0x37, 0xdc, 0x93, 0x7f, 0x1f, 0x9d, 0x7e,
+    0x77, 0xb4, 0xe3, 0xbd, 0x86, 0x64, 0x4a, 0x73, 0x21, 0xf3, 0xd3, 0xce,
+    0xe0, 0xc8, 0x19, 0xf8, 0x87, 0x9f, 0x76, 0x3e, 0x75, 0x8f, 0x6e, 0xdd,
+    0x47, 0x3b, 0xde, 0xa3, 0x60, 0xe7, 0xd0, 0x19, 0x6c, 0xe0, 0xa1, 0xd9,
+    0xdb, 0xb3, 0xf4, 0x16, 0x06, 0x73, 0xcb, 0x80, 0x1e, 0x47, 0xb7, 0x93,
+    0xf4, 0x36, 0x9a, 0x8d, 0x6f, 0xe9, 0xe4, 0xd4, 0x2d, 0xc6, 0xcd, 0xde,
+    0xe2, 0x57, 0xb5, 0x6e, 0x31, 0x6c, 0x7a, 0xe6, 0x3a, 0xce, 0xc9, 0xa7,
+    0xa5, 0x0f, 0x8c, 0x87, 0x7a, 0x71, 0x3f, 0xed, 0x1c, 0xed, 0x8c, 0x23,
+    0xef, 0x0b, 0x74, 0x05, 0xad, 0xa3, 0x68, 0xbc, 0xc5, 0x6f, 0xab, 0x40,
+    0xfb, 0x91, 0xf7, 0x73, 0xb0, 0x53, 0xf2, 0x9c, 0x8f, 0xc1, 0x89, 0x7d,
+    0x19, 0x4e, 0x6d, 0xcf, 0x1e, 0x66, 0x19, 0xfc, 0xc5, 0x52, 0xf0, 0x83,
+    0xb2, 0x1a, 0x7e, 0x46, 0x61, 0x1e, 0xc2, 0x0f, 0x69, 0x2d, 0x98, 0xc9,
+    0x27, 0xee, 0xd9, 0xc9, 0xf9, 0x39, 0xe0, 0xa4, 0x7d, 0xea, 0xe5, 0xc1,
+    0xfb, 0xf6, 0x10, 0x46, 0x9a, 0xb3, 0x57, 0x53, 0x86, 0xa0, 0x75, 0x6c,
+    0x8a, 0x42, 0xb4, 0x5d, 0xef, 0x7b, 0x43, 0x56, 0x0a, 0xe9, 0xbf, 0x05,
+    0x80, 0x39, 0x7e, 0x3d, 0x0f, 0x07, 0x09, 0xd9, 0xf4, 0xeb, 0xe7, 0x1e,
+    0x85, 0xa8, 0xe2, 0x2f, 0x7e, 0x11, 0x0a, 0x7f, 0x47, 0xfe, 0xf7, 0x90,
+    0x08, 0x7f, 0xec, 0xef, 0xec, 0x7a, 0xf5, 0x51, 0x74, 0x09, 0x0c, 0xcd,
+    0x7b, 0x1b, 0xec, 0x0c, 0x93, 0xd9, 0x1c, 0xec, 0x3e, 0x76, 0x3b, 0x4d,
+    0xc2, 0x11, 0x80, 0x8d, 0xae, 0xd1, 0xe4, 0x21, 0xd0, 0x3b, 0xde, 0xef,
+    0x01, 0x62, 0xdd, 0xb2, 0x75, 0xfa, 0x1d, 0x40, 0xfa, 0x0f, 0x44, 0x80,
+    0x1f, 0x83, 0x3f, 0x80, 0xbb, 0x72, 0x91, 0xec, 0x7d, 0xc6, 0x94, 0x5f,
+    0x02, 0x73, 0xeb, 0xde, 0xdf, 0x03, 0xfc, 0xd2, 0x02, 0x3f, 0x79, 0x82,
+    0xd3, 0x7c, 0x4d, 0x0b, 0xee, 0xc9, 0x6b, 0x72, 0x7c, 0x1b, 0x9f, 0x7e,
+    0x82, 0x27, 0xdb, 0x03, 0x26, 0xe4, 0x13, 0x2c, 0xbf, 0x4f, 0x52, 0xdb,
+    0x23, 0x22, 0xf2, 0xed, 0x82, 0x96, 0x6c, 0x6f, 0x16, 0x5e, 0x09, 0x86,
+    0x65, 0xc3, 0xe3, 0x1b, 0x2e, 0xdc, 0x3c, 0x0a, 0x5c, 0x16, 0x76, 0xa9,
+    0x8d, 0x2f, 0xc7, 0xfc, 0x85, 0xe7, 0x48, 0x75, 0x8c, 0x72, 0xde, 0xf3,
+    0x17, 0xe8, 0x3d, 0x59, 0x42, 0x95, 0x18, 0x3a, 0x4f, 0x96, 0x50, 0x3c,
+    0xb6, 0x11, 0x7d, 0x79, 0x0a, 0x3c, 0xf0, 0x94, 0x45, 0xc6, 0x80, 0xef,
+    0xfa, 0x36, 0xfc, 0xbe, 0x0d, 0xe7, 0x30, 0x3a, 0xc0, 0x18, 0x26, 0x42,
+    0xa3, 0x6d, 0x7a, 0x79, 0x4e, 0x2f, 0x58, 0x97, 0xce, 0x7a, 0xb0, 0x51,
+    0x44, 0xcb, 0x88, 0x6d, 0x50, 0xc2, 0x2b, 0x91, 0x60, 0xaf, 0xbc, 0x5f,
+    0x83, 0x67, 0x28, 0x4b, 0xdb, 0x51, 0x46, 0xbf, 0xb7, 0xb7, 0x06, 0x0e,
+    0x8e, 0xb2, 0x28, 0xcb, 0xf1, 0x63, 0x2d, 0x20, 0x3e, 0xa8, 0xd8, 0x4a,
+    0x72, 0x9e, 0xcf, 0x20, 0x02, 0x80, 0xa2, 0x59, 0x16, 0xe8, 0x2a, 0x5a,
+    0x74, 0xee, 0x6c, 0x00, 0xf3, 0xd8, 0xc8, 0x6f, 0x6f, 0xbb, 0x1b, 0xaa,
+    0x00, 0x70, 0x79, 0xc5, 0x8d, 0x6e, 0x5f, 0x32, 0x39, 0xd1, 0xc0, 0xed,
+    0x2d, 0x68, 0x38, 0x74, 0xd8, 0xe2, 0x2d, 0x4f, 0x38, 0x16, 0x9c, 0x1c,
+    0x33, 0x66, 0xc9, 0x1f, 0x86, 0xd4, 0xc4, 0x54, 0x52, 0x4f, 0xea, 0xc3,
+    0x40, 0x62, 0x57, 0x72, 0x7d, 0xc9, 0xb9, 0x99, 0x4b, 0xbd, 0xa7, 0x5e,
+    0x04, 0xfd, 0xf3, 0x40, 0x66, 0x14, 0x5f, 0x5e, 0x12, 0x6c, 0x44, 0x72,
+    0x66, 0x09, 0xb0, 0xbb, 0x28, 0xf8, 0xc5, 0x6d, 0xe3, 0xa7, 0x6a, 0xe2,
+    0xd1, 0x0b, 0x0a, 0x50, 0xce, 0x5d, 0xe0, 0xc2, 0xff, 0xe7, 0x73, 0xfb,
+    0xf7, 0x2c, 0x74, 0x22, 0x68, 0xa6, 0x4d, 0xe8, 0x43, 0xfa, 0x8f, 0x07,
+    0x15, 0x7e, 0x11, 0x0c, 0xbf, 0x2c, 0xbc, 0xf2, 0x9e, 0x07, 0x26, 0x88,
+    0x96, 0x4a, 0x41, 0x6b, 0xdb, 0x69, 0xbb, 0x03, 0xa0, 0x5d, 0x1d, 0x80,
+    0x05, 0x2b, 0x66, 0x80, 0xcf, 0x1f, 0xf1, 0x20, 0x04, 0xd7, 0x16, 0x7c,
+    0x10, 0x6a, 0x40, 0x19, 0xc7, 0x65, 0xab, 0x71, 0x51, 0xf8, 0x1d, 0x9f,
+    0x5f, 0x6c, 0x6e, 0x2a, 0x56, 0x06, 0x0b, 0x3c, 0x1b, 0x5b, 0xf9, 0xdc,
+    0x06, 0x74, 0x19, 0x23, 0x51, 0x68, 0xcb, 0x87, 0x32, 0x4c, 0xc0, 0xc7,
+    0x4b, 0x24, 0x3c, 0x5e, 0x73, 0xbe, 0x4e, 0xfa, 0x57, 0x1a, 0x2c, 0x9d,
+    0x2a, 0x55, 0x71, 0xdd, 0xa4, 0xfd, 0x08, 0x6f, 0x5c, 0xf6, 0x60, 0x29,
+    0x9c, 0x62, 0x8e, 0x50, 0x21, 0x0f, 0xca, 0x19, 0x3f, 0xf2, 0xec, 0xc3,
+    0x47, 0x5d, 0x50, 0xf4, 0x1f, 0xf5, 0x8e, 0x6c, 0x28, 0x4b, 0xc2, 0x0b,
+    0xca, 0xb0, 0xe0, 0x59, 0xd9, 0x45, 0xd9, 0x9a, 0xc7, 0x50, 0x13, 0xfa,
+    0x0d, 0x1a, 0x64, 0x01, 0xf0, 0x0a, 0xd7, 0x73, 0x92, 0xe0, 0xb7, 0x13,
+    0x76, 0x8a, 0xb0, 0x07, 0x2b, 0xe8, 0xc7, 0x0f, 0x6f, 0xdf, 0x04, 0x36,
+    0x68, 0x42, 0xb0, 0x30, 0xcb, 0x36, 0x0b, 0x41, 0xba, 0x08, 0x4d, 0x25,
+    0x51, 0xf4, 0x12, 0xd7, 0x53, 0xb4, 0xf9, 0x44, 0x5f, 0x25, 0xd0, 0x1a,
+    0xc0, 0x1c, 0x70, 0x3d, 0x00, 0x9c, 0x4b, 0x6b, 0xbe, 0x74, 0x52, 0xd7,
+    0x13, 0x6d, 0x55, 0x61, 0xd9, 0xea, 0x1e, 0x7e, 0x54, 0xe0, 0x38, 0x88,
+    0x40, 0x35, 0x43, 0xe1, 0x16, 0xb5, 0x43, 0x10, 0xe9, 0x54, 0x06, 0xdb,
+    0x4a, 0x11, 0xb6, 0xbf, 0x05, 0xe6, 0x75, 0x00, 0x45, 0x8e, 0x6b, 0x3c,
+    0x58, 0x28, 0xca, 0x7e, 0x0b, 0xee, 0x22, 0x39, 0x68, 0x8a, 0x8a, 0xc6,
+    0x51, 0x5e, 0x69, 0x52, 0xa8, 0x4c, 0x88, 0xe5, 0x1b, 0xb9, 0x5b, 0xd0,
+    0xe4, 0x6f, 0x8e, 0x8b, 0x49, 0x76, 0x46, 0x7c, 0xb0, 0xd4, 0x89, 0x73,
+    0x17, 0x53, 0x0f, 0x21, 0x81, 0x56, 0x04, 0x72, 0x67, 0x8e, 0xeb, 0x9e,
+    0x74, 0x4e, 0x37, 0x37, 0x0b, 0xd8, 0xbb, 0x71, 0x50, 0xa2, 0x05, 0xf4,
+    0x52, 0xac, 0x04, 0xf4, 0x07, 0x02, 0x02, 0xe5, 0x7e, 0x9f, 0x81, 0x46,
+    0x80, 0x24, 0xce, 0x50, 0x09, 0x91, 0xdd, 0x2e, 0x01, 0x0e, 0x20, 0xa8,
+    0x63, 0x44, 0xfc, 0x3e, 0x36, 0x82, 0x44, 0xf2, 0xde, 0x03, 0xc5, 0x5b,
+    0x16, 0x47, 0xfb, 0xa7, 0x2c, 0xfd, 0x1e, 0x35, 0xe3, 0x70, 0x74, 0x8d,
+    0xc5, 0x21, 0x93, 0x40, 0xa1, 0x14, 0xc8, 0x31, 0xf1, 0x57, 0x4a, 0x08,
+    0x40, 0xd7, 0x0a, 0x04, 0x72, 0xa7, 0x26, 0x15, 0x53, 0x58, 0x3f, 0x2b,
+    0x97, 0x46, 0x66, 0x41, 0xc5, 0x88, 0xcf, 0x04, 0x56, 0x47, 0x1d, 0x33,
+    0xe6, 0x34, 0x4d, 0x54, 0x40, 0xe3, 0xaf, 0x98, 0xef, 0x4a, 0x59, 0x88,
+    0x18, 0x13, 0x3c, 0x67, 0x69, 0xc6, 0x05, 0xbe, 0xa8, 0x02, 0x6d, 0xda,
+    0x20, 0xa5, 0x81, 0xd3, 0x94, 0x25, 0x8b, 0x05, 0xce, 0x03, 0x81, 0xd3,
+    0x61, 0x3a, 0x26, 0x95, 0x27, 0xf3, 0xba, 0x85, 0x89, 0x74, 0x96, 0x24,
+    0x53, 0x16, 0xc6, 0x9a, 0xe5, 0x03, 0x2a, 0x33, 0x03, 0xc2, 0x02, 0x5d,
+    0x73, 0x12, 0x9d, 0xe7, 0x0e, 0xde, 0x8b, 0xde, 0x06, 0x21, 0xf6, 0x0a,
+    0x51, 0x5a, 0x85, 0x5f, 0x61, 0x58, 0x5b, 0xb9, 0x23, 0x54, 0x5d, 0x54,
+    0xb8, 0xcf, 0x90, 0xe4, 0x80, 0x6d, 0x42, 0x43, 0x40, 0x15, 0x27, 0x67,
+    0xa7, 0xee, 0xed, 0xed, 0xaf, 0xfc, 0xc1, 0x1d, 0xc8, 0x24, 0x30, 0xc7,
+    0xa6, 0x0e, 0xe3, 0x4f, 0xf4, 0x0b, 0xd2, 0xd6, 0xf5, 0x7e, 0x2d, 0x32,
+    0x7f, 0xd5, 0x33, 0x4f, 0x4e, 0x61, 0x10, 0xf4, 0xe8, 0x61, 0x09, 0xe8,
+    0xca, 0xf5, 0xf1, 0x61, 0x43, 0x50, 0x3f, 0x96, 0xa1, 0xaa, 0x2b, 0x18,
+    0x49, 0x8e, 0x5a, 0x31, 0x90, 0x3e, 0xa2, 0x3d, 0x80, 0xd5, 0x8c, 0xf5,
+    0x81, 0xfd, 0x2d, 0x2a, 0x9f, 0x80, 0xbe, 0xc0, 0xc7, 0x37, 0x60, 0xb0,
+    0x76, 0x5b, 0xbe, 0x27, 0x01, 0x70, 0xa0, 0x08, 0x78, 0x27, 0x69, 0x8b,
+    0x4e, 0x17, 0x54, 0x4f, 0x2f, 0x0c, 0x7e, 0xe7, 0x4b, 0x9f, 0x48, 0xd0,
+    0x59, 0x64, 0xc6, 0x0a, 0x06, 0xf6, 0xfc, 0xfa, 0xf5, 0x68, 0x73, 0x33,
+    0xdc, 0xdc, 0x4c, 0x07, 0x0e, 0x8a, 0x25, 0x3d, 0x07, 0x2a, 0xb9, 0x03,
+    0x30, 0x39, 0xfc, 0x93, 0x53, 0x5f, 0x17, 0x68, 0x9b, 0x9b, 0x4f, 0x2b,
+    0xef, 0x5d, 0xbd, 0xc0, 0x00, 0xaa, 0xc8, 0xe5, 0x03, 0xb0, 0xa4, 0x68,
+    0xf0, 0x96, 0x8d, 0x67, 0xcf, 0xaf, 0x5f, 0x48, 0x45, 0x62, 0x10, 0x0d,
+    0x9a, 0xb2, 0xa0, 0x7f, 0xbf, 0x92, 0xf7, 0x21, 0x1c, 0x53, 0x0e, 0xd9,
+    0x14, 0xbf, 0x2f, 0x58, 0x7a, 0x2d, 0x85, 0xde, 0x33, 0xe8, 0x8a, 0xb9,
+    0x80, 0x76, 0x4b, 0xe9, 0x47, 0xca, 0x40, 0x09, 0x92, 0xea, 0xb2, 0x68,
+    0xa1, 0xc8, 0x1a, 0x18, 0x31, 0x33, 0x87, 0x39, 0x30, 0x1c, 0xaa, 0x2c,
+    0x86, 0xa6, 0x91, 0xaf, 0x17, 0x45, 0x54, 0xe9, 0x33, 0x62, 0xdd, 0x4c,
+    0x11, 0xa3, 0x6e, 0x1f, 0xd9, 0x0c, 0xb2, 0x75, 0xc9, 0x92, 0x36, 0x3a,
+    0x7d, 0x29, 0xf6, 0x71, 0x50, 0xfc, 0x0e, 0x01, 0x78, 0x88, 0xb2, 0xef,
+    0x45, 0x83, 0x41, 0x48, 0xaf, 0xff, 0x24, 0x17, 0x47, 0x90, 0xd0, 0x0b,
+    0x69, 0x1a, 0xc1, 0xaf, 0xf4, 0xfc, 0x7e, 0x0a, 0x63, 0xe0, 0x0e, 0x86,
+    0x60, 0x4a, 0x29, 0xaf, 0xf0, 0x70, 0x98, 0x48, 0x51, 0x51, 0x9a, 0xdc,
+    0x0c, 0x64, 0x36, 0x32, 0x6e, 0xf7, 0x17, 0x0a, 0x87, 0x1c, 0xcb, 0x8a,
+    0xea, 0xbf, 0x03, 0x60, 0xa4, 0xd1, 0xb0, 0x5e, 0x37, 0x78, 0x47, 0x06,
+    0x33, 0x8a, 0xef, 0xb8, 0x60, 0x9c, 0xfd, 0xaa, 0x9f, 0xa5, 0x20, 0x3b,
+    0x72, 0x4c, 0x14, 0xac, 0x76, 0x03, 0x5d, 0x12, 0xd2, 0x7c, 0x45, 0x2a,
+    0x80, 0x8e, 0x42, 0x34, 0x7f, 0x36, 0x37, 0x61, 0xb2, 0x48, 0xec, 0xb8,
+    0x60, 0xa0, 0x18, 0x11, 0x20, 0xa2, 0x98, 0xcf, 0xb1, 0x2a, 0x7c, 0x45,
+    0x67, 0x1f, 0xa4, 0xa4, 0xe1, 0xd8, 0x23, 0xc8, 0x02, 0x57, 0x15, 0xd6,
+    0x7d, 0x8a, 0xfa, 0x40, 0xf0, 0x1c, 0xc1, 0x09, 0x8c, 0x2b, 0x68, 0xe0,
+    0x8a, 0xe8, 0xa0, 0xb2, 0x6d, 0x9f, 0x2b, 0xc4, 0xa5, 0x6b, 0x86, 0xea,
+    0x48, 0x5f, 0x15, 0xb6, 0xb8, 0x58, 0x44, 0xa3, 0xa0, 0x03, 0x0f, 0xd9,
+    0x62, 0x8e, 0x1f, 0xa6, 0x43, 0xcd, 0x19, 0x44, 0xe0, 0xd5, 0x3c, 0xe5,
+    0x4f, 0x71, 0x92, 0xcc, 0x55, 0x8f, 0x18, 0xa6, 0x81, 0x12, 0x6a, 0x26,
+    0x4c, 0x54, 0x1b, 0x80, 0xdc, 0x4e, 0x4e, 0x91, 0x85, 0xa3, 0xb5, 0xe7,
+    0xe2, 0x72, 0xa4, 0x60, 0xc5, 0xa7, 0x87, 0x12, 0x36, 0xfd, 0x14, 0x8c,
+    0x79, 0x0e, 0x4d, 0x64, 0x56, 0x4e, 0x7e, 0x92, 0x12, 0x4f, 0x00, 0x12,
+    0x6c, 0xcf, 0x17, 0x19, 0x48, 0x5e, 0xc1, 0xcc, 0xb1, 0x6a, 0xc4, 0x57,
+    0x52, 0x2b, 0x1e, 0x01, 0xd5, 0xeb, 0xc5, 0xc5, 0xb4, 0x3b, 0x87, 0xa0,
+    0x21, 0x84, 0xae, 0xe8, 0x07, 0xac, 0xd0, 0xf3, 0x58, 0x98, 0x92, 0xa8,
+    0xca, 0x4d, 0xaf, 0x1d, 0x30, 0x2f, 0x81, 0x9a, 0x92, 0x95, 0x90, 0xf1,
+    0xcd, 0x22, 0x95, 0x86, 0x7e, 0x53, 0x7a, 0x20, 0x8a, 0xb1, 0xa3, 0x23,
+    0x02, 0x45, 0x6e, 0x17, 0x7d, 0x4f, 0x02, 0x8c, 0xc0, 0x1c, 0x80, 0x81,
+    0xe2, 0x4f, 0x29, 0xc2, 0x56, 0xc5, 0x0c, 0x52, 0x3e, 0x83, 0x5a, 0x25,
+    0x9c, 0xb4, 0x87, 0x3f, 0x8a, 0xdc, 0x2b, 0x6a, 0xc3, 0x00, 0xc7, 0xa0,
+    0x35, 0x99, 0x45, 0xc7, 0xbb, 0x52, 0x99, 0x5d, 0x79, 0xc3, 0x36, 0x5a,
+    0xd9, 0x80, 0x87, 0x8a, 0xcd, 0x1d, 0xe0, 0x1f, 0xfe, 0x5a, 0xa8, 0x33,
+    0xf6, 0x73, 0x8e, 0xb5, 0x16, 0xc7, 0x71, 0x8b, 0xe3, 0x85, 0x25, 0xa9,
+    0x90, 0x2b, 0xf7, 0xd6, 0x4b, 0x50, 0xeb, 0x84, 0xaf, 0xc9, 0xe2, 0x14,
+    0x66, 0xbd, 0x4a, 0x53, 0x30, 0x7d, 0xda, 0xd9, 0x7c, 0x0a, 0xe2, 0xca,
+    0xb6, 0x6c, 0xb7, 0xa2, 0x17, 0xfd, 0x71, 0x62, 0x9f, 0x70, 0x4f, 0xa2,
+    0x65, 0xa3, 0x57, 0xe0, 0xd4, 0x3e, 0x0d, 0x58, 0xc5, 0xcf, 0x85, 0xa3,
+    0x38, 0x8f, 0x03, 0x3c, 0x81, 0x0e, 0xd4, 0xb2, 0x40, 0x4e, 0xe5, 0x83,
+    0x88, 0xf4, 0xa4, 0xaf, 0xc7, 0x13, 0x12, 0xca, 0xff, 0x20, 0x65, 0x15,
+    0x18, 0x63, 0xa3, 0xc5, 0x90, 0x41, 0x02, 0x7f, 0xf0, 0x70, 0xa9, 0xe1,
+    0x0d, 0x7f, 0xbc, 0x0c, 0xd0, 0x14, 0x9e, 0xf1, 0xc7, 0xc3, 0x71, 0x51,
+    0x39, 0xfe, 0xe0, 0x09, 0xba, 0xf1, 0x0b, 0x0a, 0xf2, 0x38, 0x06, 0xf8,
+    0x0a, 0x0a, 0xe3, 0x42, 0x13, 0xbd, 0x21, 0xa2, 0xe2, 0x1a, 0xe5, 0xb0,
+    0xc8, 0xf9, 0x61, 0x21, 0x62, 0xe5, 0x62, 0xe7, 0xb0, 0xd8, 0x2c, 0x28,
+    0x92, 0x51, 0xa5, 0x88, 0xd1, 0x21, 0xc7, 0x15, 0x16, 0x72, 0x08, 0xe5,
+    0x09, 0x01, 0x0e, 0xb4, 0x73, 0x26, 0x57, 0xef, 0x85, 0x40, 0x36, 0xa1,
+    0xd6, 0xa0, 0x92, 0x39, 0x20, 0x07, 0x55, 0x59, 0x96, 0x5c, 0xcf, 0x48,
+    0xd0, 0x68, 0xcd, 0x19, 0xd4, 0xf9, 0xa5, 0x23, 0x1c, 0x6c, 0x9a, 0x8b,
+    0x5a, 0x57, 0xe9, 0x25, 0x0e, 0xa0, 0x96, 0x81, 0x1c, 0x9f, 0xe4, 0x9d,
+    0x5f, 0xf7, 0x79, 0x2f, 0x41, 0x2b, 0xe6, 0x03, 0xa2, 0xd6, 0x8a, 0xd9,
+    0x60, 0x1d, 0xd2, 0xc2, 0x7c, 0x03, 0x03, 0x79, 0xcb, 0xe5, 0xe5, 0x7b,
+    0xae, 0xa7, 0x1d, 0xe7, 0x80, 0x16, 0x40, 0x70, 0xef, 0xdb, 0x68, 0xd3,
+    0x0f, 0x72, 0x67, 0xe9, 0x82, 0xe1, 0x0e, 0x86, 0xeb, 0x2b, 0xfc, 0xa6,
+    0xc5, 0x9b, 0x28, 0x03, 0xe5, 0x05, 0xd8, 0xa6, 0xfd, 0xf2, 0xa7, 0xb7,
+    0x2f, 0xb8, 0x99, 0xf9, 0x86, 0x4c, 0x76, 0x5b, 0xd5, 0xbd, 0xb1, 0xd6,
+    0xca, 0xdb, 0x00, 0xb5, 0x1e, 0xc7, 0xb1, 0xf2, 0x40, 0xa2, 0x99, 0x7a,
+    0xce, 0xc9, 0xa1, 0x25, 0x5d, 0x8e, 0x08, 0x3c, 0x82, 0xd6, 0x49, 0xe7,
+    0x10, 0xbd, 0x83, 0x7e, 0xbe, 0xad, 0x78, 0xfe, 0x4e, 0x57, 0x9e, 0x80,
+    0xa9, 0x61, 0xde, 0x54, 0x0e, 0x3a, 0x71, 0x10, 0x36, 0xb8, 0x1d, 0xd2,
+    0x50, 0x84, 0x37, 0x85, 0xb0, 0x40, 0xcb, 0xa0, 0xa9, 0x14, 0xd3, 0xf4,
+    0x27, 0xee, 0xe8, 0x03, 0x69, 0x80, 0x59, 0xa5, 0xf8, 0x03, 0xa1, 0xa9,
+    0x27, 0x98, 0xcc, 0x8d, 0x95, 0x87, 0x6d, 0x99, 0x56, 0xfd, 0x43, 0x9b,
+    0x5d, 0x82, 0x2c, 0x2f, 0xa7, 0x6e, 0x5c, 0xfa, 0x0d, 0xd4, 0x31, 0x2a,
+    0xcb, 0x2f, 0x40, 0xca, 0x7d, 0x65, 0xbe, 0xaa, 0x45, 0xaa, 0xee, 0x4b,
+    0x1a, 0x1c, 0xde, 0xab, 0x54, 0x3c, 0x80, 0xaa, 0xe0, 0x2f, 0x9d, 0x77,
+    0xc6, 0x1e, 0x15, 0x4d, 0x55, 0x58, 0xd6, 0xd2, 0xc6, 0x59, 0x79, 0xb0,
+    0xf4, 0xbe, 0x11, 0x2d, 0x97, 0xce, 0x31, 0x6f, 0x9d, 0x13, 0x9d, 0xb3,
+    0xa4, 0x5c, 0x17, 0xeb, 0x44, 0x99, 0x69, 0xb9, 0x3b, 0x87, 0xca, 0x22,
+    0x6c, 0x6e, 0x2a, 0x7d, 0xd1, 0xa2, 0x9f, 0x92, 0x0e, 0x0d, 0x43, 0xf5,
+    0x6b, 0xaa, 0xb1, 0x10, 0x32, 0x21, 0x49, 0x58, 0xce, 0x55, 0x49, 0x47,
+    0x37, 0x2c, 0x17, 0x74, 0xc7, 0x94, 0x39, 0xe6, 0x20, 0x85, 0x63, 0x2e,
+    0x3b, 0xc4, 0x9a, 0x70, 0x35, 0x9f, 0x0c, 0xdf, 0xa0, 0x66, 0x3a, 0x31,
+    0x0e, 0xb8, 0xc2, 0x4d, 0xec, 0x4f, 0xa8, 0x4b, 0xe8, 0xb8, 0x8d, 0xf7,
+    0xa4, 0xb8, 0x12, 0x59, 0x19, 0xc2, 0x12, 0x54, 0x20, 0x5e, 0xda, 0xa0,
+    0x72, 0xa7, 0x8a, 0xf9, 0x78, 0xd8, 0x41, 0x87, 0x2e, 0x1f, 0x03, 0x22,
+    0x45, 0x01, 0x3f, 0xe4, 0x0a, 0x93, 0xd0, 0x08, 0x2b, 0x75, 0x18, 0x75,
+    0x34, 0x45, 0xbb, 0x67, 0x50, 0xaa, 0x7d, 0x72, 0xaa, 0xe8, 0xe3, 0xc6,
+    0x49, 0x4a, 0x7b, 0xa5, 0x8d, 0xb4, 0xe0, 0x70, 0x3c, 0xfc, 0xdd, 0xd0,
+    0x4b, 0x0b, 0x85, 0x54, 0xce, 0xa7, 0xcc, 0x55, 0xe8, 0x9c, 0x53, 0xa0,
+    0x7c, 0xf3, 0xb6, 0xf3, 0xed, 0xae, 0x8b, 0xc8, 0x96, 0x66, 0x75, 0xae,
+    0x1a, 0x88, 0x75, 0x2b, 0x44, 0x19, 0x2a, 0x42, 0x38, 0xb2, 0x9c, 0x9c,
+    0xed, 0x2b, 0x0f, 0x4f, 0x30, 0x37, 0xd4, 0x52, 0x30, 0xa1, 0xd5, 0x6d,
+    0x6e, 0x01, 0x27, 0xe2, 0x57, 0x75, 0xb7, 0x98, 0x9a, 0x28, 0xea, 0x0c,
+    0xca, 0xcd, 0x2d, 0xa9, 0xc7, 0x0d, 0x54, 0x67, 0x7f, 0x65, 0x00, 0x4c,
+    0xab, 0x8d, 0x92, 0x65, 0xc6, 0xea, 0x1e, 0x95, 0x12, 0xcb, 0x15, 0x28,
+    0x13, 0x49, 0xac, 0x5c, 0x1f, 0xf7, 0x3a, 0xca, 0xf1, 0x43, 0x67, 0xdc,
+    0x2a, 0x2c, 0xd1, 0x58, 0x40, 0x11, 0xd9, 0x7a, 0x7d, 0xf1, 0xca, 0xc2,
+    0x44, 0xcf, 0x30, 0x53, 0x14, 0xed, 0xd3, 0x24, 0x63, 0x2a, 0xb4, 0xc8,
+    0x4a, 0xc3, 0xf1, 0x46, 0xe8, 0x28, 0x4f, 0x82, 0xda, 0x24, 0x41, 0x1f,
+    0x5d, 0x2a, 0xfa, 0x90, 0x89, 0x14, 0x54, 0xed, 0x7d, 0xc3, 0x49, 0x06,
+    0xc0, 0x57, 0x93, 0x02, 0x2f, 0x01, 0x85, 0x4b, 0x0a, 0x44, 0x7d, 0x14,
+    0x14, 0x7a, 0xd0, 0xf0, 0x81, 0xae, 0xc0, 0x76, 0xd9, 0xc8, 0x04, 0xa9,
+    0x95, 0xfc, 0x0d, 0x1b, 0x89, 0x94, 0xda, 0x88, 0xd5, 0x11, 0xc7, 0x6a,
+    0x46, 0x52, 0xdf, 0x89, 0x60, 0x1e, 0xbc, 0xbc, 0x8e, 0xd2, 0x38, 0x04,
+    0x0e, 0x79, 0x98, 0x89, 0x58, 0xbc, 0xce, 0x61, 0x2c, 0x25, 0xaf, 0x8b,
+    0x1b, 0x82, 0x08, 0x2a, 0x13, 0xfc, 0xc9, 0x83, 0xa1, 0x18, 0x1d, 0x34,
+    0xb4, 0x9c, 0x86, 0xa6, 0x12, 0xd8, 0x00, 0x08, 0x54, 0x10, 0x18, 0xd2,
+    0x81, 0xdc, 0x7c, 0x92, 0xc0, 0xb9, 0x70, 0x88, 0x77, 0x8a, 0xd1, 0x99,
+    0xe8, 0xed, 0x42, 0x32, 0xb3, 0xf9, 0x74, 0x31, 0xfc, 0xe2, 0xd8, 0x65,
+    0x97, 0xe8, 0xbc, 0xc2, 0xba, 0x72, 0x43, 0xcc, 0x5c, 0x7b, 0xcd, 0x7a,
+    0xa7, 0x92, 0xf3, 0xf0, 0x66, 0xb8, 0xd0, 0xcc, 0x9a, 0x84, 0x8f, 0xb9,
+    0x0d, 0xc9, 0x67, 0xb1, 0xea, 0x4b, 0x61, 0xe1, 0xdd, 0xde, 0x2a, 0x92,
+    0x53, 0xf5, 0x82, 0xad, 0x48, 0x0a, 0x9e, 0xe1, 0xf5, 0x35, 0xd9, 0x7d,
+    0x47, 0x6b, 0xd0, 0x39, 0x53, 0x47, 0x33, 0xf7, 0x4c, 0xc4, 0x41, 0xe6,
+    0xe3, 0x4a, 0x4e, 0x8d, 0x2e, 0xf2, 0xb8, 0xaf, 0x50, 0xa5, 0x44, 0xd5,
+    0xb7, 0x87, 0xa3, 0x26, 0xe0, 0x9b, 0x64, 0x9a, 0x51, 0x45, 0x2a, 0x3b,
+    0x38, 0x61, 0xa7, 0x34, 0xe9, 0x49, 0xb2, 0xbc, 0x6f, 0xff, 0x85, 0x5e,
+    0xd8, 0xb7, 0xf1, 0x4a, 0x2b, 0x5b, 0x90, 0x34, 0x85, 0x27, 0xb4, 0x45,
+    0x78, 0x1a, 0xba, 0x34, 0x6b, 0x89, 0x30, 0x54, 0xd7, 0x93, 0x75, 0x40,
+    0xe7, 0x78, 0x91, 0xcc, 0xe6, 0x8b, 0x9c, 0x8d, 0x8e, 0xb1, 0x10, 0x1f,
+    0x22, 0x94, 0x10, 0x3b, 0xe7, 0x73, 0x96, 0xe6, 0xd7, 0xbf, 0x84, 0xd3,
+    0x05, 0xc3, 0xfd, 0x08, 0xaa, 0x6f, 0xbb, 0xe6, 0x66, 0x1d, 0xce, 0x19,
+    0xc9, 0xa1, 0x80, 0x16, 0xbf, 0xf7, 0x13, 0xa8, 0x9f, 0xe4, 0x0f, 0xad,
+    0xfa, 0x60, 0x01, 0xc7, 0xb9, 0x76, 0xa6, 0x39, 0xad, 0x19, 0x1a, 0xb2,
+    0xb5, 0xf1, 0xb0, 0xbb, 0x06, 0xe3, 0xb1, 0x26, 0x1d, 0x86, 0x95, 0xd3,
+    0x8c, 0xc9, 0xd7, 0x64, 0x53, 0x98, 0x1e, 0x54, 0xf9, 0x89, 0x76, 0xaa,
+    0xf9, 0xaf, 0x4b, 0xe8, 0x26, 0xbc, 0xbe, 0xff, 0x8c, 0xf2, 0x49, 0xa3,
+    0x34, 0x3b, 0x63, 0xc0, 0x08, 0x50, 0xc4, 0x88, 0x5e, 0x90, 0xed, 0x61,
+    0x40, 0x8a, 0x41, 0xdc, 0xa3, 0xa0, 0x47, 0x81, 0x2f, 0x38, 0x2a, 0x10,
+    0x7d, 0xec, 0x72, 0x89, 0x4d, 0xee, 0x38, 0xd4, 0xf4, 0x3a, 0xae, 0x17,
+    0x05, 0xa9, 0x32, 0xf6, 0xdb, 0xdb, 0xae, 0xaa, 0x5f, 0xac, 0xe3, 0x8b,
+    0xee, 0x8d, 0x14, 0x94, 0xd8, 0x3f, 0xfa, 0x51, 0xe2, 0x81, 0xae, 0x34,
+    0xf8, 0xd1, 0x20, 0x6d, 0x03, 0x4f, 0x8e, 0x19, 0x36, 0xed, 0x6c, 0x74,
+    0x5c, 0x3f, 0xa5, 0x89, 0x8a, 0x0a, 0xda, 0x24, 0xcb, 0x81, 0xca, 0x86,
+    0xf1, 0xb1, 0x98, 0x6f, 0x80, 0xc2, 0xc8, 0xed, 0x17, 0x5c, 0xb0, 0xef,
+    0xa0, 0xcb, 0x4e, 0xb2, 0x13, 0xc7, 0x75, 0x0b, 0x46, 0x98, 0x83, 0x31,
+    0x45, 0xa2, 0xd6, 0x71, 0xfb, 0x24, 0xc1, 0xf8, 0xfa, 0x0a, 0xfe, 0xa1,
+    0x4c, 0x88, 0x8f, 0xe3, 0x35, 0x52, 0x4f, 0x39, 0x92, 0x88, 0x43, 0x0f,
+    0xac, 0x62, 0x78, 0x5c, 0x3f, 0x7d, 0xce, 0x8d, 0x05, 0x10, 0x00, 0x6d,
+    0x98, 0xe4, 0x2d, 0x99, 0x83, 0x5b, 0x1f, 0xc9, 0x20, 0xaa, 0x40, 0xa3,
+    0x2f, 0xb9, 0xf5, 0x20, 0x2e, 0x60, 0x86, 0xdb, 0xe2, 0x72, 0x84, 0x1c,
+    0x38, 0x8b, 0x58, 0x5f, 0x4f, 0x7d, 0xfd, 0xf9, 0x52, 0x39, 0x6e, 0x8d,
+    0x14, 0xe5, 0x62, 0x28, 0x48, 0xe4, 0xc8, 0x34, 0x05, 0x4c, 0x85, 0xea,
+    0x4b, 0xeb, 0xf2, 0x35, 0xfc, 0x53, 0x5d, 0x4f, 0x1c, 0xef, 0x24, 0x1a,
+    0x35, 0xb6, 0x33, 0xcc, 0xb2, 0x92, 0x4a, 0x04, 0x21, 0xb8, 0x68, 0x83,
+    0x8c, 0xc7, 0x53, 0x66, 0x62, 0x51, 0xcd, 0x5c, 0x46, 0x02, 0xba, 0xef,
+    0xf0, 0x1d, 0xfc, 0x82, 0xe1, 0xe8, 0x9d, 0xe0, 0xde, 0xf9, 0x00, 0x7d,
+    0xb9, 0xc9, 0x12, 0xcd, 0xc6, 0x36, 0x8e, 0x8e, 0x2b, 0x6f, 0xf3, 0x94,
+    0x5d, 0x9a, 0xc8, 0x6a, 0xa9, 0x8b, 0x2c, 0x28, 0x15, 0x25, 0x8b, 0x4c,
+    0xb0, 0x89, 0x63, 0x2e, 0x01, 0x40, 0x7c, 0x49, 0x45, 0x08, 0x24, 0x06,
+    0x6e, 0xad, 0x80, 0x8e, 0xcd, 0xae, 0xf2, 0xbb, 0xdb, 0xc3, 0x52, 0x77,
+    0xb7, 0x85, 0xfb, 0xa5, 0x26, 0x03, 0xa7, 0x83, 0xae, 0x90, 0xc2, 0x00,
+    0x1d, 0xac, 0xc3, 0x43, 0x5d, 0x14, 0xf4, 0xe5, 0xd2, 0x93, 0x38, 0x71,
+    0x0a, 0x22, 0x98, 0x71, 0x6c, 0x8c, 0x3d, 0xb2, 0x32, 0x40, 0x6f, 0xa2,
+    0x1e, 0x30, 0x6d, 0x20, 0x48, 0xae, 0x6c, 0xc3, 0x47, 0x93, 0x0d, 0x16,
+    0x4b, 0x9b, 0xe7, 0x57, 0x8d, 0x4d, 0xe9, 0x95, 0xdb, 0xf5, 0xd0, 0xa4,
+    0xb0, 0x7b, 0x85, 0xf6, 0xaf, 0xa4, 0x04, 0x32, 0xe0, 0xc4, 0xb6, 0x7d,
+    0xdb, 0xde, 0x66, 0xb5, 0x41, 0x4a, 0xd0, 0x2a, 0x75, 0x80, 0x3b, 0x5f,
+    0x24, 0x51, 0xec, 0x00, 0x9b, 0x16, 0xa3, 0xc6, 0x2d, 0x26, 0x05, 0xc1,
+    0xe4, 0x36, 0x9d, 0xf4, 0x18, 0x95, 0x3e, 0xc8, 0x32, 0xd2, 0xa7, 0x7b,
+    0x9f, 0x09, 0x01, 0x9b, 0x22, 0x7d, 0x5f, 0x0a, 0x19, 0xda, 0xa7, 0xa5,
+    0x4d, 0x14, 0xc6, 0x5d, 0x77, 0xb4, 0x1f, 0xc0, 0xdc, 0x4b, 0x3e, 0xe5,
+    0x33, 0x8f, 0x1c, 0xfb, 0xdc, 0x3d, 0x27, 0xd2, 0x98, 0x57, 0x85, 0xc7,
+    0x58, 0x8b, 0x72, 0x71, 0xf5, 0x85, 0xd9, 0xdc, 0x14, 0x9a, 0x32, 0x2e,
+    0x4e, 0xe9, 0x39, 0x17, 0x0e, 0xbe, 0xc2, 0x7e, 0xa8, 0x35, 0x02, 0xea,
+    0xff, 0x95, 0x34, 0xd2, 0x9f, 0x69, 0xd0, 0xc8, 0xd7, 0x93, 0x5b, 0x6d,
+    0x7e, 0xe8, 0xda, 0x2e, 0xbd, 0x59, 0x46, 0x4b, 0xed, 0xb2, 0x50, 0xc5,
+    0xbd, 0xc2, 0x6a, 0x9f, 0x83, 0xb0, 0xac, 0x2c, 0x41, 0x11, 0x83, 0xf3,
+    0x77, 0x50, 0x36, 0x6e, 0x6f, 0x99, 0x77, 0x2f, 0x98, 0xd3, 0x0c, 0xd9,
+    0x69, 0x15, 0x8d, 0x70, 0x63, 0x73, 0x25, 0x9d, 0x1d, 0xa7, 0xdc, 0x95,
+    0x00, 0x0f, 0xa8, 0xc6, 0x88, 0x69, 0xbf, 0xd7, 0x46, 0xa0, 0xba, 0x4c,
+    0xfe, 0x4e, 0x6a, 0x81, 0x00, 0x7f, 0x15, 0x00, 0x23, 0x86, 0x51, 0x14,
+    0x16, 0x37, 0xb1, 0x48, 0x27, 0xc2, 0x68, 0x10, 0xdf, 0xe0, 0xfb, 0x0c,
+    0x28, 0x4e, 0xa4, 0x65, 0x6f, 0x97, 0x5b, 0xb6, 0x3f, 0x7b, 0x76, 0xeb,
+    0x51, 0xb7, 0x1a, 0xb8, 0x06, 0xf2, 0xc0, 0x34, 0x55, 0xda, 0x08, 0x8d,
+    0x3d, 0x26, 0x4c, 0x1d, 0xfe, 0xea, 0xea, 0x0e, 0xf4, 0x20, 0x1d, 0x5c,
+    0xa3, 0x98, 0x80, 0xc5, 0xbc, 0x0c, 0xa7, 0x26, 0xa6, 0x59, 0xa1, 0x44,
+    0x47, 0x10, 0x10, 0x6d, 0x36, 0xa0, 0x9e, 0xd5, 0x0c, 0xd5, 0xf6, 0x25,
+    0x2a, 0x32, 0x12, 0xb0, 0x4c, 0xe2, 0x23, 0xa5, 0xa2, 0xe3, 0xa2, 0x04,
+    0xae, 0x94, 0xc8, 0x6d, 0xf9, 0x41, 0x9d, 0x81, 0x22, 0xa4, 0xc9, 0x52,
+    0xb6, 0x13, 0xba, 0x4b, 0xce, 0x76, 0x9b, 0x2d, 0x6e, 0x25, 0xea, 0x8c,
+    0x8d, 0x56, 0xae, 0x24, 0x64, 0xea, 0xce, 0x2e, 0x3a, 0x93, 0xdd, 0x7b,
+    0x3c, 0xd6, 0xa6, 0x9c, 0x71, 0x42, 0xe4, 0x97, 0xb8, 0x0f, 0x92, 0xca,
+    0x62, 0x6e, 0x09, 0x72, 0xbc, 0x36, 0x6f, 0x11, 0xf7, 0xf8, 0xd2, 0x40,
+    0xbe, 0xbd, 0x97, 0x12, 0x55, 0x66, 0x82, 0x4a, 0x44, 0x17, 0xf5, 0xc7,
+    0x6d, 0xfa, 0x8c, 0x69, 0x5b, 0x7e, 0x68, 0xd9, 0x47, 0xf1, 0x8d, 0x5f,
+    0x46, 0xa5, 0x9f, 0x55, 0x1f, 0x78, 0x48, 0x98, 0x47, 0x43, 0x9b, 0x5c,
+    0xd4, 0x28, 0x83, 0xe4, 0x25, 0xa7, 0xa4, 0x9c, 0x82, 0x55, 0x27, 0x5e,
+    0x03, 0x5b, 0xde, 0x0b, 0x4c, 0x8a, 0x22, 0x16, 0x8d, 0xd0, 0x85, 0x42,
+    0x1b, 0xd1, 0xa5, 0xae, 0xe5, 0x2a, 0xab, 0x8e, 0x79, 0xb5, 0x5d, 0xa8,
+    0x8d, 0x82, 0x0d, 0x80, 0x2a, 0xa7, 0x58, 0xd4, 0xb5, 0x82, 0x9e, 0x5c,
+    0x18, 0xd1, 0x24, 0xcd, 0xa6, 0xc3, 0xe7, 0xd0, 0x59, 0xf5, 0x35, 0xb7,
+    0x03, 0xb2, 0x8d, 0xe7, 0x18, 0x68, 0x0c, 0xdc, 0xf0, 0xc5, 0x14, 0x3f,
+    0xc4, 0xfc, 0x33, 0xac, 0x8e, 0x23, 0x71, 0x90, 0xdf, 0x1d, 0x9b, 0xd3,
+    0x8c, 0xb7, 0x87, 0xa0, 0x7d, 0x8c, 0xd9, 0xaf, 0x3f, 0x11, 0x9c, 0x3c,
+    0x6c, 0x34, 0x47, 0xe0, 0x88, 0xf4, 0x7f, 0x89, 0x74, 0x1e, 0xe8, 0xfd,
+    0x36, 0xcc, 0x27, 0x6d, 0x8a, 0x60, 0x76, 0x30, 0x1a, 0x17, 0x92, 0x5c,
+    0x4f, 0x44, 0x5c, 0x6b, 0x59, 0x3c, 0xcd, 0x5d, 0x81, 0x42, 0x92, 0x65,
+    0x7e, 0x2d, 0x30, 0xa6, 0xea, 0x61, 0x3e, 0xec, 0xa9, 0xde, 0x0b, 0x74,
+    0x9b, 0x98, 0xf7, 0xee, 0x29, 0xa8, 0x46, 0x06, 0xb3, 0x14, 0xf4, 0xc4,
+    0x8d, 0x85, 0x93, 0xe7, 0x3c, 0xe8, 0xb8, 0xa6, 0xe6, 0xc7, 0x66, 0x35,
+    0x1f, 0x46, 0x27, 0xb7, 0xd7, 0xf5, 0x66, 0xb9, 0x32, 0x7d, 0xb3, 0x02,
+    0x84, 0x31, 0xb7, 0xd5, 0x2f, 0x0c, 0x2f, 0x42, 0xd3, 0xbc, 0xea, 0x9e,
+    0x44, 0xa6, 0x56, 0x0e, 0x8a, 0xe1, 0xa0, 0xa2, 0x7a, 0xff, 0xe4, 0x18,
+    0x48, 0x79, 0xf0, 0x5f, 0x02, 0x04, 0xad, 0x4f, 0x19, 0x43, 0x91, 0x5d,
+    0x26, 0x62, 0x7b, 0x07, 0x49, 0x80, 0xa6, 0xfc, 0x36, 0x48, 0xce, 0x6d,
+    0x1e, 0xd9, 0xea, 0x37, 0xdb, 0x8d, 0xdc, 0x72, 0x2a, 0x39, 0x25, 0xf6,
+    0xe8, 0x60, 0x75, 0xe9, 0xdf, 0xb3, 0x0a, 0x79, 0x96, 0xbb, 0x39, 0x88,
+    0x31, 0xde, 0x09, 0x3e, 0x0d, 0x92, 0x6d, 0xe8, 0xe8, 0x4c, 0x76, 0x74,
+    0xe6, 0x61, 0x22, 0xbc, 0xf5, 0xed, 0x87, 0xf7, 0x77, 0x46, 0xfd, 0xdd,
+    0x69, 0xe5, 0xf2, 0xda, 0x80, 0x24, 0x1f, 0x40, 0xec, 0x6f, 0x07, 0xd0,
+    0xd5, 0x76, 0x82, 0xac, 0x99, 0x07, 0xa5, 0x99, 0x98, 0xfc, 0x40, 0xa8,
+    0x44, 0xdc, 0xc1, 0x81, 0xa6, 0x00, 0xd2, 0x84, 0xaf, 0xab, 0xd1, 0xa5,
+    0x6a, 0x5c, 0xba, 0x42, 0x04, 0xf5, 0x90, 0x5b, 0x91, 0x76, 0x95, 0x0d,
+    0xcd, 0x53, 0x6c, 0xb6, 0xea, 0xf7, 0x6a, 0x34, 0xab, 0xb9, 0x7a, 0x03,
+    0xe6, 0xc8, 0x98, 0x40, 0xeb, 0xc5, 0xfc, 0x27, 0x1c, 0x8d, 0x2a, 0x6d,
+    0x97, 0xf2, 0x31, 0x6e, 0x56, 0x3e, 0x94, 0x50, 0x3a, 0xa1, 0x1f, 0xb8,
+    0x37, 0xaf, 0xd0, 0xb3, 0xcb, 0xf9, 0xde, 0x58, 0x28, 0xc9, 0x9a, 0x9e,
+    0x27, 0x84, 0xf7, 0xce, 0xa7, 0x6c, 0x7b, 0x67, 0x6c, 0x96, 0xdf, 0x52,
+    0x5d, 0x94, 0x33, 0x76, 0xd0, 0xe5, 0xfb, 0xaa, 0x70, 0xb7, 0x72, 0xa1,
+    0xee, 0xbd, 0x2a, 0xdc, 0xce, 0x63, 0x21, 0x31, 0xb6, 0x1d, 0xd0, 0xd3,
+    0x2c, 0x54, 0xd4, 0xdc, 0xed, 0x57, 0x42, 0x07, 0x03, 0x1d, 0x01, 0xe8,
+    0x99, 0x03, 0x5a, 0x4a, 0xe2, 0xca, 0x54, 0xd7, 0x2a, 0xfc, 0xcd, 0x13,
+    0x15, 0x5b, 0xe5, 0x45, 0x58, 0xc9, 0xb8, 0xf0, 0x14, 0xf4, 0x5f, 0xc9,
+    0xa9, 0x7b, 0x8a, 0x30, 0x7b, 0x75, 0x9f, 0xa9, 0xbf, 0x0a, 0x5e, 0x15,
+    0xc2, 0x1b, 0x13, 0x3c, 0x9c, 0x00, 0x50, 0x9c, 0x68, 0xfc, 0x95, 0x0c,
+    0xfd, 0x59, 0xad, 0x0a, 0xcb, 0xa5, 0xba, 0x70, 0x4a, 0xd8, 0x73, 0x3c,
+    0xb8, 0x87, 0x58, 0x52, 0x97, 0x47, 0x0c, 0xfb, 0x3e, 0x23, 0x75, 0x52,
+    0xb2, 0x7c, 0x36, 0x98, 0xba, 0x4c, 0x60, 0x52, 0x83, 0xd9, 0x2d, 0xb1,
+    0x09, 0x13, 0x0a, 0x07, 0x84, 0x48, 0x58, 0xb9, 0xc5, 0x62, 0xf0, 0x1b,
+    0x99, 0x3f, 0x54, 0xb4, 0x22, 0x61, 0x7a, 0x4b, 0x39, 0x24, 0xc6, 0x6a,
+    0x17, 0x85, 0xe5, 0x02, 0xa8, 0x5e, 0x6a, 0x1a, 0x09, 0x2b, 0x8c, 0x86,
+    0xb2, 0x61, 0x99, 0xa2, 0x88, 0x04, 0x85, 0x27, 0xb0, 0x41, 0x8d, 0xae,
+    0x65, 0xcd, 0x20, 0x5f, 0xf9, 0x4d, 0x99, 0x8e, 0xf2, 0xf6, 0x2b, 0x39,
+    0x7c, 0x57, 0x72, 0x32, 0x6f, 0x50, 0x40, 0xdd, 0x7b, 0x36, 0x58, 0xfa,
+    0xde, 0xd3, 0xa1, 0xa6, 0xd5, 0xf9, 0xfc, 0x7a, 0xef, 0xf9, 0x60, 0xd5,
+    0xf5, 0x13, 0xf2, 0x94, 0xf7, 0x7f, 0xf1, 0x09, 0x95, 0x5f, 0x23, 0x28,
+    0x6b, 0x99, 0x66, 0x53, 0x08, 0x6f, 0x4f, 0x98, 0x7d, 0xba, 0x22, 0x23,
+    0xbc, 0xc3, 0xa5, 0x3e, 0x93, 0x06, 0x5f, 0x44, 0xa0, 0xb9, 0x34, 0x21,
+    0x90, 0xac, 0xdc, 0x81, 0xae, 0x17, 0xf8, 0xa5, 0x7a, 0x54, 0x0a, 0x4c,
+    0xd4, 0x80, 0x02, 0xda, 0x17, 0xff, 0x7e, 0x9a, 0xf0, 0xed, 0x29, 0x97,
+    0x2b, 0x3b, 0xe5, 0x29, 0x2c, 0x20, 0x77, 0x90, 0x0c, 0x9e, 0xd0, 0x8e,
+    0xd6, 0x96, 0xc6, 0x12, 0xa2, 0x38, 0xe9, 0x55, 0xdb, 0x7a, 0x69, 0x46,
+    0xda, 0x24, 0x55, 0x50, 0x3e, 0x24, 0xcf, 0x63, 0xb0, 0x65, 0x2d, 0xd2,
+    0x44, 0xee, 0xaa, 0x46, 0x23, 0x51, 0xeb, 0xdd, 0x47, 0xa1, 0x5b, 0x49,
+    0x8d, 0xf3, 0x7d, 0xc5, 0xc1, 0xbd, 0xd6, 0x37, 0x22, 0x3d, 0x52, 0x79,
+    0x7d, 0x29, 0x6e, 0x6f, 0xb9, 0x87, 0xb1, 0x8f, 0x3b, 0x32, 0x62, 0x09,
+    0xf2, 0x12, 0xfe, 0x9b, 0x9b, 0xa5, 0x06, 0x59, 0x42, 0xaa, 0x54, 0x22,
+    0xd1, 0x95, 0x95, 0x6b, 0x0d, 0x96, 0xe1, 0x0e, 0x88, 0x2e, 0x14, 0xad,
+    0x31, 0x62, 0x39, 0xc6, 0x65, 0xd0, 0x33, 0x27, 0x7b, 0xef, 0xa4, 0x1a,
+    0xb5, 0x7e, 0x5a, 0xe7, 0x26, 0xc5, 0xb6, 0x48, 0x5a, 0x46, 0xd7, 0xb6,
+    0x77, 0xcc, 0x6e, 0x61, 0xc0, 0x19, 0x2d, 0xac, 0x16, 0xa4, 0x35, 0x76,
+    0x77, 0x92, 0x9e, 0xd6, 0xc2, 0xef, 0x72, 0x2f, 0xae, 0xee, 0x67, 0x71,
+    0x6f, 0x4d, 0x02, 0xd2, 0x6d, 0x10, 0x9f, 0xd8, 0xe4, 0x5c, 0xb0, 0xb7,
+    0xa3, 0x53, 0x3f, 0xa3, 0x94, 0xaa, 0xea, 0x7a, 0x22, 0xe8, 0x94, 0x8a,
+    0x38, 0xb9, 0x8e, 0xc8, 0x00, 0x31, 0x0c, 0xff, 0xf0, 0xcd, 0x1c, 0xd6,
+    0x89, 0x25, 0x7b, 0xe5, 0x90, 0x4c, 0x55, 0x49, 0x80, 0xa3, 0x75, 0xc8,
+    0xb0, 0x06, 0x36, 0x0e, 0x10, 0xa2, 0xfb, 0xfd, 0x01, 0x42, 0x73, 0x98,
+    0x3d, 0x8b, 0x47, 0xf0, 0xc4, 0x1d, 0x8d, 0xf0, 0xc0, 0x3d, 0x25, 0x26,
+    0xa0, 0x31, 0x2f, 0xe4, 0xd3, 0xcc, 0x82, 0xf0, 0x6f, 0x3d, 0x0e, 0x04,
+    0x76, 0x1a, 0x54, 0x3c, 0x55, 0x14, 0xd4, 0x23, 0x36, 0x63, 0xca, 0x18,
+    0xc4, 0xba, 0x2c, 0x38, 0x91, 0x20, 0x2a, 0x4e, 0x68, 0xc1, 0x0c, 0x48,
+    0x9b, 0x1b, 0x38, 0xe6, 0x08, 0xc4, 0x22, 0x12, 0x4f, 0x1a, 0xe6, 0x1b,
+    0xc4, 0xb5, 0xa4, 0x94, 0xf6, 0x97, 0xed, 0x3f, 0xd8, 0x3c, 0x4f, 0x44,
+    0x70, 0xe8, 0x80, 0x71, 0x8f, 0x24, 0xee, 0x2a, 0xe7, 0x7c, 0x5f, 0x9f,
+    0xef, 0xe9, 0x38, 0x4a, 0x86, 0x1a, 0xd5, 0x49, 0xe0, 0x41, 0x95, 0xb1,
+    0xdc, 0x25, 0x8b, 0x6f, 0x6f, 0x65, 0x64, 0x54, 0xee, 0x6b, 0x65, 0xa1,
+    0x64, 0x12, 0x18, 0x7d, 0xc5, 0x91, 0x54, 0xd5, 0xbb, 0xc4, 0x4e, 0xfd,
+    0xa6, 0x3d, 0xb5, 0x34, 0xc8, 0xf0, 0x50, 0x95, 0x1a, 0x53, 0xce, 0x02,
+    0x50, 0x30, 0x43, 0x98, 0x11, 0x7a, 0xcd, 0x84, 0xbb, 0x0c, 0xf7, 0x09,
+    0x31, 0x89, 0x5c, 0xba, 0xe4, 0x53, 0xf7, 0x7b, 0x94, 0x42, 0x8e, 0x1e,
+    0x11, 0x19, 0xbf, 0xd6, 0x1a, 0x4a, 0xc1, 0xd4, 0x32, 0xc2, 0x93, 0x8c,
+    0xc9, 0x9c, 0xce, 0x0e, 0x29, 0x3e, 0xcd, 0x22, 0xfa, 0x75, 0x23, 0x2d,
+    0xc3, 0x57, 0x15, 0x7f, 0x7b, 0x1f, 0x77, 0xa5, 0x33, 0x50, 0x5e, 0x9f,
+    0x0b, 0xd7, 0x34, 0x06, 0xbf, 0xc6, 0x9b, 0x9b, 0x7a, 0x78, 0xa8, 0x7b,
+    0x83, 0x44, 0x51, 0xf8, 0xab, 0xd3, 0xa0, 0x03, 0x48, 0xc1, 0x94, 0x0d,
+    0xa6, 0x02, 0x6a, 0x87, 0x11, 0xc5, 0x77, 0x41, 0x2d, 0x25, 0x17, 0x83,
+    0x9d, 0x62, 0x3c, 0x72, 0xe9, 0x55, 0x06, 0xbc, 0x21, 0xac, 0xfb, 0x92,
+    0x8f, 0xdc, 0xde, 0xda, 0xc7, 0x2f, 0x7e, 0x7e, 0xfd, 0xfe, 0x83, 0xbd,
+    0xa1, 0x26, 0xeb, 0x34, 0x8b, 0x81, 0x76, 0x39, 0xb9, 0x72, 0xc8, 0x6d,
+    0xb6, 0x73, 0x11, 0x5e, 0x86, 0xfc, 0xc0, 0x28, 0xaf, 0x85, 0x79, 0x58,
+    0x26, 0x4b, 0x87, 0x6e, 0xe1, 0x51, 0x6c, 0x27, 0x4b, 0xa0, 0x56, 0xb9,
+    0x53, 0x36, 0xa8, 0xbc, 0x03, 0xeb, 0x39, 0x0f, 0x17, 0xd3, 0xfc, 0x97,
+    0x88, 0x2d, 0xfd, 0x61, 0x9f, 0xb5, 0x19, 0xd8, 0xed, 0x45, 0xf4, 0x5d,
+    0xe9, 0x46, 0x24, 0xc5, 0x89, 0xbb, 0xfd, 0x91, 0x60, 0x60, 0xd1, 0xb7,
+    0xed, 0x0f, 0x09, 0xa8, 0x8c, 0x1c, 0x8a, 0xf6, 0xb6, 0x13, 0x0e, 0x6c,
+    0x0e, 0x4b, 0x48, 0x7c, 0x46, 0x84, 0xe9, 0x9e, 0x06, 0x66, 0xcf, 0xaa,
+    0x0b, 0x04, 0x27, 0xf4, 0x3c, 0xd2, 0x68, 0x00, 0x0d, 0x3f, 0xb7, 0x7f,
+    0x2b, 0x83, 0xf5, 0x82, 0x91, 0xf2, 0x8c, 0xfd, 0x41, 0xf6, 0x22, 0x8e,
+    0x7e, 0x0f, 0x8e, 0xe1, 0x01, 0xe0, 0xca, 0xf0, 0x2e, 0xfb, 0xe8, 0x0f,
+    0x46, 0x96, 0x55, 0x70, 0xed, 0x09, 0x92, 0x09, 0x3e, 0x7b, 0xcb, 0x55,
+    0x29, 0xf7, 0x86, 0xed, 0xdf, 0x28, 0x75, 0xe4, 0xf1, 0x3d, 0x50, 0x60,
+    0x61, 0xc3, 0xf6, 0x23, 0x30, 0xea, 0xe1, 0x6f, 0x30, 0x52, 0x36, 0xf1,
+    0xa6, 0xca, 0x79, 0xd7, 0x89, 0x46, 0xa2, 0x9f, 0xff, 0x88, 0x46, 0x14,
+    0xd8, 0x8f, 0x0f, 0x01, 0x83, 0x05, 0xd6, 0xce, 0xb6, 0xca, 0xc3, 0x72,
+    0xb0, 0xa2, 0x40, 0x8e, 0xb8, 0x13, 0xec, 0xb6, 0xe3, 0xcc, 0xe5, 0x3c,
+    0xd9, 0x49, 0x00, 0x53, 0x62, 0x50, 0x0f, 0xd5, 0x63, 0x8c, 0x03, 0xff,
+    0xdf, 0xb7, 0x96, 0x0b, 0x46, 0x4f, 0xc1, 0xb0, 0x41, 0x4f, 0x05, 0x5d,
+    0xb5, 0xfd, 0x9d, 0x35, 0x00, 0xe5, 0x1b, 0x0b, 0x58, 0x74, 0xb6, 0x91,
+    0x9f, 0xd7, 0x90, 0x67, 0x11, 0x9c, 0x57, 0x27, 0x13, 0x6e, 0xee, 0x9e,
+    0x9c, 0xd6, 0x3d, 0x33, 0xca, 0x88, 0x61, 0x76, 0xa0, 0x58, 0x12, 0x12,
+    0x30, 0xf4, 0x68, 0xa0, 0x7c, 0xc2, 0x94, 0x38, 0x43, 0xa3, 0x54, 0xca,
+    0xae, 0xcc, 0xa5, 0x64, 0xe0, 0x0b, 0x13, 0x64, 0x52, 0xb1, 0x0b, 0xa0,
+    0xc1, 0x80, 0x42, 0x4a, 0xa5, 0x43, 0x25, 0x19, 0x03, 0xec, 0xa4, 0x9d,
+    0x0c, 0xfd, 0x0c, 0x29, 0xc7, 0x29, 0x07, 0x8f, 0x1f, 0x48, 0x5d, 0xd7,
+    0x6e, 0x17, 0x26, 0xf2, 0x0d, 0x70, 0x02, 0x54, 0x68, 0xe2, 0xcc, 0x2f,
+    0x03, 0x91, 0x29, 0x5e, 0xcd, 0x71, 0x4b, 0xb3, 0x62, 0xd5, 0x70, 0x6e,
+    0xd3, 0x42, 0x64, 0x9c, 0xe2, 0x06, 0x17, 0xba, 0x2a, 0x29, 0x96, 0x15,
+    0xc6, 0xb2, 0xb1, 0xc1, 0xb4, 0x73, 0x93, 0x45, 0xe9, 0xe7, 0xe4, 0xfc,
+    0x83, 0xb2, 0x29, 0xf7, 0x02, 0xaa, 0x27, 0x1f, 0x23, 0xb4, 0x98, 0x30,
+    0x24, 0xd3, 0xcb, 0xbc, 0x85, 0xf4, 0x35, 0x4c, 0x9c, 0xc8, 0xf5, 0x86,
+    0xc1, 0xab, 0x93, 0x18, 0xf7, 0x12, 0xf1, 0x07, 0x43, 0xb4, 0xfb, 0x79,
+    0xa9, 0xb3, 0xef, 0xb8, 0x4d, 0x1c, 0x86, 0x8e, 0x46, 0x21, 0x77, 0x2f,
+    0xce, 0x1c, 0x4c, 0x1d, 0xc9, 0xa1, 0x64, 0x54, 0xbf, 0x38, 0x63, 0x13,
+    0x93, 0xf1, 0xde, 0x8f, 0x31, 0xf2, 0x0f, 0xf0, 0x83, 0x40, 0x19, 0xc2,
+    0x2f, 0x4d, 0xe8, 0x39, 0xb9, 0xf3, 0x0c, 0x7e, 0xff, 0x36, 0x79, 0x97,
+    0xd8, 0xe8, 0x03, 0x08, 0x1b, 0x26, 0x55, 0x04, 0x3c, 0x50, 0xc4, 0x84,
+    0xc3, 0x08, 0x83, 0xcf, 0x2b, 0x51, 0x2e, 0x0c, 0x45, 0x2f, 0x68, 0x0c,
+    0xc6, 0x30, 0xb7, 0x72, 0xe3, 0x9f, 0x73, 0x2e, 0x07, 0xb5, 0x8c, 0x69,
+    0x90, 0x01, 0x13, 0x61, 0x30, 0x38, 0xa0, 0xaf, 0xab, 0xeb, 0xa0, 0xc6,
+    0x96, 0xf2, 0xe0, 0x12, 0x45, 0x08, 0x08, 0x9f, 0xd7, 0x33, 0xba, 0x96,
+    0x27, 0x27, 0x23, 0x3f, 0x1c, 0xd3, 0xe7, 0xa6, 0x8e, 0x41, 0xe7, 0x9a,
+    0xb3, 0x11, 0x88, 0xa0, 0x1b, 0x58, 0xab, 0x30, 0x0f, 0x83, 0x44, 0x58,
+    0xac, 0xa9, 0x18, 0x04, 0x00, 0xbe, 0xfd, 0x19, 0x06, 0x91, 0x05, 0xc1,
+    0xf5, 0x00, 0x4f, 0xf2, 0xc2, 0x7f, 0xa5, 0xf8, 0xa2, 0x1c, 0xd7, 0x2d,
+    0x42, 0xa3, 0x03, 0xee, 0xdf, 0xc4, 0x13, 0xd4, 0x0c, 0x43, 0xea, 0x5e,
+    0x72, 0x5e, 0xe4, 0x60, 0xf0, 0x7e, 0x06, 0x7d, 0x29, 0x5d, 0xa3, 0xb7,
+    0x8f, 0x81, 0xba, 0x14, 0xb7, 0x23, 0xa0, 0x62, 0x71, 0x7c, 0x7a, 0x28,
+    0x23, 0x61, 0x41, 0xde, 0x57, 0xa2, 0xf2, 0xd0, 0x3c, 0x88, 0x30, 0x2a,
+    0xa3, 0x16, 0xae, 0x37, 0x02, 0x48, 0x20, 0xaf, 0xe7, 0x20, 0xf0, 0x30,
+    0xd6, 0x62, 0xe1, 0x6a, 0x98, 0x3e, 0xe3, 0x81, 0xc7, 0xa8, 0x01, 0xc8,
+    0x7d, 0x44, 0x0c, 0xec, 0xe8, 0xd3, 0x4e, 0x8f, 0xed, 0xde, 0x89, 0x2f,
+    0xa1, 0xac, 0x6f, 0xce, 0x16, 0x8e, 0xe9, 0x57, 0x27, 0xc9, 0xe9, 0x09,
+    0x70, 0xd8, 0x53, 0xcf, 0xe6, 0x42, 0xa9, 0x36, 0x7e, 0x3c, 0xcb, 0xdd,
+    0x36, 0xe4, 0x39, 0xe8, 0x72, 0xc3, 0xb3, 0x1a, 0xc5, 0x14, 0x72, 0x8c,
+    0x0c, 0x5e, 0x69, 0x93, 0xb8, 0x74, 0x68, 0xf8, 0x82, 0x7f, 0x44, 0x40,
+    0x48, 0x20, 0xf1, 0x32, 0x01, 0xe1, 0xf7, 0x1c, 0xde, 0x6c, 0x44, 0x3e,
+    0x4e, 0xa0, 0x06, 0x50, 0x21, 0x5d, 0x6f, 0x6a, 0x76, 0x70, 0x71, 0xa4,
+    0xc6, 0x73, 0x3f, 0x7d, 0x24, 0xb5, 0xc0, 0xac, 0x51, 0xa3, 0x0e, 0x95,
+    0x79, 0x74, 0x5e, 0x57, 0xa2, 0x42, 0x89, 0x8c, 0x2b, 0x8f, 0xbc, 0x64,
+    0xc7, 0xe8, 0x02, 0x6b, 0xe3, 0x87, 0xf6, 0x8e, 0xf3, 0x70, 0x36, 0x87,
+    0x7e, 0x95, 0xb7, 0x00, 0x83, 0x70, 0x41, 0xf0, 0x2d, 0x71, 0xa9, 0x9d,
+    0x48, 0x0a, 0xa6, 0x62, 0xa8, 0x1b, 0x88, 0x52, 0xf5, 0x64, 0x3c, 0xb5,
+    0x88, 0x83, 0x20, 0x59, 0x40, 0xab, 0x3e, 0x20, 0xc4, 0x8a, 0xda, 0x4a,
+    0xba, 0x2f, 0x1c, 0x72, 0x2a, 0x96, 0x21, 0x72, 0xd4, 0x12, 0x49, 0x3d,
+    0x75, 0x4c, 0x90, 0x02, 0xca, 0x41, 0xff, 0x9d, 0x7a, 0x70, 0x59, 0x10,
+    0x2f, 0x68, 0xcb, 0x37, 0x49, 0x1a, 0x81, 0x65, 0x14, 0x4e, 0x69, 0x9d,
+    0xfc, 0x7c, 0xa5, 0x86, 0xe3, 0x47, 0xf2, 0x7c, 0x30, 0x30, 0x29, 0x84,
+    0x02, 0xcc, 0x03, 0x66, 0x4e, 0x4a, 0x27, 0xbe, 0x17, 0xf2, 0xea, 0x92,
+    0x1f, 0x9d, 0xc1, 0x36, 0xaf, 0x41, 0x89, 0xea, 0x7a, 0x57, 0xe2, 0xa4,
+    0x62, 0x19, 0xc4, 0xce, 0x8f, 0x02, 0x9f, 0x05, 0x53, 0xe5, 0x20, 0x81,
+    0xb7, 0x34, 0x48, 0xd9, 0xba, 0x33, 0x75, 0xe5, 0xbd, 0x42, 0x27, 0x67,
+    0x82, 0x7f, 0xe2, 0xc0, 0x4e, 0x62, 0xfa, 0x5c, 0x4e, 0x44, 0x67, 0xdd,
+    0x87, 0x60, 0x5c, 0xde, 0xd0, 0xbb, 0x6f, 0xcb, 0x64, 0xef, 0x6c, 0xba,
+    0x48, 0xc5, 0x6b, 0xb2, 0xc8, 0x6d, 0x3c, 0xd7, 0x77, 0x33, 0x4b, 0x16,
+    0x19, 0xa3, 0xcf, 0xc3, 0xf8, 0x36, 0x3d, 0xe3, 0x05, 0x1a, 0xb6, 0x47,
+    0x8f, 0x53, 0x16, 0x5e, 0x32, 0x99, 0x8c, 0x15, 0xfa, 0x09, 0xa8, 0x64,
+    0xd1, 0xf0, 0x4b, 0x90, 0xb4, 0x29, 0x71, 0x04, 0x8a, 0x87, 0x7c, 0x5e,
+    0xcc, 0xe5, 0x13, 0x62, 0x77, 0x60, 0xbf, 0xc5, 0x47, 0x02, 0x5e, 0x66,
+    0x23, 0x1e, 0xe2, 0x53, 0x70, 0x83, 0xf1, 0x96, 0x17, 0x32, 0x42, 0x75,
+    0xb6, 0x82, 0x8c, 0x2a, 0xdb, 0x2a, 0xf1, 0xb3, 0xa7, 0x6d, 0x9f, 0x6c,
+    0x6e, 0x5e, 0x55, 0xcf, 0x0f, 0xf5, 0xc8, 0x57, 0x7f, 0x46, 0x0e, 0x60,
+    0xce, 0x12, 0x0d, 0x88, 0x2c, 0x70, 0x17, 0xd6, 0x74, 0x20, 0x63, 0xe8,
+    0x9d, 0x6a, 0x4b, 0xa0, 0x80, 0x2b, 0x98, 0x2d, 0x57, 0x2f, 0xe5, 0x3a,
+    0xc2, 0x84, 0x1f, 0x82, 0x8c, 0xd0, 0x55, 0xc9, 0x8a, 0x10, 0xf7, 0x78,
+    0x00, 0x4c, 0x67, 0x11, 0xf3, 0xb3, 0x49, 0xb8, 0xe8, 0xb0, 0xd0, 0x72,
+    0x36, 0xa2, 0x4b, 0x54, 0x08, 0x31, 0xf2, 0xcc, 0x17, 0xc9, 0xb2, 0x58,
+    0x3f, 0x9f, 0xa4, 0xc9, 0x92, 0xce, 0xd0, 0xa1, 0xb1, 0x40, 0x61, 0xe9,
+    0x8e, 0xcd, 0xae, 0xe6, 0xb4, 0xfd, 0x62, 0x15, 0xd7, 0x45, 0x60, 0x8c,
+    0x21, 0x0a, 0x03, 0x3c, 0xdf, 0xdb, 0x74, 0xbc, 0x82, 0xdb, 0x61, 0x32,
+    0x55, 0x54, 0x58, 0xc4, 0xb5, 0x2a, 0x95, 0x0a, 0xe7, 0xe7, 0x22, 0xe8,
+    0x9e, 0xca, 0x83, 0x92, 0x5d, 0x69, 0x5f, 0x71, 0x9c, 0x69, 0x3d, 0x00,
+    0x03, 0xed, 0xba, 0x7c, 0xa7, 0x22, 0xab, 0x03, 0x1b, 0x8f, 0xa5, 0x1c,
+    0x1b, 0x92, 0xbb, 0xe8, 0x89, 0xdf, 0xf9, 0x37, 0x3f, 0xe2, 0x7d, 0xab,
+    0x10, 0xf1, 0xa3, 0xdb, 0x69, 0x78, 0xcd, 0xd2, 0x93, 0x5f, 0xff, 0x75,
+    0xfa, 0xe8, 0x56, 0x1c, 0x9c, 0x05, 0xc4, 0x20, 0x83, 0x13, 0xd3, 0xdc,
+    0x1d, 0x0f, 0x70, 0x46, 0x17, 0x25, 0xa0, 0x9f, 0xd6, 0x28, 0xd9, 0xf6,
+    0x50, 0xb6, 0x98, 0xe4, 0x1b, 0x96, 0x5e, 0x23, 0xf7, 0x78, 0xc5, 0x4a,
+    0x79, 0x43, 0xb1, 0x55, 0x7f, 0xca, 0x8d, 0xfa, 0x29, 0x83, 0x0c, 0x76,
+    0xd7, 0x6a, 0xc8, 0x53, 0x2e, 0x62, 0x35, 0xee, 0x57, 0x0d, 0xd6, 0x44,
+    0xab, 0x37, 0x8d, 0x2e, 0x99, 0x79, 0x0d, 0x4b, 0x45, 0x85, 0xdc, 0x18,
+    0x6e, 0x31, 0x2e, 0x47, 0xbb, 0x3e, 0x82, 0x7c, 0xcc, 0x22, 0xaa, 0x84,
+    0x0f, 0x3f, 0xba, 0x6f, 0x83, 0xe5, 0x98, 0xef, 0x68, 0x32, 0x89, 0x15,
+    0x5f, 0x83, 0x17, 0x01, 0x86, 0x24, 0x85, 0x31, 0xee, 0x2d, 0xf0, 0x22,
+    0x0c, 0x25, 0x1c, 0x15, 0x03, 0x35, 0x91, 0x86, 0x06, 0x8e, 0x90, 0x4b,
+    0xac, 0xba, 0xf1, 0xc2, 0x11, 0x0d, 0x9b, 0x41, 0x9b, 0x1e, 0x65, 0x8b,
+    0xeb, 0x3b, 0x18, 0x7b, 0x79, 0x7b, 0x7b, 0x06, 0x36, 0x21, 0x9e, 0x39,
+    0x02, 0x66, 0x9b, 0x00, 0xb3, 0x4d, 0x82, 0x18, 0x98, 0x5e, 0x04, 0x88,
+    0x75, 0x4d, 0xc7, 0x69, 0x89, 0x05, 0x53, 0x2e, 0x9d, 0x80, 0xe5, 0xd9,
+    0x90, 0xc5, 0x2b, 0x50, 0xca, 0x31, 0x8a, 0xaa, 0xaa, 0xc1, 0x0b, 0x88,
+    0x1e, 0x42, 0x6e, 0x66, 0xb2, 0x6b, 0x66, 0x20, 0x70, 0xb9, 0x09, 0xe6,
+    0x25, 0x60, 0x56, 0x9b, 0xb5, 0x32, 0x18, 0x24, 0x68, 0x25, 0xce, 0xa2,
+    0xae, 0x02, 0xc2, 0x00, 0xf0, 0xae, 0x91, 0x9c, 0xf4, 0x3f, 0xb7, 0x2d,
+    0x82, 0x60, 0x41, 0x8a, 0xa6, 0x32, 0xc8, 0xab, 0xf0, 0xe7, 0x81, 0x8c,
+    0xa5, 0x0d, 0x65, 0xd0, 0x24, 0xa7, 0xe2, 0x08, 0x25, 0x6d, 0x4b, 0x78,
+    0x37, 0xc3, 0x45, 0x8a, 0x66, 0x38, 0x57, 0x22, 0xfd, 0xd8, 0x43, 0xac,
+    0xf8, 0x3e, 0x4a, 0x41, 0x4a, 0xa6, 0xd0, 0xb3, 0x03, 0x46, 0x40, 0xe2,
+    0x4a, 0x7e, 0xe3, 0x01, 0x7f, 0x69, 0x62, 0x71, 0x1e, 0x9e, 0x69, 0x2e,
+    0x55, 0x48, 0xef, 0x02, 0xe6, 0x86, 0xfa, 0x74, 0x0c, 0xd0, 0x5e, 0xdc,
+    0xde, 0x66, 0x3c, 0x1c, 0x9e, 0xaf, 0xe9, 0xf9, 0xb9, 0x8a, 0x26, 0xb1,
+    0xe4, 0xc8, 0xfa, 0x62, 0xe6, 0xb4, 0x98, 0x79, 0xb9, 0x98, 0x79, 0x7d,
+    0x31, 0x89, 0xcd, 0xc4, 0x1e, 0x2b, 0x57, 0x32, 0xa6, 0x95, 0x64, 0x72,
+    0x25, 0x19, 0x85, 0x00, 0xaa, 0x4b, 0xc5, 0x77, 0xc7, 0x0d, 0x4b, 0xe5,
+    0xde, 0x08, 0xb7, 0x91, 0x60, 0x75, 0xc5, 0x70, 0x41, 0x2c, 0x8e, 0xc7,
+    0x2c, 0x35, 0x62, 0xb6, 0x88, 0x4f, 0xbb, 0xbd, 0x9d, 0xea, 0xe7, 0xef,
+    0x70, 0xdc, 0xd3, 0x36, 0x49, 0x27, 0x74, 0xd0, 0x70, 0x0d, 0x99, 0x6b,
+    0xb9, 0xcc, 0x1c, 0x7b, 0xc0, 0xf1, 0x80, 0x2c, 0x18, 0xb0, 0xd5, 0xeb,
+    0x97, 0x37, 0xf1, 0xa0, 0x04, 0x2a, 0x74, 0x3a, 0x50, 0x5f, 0xf0, 0xb8,
+    0x3b, 0x06, 0x41, 0x61, 0x2c, 0x32, 0x75, 0x68, 0x6b, 0x31, 0x33, 0x5a,
+    0x16, 0x8e, 0x45, 0x9c, 0x15, 0x91, 0xd3, 0xfa, 0x31, 0x8c, 0x47, 0x53,
+    0x26, 0x4f, 0x65, 0xeb, 0x53, 0x16, 0x79, 0x81, 0x21, 0xac, 0xba, 0x3c,
+    0xf3, 0xde, 0xe4, 0xe6, 0x01, 0x05, 0x71, 0x4c, 0x0b, 0x52, 0x00, 0x22,
+    0x76, 0xfd, 0xb8, 0x00, 0x03, 0xa8, 0x9a, 0x02, 0x73, 0x01, 0x22, 0x62,
+    0x85, 0x51, 0x0b, 0x8e, 0x85, 0x4b, 0x22, 0x76, 0xcd, 0xc7, 0x79, 0xd0,
+    0x44, 0xe6, 0xd2, 0x0e, 0x4c, 0xb3, 0x8d, 0xe8, 0x2e, 0xb3, 0x63, 0x73,
+    0xb3, 0xb8, 0x4a, 0x07, 0x28, 0x6c, 0xe5, 0x49, 0x65, 0xc5, 0x92, 0x5a,
+    0x0a, 0x7f, 0xb0, 0x50, 0x75, 0xb1, 0xf0, 0xfa, 0x0c, 0x8b, 0x5f, 0x09,
+    0x66, 0x71, 0x77, 0xa4, 0xb5, 0x88, 0x29, 0x91, 0xb4, 0x12, 0x6b, 0x74,
+    0x36, 0xe5, 0x0f, 0x85, 0x72, 0x62, 0x09, 0xd5, 0xc4, 0x2a, 0x14, 0x13,
+    0xab, 0x50, 0x72, 0x2c, 0xa9, 0xd7, 0x58, 0xa5, 0x0e, 0x64, 0x95, 0x7a,
+    0x8f, 0x35, 0x9c, 0x84, 0xf1, 0x18, 0x3a, 0x22, 0xd6, 0x67, 0x7d, 0x61,
+    0xd7, 0xd4, 0x20, 0xfc, 0x82, 0x3c, 0xca, 0x32, 0x7c, 0x80, 0x76, 0x59,
+    0xf5, 0x4c, 0x99, 0xc1, 0x3b, 0xe9, 0xde, 0x4c, 0xab, 0x1e, 0xc9, 0x7c,
+    0x6d, 0xb4, 0x16, 0x4a, 0x6f, 0x8a, 0xe9, 0xe6, 0x3e, 0x3a, 0xb1, 0xda,
+    0xb8, 0xdf, 0xbc, 0x42, 0x1d, 0x83, 0x56, 0xab, 0x82, 0xee, 0x1c, 0xcb,
+    0x01, 0xdd, 0x31, 0xfc, 0xd2, 0xa5, 0x35, 0x92, 0xb6, 0x6b, 0xc1, 0xda,
+    0x45, 0x9c, 0x2d, 0xad, 0x75, 0x42, 0x16, 0xb6, 0x2d, 0xf4, 0x33, 0xdc,
+    0x8a, 0xd8, 0xe8, 0xa0, 0x32, 0xc5, 0x5c, 0xe9, 0x19, 0x8b, 0x78, 0xbc,
+    0x94, 0x7d, 0xb6, 0x38, 0x3b, 0x9b, 0xb2, 0x0c, 0x30, 0x3d, 0x1a, 0x40,
+    0xa9, 0x0d, 0x76, 0x12, 0x9d, 0xfa, 0x31, 0xfc, 0x09, 0xf0, 0xa9, 0xaf,
+    0x5c, 0xcc, 0x10, 0xe5, 0x02, 0x89, 0x41, 0x4b, 0xd8, 0xe8, 0xb8, 0xde,
+    0x25, 0x1e, 0x01, 0x59, 0x39, 0xaa, 0x5f, 0xe6, 0xf9, 0x44, 0x71, 0xcc,
+    0xbc, 0x9c, 0xd4, 0x95, 0x8d, 0xf6, 0x78, 0x9a, 0x9c, 0x85, 0xd3, 0x01,
+    0x60, 0x27, 0x20, 0xd9, 0xc7, 0x89, 0x87, 0x8c, 0x3c, 0x04, 0x6c, 0xcc,
+    0x82, 0xe7, 0x13, 0x81, 0xa7, 0xc0, 0x8b, 0x9f, 0xa3, 0xe5, 0x5f, 0x00,
+    0x06, 0xd8, 0x31, 0xe0, 0x5a, 0x66, 0x50, 0xf1, 0x9d, 0x82, 0xe5, 0xf5,
+    0x05, 0x59, 0xa0, 0x03, 0xa1, 0x54, 0xf9, 0x7f, 0x98, 0xa8, 0x0a, 0xa7,
+    0x08, 0x14, 0xbd, 0x2a, 0x8c, 0x75, 0x3c, 0xa0, 0xc4, 0x44, 0xa8, 0xeb,
+    0x31, 0xf0, 0x64, 0x79, 0x92, 0x02, 0xeb, 0x00, 0xfb, 0xc3, 0xec, 0x97,
+    0x13, 0x3a, 0x74, 0x6e, 0x87, 0x17, 0xe1, 0xd5, 0xf3, 0xa2, 0xa0, 0xed,
+    0x9d, 0x40, 0x99, 0x53, 0x89, 0xde, 0x6a, 0x21, 0x35, 0xbb, 0x1c, 0xc8,
+    0x8f, 0x0a, 0x2c, 0xb8, 0xb3, 0x29, 0x96, 0x83, 0xc1, 0xe3, 0x11, 0xd9,
+    0x62, 0x38, 0x04, 0xa4, 0xb3, 0xc1, 0xcc, 0x17, 0x8f, 0x7c, 0x28, 0xe8,
+    0x15, 0x49, 0x50, 0x24, 0x03, 0x53, 0xc2, 0x1d, 0x83, 0x2c, 0x99, 0x5e,
+    0xf2, 0x10, 0xd3, 0x08, 0xbb, 0x48, 0xb0, 0x13, 0xef, 0x25, 0x5e, 0x01,
+    0x11, 0x89, 0xde, 0x45, 0x43, 0x20, 0x2a, 0x70, 0x97, 0x13, 0x72, 0xff,
+    0x3e, 0x71, 0x12, 0x4f, 0xbf, 0xc1, 0xe9, 0x75, 0x31, 0x98, 0xd2, 0x5c,
+    0x4e, 0x4b, 0xd8, 0xb4, 0x09, 0xe9, 0xc5, 0x05, 0x15, 0x24, 0xaa, 0x73,
+    0x92, 0x81, 0x68, 0x9f, 0x21, 0x73, 0xa5, 0xfe, 0x13, 0xef, 0x84, 0x72,
+    0x78, 0xff, 0x29, 0x0c, 0x85, 0xfa, 0xe7, 0x67, 0x30, 0x31, 0x0f, 0x44,
+    0xeb, 0xed, 0x2d, 0xe3, 0x03, 0xe0, 0x13, 0x2f, 0x07, 0xf0, 0xf7, 0x49,
+    0xe5, 0x0a, 0x8f, 0x12, 0x1a, 0x7d, 0x7c, 0xe2, 0xd7, 0xe9, 0x48, 0x10,
+    0x50, 0xff, 0xea, 0x24, 0x5f, 0x88, 0x02, 0x7c, 0x96, 0xd0, 0x85, 0x93,
+    0x82, 0x56, 0x20, 0x50, 0x0b, 0xd6, 0xad, 0xd5, 0x02, 0x5c, 0xe2, 0xf7,
+    0xef, 0x6c, 0x6e, 0xd2, 0xe8, 0x48, 0x55, 0xe7, 0x00, 0xa2, 0x8d, 0xb3,
+    0x72, 0x28, 0x6f, 0x26, 0x78, 0x52, 0xb8, 0x78, 0x7d, 0x37, 0xd1, 0xee,
+    0x25, 0xa3, 0x8b, 0xa3, 0x72, 0xdf, 0xc9, 0xb7, 0xed, 0x4d, 0x7b, 0x9b,
+    0x29, 0xf7, 0xa4, 0x9d, 0x6c, 0x0e, 0x4e, 0x6f, 0xba, 0x5e, 0x6f, 0xb5,
+    0xe3, 0xd9, 0x03, 0xb5, 0xc1, 0xf7, 0x75, 0xac, 0x87, 0xd1, 0x94, 0xc6,
+    0x1f, 0x1d, 0x4d, 0xc1, 0x01, 0x7b, 0xfc, 0xfe, 0x03, 0x8e, 0xbe, 0x88,
+    0xf2, 0x6a, 0x21, 0x94, 0xa3, 0xa2, 0x90, 0x2c, 0x70, 0xb3, 0x48, 0xa7,
+    0x7e, 0xce, 0x43, 0xe2, 0x98, 0x27, 0xd0, 0x04, 0x34, 0x06, 0x4c, 0x40,
+    0x3b, 0xc3, 0x17, 0xa1, 0x2a, 0x3f, 0x4f, 0xbc, 0xe3, 0x89, 0xf7, 0x61,
+    0x12, 0x6c, 0xa3, 0x05, 0x82, 0x26, 0xba, 0xf7, 0x71, 0xa2, 0x5e, 0x45,
+    0xf5, 0xcb, 0x24, 0xd8, 0x11, 0xb7, 0x16, 0x7e, 0x3a, 0x3b, 0xf9, 0xf7,
+    0xe1, 0xe9, 0x77, 0xce, 0xc0, 0x77, 0x06, 0x1b, 0x87, 0x9f, 0x76, 0xc4,
+    0x5d, 0x86, 0xee, 0x21, 0x25, 0xbb, 0xdf, 0x95, 0x49, 0x78, 0xb7, 0xd3,
+    0x3f, 0x27, 0xfc, 0x72, 0x27, 0x5c, 0xa7, 0x5b, 0xd4, 0x49, 0xa2, 0x21,
+    0x71, 0x7b, 0xf7, 0x93, 0xe2, 0xd7, 0xde, 0x89, 0xbc, 0x5f, 0x9b, 0xcb,
+    0x5d, 0xcd, 0xa6, 0x50, 0xe0, 0x5f, 0x93, 0xc0, 0x56, 0xd2, 0x77, 0x2e,
+    0x32, 0x10, 0xb5, 0xde, 0x6f, 0x90, 0x4a, 0x4e, 0x72, 0x7e, 0x23, 0xd4,
+    0xa3, 0x09, 0xbf, 0xcc, 0xea, 0xd1, 0x8e, 0xf7, 0x79, 0x12, 0x7c, 0x9c,
+    0x54, 0x6f, 0x48, 0x0a, 0x6d, 0xb7, 0xff, 0x79, 0xd2, 0x9e, 0xa4, 0xec,
+    0x1c, 0xfd, 0x4b, 0x09, 0x6f, 0x8b, 0xde, 0xbd, 0x62, 0xfd, 0x83, 0x0e,
+    0x3d, 0xc3, 0xc2, 0xe3, 0x49, 0xe3, 0xf7, 0x15, 0x51, 0x4a, 0x0e, 0x34,
+    0x1b, 0x99, 0xa9, 0x4d, 0x97, 0x49, 0xb8, 0xe5, 0x82, 0x61, 0x15, 0x0c,
+    0x09, 0x94, 0x6c, 0x25, 0x07, 0x14, 0xc5, 0x61, 0xce, 0x5f, 0x00, 0x52,
+    0xe2, 0x35, 0x91, 0xc0, 0xb5, 0x1c, 0x7d, 0xcd, 0xf0, 0xe4, 0x17, 0xc6,
+    0x3e, 0xc3, 0xd2, 0xd9, 0xe4, 0xc7, 0xb6, 0xb7, 0x3f, 0x4c, 0xb6, 0xb7,
+    0x81, 0xb5, 0xd5, 0x07, 0x2f, 0xf6, 0x00, 0x5c, 0x6f, 0x11, 0x0c, 0x4f,
+    0x42, 0xdc, 0x50, 0x56, 0x65, 0x07, 0xb0, 0xbf, 0xba, 0x86, 0x60, 0x73,
+    0x59, 0x84, 0x64, 0x65, 0x87, 0x67, 0x49, 0x9a, 0x93, 0x01, 0x09, 0x26,
+    0x37, 0x3e, 0xfb, 0xac, 0x34, 0x6b, 0x91, 0x55, 0x80, 0x88, 0x9e, 0x45,
+    0x19, 0x73, 0xa6, 0xc4, 0x4b, 0xa1, 0x31, 0x68, 0xd8, 0x26, 0x51, 0x2a,
+    0x5a, 0xd1, 0xc5, 0xcb, 0x10, 0x44, 0x62, 0xfa, 0x21, 0x9a, 0xa1, 0xb8,
+    0x14, 0xfc, 0x37, 0xa3, 0xc0, 0x3c, 0xa7, 0xdc, 0x7f, 0xf1, 0xc4, 0x00,
+    0x36, 0x02, 0xb9, 0xa5, 0x11, 0x0d, 0x80, 0xad, 0x45, 0xe8, 0x3e, 0x9e,
+    0xf2, 0x8b, 0xe6, 0x80, 0xb1, 0x10, 0xa5, 0xe1, 0xde, 0x88, 0xe8, 0x87,
+    0xe7, 0x78, 0x38, 0xc9, 0x60, 0x81, 0x5c, 0x44, 0x87, 0xd9, 0x02, 0x88,
+    0x61, 0x41, 0x6d, 0x20, 0x28, 0xa2, 0xa0, 0xd0, 0x5f, 0x49, 0x59, 0x04,
+    0xf6, 0x8d, 0x16, 0xf6, 0x80, 0x39, 0x72, 0xc6, 0xbe, 0x43, 0x2d, 0xa9,
+    0x1b, 0xf5, 0xe5, 0xb1, 0xe7, 0x95, 0x97, 0xe1, 0x46, 0x0a, 0xac, 0x14,
+    0x90, 0x4a, 0x49, 0xaa, 0x9f, 0x06, 0x4e, 0x7b, 0xdb, 0x0d, 0x3e, 0x0d,
+    0x90, 0x54, 0x1f, 0x75, 0x03, 0x7b, 0x1b, 0xc4, 0x09, 0x2c, 0x09, 0x5e,
+    0xf7, 0xa5, 0x1d, 0x42, 0xc9, 0x5c, 0x0f, 0x4f, 0x76, 0xe5, 0x1c, 0x0e,
+    0x64, 0x53, 0x64, 0x2c, 0x97, 0x60, 0x51, 0xfa, 0x84, 0xf1, 0x88, 0x42,
+    0x14, 0x90, 0x2e, 0x6b, 0xe0, 0xad, 0x42, 0xd3, 0x95, 0x44, 0xb8, 0x63,
+    0x96, 0xe7, 0x78, 0x88, 0x29, 0xb8, 0x41, 0x68, 0xf9, 0xf6, 0x0f, 0xaf,
+    0x3e, 0xd8, 0x5e, 0x29, 0x6b, 0xfc, 0x37, 0x93, 0x82, 0x88, 0xe1, 0x91,
+    0xc0, 0x85, 0x0f, 0x92, 0xfb, 0xf1, 0x67, 0xe2, 0x89, 0xb4, 0xe3, 0xe6,
+    0x71, 0xf6, 0xe6, 0x6f, 0x74, 0xbc, 0xab, 0x49, 0x6a, 0xd8, 0x24, 0x47,
+    0x6a, 0x1f, 0xb6, 0x7f, 0x7d, 0xfb, 0xe6, 0xc7, 0x3c, 0x9f, 0xff, 0xcc,
+    0x7e, 0x5f, 0x80, 0x31, 0xb2, 0xf2, 0x42, 0xe8, 0x61, 0x9e, 0x67, 0xfe,
+    0x0d, 0xc7, 0x38, 0xbf, 0xba, 0x0d, 0xe5, 0x59, 0x1a, 0x21, 0x36, 0xa4,
+    0x5f, 0xb5, 0x94, 0x8d, 0x2b, 0x0f, 0xe9, 0xc0, 0xff, 0xd7, 0xc4, 0x03,
+    0x62, 0xf6, 0x35, 0x3a, 0x86, 0x04, 0xcf, 0xa2, 0x0e, 0xae, 0x90, 0x82,
+    0x29, 0xba, 0xfe, 0xb7, 0x09, 0x8f, 0x64, 0xe7, 0x1d, 0xcf, 0x51, 0x47,
+    0xb7, 0x57, 0x1e, 0x68, 0x77, 0x59, 0xf6, 0x32, 0x99, 0xc1, 0x9b, 0xbf,
+    0xd1, 0xf5, 0x04, 0x00, 0xfd, 0x0e, 0x06, 0x2f, 0x23, 0x48, 0x5e, 0x22,
+    0x97, 0x83, 0xa9, 0x0e, 0x41, 0xd5, 0x62, 0xf8, 0x80, 0x5c, 0xee, 0x7b,
+    0x7e, 0x6a, 0xf8, 0xcd, 0xa4, 0x80, 0x71, 0x89, 0x08, 0x5f, 0x2e, 0xb8,
+    0x30, 0x99, 0x5e, 0x78, 0xb3, 0x0b, 0xef, 0x4d, 0xe4, 0x5d, 0x80, 0x95,
+    0x79, 0x81, 0x4a, 0x85, 0x30, 0xb7, 0x6e, 0x56, 0xde, 0x97, 0x8b, 0xdb,
+    0x5b, 0xbc, 0xff, 0x25, 0xa1, 0x74, 0xd0, 0x25, 0x00, 0xe8, 0x6c, 0x44,
+    0x28, 0x29, 0x5f, 0x1c, 0xbe, 0x75, 0xf8, 0xf3, 0x84, 0x5c, 0xff, 0xfa,
+    0x42, 0xba, 0xc5, 0xa6, 0x54, 0x7c, 0x71, 0xf2, 0xf3, 0x04, 0x83, 0x73,
+    0xf9, 0x43, 0x50, 0x29, 0x88, 0x69, 0x6e, 0xdf, 0xb9, 0x00, 0xb1, 0x76,
+    0x51, 0x8a, 0x25, 0xa8, 0x58, 0xb0, 0xa5, 0xed, 0x6d, 0x12, 0x4c, 0x38,
+    0x46, 0x45, 0x32, 0x85, 0x88, 0xe1, 0x30, 0xea, 0xb6, 0x02, 0x1d, 0x10,
+    0x03, 0xce, 0xf4, 0xc2, 0xcc, 0xfe, 0x5c, 0xce, 0xfc, 0xa0, 0x02, 0xe0,
+    0xbb, 0x37, 0xbd, 0xe0, 0xaf, 0xe2, 0xb7, 0xd2, 0x4e, 0x00, 0xac, 0x92,
+    0xbc, 0x92, 0xc3, 0x64, 0xba, 0x6d, 0xef, 0xec, 0xd8, 0xdb, 0xc8, 0x3b,
+    0x93, 0x2c, 0xdf, 0xc0, 0x0a, 0x7a, 0x0e, 0xb6, 0x00, 0x39, 0x34, 0x14,
+    0x68, 0x19, 0x5d, 0x9f, 0xf4, 0xa0, 0xb2, 0x59, 0x79, 0x81, 0x1d, 0xba,
+    0x7e, 0x5b, 0xdd, 0x43, 0x67, 0x76, 0x21, 0xc6, 0x51, 0x84, 0xf3, 0xd9,
+    0xdf, 0xda, 0xe4, 0x9a, 0x15, 0x75, 0x45, 0x2e, 0xdf, 0x63, 0xea, 0xc0,
+    0x22, 0xa1, 0xcf, 0xf8, 0x0d, 0x07, 0x91, 0xb2, 0xe8, 0x9b, 0x9b, 0x6f,
+    0x22, 0xda, 0xa8, 0xa0, 0x28, 0x0d, 0x71, 0x56, 0x00, 0xe0, 0x46, 0x77,
+    0xae, 0x8a, 0x2c, 0x6c, 0x55, 0x3c, 0x62, 0x16, 0x5d, 0x47, 0x28, 0x13,
+    0x60, 0xe9, 0x81, 0x71, 0x86, 0x23, 0x8a, 0xe5, 0x08, 0xa7, 0xd0, 0xc9,
+    0x86, 0xc8, 0xb9, 0xbd, 0xc5, 0x2c, 0xbe, 0x17, 0x8b, 0xb4, 0xb8, 0x11,
+    0x88, 0x77, 0x7d, 0xc7, 0x16, 0x72, 0x89, 0xcf, 0xf3, 0x7c, 0x29, 0x5c,
+    0x01, 0x06, 0xf0, 0x86, 0xf3, 0x00, 0x0d, 0x81, 0x3f, 0x79, 0x72, 0x34,
+    0xf2, 0x41, 0x4a, 0x6a, 0x92, 0x19, 0x73, 0x82, 0x87, 0xac, 0xee, 0xfd,
+    0x7e, 0x11, 0x00, 0x1f, 0x6a, 0x6f, 0x23, 0x17, 0xe2, 0xce, 0x65, 0x0e,
+    0x0f, 0xf2, 0x70, 0xfe, 0x7e, 0x01, 0x13, 0x82, 0x0a, 0xa2, 0x63, 0x64,
+    0x7e, 0x78, 0x72, 0x1e, 0xd6, 0x0f, 0xb1, 0x1f, 0xf2, 0xbe, 0x40, 0x81,
+    0x0d, 0x44, 0xbc, 0x2f, 0x22, 0x0d, 0xf8, 0x6b, 0xb1, 0x8b, 0x3c, 0xbf,
+    0x50, 0x86, 0x3c, 0xbf, 0x70, 0xcb, 0xe5, 0x82, 0xa1, 0x0a, 0xdc, 0xb0,
+    0x3f, 0x03, 0xd7, 0x53, 0xbc, 0xf5, 0xc0, 0xcc, 0x79, 0x8d, 0x00, 0x6b,
+    0x08, 0x06, 0xf2, 0xfb, 0x85, 0xa9, 0x2a, 0xfc, 0x50, 0xd1, 0x81, 0x7c,
+    0xd8, 0xb6, 0x83, 0x81, 0xed, 0x73, 0x57, 0x8c, 0xcc, 0xc3, 0x23, 0x23,
+    0x43, 0x21, 0x18, 0x21, 0xd7, 0x75, 0x35, 0xa9, 0x0b, 0x4d, 0x01, 0xcd,
+    0x89, 0x6d, 0xad, 0x0b, 0x2f, 0x23, 0xd0, 0x08, 0xc6, 0x74, 0x32, 0xbf,
+    0x38, 0xf5, 0xf2, 0x0b, 0xf4, 0x71, 0x2f, 0x2e, 0x2a, 0x46, 0x4f, 0x7e,
+    0x81, 0x46, 0xb6, 0x1a, 0xce, 0x7f, 0x1a, 0x90, 0x62, 0xbd, 0xf2, 0x2e,
+    0x2f, 0xc8, 0xe1, 0x88, 0xf7, 0x2a, 0x6e, 0xfb, 0xa0, 0x57, 0x7c, 0xda,
+    0xd1, 0xc1, 0x3a, 0x28, 0xae, 0xc8, 0xf2, 0x15, 0xa4, 0x95, 0x68, 0xee,
+    0x2d, 0x69, 0x08, 0xc0, 0x47, 0x41, 0xac, 0x5d, 0x5d, 0x04, 0xcb, 0x0b,
+    0xbc, 0xf0, 0x54, 0xf0, 0xcc, 0x1f, 0x41, 0x2c, 0x30, 0xba, 0x5b, 0x25,
+    0x01, 0xc8, 0x26, 0x17, 0x85, 0x2c, 0x5d, 0x5e, 0xd4, 0x89, 0x73, 0x71,
+    0xe1, 0xd8, 0xbf, 0xb6, 0x44, 0x4d, 0x36, 0x6a, 0xa1, 0x6e, 0x6c, 0x7b,
+    0xb6, 0xce, 0x85, 0x51, 0xcc, 0x43, 0xb9, 0x67, 0x34, 0x63, 0x1b, 0xe6,
+    0x8f, 0xc7, 0x8f, 0x76, 0xe8, 0x9e, 0x38, 0x0e, 0x8b, 0x19, 0xb0, 0x3f,
+    0x8e, 0x65, 0xd9, 0x05, 0x22, 0x37, 0x10, 0x54, 0x76, 0x51, 0x12, 0x92,
+    0x47, 0x81, 0xed, 0x50, 0x14, 0x12, 0x85, 0x25, 0xea, 0xd9, 0x5e, 0x8f,
+    0xc2, 0x6a, 0x61, 0x2a, 0x6d, 0xb4, 0x76, 0xd3, 0x68, 0xc4, 0xde, 0x8a,
+    0x66, 0x36, 0x37, 0x0d, 0x89, 0x50, 0x1f, 0x29, 0x0e, 0x27, 0xc0, 0xcf,
+    0xee, 0xf0, 0x0e, 0x0b, 0x54, 0x2b, 0x13, 0x37, 0x37, 0x05, 0xe6, 0x16,
+    0x84, 0x02, 0xef, 0x75, 0x42, 0x41, 0xc9, 0x0d, 0xb3, 0x12, 0x27, 0x81,
+    0x5a, 0x58, 0xd3, 0xf6, 0xaa, 0xcd, 0xeb, 0xe2, 0xa1, 0xb5, 0x5c, 0x2e,
+    0x5b, 0xc0, 0x5f, 0x67, 0x2d, 0x58, 0x23, 0x16, 0x0f, 0x13, 0xbc, 0x7a,
+    0x83, 0x80, 0x3a, 0x21, 0xa0, 0x67, 0x64, 0x9d, 0x1e, 0x13, 0xf3, 0x55,
+    0x12, 0xa1, 0x1b, 0xd0, 0x68, 0xcb, 0x84, 0x93, 0x63, 0xe4, 0xaf, 0xe8,
+    0xb0, 0xaf, 0xaf, 0x5b, 0xb0, 0xb8, 0x20, 0x90, 0xc4, 0xb4, 0xc3, 0x8b,
+    0x71, 0x5e, 0x8c, 0x1b, 0xfa, 0x81, 0x1e, 0xdc, 0xb7, 0x17, 0xe0, 0xaa,
+    0x2b, 0x97, 0x86, 0xdc, 0x98, 0x6b, 0xa1, 0x14, 0x56, 0x95, 0xa3, 0x54,
+    0xe0, 0xf1, 0xf3, 0x0b, 0xef, 0xc5, 0x45, 0xb0, 0xd1, 0xc5, 0x61, 0xf4,
+    0x3a, 0x9d, 0x43, 0xc2, 0x21, 0xa8, 0xb7, 0xc8, 0x08, 0xfa, 0xfc, 0xf1,
+    0x70, 0xb7, 0xd3, 0xb9, 0xbd, 0xdd, 0xed, 0xf0, 0xce, 0x78, 0x1a, 0x05,
+    0x73, 0x2b, 0x85, 0xed, 0xf3, 0x08, 0x6f, 0xbd, 0x0c, 0x82, 0xcb, 0x0b,
+    0x1a, 0x18, 0xf0, 0x81, 0x39, 0x12, 0xa2, 0xf3, 0x3a, 0xd2, 0x51, 0x03,
+    0xea, 0x8c, 0x71, 0xb2, 0xd9, 0x3c, 0x89, 0x33, 0xc6, 0x67, 0xeb, 0xc8,
+    0xdb, 0x32, 0x5b, 0xa4, 0xc4, 0x12, 0xbf, 0x85, 0x7a, 0xaf, 0x23, 0x89,
+    0x27, 0xfd, 0x02, 0x4f, 0x5e, 0x47, 0x3c, 0x2f, 0xf8, 0x6d, 0x32, 0xe0,
+    0x77, 0xae, 0xfa, 0xf8, 0xf6, 0x2f, 0x78, 0x23, 0xf5, 0xdb, 0xff, 0xe7,
+    0x84, 0x53, 0xd0, 0xeb, 0xc8, 0x1d, 0x48, 0xee, 0xe2, 0xff, 0x5a, 0x26,
+    0xc2, 0x50, 0x51, 0xaa, 0xa3, 0x76, 0x4b, 0x77, 0xb5, 0xe2, 0x16, 0x2e,
+    0x6e, 0x76, 0x9d, 0x2d, 0xce, 0xcf, 0xe9, 0x52, 0x6b, 0x82, 0x27, 0x1f,
+    0x9d, 0x58, 0x7c, 0xfc, 0xd4, 0x7a, 0x3d, 0xc3, 0x7d, 0x7e, 0xa1, 0x26,
+    0xf1, 0x2b, 0x2d, 0xf4, 0x34, 0x8c, 0x35, 0xef, 0xe3, 0x6d, 0xbf, 0xcf,
+    0x2f, 0x6a, 0x4e, 0x75, 0xbc, 0x2d, 0xb3, 0x5d, 0xaa, 0x03, 0x01, 0x2c,
+    0x51, 0x79, 0x2f, 0x11, 0xf7, 0x63, 0xc6, 0x15, 0x43, 0xdf, 0x52, 0x2b,
+    0xc8, 0x3b, 0xfa, 0xc8, 0xe3, 0xe6, 0xc0, 0x3a, 0xce, 0x2f, 0x00, 0xb7,
+    0x60, 0x36, 0x62, 0xce, 0xc8, 0x12, 0x07, 0x18, 0x53, 0x03, 0x79, 0xae,
+    0x4f, 0x73, 0xa6, 0x24, 0x7d, 0x84, 0x40, 0xe1, 0x3e, 0x07, 0x5c, 0x40,
+    0x1c, 0x18, 0x0a, 0x07, 0x8f, 0x04, 0xb0, 0xa0, 0x1e, 0xbf, 0x7b, 0x98,
+    0x0b, 0x27, 0x71, 0xbd, 0x30, 0xa4, 0xba, 0xe5, 0xdd, 0xc2, 0x80, 0x3c,
+    0x39, 0xee, 0x39, 0xbd, 0x28, 0xd8, 0x2f, 0x28, 0xcf, 0x2f, 0x2e, 0x3c,
+    0x9b, 0x2a, 0xa4, 0x42, 0x7b, 0x5e, 0xe2, 0xd0, 0x90, 0x77, 0xae, 0x40,
+    0xd3, 0x7e, 0x7e, 0xa1, 0xbc, 0x53, 0xb0, 0x14, 0x54, 0x29, 0x30, 0x09,
+    0x41, 0xc6, 0xa3, 0xc6, 0xbc, 0x22, 0x6d, 0x20, 0xb4, 0x70, 0x5f, 0xa8,
+    0xcf, 0x4a, 0x7d, 0x04, 0xd4, 0xeb, 0x68, 0x55, 0xe8, 0xd9, 0x94, 0x53,
+    0xde, 0x7c, 0x08, 0xfc, 0xf9, 0x8c, 0x82, 0x40, 0x3c, 0xa9, 0xd3, 0xd7,
+    0x9a, 0x80, 0x27, 0x02, 0xf7, 0x35, 0x90, 0x01, 0xa8, 0x23, 0xd9, 0x75,
+    0x3c, 0x24, 0x2b, 0x0a, 0x25, 0x10, 0xf2, 0x77, 0x4c, 0x10, 0x44, 0x9a,
+    0x80, 0x8e, 0xed, 0x08, 0x26, 0x22, 0x94, 0x0a, 0xef, 0xfa, 0x82, 0x9e,
+    0x60, 0xae, 0x31, 0x9e, 0x17, 0x87, 0xe7, 0x79, 0x98, 0x65, 0xf8, 0xa1,
+    0x14, 0x62, 0x08, 0xc0, 0x9b, 0xbf, 0x8f, 0xd8, 0x74, 0x54, 0x61, 0x09,
+    0x65, 0xf2, 0xf2, 0x02, 0xd9, 0x40, 0xa0, 0xa6, 0x61, 0x42, 0xbf, 0x2c,
+    0x9e, 0x5f, 0xb8, 0x57, 0x17, 0xc2, 0x77, 0x0e, 0xa3, 0xce, 0x2f, 0x38,
+    0xdf, 0x28, 0xee, 0x73, 0xc1, 0x01, 0x15, 0xaa, 0x7e, 0x7a, 0xd1, 0xa0,
+    0xeb, 0x37, 0xb2, 0x05, 0x13, 0x8c, 0xa4, 0x55, 0xa0, 0x00, 0xda, 0x2b,
+    0xbb, 0x71, 0x89, 0x5b, 0x67, 0xa8, 0x8d, 0x0a, 0x0e, 0x3b, 0x10, 0xbf,
+    0xa4, 0xe1, 0x63, 0x2e, 0x69, 0xb6, 0xe8, 0x94, 0xad, 0xeb, 0xf7, 0xd2,
+    0x28, 0x7d, 0x3f, 0x51, 0xf7, 0x1f, 0xb5, 0x5b, 0x92, 0x10, 0xdf, 0x40,
+    0x71, 0x0b, 0x6a, 0x67, 0x78, 0x9b, 0xea, 0x94, 0x97, 0x0c, 0x52, 0xe0,
+    0x96, 0xfd, 0xfe, 0xa7, 0x63, 0x30, 0x52, 0x64, 0x4f, 0xb9, 0x2b, 0x87,
+    0x43, 0x77, 0x75, 0x7d, 0x45, 0xab, 0x52, 0xff, 0xe1, 0xaa, 0x4d, 0xad,
+    0x65, 0xdc, 0x05, 0x03, 0x9b, 0xd4, 0x44, 0xe2, 0xa6, 0x13, 0x5a, 0xb4,
+    0x3d, 0x51, 0x5c, 0x8a, 0x4b, 0xa7, 0xcb, 0x02, 0x2d, 0x16, 0x08, 0x6c,
+    0x72, 0xe9, 0x7e, 0x71, 0xc1, 0xec, 0x0e, 0xa5, 0x33, 0x4d, 0x0e, 0xa8,
+    0x7b, 0x98, 0x14, 0x27, 0x29, 0x9c, 0x90, 0x14, 0x9d, 0x04, 0xcd, 0xd7,
+    0x14, 0x7e, 0xba, 0xc0, 0x23, 0x8b, 0x0a, 0x7a, 0x98, 0x4d, 0x1b, 0xd9,
+    0xa5, 0x93, 0x0e, 0xc0, 0x2a, 0xb6, 0x0f, 0x47, 0xd1, 0xe5, 0x91, 0xed,
+    0xf2, 0xa4, 0xf2, 0xf4, 0xe1, 0x2f, 0x13, 0x3c, 0x0d, 0x21, 0x4e, 0xe4,
+    0xa5, 0xe8, 0x04, 0xf0, 0x80, 0xb7, 0x67, 0xc6, 0xc0, 0x0a, 0x09, 0x84,
+    0x50, 0xec, 0xb4, 0xd1, 0x94, 0xc2, 0x28, 0xe0, 0x02, 0xf1, 0xe3, 0xcf,
+    0xaf, 0xd1, 0xbf, 0x95, 0xc4, 0x18, 0x77, 0x2c, 0xb5, 0x5b, 0xe3, 0xfe,
+    0xf9, 0x89, 0xe2, 0x9d, 0x0d, 0x47, 0xd5, 0xfd, 0x60, 0x83, 0xd3, 0x89,
+    0x05, 0x28, 0xb6, 0x3d, 0xe3, 0x31, 0x45, 0x0a, 0xcb, 0x09, 0x23, 0x3a,
+    0xc4, 0x84, 0x16, 0x72, 0xc4, 0x6f, 0x67, 0x54, 0xee, 0xfd, 0x47, 0x8e,
+    0x19, 0x79, 0x09, 0xef, 0x3d, 0xe4, 0x0e, 0x5b, 0x71, 0x01, 0x22, 0xee,
+    0x64, 0x2d, 0xf8, 0xbb, 0xbe, 0x09, 0x83, 0x13, 0x30, 0x6e, 0x1e, 0x85,
+    0x85, 0x4e, 0xcf, 0xe8, 0x56, 0x62, 0x27, 0x0f, 0xa2, 0x41, 0xe2, 0x27,
+    0xdb, 0xf6, 0x89, 0xbd, 0xed, 0x2c, 0xca, 0x2f, 0x53, 0x04, 0x41, 0x88,
+    0x5a, 0x84, 0x88, 0xd4, 0x0d, 0x07, 0x39, 0x1d, 0x79, 0xb1, 0x4f, 0x51,
+    0x4b, 0x86, 0x7a, 0xd9, 0x20, 0xc5, 0xb9, 0x3b, 0xa0, 0xd8, 0x22, 0x17,
+    0x61, 0xe2, 0x0c, 0xa3, 0x5f, 0xd6, 0x00, 0x15, 0x07, 0x24, 0x9f, 0xd2,
+    0xdc, 0x20, 0xa6, 0xad, 0xb1, 0x08, 0xfd, 0xef, 0xbc, 0xb2, 0xd8, 0x7b,
+    0x11, 0x8e, 0x5f, 0xb0, 0xe7, 0x79, 0xe0, 0xdb, 0xa6, 0xfa, 0x5d, 0x84,
+    0xbf, 0xf5, 0x3a, 0xf8, 0x65, 0x84, 0x6d, 0x5b, 0xb8, 0xbc, 0x9d, 0x8f,
+    0x17, 0xc1, 0xc8, 0x45, 0x0c, 0x2e, 0x62, 0x1b, 0x2b, 0xf7, 0x24, 0x96,
+    0x51, 0xc9, 0x74, 0x75, 0x4c, 0x64, 0xbe, 0x63, 0x59, 0x6c, 0x27, 0x0c,
+    0xca, 0xc8, 0xe3, 0x48, 0xb8, 0xb4, 0x45, 0x7c, 0xf1, 0x0d, 0x4e, 0xcc,
+    0x8f, 0x3d, 0x9a, 0x98, 0x8f, 0x11, 0xe8, 0xea, 0xce, 0x0f, 0x1d, 0x4a,
+    0xfc, 0x78, 0x21, 0x80, 0x2c, 0x8e, 0x4c, 0x30, 0x71, 0xff, 0x66, 0x75,
+    0x07, 0x07, 0x6f, 0xbb, 0x43, 0x0e, 0x8c, 0xb7, 0x13, 0x12, 0xbc, 0x5c,
+    0x52, 0x3f, 0x90, 0x75, 0x32, 0xb4, 0x24, 0x98, 0x1a, 0xc4, 0xaa, 0x68,
+    0xdd, 0x60, 0x7c, 0xd0, 0x4d, 0x1f, 0x78, 0x1d, 0xf7, 0x08, 0xed, 0xb2,
+    0xc5, 0xd9, 0x2c, 0xc2, 0x0a, 0xb8, 0x55, 0x06, 0x02, 0x91, 0xc9, 0x67,
+    0xfe, 0x21, 0x16, 0xf1, 0x82, 0x7a, 0x0d, 0x7f, 0x74, 0x6c, 0x34, 0xc8,
+    0x12, 0x91, 0x0e, 0xe6, 0xcb, 0xf0, 0xcb, 0x59, 0x72, 0x85, 0xaf, 0xb7,
+    0xb7, 0x18, 0x7c, 0x0b, 0xef, 0x14, 0xd7, 0x14, 0x01, 0x50, 0xf1, 0x86,
+    0x0c, 0x94, 0xbd, 0xae, 0xb8, 0x5b, 0x15, 0xe6, 0xa6, 0xc2, 0x38, 0xa8,
+    0xdd, 0x87, 0x54, 0x52, 0x81, 0xd8, 0xc9, 0x56, 0x57, 0xc3, 0x31, 0xc7,
+    0x73, 0x09, 0xd0, 0xd6, 0x09, 0x0e, 0x43, 0x2d, 0x11, 0x2e, 0x44, 0x03,
+    0xc6, 0x6c, 0x8e, 0x5f, 0x34, 0xb8, 0x12, 0x4d, 0x8a, 0x61, 0x12, 0x60,
+    0xaa, 0x31, 0x7a, 0xfa, 0x16, 0x90, 0x5b, 0x6e, 0x01, 0x49, 0x40, 0x62,
+    0xcc, 0x88, 0x0c, 0x7e, 0x36, 0x1c, 0xa1, 0x81, 0xb6, 0xf9, 0xc6, 0x88,
+    0x2c, 0x2f, 0xce, 0xee, 0xb3, 0xdf, 0x9d, 0x8e, 0xab, 0xec, 0x1e, 0xc1,
+    0x88, 0x4c, 0x3b, 0x24, 0xb7, 0xb7, 0xc5, 0x05, 0x73, 0x50, 0x9c, 0x37,
+    0xe1, 0x54, 0x2e, 0xe4, 0x50, 0x37, 0x42, 0x41, 0xeb, 0xaa, 0x9d, 0xaa,
+    0x14, 0x96, 0x6d, 0xa9, 0xbe, 0x70, 0x0e, 0x54, 0x2d, 0xd7, 0x1f, 0xb6,
+    0xab, 0x49, 0x55, 0x93, 0xae, 0xfc, 0x82, 0x03, 0x4f, 0xa9, 0x7d, 0x6d,
+    0x81, 0xae, 0x11, 0x80, 0xff, 0x81, 0x58, 0x1d, 0xad, 0xdc, 0x43, 0xe9,
+    0x7f, 0x16, 0x0e, 0x6b, 0x6b, 0x0a, 0xe2, 0x37, 0xa8, 0xc5, 0x52, 0x1f,
+    0x3d, 0x52, 0x45, 0xf6, 0x16, 0x3a, 0x0e, 0x86, 0xb8, 0xef, 0x37, 0x62,
+    0x5b, 0xc4, 0x5d, 0x5f, 0xfc, 0xf4, 0xee, 0xfb, 0xd7, 0x3f, 0x7c, 0x7e,
+    0xfd, 0xe1, 0xd5, 0xdb, 0xe3, 0xe0, 0x04, 0x3d, 0x65, 0x3f, 0xa4, 0xc9,
+    0x62, 0xfe, 0x3a, 0x67, 0x33, 0xc7, 0xfe, 0x01, 0x23, 0xf4, 0xc2, 0xa9,
+    0x05, 0x96, 0xcc, 0x79, 0x34, 0xb6, 0x3d, 0xfe, 0xb9, 0xa3, 0xef, 0x43,
+    0x0c, 0x88, 0xb8, 0x76, 0x29, 0x1a, 0x98, 0x67, 0xf1, 0xe2, 0x23, 0x76,
+    0x19, 0x0d, 0x19, 0xbf, 0x54, 0xbf, 0x7c, 0x7e, 0x8d, 0xdf, 0x48, 0x10,
+    0x75, 0x3c, 0xfa, 0x60, 0xc2, 0x33, 0x64, 0xfd, 0xfc, 0xf1, 0x07, 0x96,
+    0x7b, 0xf6, 0x87, 0x09, 0xb3, 0xc6, 0xa2, 0x2b, 0x44, 0x32, 0x8b, 0x76,
+    0x95, 0x99, 0xc5, 0xdb, 0xb0, 0xeb, 0x1d, 0x0d, 0xe9, 0xf9, 0xbd, 0xd0,
+    0x8a, 0x64, 0x67, 0xf2, 0x5d, 0xeb, 0x50, 0xcf, 0x32, 0xf5, 0x1c, 0x8e,
+    0x66, 0x80, 0x85, 0x52, 0xc5, 0xc2, 0x13, 0xa6, 0xd4, 0xf9, 0x92, 0x9d,
+    0x59, 0x1f, 0x5f, 0xd3, 0xe7, 0x1b, 0xdb, 0xd6, 0x13, 0xdc, 0x13, 0xc5,
+    0x0f, 0x17, 0xa0, 0xd1, 0x25, 0x06, 0xa4, 0xc0, 0xe9, 0xed, 0x3f, 0x3e,
+    0x7c, 0xb8, 0x2f, 0x90, 0x66, 0xbf, 0xe7, 0xf9, 0xf3, 0x34, 0xf9, 0x82,
+    0xb1, 0x66, 0xe8, 0x4b, 0xba, 0x1f, 0x88, 0xa8, 0x07, 0x5e, 0xcd, 0xc2,
+    0x5a, 0xf6, 0xba, 0x86, 0xdf, 0x93, 0x3a, 0x8a, 0x17, 0xc1, 0xf2, 0x8b,
+    0x42, 0xef, 0x6a, 0xfe, 0x75, 0x5c, 0xe9, 0x61, 0x9e, 0xa4, 0x4d, 0x3d,
+    0x7c, 0xcc, 0x70, 0xe0, 0x54, 0x93, 0x54, 0xcb, 0xbb, 0x47, 0x2d, 0x15,
+    0x59, 0xcb, 0xe1, 0xc7, 0xf1, 0xc3, 0xa9, 0xdb, 0xd0, 0x76, 0xb9, 0xa0,
+    0x72, 0x35, 0xee, 0xd9, 0x45, 0xb1, 0x78, 0x77, 0x76, 0xf1, 0x33, 0xc3,
+    0x98, 0x63, 0xdb, 0x93, 0xac, 0x56, 0xb6, 0x2d, 0xdf, 0x79, 0xf3, 0xf2,
+    0x8d, 0x7a, 0xe0, 0x55, 0x2c, 0xea, 0x68, 0x06, 0x1a, 0x50, 0x38, 0x66,
+    0x59, 0x43, 0xeb, 0xff, 0x48, 0x32, 0xdb, 0xfb, 0x3d, 0xc9, 0xee, 0x05,
+    0xf0, 0x7f, 0x24, 0xc7, 0x88, 0xe8, 0xf3, 0xc5, 0xd9, 0x34, 0xca, 0x26,
+    0x6c, 0x64, 0x21, 0x4f, 0xcd, 0x7c, 0xab, 0x63, 0x39, 0x21, 0x52, 0x68,
+    0x96, 0x5b, 0x49, 0x3c, 0x64, 0xae, 0x05, 0x08, 0xd9, 0xa5, 0x34, 0xb0,
+    0xb6, 0x45, 0xa2, 0x67, 0x85, 0xc3, 0x2f, 0x71, 0xb2, 0x04, 0xa9, 0x33,
+    0x86, 0x9a, 0x67, 0xd7, 0x84, 0xb2, 0x67, 0xb4, 0x7a, 0x4d, 0x53, 0x7f,
+    0x91, 0x84, 0x53, 0x96, 0xe1, 0x3d, 0x3c, 0x78, 0x4b, 0xb3, 0xed, 0x2d,
+    0xa2, 0x38, 0xef, 0x1e, 0xdc, 0x6b, 0xa8, 0xef, 0xf9, 0x18, 0xf9, 0x08,
+    0xad, 0x94, 0x0d, 0x59, 0x74, 0x09, 0xdd, 0x2e, 0x23, 0xe0, 0x91, 0x9c,
+    0x51, 0x5a, 0xb3, 0x30, 0xbe, 0xb6, 0x66, 0xd1, 0x14, 0xca, 0x31, 0x20,
+    0xcf, 0x51, 0x86, 0x73, 0x43, 0xd9, 0x6b, 0x25, 0x30, 0x34, 0x50, 0x8b,
+    0x20, 0x21, 0x66, 0x16, 0xaa, 0xcb, 0x16, 0x69, 0x20, 0x56, 0x9e, 0x58,
+    0x87, 0x7c, 0x49, 0xa8, 0xb9, 0x0f, 0xc9, 0x3c, 0x1a, 0x1e, 0x9d, 0x21,
+    0xcf, 0xb3, 0x40, 0x30, 0x40, 0xae, 0x90, 0xab, 0x4d, 0xf3, 0x79, 0x03,
+    0x36, 0x47, 0x3c, 0xbc, 0x7e, 0x8d, 0xd1, 0x0b, 0xf4, 0xd5, 0x94, 0x87,
+    0x4c, 0x08, 0xef, 0xcd, 0x2d, 0x41, 0x46, 0x1f, 0x6a, 0x15, 0x0b, 0x41,
+    0xc9, 0xf2, 0x19, 0xd3, 0xe9, 0x5e, 0x80, 0x16, 0xf0, 0xcd, 0xb9, 0x35,
+    0xa5, 0x2e, 0x23, 0x80, 0x81, 0x1c, 0x3c, 0x79, 0x48, 0xf8, 0xd0, 0x77,
+    0x78, 0xee, 0xb5, 0x45, 0x37, 0x80, 0x2a, 0x50, 0x91, 0x00, 0xb9, 0xd7,
+    0xac, 0xfe, 0xb1, 0x60, 0x0b, 0x76, 0x3c, 0x07, 0x40, 0x3e, 0x08, 0x49,
+    0xff, 0x37, 0x63, 0xf3, 0x02, 0x3b, 0x95, 0x15, 0x9a, 0x80, 0xaa, 0xc1,
+    0x51, 0x37, 0xc2, 0x15, 0x39, 0xc7, 0x6f, 0xe6, 0x58, 0x78, 0x00, 0x62,
+    0x1a, 0xc2, 0xf4, 0x96, 0x13, 0x16, 0xd3, 0x7c, 0x7f, 0x7e, 0xf6, 0xd6,
+    0xfa, 0x1d, 0x7b, 0xc6, 0x62, 0xe7, 0xf8, 0x95, 0x20, 0x33, 0x8f, 0xa3,
+    0x99, 0x3e, 0x84, 0xd3, 0xa9, 0x8b, 0x6b, 0x7b, 0x98, 0x42, 0x8f, 0xf7,
+    0x90, 0x09, 0xd4, 0x13, 0xc0, 0x4b, 0x2e, 0x45, 0x31, 0xa7, 0x2c, 0x1a,
+    0x03, 0x81, 0x37, 0x80, 0x0f, 0xf7, 0x8f, 0xfe, 0x44, 0x67, 0x20, 0xa3,
+    0x45, 0xfb, 0xb4, 0xc4, 0x68, 0x90, 0x5a, 0xe7, 0x69, 0x32, 0x6b, 0xea,
+    0xad, 0x58, 0xfd, 0x3f, 0x37, 0xb7, 0x52, 0xd8, 0x59, 0x64, 0x4a, 0x37,
+    0x74, 0xf7, 0x0b, 0x48, 0x1f, 0xe0, 0x6e, 0x7f, 0x51, 0x87, 0x22, 0xbe,
+    0x4e, 0x76, 0x7c, 0xc9, 0x1b, 0xaf, 0x2f, 0xfc, 0xde, 0xee, 0xee, 0xdb,
+    0x1f, 0xff, 0xb0, 0x7e, 0xfe, 0xfe, 0xbe, 0xeb, 0x9e, 0x9e, 0xbf, 0x1a,
+    0x4e, 0x92, 0xb7, 0x92, 0x55, 0x3e, 0x04, 0x8d, 0xb1, 0x22, 0x42, 0x3d,
+    0xb7, 0xd2, 0xf3, 0x12, 0x9d, 0xd1, 0x77, 0x6e, 0x9b, 0xfa, 0x01, 0x80,
+    0x44, 0xe7, 0xd7, 0x1f, 0xd2, 0x30, 0xce, 0x48, 0x5b, 0x7c, 0x40, 0x4f,
+    0xbc, 0xaa, 0xa1, 0x2f, 0x62, 0xa5, 0x11, 0x68, 0x97, 0x38, 0x14, 0x95,
+    0x2f, 0x84, 0x31, 0x32, 0x5d, 0x6b, 0x8e, 0xb1, 0x52, 0xbc, 0xb4, 0x71,
+    0x4c, 0x02, 0xe3, 0xd3, 0xf7, 0x28, 0x66, 0xe6, 0x51, 0xfc, 0x00, 0x11,
+    0x8c, 0xda, 0xc8, 0x0f, 0xef, 0x5f, 0xff, 0x64, 0x41, 0x35, 0x14, 0x9b,
+    0xa5, 0x32, 0x02, 0x23, 0x14, 0xf8, 0x9f, 0xde, 0xd5, 0xe9, 0x7b, 0xa0,
+    0xde, 0x8f, 0xf3, 0x07, 0xc1, 0xe2, 0x19, 0xee, 0xbc, 0xe1, 0xad, 0xe1,
+    0x73, 0xa8, 0xbb, 0x98, 0x23, 0x7f, 0x50, 0x3a, 0xa4, 0xd1, 0x38, 0x29,
+    0xfb, 0x7d, 0x81, 0xc1, 0x97, 0x34, 0xa4, 0xfd, 0x5f, 0x2c, 0xdc, 0x30,
+    0x60, 0xdc, 0x00, 0x46, 0x31, 0x60, 0xa1, 0x56, 0x9d, 0x82, 0xa2, 0x0e,
+    0xd6, 0xcc, 0xc8, 0xc8, 0xdc, 0x94, 0x41, 0x2e, 0x40, 0xa3, 0x7f, 0x8b,
+    0xe0, 0x79, 0x00, 0xc7, 0x7e, 0x3d, 0x8e, 0x93, 0x94, 0x95, 0x5c, 0x60,
+    0x8e, 0x8d, 0x64, 0x56, 0x36, 0x01, 0x55, 0x85, 0x21, 0x90, 0x42, 0x5d,
+    0x10, 0xe1, 0x5e, 0x84, 0xe4, 0xbb, 0xe3, 0x69, 0x84, 0x52, 0x85, 0x1f,
+    0x35, 0xbb, 0xcf, 0xd8, 0xc2, 0xab, 0x07, 0x8d, 0xed, 0x19, 0x3a, 0xbb,
+    0x2a, 0x43, 0xb3, 0xf2, 0x14, 0x0f, 0x37, 0x59, 0x20, 0xb6, 0xc5, 0x50,
+    0xa7, 0x49, 0x3c, 0x5e, 0x3f, 0xd2, 0xb5, 0x23, 0xcb, 0x4c, 0x5a, 0x17,
+    0xfa, 0x8e, 0xf8, 0x80, 0xf0, 0x89, 0x2f, 0xe6, 0x48, 0xee, 0xf0, 0x15,
+    0x2b, 0x98, 0xa1, 0xf4, 0x2d, 0x25, 0xaf, 0x07, 0x06, 0xf4, 0xb8, 0x6d,
+    0x9d, 0xdc, 0x7c, 0xb2, 0x61, 0x69, 0x3f, 0xd9, 0x7e, 0x77, 0xd7, 0x83,
+    0x47, 0xc2, 0x1b, 0x78, 0xa3, 0x2f, 0xc6, 0x61, 0x82, 0xd8, 0x12, 0xca,
+    0x20, 0xed, 0xe4, 0x93, 0x9d, 0x0f, 0x67, 0x9f, 0xec, 0xd3, 0xd5, 0x69,
+    0xc3, 0x20, 0xe7, 0x2c, 0xcc, 0xbf, 0x42, 0xb3, 0x38, 0x5e, 0xcc, 0x79,
+    0x50, 0x61, 0x34, 0x02, 0x4a, 0xc4, 0x2f, 0x9d, 0x96, 0x70, 0xe4, 0xda,
+    0x06, 0x27, 0x01, 0xa3, 0x86, 0x41, 0x47, 0xa6, 0x25, 0x7d, 0xa2, 0x44,
+    0xbf, 0x53, 0xc2, 0xca, 0x91, 0xfe, 0xc8, 0xc2, 0x34, 0x3f, 0x83, 0x87,
+    0xaf, 0x52, 0x83, 0xc0, 0x9e, 0x22, 0x5f, 0xa7, 0x1c, 0x22, 0x68, 0x3a,
+    0xa1, 0x64, 0xa3, 0xf8, 0xf1, 0xb1, 0xaf, 0xd7, 0x00, 0xd2, 0xf3, 0x8f,
+    0x31, 0xea, 0x75, 0xf1, 0xd7, 0x69, 0x35, 0x0a, 0x77, 0x27, 0xfd, 0xf1,
+    0x1c, 0xa9, 0x16, 0x39, 0x1c, 0x46, 0xb5, 0xd3, 0x9e, 0x52, 0x21, 0xdd,
+    0xfe, 0xc4, 0x10, 0x25, 0xbf, 0xcd, 0xff, 0x62, 0x26, 0x07, 0x12, 0x26,
+    0x2f, 0x9b, 0x36, 0x76, 0xcd, 0x4f, 0x8d, 0xf1, 0x68, 0xc3, 0x0f, 0xe1,
+    0xf4, 0xcb, 0x83, 0xd8, 0x1c, 0x45, 0x32, 0xc8, 0x2e, 0x32, 0x14, 0x76,
+    0x99, 0x50, 0x90, 0x88, 0xc5, 0x16, 0xc4, 0x82, 0x4a, 0x40, 0xd8, 0xac,
+    0x66, 0xa4, 0xe7, 0x2f, 0x17, 0xf9, 0xf5, 0x8b, 0xeb, 0xe1, 0x94, 0x3d,
+    0x8c, 0x4b, 0x44, 0x29, 0x7a, 0xbb, 0xad, 0xb3, 0xc5, 0x08, 0x7b, 0x40,
+    0x9b, 0x13, 0x45, 0x09, 0x20, 0x34, 0x19, 0xbc, 0xc0, 0x15, 0x26, 0xc9,
+    0x22, 0x15, 0xc4, 0xd9, 0xed, 0x10, 0x58, 0xba, 0x7f, 0x7b, 0xc8, 0x82,
+    0xbc, 0x4f, 0xa3, 0x24, 0x05, 0xe2, 0x67, 0xf7, 0xe5, 0x15, 0xb2, 0x22,
+    0x70, 0x73, 0x59, 0xb3, 0x60, 0x15, 0xdc, 0x2d, 0xe8, 0x59, 0x93, 0x68,
+    0x8c, 0xfa, 0x3b, 0x1d, 0x76, 0x17, 0x83, 0x03, 0xc6, 0xc1, 0xa6, 0x69,
+    0xf2, 0xf9, 0x49, 0xa7, 0xf3, 0x39, 0x5b, 0x22, 0x6f, 0x45, 0x26, 0x02,
+    0x2c, 0x63, 0x16, 0x02, 0x33, 0xdb, 0x09, 0xa7, 0x61, 0x0a, 0xbc, 0xc2,
+    0x7f, 0xba, 0xaa, 0x2b, 0x13, 0xaf, 0x62, 0x72, 0x95, 0xe1, 0x5a, 0x17,
+    0xfc, 0xe5, 0x1e, 0x0a, 0xc5, 0xfb, 0xb2, 0xac, 0xac, 0xf6, 0xba, 0x98,
+    0x60, 0x91, 0xc4, 0x67, 0x27, 0xdf, 0x68, 0x86, 0xf5, 0x11, 0xbc, 0x49,
+    0xc6, 0xf7, 0x55, 0x64, 0xb8, 0xc7, 0x0c, 0x2a, 0xbc, 0x01, 0x6a, 0x01,
+    0x52, 0x9c, 0x8a, 0xa7, 0xbb, 0x15, 0x2e, 0x2a, 0x46, 0x2b, 0xc8, 0xdb,
+    0x00, 0xe6, 0x3f, 0x1e, 0xd3, 0x4d, 0x9b, 0xb5, 0x4e, 0x96, 0xec, 0xec,
+    0xcf, 0xf5, 0x20, 0x9a, 0x46, 0x2c, 0x29, 0xfd, 0x16, 0x86, 0x8e, 0xb2,
+    0xeb, 0x6c, 0xfa, 0xe7, 0xa6, 0x42, 0x0d, 0xac, 0x99, 0x0a, 0x2f, 0xf0,
+    0x23, 0xba, 0x27, 0x1e, 0xe0, 0xda, 0x38, 0xe6, 0xcd, 0x02, 0xa0, 0x50,
+    0xd9, 0x58, 0x6b, 0xc1, 0xf3, 0x0e, 0xbe, 0xca, 0xbd, 0x21, 0x7a, 0xc1,
+    0x5a, 0xf5, 0x3e, 0x14, 0xf4, 0x38, 0xa6, 0xed, 0x41, 0xeb, 0xcd, 0xab,
+    0x97, 0x77, 0xa2, 0x07, 0xe0, 0xf1, 0x5f, 0xca, 0xff, 0xb2, 0xb2, 0x6b,
+    0x63, 0x67, 0xa4, 0xa6, 0xb1, 0x1f, 0x81, 0x1e, 0x1f, 0xc4, 0xf6, 0xb0,
+    0xc3, 0x25, 0xd8, 0xdb, 0x93, 0x64, 0x49, 0xdd, 0x40, 0xfb, 0x68, 0xe5,
+    0x01, 0xbb, 0x8f, 0xf9, 0xb1, 0x3b, 0x81, 0x38, 0xa4, 0xe6, 0x91, 0xf0,
+    0xa7, 0x11, 0x9d, 0x2d, 0x40, 0x5d, 0x6a, 0x41, 0x1a, 0xf4, 0x0c, 0x70,
+    0xe2, 0xd7, 0x79, 0xbd, 0x7c, 0xf5, 0xfc, 0xe3, 0x0f, 0x9f, 0xbf, 0x7f,
+    0xf3, 0xec, 0x87, 0x63, 0x3c, 0x9d, 0xc6, 0x09, 0xed, 0xe7, 0x70, 0xe9,
+    0x0b, 0xc2, 0xb6, 0xe0, 0x19, 0x69, 0x5b, 0x28, 0xc8, 0x05, 0xae, 0x78,
+    0x4a, 0xd9, 0xe3, 0x3c, 0x65, 0xe1, 0xcc, 0xb7, 0xf9, 0xaf, 0x95, 0xf2,
+    0x1a, 0xba, 0xd2, 0x04, 0x7a, 0x78, 0x14, 0x87, 0x20, 0xa0, 0xe8, 0x83,
+    0x98, 0x20, 0x61, 0x2f, 0x59, 0xe1, 0x95, 0xcb, 0x92, 0xe1, 0x17, 0xe0,
+    0x9f, 0x0e, 0x97, 0x68, 0x5c, 0xfb, 0xe4, 0xce, 0xce, 0x6c, 0x07, 0x1a,
+    0xcb, 0xa8, 0xd9, 0xf6, 0xfc, 0xda, 0xb5, 0x3d, 0xd2, 0x9e, 0x92, 0x74,
+    0xe4, 0xdb, 0xfc, 0xb7, 0xd4, 0x2d, 0xaa, 0x3d, 0x02, 0x0c, 0xb8, 0x49,
+    0xec, 0xe0, 0x59, 0x07, 0x0a, 0x07, 0x25, 0xdb, 0x1f, 0x37, 0x39, 0xae,
+    0xad, 0x33, 0x36, 0x4d, 0x96, 0xd4, 0x1e, 0xa2, 0x47, 0x06, 0x63, 0x47,
+    0x60, 0x42, 0x1b, 0xa2, 0x3d, 0x5a, 0x3a, 0x10, 0x4d, 0xd1, 0x10, 0x04,
+    0xe8, 0x30, 0x9c, 0xe7, 0x0b, 0x54, 0x55, 0x91, 0x28, 0x17, 0x08, 0x06,
+    0xcf, 0x1a, 0xa5, 0x74, 0xea, 0x43, 0xeb, 0xd3, 0xc3, 0xd6, 0x41, 0x05,
+    0x91, 0x7a, 0xa9, 0x10, 0xc9, 0x5c, 0x10, 0xdb, 0x1e, 0xff, 0xf6, 0x3a,
+    0x7e, 0x84, 0x45, 0x74, 0x47, 0x6b, 0xc4, 0xc3, 0xc1, 0xa0, 0xa5, 0x69,
+    0x92, 0xcc, 0x1d, 0xd7, 0x8a, 0xf0, 0x7b, 0xaa, 0x39, 0x89, 0x32, 0x5c,
+    0x34, 0x72, 0xb8, 0xc8, 0x16, 0x40, 0xfa, 0x63, 0x30, 0xc4, 0x5c, 0xa9,
+    0x8f, 0x49, 0xd6, 0x04, 0xd2, 0x60, 0x85, 0x66, 0x80, 0x37, 0x7a, 0x9f,
+    0x7c, 0xbf, 0xed, 0x98, 0x3a, 0x7e, 0x91, 0xcc, 0x40, 0x2f, 0x20, 0x9c,
+    0x83, 0xc6, 0x83, 0x1b, 0x50, 0xd2, 0x30, 0x0a, 0xaf, 0xfa, 0xd9, 0x07,
+    0x3c, 0x34, 0x17, 0x3c, 0xc2, 0x5b, 0x8e, 0xf0, 0x83, 0xb1, 0x7d, 0xba,
+    0xbd, 0x5c, 0x5c, 0xf0, 0xdb, 0x57, 0xae, 0x32, 0x77, 0xec, 0xc3, 0xf9,
+    0xd1, 0x4b, 0xae, 0x21, 0x2d, 0x41, 0xe2, 0xc1, 0xd4, 0xcf, 0x92, 0x24,
+    0xdf, 0x38, 0xdc, 0x99, 0x1f, 0x41, 0xce, 0x87, 0x94, 0xdc, 0x41, 0x29,
+    0x13, 0x48, 0x89, 0xc2, 0xb1, 0xbb, 0x2f, 0x75, 0x92, 0x36, 0x96, 0x82,
+    0xc6, 0x1b, 0x76, 0xa1, 0x49, 0xe9, 0x2c, 0x23, 0x99, 0x52, 0x86, 0xab,
+    0xe7, 0xe0, 0x27, 0x90, 0xdd, 0xfe, 0xca, 0xeb, 0xee, 0x77, 0x3a, 0x1d,
+    0x7c, 0xa0, 0xdd, 0x98, 0xcf, 0xcb, 0xe8, 0x3c, 0xfa, 0xf3, 0x73, 0xc8,
+    0xac, 0x7f, 0xbe, 0xfe, 0xfe, 0x35, 0x8c, 0x8f, 0x47, 0x35, 0xa2, 0x1f,
+    0x05, 0x16, 0x9c, 0xa2, 0x61, 0xd8, 0x48, 0x4e, 0xea, 0x3d, 0xba, 0xeb,
+    0x18, 0x9f, 0x14, 0x90, 0x31, 0xa2, 0x44, 0x94, 0xcb, 0xb9, 0xc0, 0x78,
+    0xce, 0x3f, 0x73, 0xec, 0xf2, 0xb5, 0x0f, 0x73, 0x51, 0x32, 0xe2, 0xea,
+    0x67, 0x6a, 0xae, 0x92, 0x49, 0x73, 0xe0, 0xed, 0xfd, 0x15, 0xb3, 0xe0,
+    0x0c, 0x06, 0xb8, 0x03, 0xba, 0x8c, 0xa0, 0x69, 0xab, 0x25, 0x16, 0x46,
+    0x68, 0xb3, 0x34, 0x15, 0x7b, 0x1b, 0xab, 0xfc, 0x2b, 0x59, 0x80, 0xae,
+    0x32, 0x9e, 0xe4, 0xd6, 0x04, 0x8f, 0x08, 0xc9, 0xd5, 0x12, 0x13, 0x23,
+    0xd2, 0x04, 0xd0, 0x2a, 0x15, 0x7e, 0xa6, 0x75, 0xb0, 0xf0, 0x92, 0x32,
+    0x5a, 0xce, 0x4e, 0xb1, 0x9c, 0xed, 0x3f, 0xb7, 0xa0, 0x1d, 0xbe, 0xa0,
+    0xab, 0x7e, 0xb1, 0x03, 0xab, 0xf0, 0x49, 0xda, 0xeb, 0x3c, 0x17, 0x4c,
+    0x91, 0xb6, 0x98, 0xbd, 0x73, 0x06, 0x0a, 0x8a, 0x37, 0x61, 0xd3, 0xb9,
+    0xb8, 0xf1, 0x0c, 0xcb, 0x04, 0xf8, 0x47, 0x7c, 0xe6, 0x85, 0x97, 0x0e,
+    0xc4, 0x2f, 0x4f, 0xa4, 0xaa, 0x01, 0xfd, 0x15, 0xa5, 0xb0, 0x95, 0x80,
+    0xfe, 0xf2, 0x04, 0x6c, 0x30, 0xc0, 0x3f, 0xfd, 0xd5, 0x37, 0xe5, 0xa9,
+    0x9a, 0x42, 0x90, 0xa8, 0x03, 0x31, 0xf7, 0x2b, 0xee, 0xbf, 0x60, 0x69,
+    0x80, 0x53, 0x33, 0x8f, 0x45, 0x69, 0x9a, 0x84, 0xc8, 0x9b, 0x10, 0x58,
+    0x91, 0xe0, 0xf9, 0x0e, 0x7d, 0xb9, 0x46, 0x6e, 0x0e, 0x3d, 0x72, 0xb6,
+    0x0e, 0xa7, 0x98, 0x7b, 0xb4, 0xe5, 0xdd, 0x50, 0x58, 0x31, 0x66, 0xf3,
+    0xbd, 0x5f, 0xfc, 0x00, 0xf2, 0xd6, 0xf0, 0x7c, 0xdc, 0xda, 0xda, 0x2e,
+    0x13, 0x57, 0x6e, 0xad, 0xf5, 0x1f, 0x61, 0x36, 0x8d, 0x8d, 0xe3, 0x67,
+    0x8c, 0xb1, 0x6d, 0xfe, 0xfd, 0xe4, 0xad, 0x39, 0x2c, 0x3b, 0x0f, 0x58,
+    0x13, 0xbc, 0x7e, 0xcb, 0x2b, 0x7b, 0x45, 0xb0, 0x54, 0x3a, 0x30, 0x29,
+    0x1c, 0xa2, 0x13, 0xda, 0xcb, 0xe3, 0x1b, 0xb3, 0x01, 0xf5, 0x44, 0xe7,
+    0xce, 0x94, 0xbe, 0x38, 0x9e, 0xb5, 0xb0, 0xf4, 0x96, 0x17, 0x8d, 0xea,
+    0x73, 0xa1, 0x8d, 0x60, 0x75, 0x6a, 0x12, 0xd9, 0x4f, 0xb0, 0x3d, 0x2e,
+    0xed, 0xb1, 0x3d, 0xbe, 0x53, 0xbc, 0x25, 0x86, 0x6a, 0xbf, 0xc3, 0xfb,
+    0xda, 0x57, 0xae, 0x67, 0x2c, 0x44, 0xf1, 0x41, 0xa2, 0xe4, 0x16, 0x1d,
+    0xde, 0xd9, 0x6a, 0x2a, 0xba, 0x0c, 0xd3, 0x18, 0xf8, 0x80, 0x2c, 0xfc,
+    0x4f, 0xf1, 0xda, 0x54, 0x3c, 0x8a, 0xcf, 0x13, 0x59, 0xf6, 0x35, 0x3e,
+    0x37, 0x15, 0x1c, 0xb1, 0xb3, 0x45, 0xd1, 0xea, 0x4b, 0x7a, 0x81, 0xa2,
+    0x14, 0xa8, 0x33, 0x46, 0x43, 0x28, 0xe5, 0x88, 0xff, 0x31, 0x72, 0x04,
+    0xf8, 0x3c, 0x02, 0xa8, 0xd8, 0xf5, 0x3d, 0x69, 0xc0, 0x18, 0xaf, 0x28,
+    0x6c, 0x5c, 0x73, 0xef, 0xb4, 0x86, 0x17, 0xaa, 0x19, 0x41, 0x85, 0xbc,
+    0x79, 0x88, 0x26, 0x5a, 0xec, 0x49, 0xaf, 0x50, 0x7d, 0x11, 0xa9, 0x22,
+    0xe1, 0x22, 0x86, 0xf8, 0x6f, 0xe1, 0x1c, 0xb6, 0x3c, 0x15, 0x77, 0xa8,
+    0x40, 0xab, 0x6b, 0xdd, 0xb9, 0xb8, 0xa2, 0x2f, 0xbf, 0xda, 0xa7, 0x2f,
+    0x1f, 0xea, 0xcb, 0xff, 0xdf, 0x08, 0x20, 0xf3, 0x3e, 0xa7, 0x4e, 0x3e,
+    0x0d, 0x40, 0xdc, 0x3a, 0x69, 0xb7, 0x3e, 0x3f, 0x6b, 0xfd, 0x16, 0xb6,
+    0xfe, 0xe8, 0xb4, 0x9e, 0x9e, 0x6e, 0xc3, 0x4a, 0x73, 0x1e, 0x57, 0xb6,
+    0x6e, 0xd2, 0xa2, 0xbf, 0xa6, 0xed, 0xef, 0xb6, 0xb4, 0x66, 0x8d, 0xae,
+    0xe3, 0x7b, 0xb5, 0x8b, 0x8e, 0x84, 0x73, 0x60, 0x5a, 0xa3, 0xfa, 0x58,
+    0xcb, 0x1a, 0x5c, 0x1b, 0xd6, 0xea, 0xcd, 0xa2, 0x18, 0xbf, 0xb3, 0x7e,
+    0x27, 0x9e, 0xc4, 0x54, 0xf5, 0x2b, 0x31, 0xa5, 0x82, 0x07, 0xd0, 0xa7,
+    0x2f, 0xfa, 0xf5, 0xe1, 0xbf, 0xff, 0x5e, 0xbc, 0x30, 0x9b, 0x27, 0x4d,
+    0x30, 0x36, 0x40, 0xac, 0xeb, 0x1d, 0xec, 0xef, 0xef, 0xee, 0x6b, 0x20,
+    0xae, 0x7b, 0x1b, 0x1e, 0xd0, 0x60, 0xc7, 0xd0, 0x60, 0x65, 0xaf, 0xf2,
+    0x41, 0xad, 0x75, 0xb5, 0x96, 0x8c, 0x46, 0xd0, 0xc3, 0xda, 0x3b, 0xd0,
+    0x1b, 0x34, 0x6c, 0x01, 0x17, 0xb8, 0xa4, 0x85, 0x81, 0x34, 0x63, 0x93,
+    0x6c, 0xe3, 0x2f, 0xc3, 0x27, 0xf1, 0xb1, 0xcb, 0xe2, 0xe9, 0x3f, 0xc1,
+    0x6b, 0x4c, 0x61, 0x0e, 0x8a, 0x24, 0x9d, 0xf3, 0x7b, 0xac, 0x23, 0x26,
+    0x8f, 0x57, 0x3d, 0x04, 0x0a, 0xe5, 0x14, 0x9f, 0x78, 0xdc, 0x1a, 0x10,
+    0xe3, 0xeb, 0x6a, 0xe0, 0x7d, 0x24, 0x8f, 0x0e, 0x95, 0x9d, 0x79, 0x37,
+    0xf7, 0x12, 0xcc, 0xae, 0xda, 0x68, 0xef, 0xab, 0x1a, 0xdd, 0xde, 0x6a,
+    0xd1, 0x98, 0x53, 0x18, 0xaf, 0xde, 0xbe, 0x9a, 0x83, 0x5d, 0x95, 0xf7,
+    0x47, 0x85, 0xd3, 0x68, 0x84, 0xe7, 0xf0, 0x05, 0x24, 0x1c, 0x0a, 0x01,
+    0xe2, 0xf0, 0x12, 0xea, 0x4b, 0xb0, 0xb5, 0x45, 0xa7, 0xc0, 0xc5, 0x74,
+    0x79, 0xa4, 0xd5, 0x46, 0x20, 0x47, 0x2a, 0x22, 0xaf, 0x6e, 0x64, 0x69,
+    0x5b, 0x36, 0x95, 0x59, 0xa3, 0x24, 0xde, 0xca, 0x2d, 0xfa, 0xe2, 0xda,
+    0x86, 0x0d, 0xcb, 0x55, 0x34, 0x21, 0xe3, 0x8a, 0x58, 0xfe, 0x62, 0x91,
+    0xe5, 0xc9, 0xec, 0x17, 0x1c, 0x45, 0x04, 0x0a, 0xb9, 0x68, 0x04, 0x43,
+    0x9b, 0x44, 0xeb, 0x77, 0x17, 0x5d, 0x7d, 0xd3, 0x84, 0x67, 0xdd, 0x02,
+    0xd1, 0xcc, 0xf9, 0x3d, 0x91, 0x5f, 0x8c, 0x0b, 0xb4, 0xec, 0x2d, 0x02,
+    0xfa, 0x96, 0x57, 0x05, 0x8c, 0x32, 0xa4, 0xb5, 0xa5, 0xee, 0x87, 0xd4,
+    0x5d, 0xaf, 0x5e, 0xe0, 0xa6, 0xba, 0x64, 0x60, 0x30, 0xf3, 0x35, 0x73,
+    0x71, 0xd1, 0xbc, 0x72, 0xd0, 0xf7, 0x20, 0x88, 0x8a, 0x17, 0xa4, 0x41,
+    0x9f, 0xac, 0x30, 0x05, 0x59, 0xa9, 0x20, 0x87, 0x87, 0xab, 0x97, 0xf7,
+    0xa3, 0x79, 0x5d, 0x27, 0x57, 0x69, 0xaf, 0x1c, 0x82, 0xa2, 0xaa, 0xca,
+    0x26, 0xb6, 0x2c, 0xb5, 0xef, 0x26, 0x30, 0xe8, 0xca, 0xb5, 0xea, 0xa8,
+    0xaa, 0xab, 0xee, 0x32, 0x90, 0xb1, 0xae, 0x52, 0x8f, 0xd1, 0x5e, 0xd9,
+    0x2a, 0x07, 0x41, 0x23, 0xa6, 0xc6, 0xea, 0x66, 0x04, 0x52, 0xd4, 0xea,
+    0x1b, 0xc1, 0x62, 0xb8, 0x37, 0xb6, 0xa4, 0xb0, 0xba, 0x57, 0x56, 0x59,
+    0x8c, 0xd2, 0xd2, 0xc1, 0xf6, 0x31, 0x4c, 0x78, 0xcb, 0xcc, 0x2e, 0x54,
+    0x18, 0x8d, 0xb7, 0x8c, 0x80, 0x2e, 0xda, 0x12, 0xa0, 0xae, 0x8d, 0x00,
+    0xb7, 0x08, 0x24, 0x24, 0x28, 0x2d, 0x73, 0xb9, 0xa7, 0xca, 0xf0, 0x41,
+    0x4f, 0x1e, 0xb2, 0xf8, 0x67, 0x10, 0xa6, 0x84, 0x45, 0x33, 0xfe, 0x00,
+    0x5b, 0xda, 0xda, 0xa6, 0xae, 0xaa, 0x98, 0xc4, 0xf5, 0x7c, 0x9e, 0x05,
+    0x93, 0x2d, 0xe6, 0xa6, 0x2e, 0x87, 0x00, 0x97, 0x0a, 0x9a, 0x05, 0xb0,
+    0x6d, 0xf1, 0x30, 0x1b, 0xb5, 0xba, 0xad, 0x9e, 0x7c, 0x9b, 0x8e, 0xe1,
+    0x6d, 0x57, 0xbe, 0x5d, 0x4d, 0xe1, 0x6d, 0x4f, 0xc5, 0xb1, 0xaf, 0x45,
+    0x48, 0xe9, 0x7e, 0xb7, 0xe4, 0x3c, 0x4e, 0x5d, 0x44, 0x06, 0xb7, 0x5f,
+    0xcc, 0x3e, 0xe0, 0x20, 0x06, 0x04, 0x79, 0xc4, 0x43, 0xb8, 0xe9, 0x4c,
+    0xbe, 0xbd, 0xa3, 0x38, 0xf9, 0x95, 0xb3, 0xbe, 0xca, 0x41, 0x28, 0x7f,
+    0xab, 0x7a, 0xdc, 0x7d, 0xab, 0x38, 0xfc, 0x6b, 0x58, 0xd2, 0xf2, 0xbb,
+    0x0c, 0x05, 0xb0, 0x6a, 0x3a, 0xe8, 0x33, 0x1e, 0x59, 0x0e, 0x50, 0xa6,
+    0xef, 0xed, 0xd1, 0x49, 0xc4, 0x1b, 0x98, 0xfa, 0xb7, 0xe5, 0xba, 0xd0,
+    0x6d, 0xd7, 0xc4, 0xd3, 0x29, 0x57, 0x6d, 0xa2, 0xd8, 0x26, 0xb9, 0x6f,
+    0x0b, 0xf4, 0xa1, 0x6e, 0x7e, 0x20, 0x33, 0x3a, 0xbf, 0xe6, 0x0d, 0xba,
+    0xcd, 0x62, 0xfb, 0x2b, 0x46, 0x57, 0xcf, 0x55, 0x24, 0x5d, 0xc3, 0x34,
+    0x34, 0x87, 0xf0, 0x7d, 0xba, 0x43, 0xa9, 0xeb, 0xd8, 0x22, 0xe4, 0xd8,
+    0xf6, 0x6a, 0x0d, 0x6a, 0x9b, 0x2c, 0xd5, 0x06, 0xf1, 0x74, 0x56, 0x81,
+    0x0a, 0x41, 0x50, 0x58, 0x09, 0xee, 0x8d, 0xe2, 0xe3, 0x59, 0xd7, 0x02,
+    0xba, 0x75, 0xe4, 0xd2, 0x42, 0xaf, 0xd0, 0x1e, 0x26, 0x8b, 0x70, 0xdf,
+    0x20, 0xe8, 0xb8, 0x37, 0x74, 0x8e, 0xb4, 0xe4, 0x3c, 0xab, 0x6f, 0xa8,
+    0x40, 0x13, 0x49, 0x1b, 0x41, 0x26, 0xb0, 0x57, 0xcc, 0x75, 0x4b, 0xcc,
+    0xb5, 0x30, 0xbb, 0xea, 0xd6, 0xcc, 0x0f, 0x20, 0x96, 0x05, 0x15, 0xf0,
+    0xa3, 0x17, 0xe2, 0x45, 0xca, 0x6b, 0x6a, 0xa1, 0x90, 0xd5, 0x6e, 0xc1,
+    0x74, 0x8b, 0xf9, 0x93, 0xd8, 0xe6, 0x37, 0x80, 0x89, 0x9a, 0xa4, 0x47,
+    0x98, 0x3a, 0x7a, 0x1d, 0x2b, 0x7d, 0x89, 0x4a, 0x74, 0xe2, 0x09, 0x33,
+    0x6a, 0xa3, 0xa9, 0xa1, 0xac, 0x36, 0x54, 0x25, 0x96, 0xb8, 0xfc, 0x8c,
+    0xbc, 0xb1, 0x11, 0x1e, 0x63, 0xcc, 0x4c, 0x23, 0x37, 0x20, 0x93, 0xd6,
+    0x49, 0x65, 0x62, 0x3a, 0xfe, 0x18, 0x51, 0x47, 0xab, 0x4e, 0x82, 0x81,
+    0x97, 0x46, 0xa6, 0xdb, 0xd6, 0x19, 0xa9, 0x2f, 0x17, 0x87, 0x4e, 0x33,
+    0xd6, 0xf3, 0xb7, 0xdc, 0x02, 0x37, 0x02, 0x51, 0xb4, 0x88, 0x0d, 0x17,
+    0xca, 0xc9, 0x69, 0x09, 0xfc, 0x47, 0x74, 0xf5, 0xb9, 0x28, 0x57, 0x86,
+    0x74, 0x5f, 0x29, 0x52, 0xf2, 0xca, 0x95, 0x4b, 0x23, 0xa5, 0x1c, 0x7e,
+    0xe5, 0x98, 0x8b, 0x9d, 0xe0, 0x86, 0xeb, 0xc2, 0x7c, 0xd7, 0x3f, 0xc3,
+    0xd7, 0x62, 0x6e, 0xeb, 0x35, 0x81, 0x1b, 0x09, 0x1d, 0x5e, 0x55, 0xb9,
+    0x1a, 0xa9, 0x54, 0x40, 0x63, 0xb6, 0xc4, 0xe3, 0xdd, 0x01, 0x89, 0x05,
+    0x72, 0x30, 0x16, 0x40, 0xc2, 0xb9, 0x8b, 0xec, 0x0d, 0x8d, 0xaa, 0x20,
+    0xbd, 0xc2, 0x76, 0xca, 0xd1, 0x9e, 0x14, 0xf2, 0xe5, 0x14, 0x14, 0xd8,
+    0xa0, 0x52, 0x4e, 0x34, 0x07, 0xb8, 0x2a, 0x66, 0xa3, 0x14, 0x0f, 0x44,
+    0x66, 0x9f, 0xce, 0xd0, 0xc9, 0xbb, 0x5d, 0xeb, 0xe5, 0x00, 0x37, 0x74,
+    0x62, 0xc1, 0x6b, 0x1d, 0xf3, 0x7c, 0xca, 0x1c, 0x79, 0xd2, 0xd9, 0x9b,
+    0x46, 0xb3, 0x48, 0xcc, 0x6f, 0x19, 0x62, 0xe0, 0x3f, 0xee, 0x2b, 0x49,
+    0xd6, 0xad, 0x9f, 0x37, 0xdd, 0xc0, 0x02, 0x30, 0x1c, 0x51, 0xd5, 0x7c,
+    0xd7, 0x5c, 0x9f, 0x5a, 0x21, 0x47, 0x69, 0x83, 0xd7, 0xb8, 0xec, 0x65,
+    0x25, 0x7a, 0x47, 0x1f, 0xb1, 0x46, 0x68, 0x51, 0x5e, 0xac, 0x92, 0x72,
+    0x19, 0x13, 0xf5, 0xc7, 0x33, 0x38, 0x1b, 0xbd, 0x51, 0x63, 0xe2, 0xeb,
+    0x1c, 0x86, 0x2f, 0x2c, 0x7e, 0x60, 0x0f, 0x01, 0x42, 0xb5, 0xe1, 0xb5,
+    0x78, 0x76, 0x4a, 0xf1, 0x8e, 0xad, 0xa9, 0xab, 0xd1, 0x47, 0xb0, 0x29,
+    0x48, 0xa4, 0x60, 0xd8, 0x88, 0xc0, 0xae, 0xba, 0x4b, 0xc3, 0x91, 0x18,
+    0x13, 0x30, 0x33, 0x45, 0xa4, 0x6e, 0xed, 0x70, 0xed, 0x63, 0x8b, 0xcb,
+    0xd3, 0x2d, 0x90, 0xa7, 0x5b, 0xf7, 0x95, 0xa7, 0xca, 0x4c, 0x0b, 0x2c,
+    0x97, 0x7b, 0x18, 0xb8, 0x75, 0xf0, 0xad, 0x7c, 0xb1, 0xb9, 0x99, 0x56,
+    0x8a, 0xd8, 0xfb, 0x40, 0x84, 0x8e, 0x9f, 0xb1, 0x6c, 0x31, 0xcd, 0x05,
+    0x2a, 0xab, 0xea, 0x68, 0x5f, 0xc2, 0xab, 0x68, 0x13, 0x69, 0x0f, 0x0b,
+    0x0b, 0x75, 0xe3, 0x43, 0xe2, 0xc8, 0xde, 0x15, 0x45, 0x28, 0xe0, 0x65,
+    0x04, 0x42, 0xd6, 0xf4, 0x23, 0x9e, 0xcb, 0xe1, 0xaa, 0x42, 0x8c, 0x24,
+    0xa6, 0x6c, 0x8e, 0xbc, 0xd4, 0x5b, 0xc5, 0xf9, 0x8e, 0x2a, 0x09, 0xd2,
+    0x4f, 0xed, 0xd2, 0x66, 0x7e, 0x63, 0x79, 0xfc, 0x59, 0x9e, 0x7a, 0x53,
+    0x40, 0x87, 0x53, 0xd9, 0xd2, 0x4f, 0x20, 0x6c, 0xe1, 0xbd, 0xb3, 0x7c,
+    0x5d, 0xdd, 0x1b, 0xa5, 0x56, 0x39, 0x26, 0x2e, 0xd3, 0x9c, 0xad, 0xd2,
+    0x5d, 0xa8, 0xd6, 0xd9, 0xdc, 0x74, 0xaa, 0xbb, 0x1e, 0xe8, 0xf9, 0x8b,
+    0x6b, 0xe7, 0x8d, 0x80, 0xdb, 0x95, 0x48, 0xd3, 0x2e, 0x1b, 0xd3, 0x4b,
+    0x6d, 0x6f, 0x51, 0x3b, 0xd3, 0x2d, 0x71, 0x3b, 0x6c, 0x39, 0xa2, 0xcf,
+    0xc9, 0x74, 0x14, 0x94, 0xaf, 0x7d, 0x65, 0xac, 0x05, 0x5c, 0x0a, 0x89,
+    0x2e, 0x34, 0x0c, 0x75, 0xd0, 0xb4, 0x55, 0x24, 0x82, 0x9f, 0xda, 0xd6,
+    0xcb, 0x68, 0x64, 0x5d, 0x27, 0x0b, 0x6b, 0x1a, 0x7d, 0x11, 0x3b, 0x42,
+    0xb4, 0xe5, 0x43, 0x3b, 0xb2, 0xb8, 0x7f, 0x5d, 0xd6, 0x1b, 0xc8, 0xa1,
+    0xcc, 0x46, 0x71, 0x46, 0xfb, 0x20, 0x62, 0xea, 0xca, 0x1c, 0x8a, 0x51,
+    0x13, 0xec, 0xf1, 0x04, 0x62, 0x15, 0x26, 0xc5, 0x5d, 0x1c, 0x5b, 0x3b,
+    0x3b, 0x5b, 0xdb, 0xb2, 0xa9, 0x7e, 0x91, 0x0f, 0xab, 0x11, 0x8d, 0x63,
+    0x87, 0x2e, 0x8f, 0x68, 0xdc, 0xff, 0xda, 0x3a, 0x0c, 0x2d, 0xba, 0x0d,
+    0xc4, 0xde, 0xda, 0x86, 0x92, 0xdb, 0x5b, 0xf6, 0x51, 0xd9, 0xd6, 0xf6,
+    0xd6, 0xe1, 0x4e, 0x78, 0x84, 0xce, 0x52, 0x42, 0x38, 0x79, 0xb3, 0x9f,
+    0x06, 0x3f, 0xa9, 0x6b, 0xad, 0xaa, 0xba, 0xee, 0x50, 0x44, 0x95, 0x70,
+    0xc2, 0x7c, 0xff, 0xf1, 0x6e, 0xc2, 0xa4, 0x03, 0xae, 0x15, 0x06, 0x2d,
+    0x71, 0xa2, 0xa0, 0xda, 0xb2, 0xf7, 0x52, 0xf9, 0x15, 0x8c, 0xae, 0x54,
+    0x0d, 0x69, 0x27, 0x86, 0xf6, 0xf0, 0xb6, 0x5c, 0x7e, 0x53, 0xf1, 0x7d,
+    0x11, 0x5d, 0xa3, 0x9b, 0x6a, 0xf3, 0x15, 0xf6, 0x49, 0x7b, 0x10, 0xc0,
+    0x3d, 0x69, 0x63, 0xe2, 0xfb, 0x69, 0x38, 0xce, 0x3c, 0x85, 0x9e, 0x4b,
+    0x75, 0x81, 0xee, 0x63, 0x29, 0x4b, 0xd1, 0xe6, 0x1b, 0x9e, 0xc2, 0x56,
+    0xa4, 0x3e, 0x68, 0x13, 0xf7, 0xb2, 0xb5, 0xa8, 0x11, 0xc5, 0xb6, 0xe2,
+    0xef, 0x5b, 0xdb, 0x65, 0xe3, 0x64, 0x53, 0x95, 0xaf, 0xc4, 0x62, 0x79,
+    0x23, 0x4d, 0x52, 0x57, 0x70, 0x02, 0xfe, 0xe1, 0xab, 0x95, 0x66, 0xae,
+    0xdf, 0xc3, 0xda, 0xda, 0xdd, 0x7a, 0x88, 0x41, 0xa5, 0xd8, 0x53, 0x32,
+    0x8d, 0x2c, 0xfc, 0x72, 0xc0, 0x0f, 0xd8, 0x5c, 0x93, 0x70, 0xf4, 0x68,
+    0x1b, 0x48, 0x5b, 0x1e, 0x2e, 0x7b, 0x84, 0x7a, 0xcf, 0x0f, 0x3d, 0xd2,
+    0xa5, 0x2f, 0xe5, 0x35, 0x40, 0xec, 0xda, 0x53, 0x94, 0x63, 0x09, 0x47,
+    0x48, 0xae, 0xe9, 0xfe, 0xbc, 0x58, 0x65, 0xfd, 0x05, 0xd0, 0x4a, 0x5e,
+    0x4f, 0x0a, 0x39, 0x48, 0xb1, 0x8a, 0x94, 0xe3, 0xcc, 0x5f, 0xb4, 0xd5,
+    0xd7, 0x45, 0x97, 0xdc, 0xd0, 0x22, 0x4b, 0x10, 0x08, 0xc4, 0x36, 0x52,
+    0x00, 0x37, 0x08, 0x1e, 0x22, 0xd3, 0x68, 0xa4, 0x72, 0xd6, 0x25, 0x6e,
+    0x96, 0x2c, 0xcd, 0x80, 0x89, 0x35, 0x61, 0xd2, 0x8c, 0xb5, 0x04, 0x0a,
+    0x9d, 0xd6, 0xa9, 0xd4, 0xd7, 0xd8, 0xb4, 0xe5, 0x78, 0xb9, 0xf4, 0x8d,
+    0x47, 0x22, 0xd2, 0x22, 0x28, 0x94, 0xa8, 0x62, 0xd8, 0x74, 0xc0, 0x39,
+    0xab, 0xca, 0x7f, 0x1e, 0x18, 0x22, 0xe5, 0x3f, 0x9e, 0x4b, 0x37, 0x33,
+    0x12, 0x51, 0xfb, 0xbe, 0x03, 0x53, 0x74, 0x29, 0x53, 0x04, 0xc8, 0x09,
+    0x6f, 0x0e, 0xaf, 0x20, 0xc4, 0xd4, 0x53, 0x87, 0x4b, 0x5d, 0xbe, 0x1f,
+    0x4f, 0x7c, 0xa8, 0xcd, 0x07, 0xd6, 0x3a, 0xcb, 0xe3, 0x46, 0x1e, 0xa4,
+    0xcc, 0xd7, 0xb9, 0x11, 0x4d, 0xf9, 0x8f, 0xc4, 0xbd, 0xaf, 0x38, 0x09,
+    0x94, 0xac, 0x94, 0xba, 0x85, 0x1f, 0x75, 0x5a, 0x29, 0xfe, 0x1d, 0xe4,
+    0x53, 0xdf, 0x2f, 0xc5, 0x11, 0x88, 0x8a, 0x52, 0x64, 0xef, 0xa0, 0xa0,
+    0x5a, 0x86, 0xf8, 0xb5, 0xa4, 0x87, 0x2f, 0x49, 0x45, 0xf2, 0x11, 0x4b,
+    0xe5, 0x67, 0x23, 0x5a, 0xe7, 0xcb, 0x96, 0x38, 0x17, 0x01, 0x53, 0x42,
+    0x12, 0xe4, 0x66, 0xa9, 0x48, 0x13, 0xec, 0x77, 0x12, 0xcd, 0x5b, 0xd1,
+    0x48, 0x2b, 0x80, 0x69, 0xaf, 0x47, 0x15, 0x2d, 0x0a, 0xf9, 0xdd, 0xb7,
+    0xd0, 0x22, 0x46, 0x56, 0x8d, 0x5a, 0x28, 0x25, 0xb7, 0x54, 0x9f, 0x8f,
+    0x14, 0x56, 0x0a, 0xf5, 0xb6, 0xa9, 0xe8, 0x67, 0x2c, 0xaa, 0x22, 0x33,
+    0xa2, 0x2b, 0x9e, 0x34, 0xf2, 0xe4, 0x38, 0x6e, 0x8c, 0x9e, 0xa3, 0x69,
+    0x54, 0x38, 0xf1, 0xca, 0x3a, 0xdb, 0x5b, 0x3e, 0x7a, 0x71, 0x78, 0xc5,
+    0x15, 0x47, 0xed, 0x8a, 0x36, 0x8f, 0x77, 0x52, 0xfc, 0x93, 0x9d, 0x1d,
+    0x53, 0x9c, 0x95, 0x23, 0x77, 0x15, 0x18, 0x0d, 0x7f, 0x9a, 0x8c, 0x5b,
+    0x45, 0x67, 0x5b, 0x7c, 0x82, 0x4b, 0x59, 0x16, 0xed, 0x07, 0xab, 0xac,
+    0x69, 0x2f, 0x33, 0x9f, 0x2e, 0xcd, 0xaa, 0xea, 0x34, 0xdb, 0xb6, 0xff,
+    0xa4, 0x2b, 0x74, 0xcc, 0x7c, 0x56, 0x2e, 0x31, 0x7e, 0x22, 0x9d, 0x8e,
+    0xd4, 0x38, 0x19, 0xbf, 0x78, 0x46, 0xf6, 0xc8, 0x23, 0xe3, 0x24, 0x84,
+    0x79, 0x66, 0x65, 0xf3, 0x09, 0xf5, 0x64, 0xed, 0x3a, 0x9a, 0x1c, 0x94,
+    0xce, 0x7c, 0xd6, 0x74, 0x75, 0x85, 0x1c, 0x24, 0xbf, 0x73, 0xc2, 0xfe,
+    0xfc, 0xf9, 0xfd, 0xeb, 0x77, 0x3f, 0x7c, 0xfe, 0x6c, 0xaf, 0xa9, 0x53,
+    0x8e, 0xce, 0xa6, 0x63, 0x92, 0xf1, 0x06, 0x94, 0x2e, 0x1b, 0xa2, 0x4b,
+    0xae, 0x1d, 0x35, 0x25, 0x89, 0x29, 0x86, 0xa0, 0xb4, 0xdb, 0xfa, 0x15,
+    0xc8, 0x02, 0xf5, 0xf4, 0x44, 0x74, 0x92, 0x88, 0x52, 0xfa, 0x46, 0xad,
+    0x2d, 0xf7, 0x1a, 0x4c, 0x46, 0xa3, 0xcc, 0xe3, 0x42, 0x9d, 0xac, 0x07,
+    0x3c, 0x22, 0xcd, 0x6f, 0x64, 0x16, 0x99, 0x60, 0xfc, 0xc9, 0x8b, 0xc2,
+    0xa4, 0xa1, 0xcb, 0xd5, 0x50, 0x59, 0x19, 0xf2, 0x61, 0xe2, 0x3f, 0xf1,
+    0x89, 0xdf, 0x70, 0x20, 0x96, 0x3e, 0x18, 0xd5, 0x2b, 0x0a, 0xcb, 0x2f,
+    0x2f, 0xee, 0xa6, 0x6b, 0x1f, 0xb3, 0x63, 0xba, 0x84, 0xf8, 0x25, 0x7e,
+    0x05, 0x41, 0x5a, 0xab, 0xca, 0x77, 0x13, 0x83, 0x40, 0x4f, 0xfb, 0x91,
+    0xbe, 0xfa, 0xd6, 0x2a, 0x8c, 0x61, 0xfa, 0xaa, 0x2f, 0x4f, 0x44, 0x1f,
+    0x22, 0x2b, 0xbe, 0x05, 0x2f, 0x77, 0x3b, 0xd0, 0x5a, 0x50, 0xfa, 0x28,
+    0xed, 0xe8, 0xb2, 0x8f, 0x7b, 0xf7, 0x80, 0x66, 0x60, 0x7d, 0x51, 0xaa,
+    0x40, 0xad, 0x2f, 0x24, 0xc2, 0x73, 0x56, 0x71, 0x66, 0x95, 0x28, 0xc0,
+    0xaf, 0x73, 0x75, 0xeb, 0x4b, 0xaa, 0x77, 0x86, 0xd9, 0xb5, 0xbe, 0x2a,
+    0xac, 0xac, 0xaf, 0x34, 0xfb, 0x42, 0x46, 0x65, 0x22, 0x72, 0x89, 0x15,
+    0x41, 0x2b, 0x16, 0x29, 0x01, 0x18, 0x6b, 0x8b, 0x50, 0xbc, 0x05, 0x34,
+    0xd1, 0xc8, 0x62, 0x0d, 0x54, 0x5a, 0xb0, 0x16, 0xfc, 0xc4, 0xb3, 0x66,
+    0x05, 0xf7, 0x55, 0xad, 0x4e, 0x09, 0xee, 0xf4, 0xd0, 0x1a, 0x24, 0x19,
+    0x77, 0x8e, 0x92, 0x14, 0x3f, 0xe1, 0x54, 0x9b, 0xa8, 0xdb, 0x2f, 0x8f,
+    0xa0, 0x83, 0xda, 0x64, 0x91, 0xee, 0x12, 0xd8, 0x45, 0xbf, 0xf6, 0xd1,
+    0xe1, 0xa4, 0x7b, 0x84, 0xc7, 0x06, 0xf7, 0x76, 0x77, 0xf1, 0x42, 0xfd,
+    0x65, 0x78, 0x7d, 0xb8, 0x03, 0x49, 0x87, 0x93, 0xde, 0xd1, 0x0b, 0x11,
+    0x3a, 0x46, 0x8c, 0x01, 0x52, 0x7b, 0x47, 0x87, 0xa8, 0xef, 0x58, 0xe1,
+    0x90, 0x7f, 0x9f, 0xfa, 0x5b, 0xdb, 0x8a, 0x46, 0x80, 0xbe, 0xaa, 0x0d,
+    0x67, 0xcb, 0x2e, 0x0a, 0xf5, 0xc8, 0x2a, 0x15, 0x25, 0x60, 0x0a, 0xa4,
+    0xbc, 0xf0, 0xb1, 0xa8, 0x75, 0x21, 0x69, 0x07, 0xd5, 0x3a, 0xae, 0x6a,
+    0x5a, 0xfc, 0x3a, 0x17, 0x71, 0x5f, 0x80, 0xd6, 0x22, 0xbf, 0xa3, 0xc1,
+    0x52, 0x9e, 0x5b, 0xf3, 0x34, 0x9a, 0x85, 0xe9, 0xb5, 0x6d, 0xf1, 0xaf,
+    0x92, 0xdb, 0xc7, 0xbc, 0xda, 0x91, 0xa5, 0x35, 0xc6, 0x2f, 0x7a, 0x30,
+    0xb4, 0x55, 0xd4, 0xe3, 0xc1, 0x70, 0x7c, 0x4e, 0xba, 0xba, 0x8e, 0xa3,
+    0xc3, 0x37, 0x82, 0x0a, 0xad, 0x04, 0x05, 0x73, 0x13, 0xd8, 0x39, 0x5c,
+    0x78, 0xec, 0x5d, 0xcc, 0x78, 0xa4, 0x2e, 0x8f, 0xbe, 0xe3, 0x91, 0xb0,
+    0x32, 0x6e, 0x1c, 0x8d, 0x78, 0xcc, 0xc3, 0x60, 0x22, 0x79, 0x8a, 0x31,
+    0xa7, 0x93, 0xed, 0xc5, 0x51, 0x20, 0x5a, 0xcb, 0xf2, 0x94, 0xdb, 0x88,
+    0xe1, 0x6d, 0xfa, 0x69, 0x19, 0xfc, 0x8b, 0x51, 0xf1, 0xc0, 0xef, 0x70,
+    0x4e, 0x20, 0x45, 0x43, 0x1e, 0xf1, 0x4a, 0x71, 0x7a, 0xc6, 0x75, 0x19,
+    0xc9, 0x81, 0x3e, 0x64, 0x61, 0x8a, 0x6d, 0xa8, 0x62, 0x89, 0x14, 0x0c,
+    0xd3, 0x9a, 0x18, 0x17, 0x6b, 0xb6, 0x53, 0x56, 0x2a, 0xc1, 0x54, 0x0e,
+    0xd6, 0x04, 0xa1, 0x4c, 0xcc, 0x5e, 0x8b, 0xac, 0xb7, 0xc2, 0xb3, 0x84,
+    0x87, 0x2d, 0x66, 0x0c, 0xe1, 0x47, 0x61, 0x9b, 0x18, 0xb5, 0xc9, 0xa3,
+    0x35, 0xa9, 0xaf, 0x39, 0x46, 0x68, 0xc2, 0xa8, 0x34, 0xea, 0x29, 0x06,
+    0xa6, 0xa7, 0xc2, 0x70, 0xa0, 0xb8, 0x1c, 0x25, 0xb4, 0x20, 0x90, 0x87,
+    0x23, 0x84, 0x5c, 0x7d, 0x13, 0x46, 0x60, 0x0f, 0x1a, 0x25, 0xdb, 0x47,
+    0x2f, 0xf0, 0x11, 0x23, 0xe4, 0x0e, 0x77, 0x78, 0xa9, 0x23, 0x8b, 0x87,
+    0xa1, 0xfb, 0x16, 0x59, 0x06, 0xc5, 0xa8, 0xb8, 0x1c, 0xb4, 0x8f, 0xde,
+    0x25, 0x79, 0x19, 0xbf, 0x0d, 0x33, 0x20, 0xf3, 0x81, 0x26, 0x02, 0xe0,
+    0xe0, 0x61, 0xc9, 0x49, 0x8a, 0xdf, 0x4f, 0x97, 0xf0, 0x11, 0xd1, 0xd9,
+    0x04, 0x16, 0x19, 0x14, 0x6d, 0x5b, 0x23, 0x0d, 0xdd, 0x64, 0x4c, 0xe7,
+    0x9a, 0x30, 0xe9, 0xb6, 0x08, 0x6d, 0x05, 0x13, 0xda, 0x34, 0x35, 0x6e,
+    0x56, 0xef, 0xa4, 0xe7, 0xbc, 0x19, 0xfb, 0xe8, 0xa5, 0x88, 0xa5, 0x46,
+    0xa3, 0xda, 0xba, 0x2f, 0x88, 0xac, 0x52, 0x8f, 0xb4, 0xc9, 0xc8, 0x68,
+    0x09, 0x95, 0x10, 0x08, 0x4d, 0xc6, 0xcc, 0xda, 0x47, 0x3f, 0xd3, 0x6f,
+    0x09, 0xb0, 0xbf, 0xaa, 0xf5, 0x32, 0xf4, 0x56, 0xac, 0x4b, 0xd1, 0x85,
+    0x84, 0x2f, 0xd7, 0x8e, 0xad, 0xc5, 0x1c, 0xb7, 0xc4, 0x39, 0x80, 0x17,
+    0xd3, 0x23, 0xd4, 0xb6, 0x5e, 0x88, 0x13, 0xb5, 0x42, 0xbb, 0x52, 0x57,
+    0xaf, 0xae, 0x50, 0x22, 0x0a, 0x89, 0x75, 0x83, 0xaa, 0x58, 0xfd, 0x39,
+    0x2a, 0x7b, 0xe4, 0x3d, 0xf1, 0xa1, 0x45, 0xaa, 0xa6, 0x69, 0x8b, 0x58,
+    0x03, 0x7b, 0x92, 0xe5, 0x5f, 0x80, 0x92, 0x69, 0xbd, 0x7e, 0xa9, 0x75,
+    0xc3, 0x75, 0xd1, 0x4a, 0xdb, 0x54, 0x4b, 0x23, 0xe3, 0x52, 0x5f, 0x06,
+    0x9e, 0x90, 0x4f, 0x12, 0xa8, 0x8a, 0xd7, 0x63, 0xd9, 0x16, 0xa8, 0x88,
+    0x1c, 0x82, 0xb3, 0xc5, 0x34, 0x8f, 0x40, 0xe7, 0xcf, 0x89, 0xec, 0x5a,
+    0x08, 0x29, 0x8e, 0xbb, 0x7c, 0xde, 0x0d, 0x74, 0x6f, 0xeb, 0x5c, 0x96,
+    0x2e, 0xba, 0xa1, 0x2b, 0x3d, 0xe4, 0x33, 0xbf, 0xdb, 0x32, 0xb0, 0xf1,
+    0x9a, 0x97, 0x2a, 0x1b, 0x95, 0x3c, 0x99, 0x97, 0x97, 0x6f, 0x82, 0x83,
+    0x7e, 0x9c, 0x93, 0x6f, 0xe9, 0xfb, 0x62, 0xdc, 0xf7, 0xe4, 0xdc, 0x2a,
+    0xdf, 0x10, 0x2b, 0xf7, 0x0c, 0x2f, 0xfc, 0x90, 0x94, 0xf1, 0x57, 0xe0,
+    0x0d, 0x0f, 0x8d, 0x47, 0x9c, 0xa4, 0x87, 0xbf, 0x16, 0x29, 0x8b, 0xb0,
+    0x75, 0x6a, 0x1f, 0x78, 0xdb, 0x3f, 0xe1, 0xf9, 0xbf, 0xa0, 0x0b, 0xe1,
+    0xbd, 0x12, 0x9d, 0x70, 0xf9, 0xac, 0xe3, 0xbe, 0xe0, 0xc8, 0xe8, 0x4c,
+    0x83, 0x1f, 0xbc, 0xe6, 0xeb, 0xe8, 0xff, 0x02, 0x17, 0x1c, 0x8e, 0xc8,
+    0x87, 0x12, 0x01, 0x00};
@@ -0,0 +1,150 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <Arduino.h>
+
+#include "InflightWindow.h"
+
+static const uint8_t PUBLISH_QOS1 = 0x32;
+static const uint8_t PUBLISH_DUP = 0x08;
+static const uint8_t PUBLISH_RETAIN = 0x01;
+
+static uint16_t readWord(const uint8_t *data) { return data[0] << 8 | data[1]; }
+
+static uint32_t readTime(const uint8_t *data) {
+  return static_cast<uint32_t>(readWord(data)) << 16 | readWord(data + 2);
+}
+
+static uint8_t *writeWord(uint8_t *data, uint16_t word) {
+  *data++ = word >> 8;
+  *data++ = word & 0xff;
+  return data;
+}
+
+static void writeTime(uint8_t *data, uint32_t time) {
+  writeWord(writeWord(data, time >> 16), time & 0xffff);
+}
+
+// fixed header, remaining length and the variable part
+size_t InflightWindow::packetSize(size_t remainingLength) {
+  size_t size = 1 + remainingLength;
+  do {
+    ++size;
+    remainingLength /= 128;
+  } while (remainingLength > 0);
+  return size;
+}
+
+bool InflightWindow::isTooLarge(size_t topicLength, size_t payloadLength) {
+  return HEADER_SIZE + packetSize(2 + topicLength + 2 + payloadLength) >
+         MQTT_INFLIGHT_BUFFER_SIZE;
+}
+
+bool InflightWindow::publish(Print &output, const char *topic,
+                             const char *prefix, size_t prefixLength,
+                             const char *body, size_t bodyLength,
+                             bool retained) {
+  const size_t topicLength = strlen(topic);
+  size_t remaining = 2 + topicLength + 2 + prefixLength + bodyLength;
+  const size_t size = packetSize(remaining);
+  if (count >= MQTT_INFLIGHT_WINDOW ||
+      used + HEADER_SIZE + size > sizeof(entries)) {
+    return false;
+  }
+
+  const uint16_t packetId = packetIds.next();
+  uint8_t *entry = entries + used;
+  writeWord(entry, packetId);
+  writeWord(entry + 2, size);
+  writeTime(entry + 4, millis());
+
+  uint8_t *packet = entry + HEADER_SIZE;
+  uint8_t *pos = packet;
+  *pos++ = PUBLISH_QOS1 | (retained ? PUBLISH_RETAIN : 0);
+  do {
+    *pos = remaining % 128;
+    remaining /= 128;
+    if (remaining > 0) {
+      *pos |= 0x80;
+    }
+    ++pos;
+  } while (remaining > 0);
+  pos = writeWord(pos, topicLength);
+  memcpy(pos, topic, topicLength);
+  pos = writeWord(pos + topicLength, packetId);
+  memcpy(pos, prefix, prefixLength);
+  memcpy(pos + prefixLength, body, bodyLength);
+
+  used += HEADER_SIZE + size;
+  ++count;
+  ++sent;
+  output.write(packet, size);
+  return true;
+}
+
+bool InflightWindow::acknowledge(uint16_t packetId) {
+  size_t offset = 0;
+  while (offset < used) {
+    uint8_t *entry = entries + offset;
+    const size_t size = HEADER_SIZE + readWord(entry + 2);
+    if (readWord(entry) == packetId) {
+      ackMillisMax = std::max(ackMillisMax, millis() - readTime(entry + 4));
+      memmove(entry, entry + size, used - offset - size);
+      used -= size;
+      --count;
+      ++acknowledged;
+      return true;
+    }
+    offset += size;
+  }
+  return false;
+}
+
+size_t InflightWindow::resend(Print &output) {
+  size_t offset = 0;
+  while (offset < used) {
+    uint8_t *entry = entries + offset;
+    const size_t size = readWord(entry + 2);
+    uint8_t *packet = entry + HEADER_SIZE;
+    packet[0] |= PUBLISH_DUP;
+    writeTime(entry + 4, millis());
+    output.write(packet, size);
+    offset += HEADER_SIZE + size;
+  }
+  resent += count;
+  return count;
+}
+
+InflightWindow::Stats InflightWindow::stats() const {
+  return {sent, acknowledged, resent, count, ackMillisMax};
+}
@@ -0,0 +1,115 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef INFLIGHTWINDOW_H
+#define INFLIGHTWINDOW_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Print.h>
+
+#ifndef MQTT_INFLIGHT_WINDOW
+// QoS 1 messages sent without waiting for their PUBACK
+#define MQTT_INFLIGHT_WINDOW 8
+#endif
+
+#ifndef MQTT_INFLIGHT_BUFFER_SIZE
+// Bytes for the packets of the unacknowledged messages
+#define MQTT_INFLIGHT_BUFFER_SIZE 2048
+#endif
+
+// Packet identifiers of a connection.  Packets in flight at the same time
+// need distinct identifiers, whatever their type, so SUBSCRIBE and PUBLISH
+// draw them from the same counter.
+class PacketIdCounter {
+ public:
+  uint16_t next() {
+    id = id == 0xffff ? 1 : id + 1;
+    return id;
+  }
+
+ private:
+  uint16_t id = 0;
+};
+
+// QoS 1 PUBLISH packets waiting for their PUBACK.
+//
+// Up to MQTT_INFLIGHT_WINDOW packets are sent back to back without waiting
+// for the broker, each with its own packet identifier.  The packets are
+// stored in the order they were sent in a fixed buffer of
+// MQTT_INFLIGHT_BUFFER_SIZE bytes until they are acknowledged, in any order.
+// After a reconnect, the unacknowledged packets are sent again with the DUP
+// flag.
+class InflightWindow {
+ public:
+  struct Stats {
+    size_t sent;
+    size_t acknowledged;
+    size_t resent;
+    size_t depth;
+    unsigned long ackMillisMax;
+  };
+
+  explicit InflightWindow(PacketIdCounter &packetIds)
+      : packetIds(packetIds), entries() {}
+
+  // True if a message can never be sent with QoS 1 because its packet
+  // exceeds the buffer.
+  static bool isTooLarge(size_t topicLength, size_t payloadLength);
+  // Sends a QoS 1 PUBLISH to topic, the payload is prefix followed by body.
+  // Returns false if the window is full.
+  bool publish(Print &output, const char *topic, const char *prefix,
+               size_t prefixLength, const char *body, size_t bodyLength,
+               bool retained);
+  // Releases the packet with packetId, false if it is not in flight.
+  bool acknowledge(uint16_t packetId);
+  // Sends all unacknowledged packets again, returns their number.
+  size_t resend(Print &output);
+  size_t depth() const { return count; }
+  Stats stats() const;
+
+ private:
+  // every entry starts with the packet identifier, the packet size and the
+  // time it was sent, followed by the packet
+  static const size_t HEADER_SIZE = 8;
+
+  static size_t packetSize(size_t remainingLength);
+
+  PacketIdCounter &packetIds;
+  uint8_t entries[MQTT_INFLIGHT_BUFFER_SIZE];
+  size_t used = 0;
+  size_t count = 0;
+  size_t sent = 0;
+  size_t acknowledged = 0;
+  size_t resent = 0;
+  unsigned long ackMillisMax = 0;
+};
+
+#endif  // INFLIGHTWINDOW_H
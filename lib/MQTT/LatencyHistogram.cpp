@@ -0,0 +1,74 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "LatencyHistogram.h"
+
+static uint32_t bucketStart(size_t bucket) {
+  return bucket == 0 ? 0 : 64UL << (bucket - 1);
+}
+
+void LatencyHistogram::record(unsigned long latency) {
+  size_t bucket = 0;
+  for (unsigned long limit = 64;
+       latency >= limit && bucket < MQTT_LATENCY_BUCKETS - 1; limit <<= 1) {
+    bucket++;
+  }
+  buckets[bucket]++;
+  samples++;
+  max = std::max<uint32_t>(max, latency);
+}
+
+uint32_t LatencyHistogram::percentile(uint8_t percent) const {
+  if (samples == 0) {
+    return 0;
+  }
+  // rank of the sample, counted from 1
+  const uint32_t rank =
+      std::max<uint32_t>(1, (uint64_t(samples) * percent + 99) / 100);
+  uint32_t below = 0;
+  for (size_t bucket = 0; bucket < MQTT_LATENCY_BUCKETS - 1; bucket++) {
+    if (below + buckets[bucket] >= rank) {
+      // the maximum narrows the bucket holding it
+      const uint32_t start = bucketStart(bucket);
+      const uint32_t end = std::min(bucketStart(bucket + 1), max);
+      return start + uint64_t(end - start) * (rank - below) / buckets[bucket];
+    }
+    below += buckets[bucket];
+  }
+  // the last bucket is open ended
+  return max;
+}
+
+void LatencyHistogram::reset() {
+  std::fill_n(buckets, MQTT_LATENCY_BUCKETS, 0);
+  samples = 0;
+  max = 0;
+}
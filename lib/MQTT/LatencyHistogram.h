@@ -0,0 +1,59 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Buckets are powers of two, starting with <64us and ending with >=2^28us
+// (about 4.5 minutes).
+#define MQTT_LATENCY_BUCKETS 24
+
+// Histogram of latencies in microseconds.  Percentiles are interpolated
+// within their bucket, the maximum is exact.
+class LatencyHistogram {
+ public:
+  LatencyHistogram() { reset(); }
+
+  void record(unsigned long latency);
+  // Latency below which percent of the samples are, 0 without samples.
+  uint32_t percentile(uint8_t percent) const;
+  uint32_t maximum() const { return max; }
+  uint32_t count() const { return samples; }
+  void reset();
+
+ private:
+  uint32_t buckets[MQTT_LATENCY_BUCKETS];
+  uint32_t samples;
+  uint32_t max;
+};
+
+#endif  // LATENCYHISTOGRAM_H
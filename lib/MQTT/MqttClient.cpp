@@ -27,34 +27,56 @@
   SOFTWARE.
 */
 
+#include <limits.h>
+
+#include <algorithm>
+
 #include <ArduinoSimpleLogging.h>
 
 #include <Version.h>
 
 #include "MqttClient.h"
 
-class PayloadString : public String {
- public:
-  PayloadString(const uint8_t *data, unsigned int length) : String() {
-    if (reserve(length)) {
-      setLen(length);
-      memmove(wbuffer(), data, length);
-      wbuffer()[length] = 0;
-    }
-  }
-};
+// fixed header, remaining length and return code of a CONNACK packet
+static const size_t CONNACK_SIZE = 4;
+
+// Latencies measured in milliseconds, saturated at about 71 minutes
+static unsigned long millisToMicros(unsigned long latency) {
+  return std::min<unsigned long>(latency, ULONG_MAX / 1000) * 1000;
+}
 
 MqttClient::MqttClient(const Settings &settings, WiFiClient &client)
-    : settings(settings), mqttClient(client), lastConnectAttempt(0) {}
+    : settings(settings),
+      connection(client),
+      mqttClient(connection),
+      queue(settings.mqttQueueSpill) {
+  using namespace std::placeholders;
+  connection.registerPubackHandler(
+      [this](uint16_t packetId) { onPuback(packetId); });
+  connection.registerStreamHandler(std::bind(
+      &MqttClient::onStreamedMessage, this, _1, _2, _3, _4, _5));
+  if (settings.mqttQos > 0) {
+    inflight = new InflightWindow(packetIds);
+  }
+  if (settings.mqttCoalesceWindow > 0) {
+    coalescer = new PublishCoalescer();
+  }
+}
 
-MqttClient::~MqttClient() { mqttClient.disconnect(); }
+MqttClient::~MqttClient() {
+  mqttClient.disconnect();
+  delete inflight;
+  delete coalescer;
+  free(streamBuffer);
+}
 
 void MqttClient::begin() {
   using namespace std::placeholders;
-  mqttClient.setServer(settings.mqttBroker.c_str(), settings.mqttBrokerPort);
-
   mqttClient.setCallback(std::bind(&MqttClient::onMessage, this, _1, _2, _3));
 
+  // the first ping is sent once connected
+  lastLatencyReport = millis();
+  lastPing = lastLatencyReport - MQTT_PING_INTERVAL;
   reconnect();
 }
 
@@ -76,77 +98,618 @@ bool MqttClient::connect() {
 }
 
 void MqttClient::reconnect() {
-  if (lastConnectAttempt > 0 &&
-      (millis() - lastConnectAttempt) < MQTT_CONNECTION_ATTEMPT_DELAY) {
-    return;
+  // steps that complete at once are taken in the same call
+  while (advanceConnection()) {
   }
+}
 
-  if (!mqttClient.connected()) {
-    Logger.debug.println(F("Try to (re)connect to MQTT broker"));
-    if (connect()) {
-      Logger.info.println(F("MQTT connected."));
-      if (subsrcibe()) {
-        mqttClient.publish(settings.mqttStateTopic.c_str(),
-                           stateMessage(true).c_str(), true);
-        mqttClient.publish(settings.mqttVersionTopic.c_str(),
-                           fwJsonVersion(false).c_str(), true);
-        Logger.info.println(F("MQTT subscribed."));
-      } else {
-        Logger.error.println(F("MQTT subsrcibe failed!"));
+bool MqttClient::advanceConnection() {
+  switch (connectState) {
+    case DISCONNECTED:
+      if (millis() - connectStateSince < retryDelay) {
+        return false;
+      }
+      Logger.debug.println(F("Try to (re)connect to MQTT broker"));
+      setConnectState(CONNECTING);
+      connection.open(settings.mqttBroker.c_str(), settings.mqttBrokerPort);
+      return true;
+
+    case CONNECTING:
+      switch (connection.status()) {
+        case MqttConnection::OPEN:
+          sendConnect();
+          setConnectState(HANDSHAKING);
+          return true;
+        case MqttConnection::OPENING:
+          if (millis() - connectStateSince >= MQTT_CONNECT_TIMEOUT) {
+            connectFailed(F("connect timeout"));
+          }
+          return false;
+        default:
+          connectFailed(F("broker not reachable"));
+          return false;
+      }
+
+    case HANDSHAKING:
+      if (connection.available() >= static_cast<int>(CONNACK_SIZE)) {
+        receiveConnack();
+      } else if (!connection.connected()) {
+        connectFailed(F("connection closed"));
+      } else if (millis() - connectStateSince >= MQTT_CONNECT_TIMEOUT) {
+        connectFailed(F("no CONNACK"));
+      }
+      return false;
+
+    case CONNECTED:
+      if (mqttClient.connected()) {
+        return false;
       }
-    } else {
-      Logger.error.println(F("MQTT connect failed!"));
+      Logger.warning.println(F("MQTT connection lost."));
+      connection.stop();
+      retryDelay = 0;
+      setConnectState(DISCONNECTED);
+      return true;
+  }
+  return false;
+}
+
+void MqttClient::setConnectState(ConnectState state) {
+  connectState = state;
+  connectStateSince = millis();
+}
+
+// MQTT 3.1.1 CONNECT packet with the same content PubSubClient::connect()
+// sends, which would block until CONNACK arrives.
+// Writes the remaining length field of a fixed header to pos, returns the
+// end of the field.
+static uint8_t *writeRemainingLength(uint8_t *pos, size_t remaining) {
+  do {
+    *pos = remaining % 128;
+    remaining /= 128;
+    if (remaining > 0) {
+      *pos |= 0x80;
     }
+    ++pos;
+  } while (remaining > 0);
+  return pos;
+}
+
+void MqttClient::sendConnect() {
+  const bool hasUser = settings.mqttUser.length() > 0;
+  const String will = stateMessage(false);
+  size_t remaining = 10 + 2 + settings.deviceName.length() + 2 +
+                     settings.mqttStateTopic.length() + 2 + will.length();
+  if (hasUser) {
+    remaining +=
+        2 + settings.mqttUser.length() + 2 + settings.mqttPassword.length();
   }
 
-  lastConnectAttempt = millis();
+  uint8_t header[15] = {MQTTCONNECT};
+  const size_t length = writeRemainingLength(header + 1, remaining) - header;
+
+  // clean session, retained will with QoS 0, user name and password
+  const uint8_t flags = 0x02 | 0x04 | 0x20 | (hasUser ? 0xc0 : 0x00);
+  const uint8_t variableHeader[] = {
+      0, 4, 'M', 'Q', 'T', 'T', 4, flags, MQTT_KEEPALIVE >> 8,
+      MQTT_KEEPALIVE & 0xff};
+  memcpy(header + length, variableHeader, sizeof(variableHeader));
+  connection.write(header, length + sizeof(variableHeader));
+
+  writeField(settings.deviceName);
+  writeField(settings.mqttStateTopic);
+  writeField(will);
+  if (hasUser) {
+    writeField(settings.mqttUser);
+    writeField(settings.mqttPassword);
+  }
+}
+
+void MqttClient::writeField(const String &field) {
+  const uint8_t length[] = {static_cast<uint8_t>(field.length() >> 8),
+                            static_cast<uint8_t>(field.length() & 0xff)};
+  connection.write(length, sizeof(length));
+  connection.write(reinterpret_cast<const uint8_t *>(field.c_str()),
+                   field.length());
+}
+
+void MqttClient::receiveConnack() {
+  uint8_t connack[CONNACK_SIZE];
+  connection.read(connack, sizeof(connack));
+  if (connack[0] != MQTTCONNACK || connack[1] != 2) {
+    connectFailed(F("unexpected reply"));
+    return;
+  }
+  if (connack[3] != 0) {
+    Logger.debug.print(F("MQTT CONNACK return code: "));
+    Logger.debug.println(connack[3]);
+    connectFailed(F("refused by broker"));
+    return;
+  }
+
+  // let PubSubClient take over the established session
+  connection.replay(connack, sizeof(connack));
+  if (!connect()) {
+    connectFailed(F("handshake"));
+    return;
+  }
+  onConnected();
+}
+
+void MqttClient::onConnected() {
+  retryDelay = 0;
+  connectBackoff = 0;
+  setConnectState(CONNECTED);
+  Logger.info.println(F("MQTT connected."));
+  if (subsrcibe()) {
+    mqttClient.publish(settings.mqttStateTopic.c_str(),
+                       stateMessage(true).c_str(), true);
+    mqttClient.publish(settings.mqttVersionTopic.c_str(),
+                       fwJsonVersion(false).c_str(), true);
+    Logger.info.println(F("MQTT subscribed."));
+  } else {
+    Logger.error.println(F("MQTT subsrcibe failed!"));
+  }
+  const size_t resent = inflight ? inflight->resend(connection) : 0;
+  if (resent > 0) {
+    Logger.info.print(F("MQTT resent "));
+    Logger.info.print(resent);
+    Logger.info.println(F(" unacknowledged messages"));
+  }
+  if (!queue.empty()) {
+    Logger.info.print(F("MQTT publish "));
+    Logger.info.print(queue.stats().depth);
+    Logger.info.println(F(" queued messages"));
+  }
+}
+
+void MqttClient::connectFailed(const __FlashStringHelper *reason) {
+  connection.stop();
+  connectBackoff = connectBackoff == 0
+                       ? MQTT_CONNECTION_ATTEMPT_DELAY
+                       : std::min<unsigned long>(2 * connectBackoff,
+                                                 MQTT_CONNECTION_BACKOFF_MAX);
+  // jitter keeps gateways from retrying in lockstep after a broker restart
+  retryDelay = random(connectBackoff / 2, connectBackoff + 1);
+  setConnectState(DISCONNECTED);
+
+  Logger.error.print(F("MQTT connect failed: "));
+  Logger.error.print(reason);
+  Logger.error.print(F(", retry in "));
+  Logger.error.print(retryDelay);
+  Logger.error.println(F(" ms"));
 }
 
 bool MqttClient::subsrcibe() {
   String topic = settings.mqttSendTopic + "+";
+  String macroTopic = settings.mqttSendTopic + F("macro/+");
 
-  Logger.debug.print(F("MQTT subscribe to topic: "));
-  Logger.debug.println(topic);
+  Logger.debug.print(F("MQTT subscribe to topics: "));
+  Logger.debug.print(topic);
+  Logger.debug.print(F(", "));
+  Logger.debug.println(macroTopic);
 
-  return mqttClient.subscribe(topic.c_str());
+  if (!subscribe(topic) || !subscribe(macroTopic)) {
+    return false;
+  }
+  if (settings.mqttLatencyInterval == 0) {
+    return true;
+  }
+  String pingTopic = settings.mqttStateTopic + F(MQTT_PING_TOPIC_SUFFIX);
+  Logger.debug.print(F("MQTT subscribe to ping topic: "));
+  Logger.debug.println(pingTopic);
+  return subscribe(pingTopic);
+}
+
+// Subscribes to topic with QoS 0.  Written like CONNECT instead of through
+// PubSubClient, whose SUBSCRIBE packet identifiers would collide with the
+// ones of the messages in flight.
+bool MqttClient::subscribe(const String &topic) {
+  if (!mqttClient.connected()) {
+    return false;
+  }
+  const uint16_t packetId = packetIds.next();
+  uint8_t header[7] = {MQTTSUBSCRIBE | MQTTQOS1};
+  uint8_t *pos = writeRemainingLength(header + 1, 2 + 2 + topic.length() + 1);
+  *pos++ = packetId >> 8;
+  *pos++ = packetId & 0xff;
+  connection.write(header, pos - header);
+  writeField(topic);
+  const uint8_t qos = 0;
+  return connection.write(&qos, sizeof(qos)) == sizeof(qos);
 }
 
 void MqttClient::loop() {
+  if (coalescer && coalescer->isDue(settings.mqttCoalesceWindow)) {
+    publishBatch();
+  }
   reconnect();
-  mqttClient.loop();
+  if (connectState == CONNECTED) {
+    mqttClient.loop();
+    publishQueued();
+    if (settings.mqttLatencyInterval > 0) {
+      probeLatency();
+    }
+  }
+}
+
+// Returns the topic without the send topic prefix, nullptr for other topics.
+const char *MqttClient::sendTopicPart(const char *topic) {
+  const size_t prefixLength = settings.mqttSendTopic.length();
+  if (strncmp(topic, settings.mqttSendTopic.c_str(), prefixLength) != 0) {
+    Logger.debug.print(F("Ignore MQTT message: "));
+    Logger.debug.println(topic);
+    return nullptr;
+  }
+  return topic + prefixLength;
 }
 
 void MqttClient::onMessage(char *topic, uint8_t *payload, unsigned int length) {
-  PayloadString strPayload(payload, length);
-  String strTopic(topic);
+  if (isPingTopic(topic)) {
+    onPing(payload, length);
+    return;
+  }
+  // topic and payload are handed on in place, without String copies
+  const char *topicPart = sendTopicPart(topic);
+  if (!topicPart) {
+    return;
+  }
+
+  if (onRfRawCallback && strcmp_P(topicPart, PSTR("RAW")) == 0) {
+    Logger.debug.print(F("New MQTT RAW message: "));
+    Logger.debug.println(topic);
+    onRfRawCallback(payload, length, 0, length);
+    return;
+  }
 
   Logger.debug.print(F("New MQTT message: "));
-  Logger.debug.print(strTopic);
+  Logger.debug.print(topic);
   Logger.debug.print(F(" .. "));
-  Logger.debug.println(strPayload);
+  Logger.debug.write(payload, length);
+  Logger.debug.println();
+
+  if (onRfDataCallback) {
+    onRfDataCallback(topicPart, reinterpret_cast<const char *>(payload),
+                     length);
+  }
+}
+
+// Messages too large for PubSubClient arrive chunk by chunk.  RAW messages
+// are handed on in chunks, others are collected in a buffer of their size.
+void MqttClient::onStreamedMessage(const char *topic, const uint8_t *data,
+                                   size_t length, size_t offset,
+                                   size_t total) {
+  if (offset == 0) {
+    // the topic is the same for all chunks, it is only checked once
+    streamAccepted = sendTopicPart(topic) != nullptr;
+  }
+  if (!streamAccepted) {
+    return;
+  }
+  const char *topicPart = topic + settings.mqttSendTopic.length();
+
+  if (onRfRawCallback && strcmp_P(topicPart, PSTR("RAW")) == 0) {
+    if (offset == 0) {
+      Logger.debug.print(F("New streamed MQTT RAW message: "));
+      Logger.debug.print(topic);
+      Logger.debug.print(F(" .. "));
+      Logger.debug.print(total);
+      Logger.debug.println(F(" bytes"));
+    }
+    onRfRawCallback(data, length, offset, total);
+    return;
+  }
 
-  if (strTopic.startsWith(settings.mqttSendTopic)) {
-    if (onRfDataCallback) {
-      onRfDataCallback(String(topic + settings.mqttSendTopic.length()),
-                       strPayload);
+  if (offset == 0) {
+    free(streamBuffer);
+    streamBuffer = nullptr;
+    if (total <= MQTT_STREAM_MAX_SIZE) {
+      streamBuffer = static_cast<char *>(malloc(total));
+    }
+    if (!streamBuffer) {
+      Logger.error.print(F("MQTT message of "));
+      Logger.error.print(total);
+      Logger.error.print(F(" bytes dropped: "));
+      Logger.error.println(topic);
+      return;
     }
   }
+  if (!streamBuffer) {
+    return;
+  }
+  memcpy(streamBuffer + offset, data, length);
+  if (offset + length < total) {
+    return;
+  }
+
+  Logger.debug.print(F("New streamed MQTT message: "));
+  Logger.debug.print(topic);
+  Logger.debug.print(F(" .. "));
+  Logger.debug.write(reinterpret_cast<const uint8_t *>(streamBuffer), total);
+  Logger.debug.println();
+  if (onRfDataCallback) {
+    onRfDataCallback(topicPart, streamBuffer, total);
+  }
+  free(streamBuffer);
+  streamBuffer = nullptr;
 }
 
 void MqttClient::registerRfDataHandler(const MqttClient::RfDataCb &cb) {
   onRfDataCallback = cb;
 }
 
-void MqttClient::publishCode(const String &protocol, const String &payload) {
-  String topic = settings.mqttReceiveTopic + protocol;
+void MqttClient::registerRfRawHandler(const MqttClient::RfRawCb &cb) {
+  onRfRawCallback = cb;
+}
 
-  Logger.debug.print(F("Publish MQTT message: "));
-  Logger.debug.print(topic);
-  Logger.debug.print(F(" retain="));
-  Logger.debug.print(settings.mqttRetain);
-  Logger.debug.print(F(" .. "));
-  Logger.debug.println(payload);
-  mqttClient.publish(topic.c_str(), payload.c_str(), settings.mqttRetain);
+void MqttClient::publishCode(const char *protocol, const char *payload) {
+  const unsigned long received = micros();
+  if (coalescer) {
+    if (coalescer->add(protocol, payload)) {
+      return;
+    }
+    publishBatch();
+    if (coalescer->add(protocol, payload)) {
+      return;
+    }
+    // too large for a batch, published on its own
+  }
+  // queued codes are accounted when they are published
+  if (publish(protocol, payload)) {
+    publishLatency.record(micros() - received);
+  }
+}
+
+void MqttClient::publishBatch() {
+  if (coalescer->empty()) {
+    return;
+  }
+  Logger.debug.print(F("MQTT batch of "));
+  Logger.debug.print(coalescer->size());
+  Logger.debug.println(F(" codes"));
+  // the latency of the oldest code
+  const unsigned long age = coalescer->age();
+  if (publish(MQTT_COALESCE_TOPIC, coalescer->payload())) {
+    publishLatency.record(millisToMicros(age));
+  }
+  coalescer->clear();
 }
 
-bool MqttClient::isConnected() { return mqttClient.connected(); }
+// Returns true if the message is published at once, false if it is queued
+// or dropped.
+bool MqttClient::publish(const char *protocol, const char *payload) {
+  // queued messages go first to keep the order
+  if (queue.empty() && isConnected()) {
+    int length = snprintf(topic, sizeof(topic), "%s%s",
+                          settings.mqttReceiveTopic.c_str(), protocol);
+    if (length < 0 || static_cast<size_t>(length) >= sizeof(topic)) {
+      Logger.error.print(F("MQTT publish failed, topic exceeds "));
+      Logger.error.print(sizeof(topic) - 1);
+      Logger.error.println(F(" characters"));
+      return false;
+    }
+
+    Logger.debug.print(F("Publish MQTT message: "));
+    Logger.debug.print(topic);
+    Logger.debug.print(F(" retain="));
+    Logger.debug.print(settings.mqttRetain);
+    Logger.debug.print(F(" .. "));
+    Logger.debug.println(payload);
+    if (publishPayload("", 0, payload, strlen(payload))) {
+      return true;
+    }
+  }
+
+  if (queue.add(protocol, payload)) {
+    Logger.debug.print(F("MQTT message queued: "));
+    Logger.debug.println(protocol);
+  } else {
+    Logger.warning.print(F("MQTT queue full, message dropped: "));
+    Logger.warning.println(protocol);
+  }
+  return false;
+}
+
+// Publishes prefix followed by payload to topic, with QoS 1 if configured
+// and the packet fits into the in-flight window.  Returns false if the
+// message has to wait.
+bool MqttClient::publishPayload(const char *prefix, size_t prefixLength,
+                                const char *payload, size_t length) {
+  if (inflight &&
+      !InflightWindow::isTooLarge(strlen(topic), prefixLength + length)) {
+    return inflight->publish(connection, topic, prefix, prefixLength, payload,
+                             length, settings.mqttRetain);
+  }
+  // fixed header, topic length field and topic
+  const size_t headerLength = 5 + 2 + strlen(topic);
+  if (prefixLength == 0 && headerLength + length <= MQTT_MAX_PACKET_SIZE) {
+    return mqttClient.publish(topic, reinterpret_cast<const uint8_t *>(payload),
+                              length, settings.mqttRetain);
+  }
+  // written straight to the socket, bypassing the buffer of PubSubClient
+  if (!mqttClient.beginPublish(topic, prefixLength + length,
+                               settings.mqttRetain)) {
+    return false;
+  }
+  mqttClient.write(reinterpret_cast<const uint8_t *>(prefix), prefixLength);
+  mqttClient.write(reinterpret_cast<const uint8_t *>(payload), length);
+  mqttClient.endPublish();
+  return true;
+}
+
+void MqttClient::onPuback(uint16_t packetId) {
+  if (!inflight || !inflight->acknowledge(packetId)) {
+    Logger.debug.print(F("MQTT PUBACK for unknown packet "));
+    Logger.debug.println(packetId);
+  }
+}
+
+void MqttClient::publishQueued() {
+  if (queue.empty()) {
+    return;
+  }
+  if (settings.mqttQos == 0 &&
+      millis() - lastQueuedPublish < MQTT_QUEUE_DRAIN_INTERVAL) {
+    return;
+  }
+  PublishQueue::Message message;
+  if (!queue.peek(message)) {
+    return;
+  }
+  lastQueuedPublish = millis();
+  if (!publishMessage(message)) {
+    // kept for the next connection
+    return;
+  }
+  queue.pop();
+  if (queue.empty()) {
+    publishQueueStats();
+  }
+}
+
+// Publishes a queued message, JSON objects get the milliseconds since they
+// were queued as "queued" member.  Returns false if the message is kept.
+bool MqttClient::publishMessage(const PublishQueue::Message &message) {
+  int length = snprintf(topic, sizeof(topic), "%s%.*s",
+                        settings.mqttReceiveTopic.c_str(),
+                        static_cast<int>(message.protocolLength),
+                        message.protocol);
+  if (length < 0 || static_cast<size_t>(length) >= sizeof(topic)) {
+    Logger.error.print(F("MQTT publish failed, topic exceeds "));
+    Logger.error.print(sizeof(topic) - 1);
+    Logger.error.println(F(" characters"));
+    return true;
+  }
+
+  char prefix[32];
+  int prefixLength = 0;
+  const char *payload = message.payload;
+  size_t payloadLength = message.payloadLength;
+  if (payloadLength >= 2 && payload[0] == '{') {
+    prefixLength = snprintf(prefix, sizeof(prefix), "{\"queued\":%lu%s",
+                            millis() - message.queued,
+                            payload[1] == '}' ? "" : ",");
+    ++payload;
+    --payloadLength;
+  }
+
+  Logger.debug.print(F("Publish queued MQTT message: "));
+  Logger.debug.println(topic);
+  if (!publishPayload(prefix, prefixLength, payload, payloadLength)) {
+    return false;
+  }
+  publishLatency.record(millisToMicros(millis() - message.queued));
+  return true;
+}
+
+void MqttClient::publishQueueStats() {
+  const PublishQueue::Stats stats = queue.stats();
+  char payload[128];
+  snprintf(payload, sizeof(payload),
+           "{\"queued\":%u,\"spilled\":%u,\"dropped\":%u,\"maxDepth\":%u}",
+           static_cast<unsigned>(stats.queued),
+           static_cast<unsigned>(stats.spilled),
+           static_cast<unsigned>(stats.dropped),
+           static_cast<unsigned>(stats.maxDepth));
+  Logger.info.print(F("MQTT queue drained: "));
+  Logger.info.println(payload);
+  publishStats("queue", payload);
+}
+
+// Publishes to <mqttStateTopic>/<name> at once with QoS 0.  Through the
+// queue, the batches or the in-flight window, stats would be queued and
+// measured themselves.
+void MqttClient::publishStats(const char *name, const char *payload) {
+  int length = snprintf(topic, sizeof(topic), "%s/%s",
+                        settings.mqttStateTopic.c_str(), name);
+  if (length > 0 && static_cast<size_t>(length) < sizeof(topic)) {
+    mqttClient.publish(topic, payload, false);
+  }
+}
+
+// Publishes to <mqttReceiveTopic>ack/<protocol> at once with QoS 0.  An ack
+// answers a command, it is neither batched with the received codes nor
+// measured as their latency.
+void MqttClient::publishAck(const char *protocol, const char *payload) {
+  int length = snprintf(topic, sizeof(topic), "%sack/%s",
+                        settings.mqttReceiveTopic.c_str(), protocol);
+  if (length > 0 && static_cast<size_t>(length) < sizeof(topic)) {
+    mqttClient.publish(topic, payload, false);
+  }
+}
+
+bool MqttClient::isPingTopic(const char *topic) const {
+  const size_t length = settings.mqttStateTopic.length();
+  return settings.mqttLatencyInterval > 0 &&
+         strncmp(topic, settings.mqttStateTopic.c_str(), length) == 0 &&
+         strcmp_P(topic + length, PSTR(MQTT_PING_TOPIC_SUFFIX)) == 0;
+}
+
+void MqttClient::probeLatency() {
+  if (millis() - lastPing >= MQTT_PING_INTERVAL) {
+    sendPing();
+  }
+  if (millis() - lastLatencyReport >=
+      settings.mqttLatencyInterval * 1000UL) {
+    publishLatencyStats();
+  }
+}
+
+// Publishes the time it is sent to the ping topic, the round trip is
+// measured when the broker delivers it back.
+void MqttClient::sendPing() {
+  if (pingPending) {
+    pingsLost++;
+  }
+  lastPing = millis();
+  pingSent = micros();
+  pingPending = true;
+
+  char payload[12];
+  snprintf(payload, sizeof(payload), "%lu", pingSent);
+  snprintf(topic, sizeof(topic), "%s" MQTT_PING_TOPIC_SUFFIX,
+           settings.mqttStateTopic.c_str());
+  mqttClient.publish(topic, payload, false);
+}
+
+void MqttClient::onPing(const uint8_t *payload, unsigned int length) {
+  char expected[12];
+  const int expectedLength =
+      snprintf(expected, sizeof(expected), "%lu", pingSent);
+  if (!pingPending || length != static_cast<unsigned int>(expectedLength) ||
+      memcmp(payload, expected, length) != 0) {
+    Logger.debug.println(F("Ignore stale MQTT ping"));
+    return;
+  }
+  pingPending = false;
+  roundTrip.record(micros() - pingSent);
+}
+
+// Percentiles in microseconds since the last report
+void MqttClient::publishLatencyStats() {
+  lastLatencyReport = millis();
+  char payload[224];
+  snprintf(payload, sizeof(payload),
+           "{\"publish\":{\"p50\":%lu,\"p95\":%lu,\"max\":%lu,"
+           "\"count\":%lu},"
+           "\"roundTrip\":{\"p50\":%lu,\"p95\":%lu,\"max\":%lu,"
+           "\"count\":%lu,\"lost\":%u}}",
+           static_cast<unsigned long>(publishLatency.percentile(50)),
+           static_cast<unsigned long>(publishLatency.percentile(95)),
+           static_cast<unsigned long>(publishLatency.maximum()),
+           static_cast<unsigned long>(publishLatency.count()),
+           static_cast<unsigned long>(roundTrip.percentile(50)),
+           static_cast<unsigned long>(roundTrip.percentile(95)),
+           static_cast<unsigned long>(roundTrip.maximum()),
+           static_cast<unsigned long>(roundTrip.count()),
+           static_cast<unsigned>(pingsLost));
+  Logger.info.print(F("MQTT latency: "));
+  Logger.info.println(payload);
+  publishStats("latency", payload);
+  publishLatency.reset();
+  roundTrip.reset();
+  pingsLost = 0;
+}
+
+bool MqttClient::isConnected() {
+  return connectState == CONNECTED && mqttClient.connected();
+}
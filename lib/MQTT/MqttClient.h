@@ -37,35 +37,147 @@
 
 #include <Settings.h>
 
+#include "InflightWindow.h"
+#include "LatencyHistogram.h"
+#include "MqttConnection.h"
+#include "PublishCoalescer.h"
+#include "PublishQueue.h"
+
+// Milliseconds before retrying a failed connection attempt, doubled with
+// every further failure up to MQTT_CONNECTION_BACKOFF_MAX.  The actual delay
+// is a random value between half and the full delay.
 #ifndef MQTT_CONNECTION_ATTEMPT_DELAY
-#define MQTT_CONNECTION_ATTEMPT_DELAY 5000
+#define MQTT_CONNECTION_ATTEMPT_DELAY 1000
+#endif
+
+#ifndef MQTT_CONNECTION_BACKOFF_MAX
+#define MQTT_CONNECTION_BACKOFF_MAX 60000
+#endif
+
+// Milliseconds to wait for the TCP connection and for CONNACK each
+#ifndef MQTT_CONNECT_TIMEOUT
+#define MQTT_CONNECT_TIMEOUT 10000
+#endif
+
+// Milliseconds between two queued messages published after a reconnect with
+// QoS 0, with QoS 1 the in-flight window paces them
+#ifndef MQTT_QUEUE_DRAIN_INTERVAL
+#define MQTT_QUEUE_DRAIN_INTERVAL 50
+#endif
+
+// Milliseconds between two pings measuring the round trip to the broker,
+// while mqttLatencyInterval is set.  The ping is published to
+// <mqttStateTopic>/ping, which the gateway subscribes to.
+#ifndef MQTT_PING_INTERVAL
+#define MQTT_PING_INTERVAL 10000
+#endif
+
+#define MQTT_PING_TOPIC_SUFFIX "/ping"
+
+// Messages larger than MQTT_MAX_PACKET_SIZE are received in chunks, RAW
+// pulse trains are parsed on the fly, other messages up to this size are
+// collected in a buffer allocated for the message
+#ifndef MQTT_STREAM_MAX_SIZE
+#define MQTT_STREAM_MAX_SIZE 4096
+#endif
+
+#ifndef MQTT_TOPIC_BUFFER_SIZE
+#define MQTT_TOPIC_BUFFER_SIZE 128
 #endif
 
 class MqttClient {
  public:
-  using RfDataCb =
-      std::function<void(const String &topic_part, const String &payload)>;
+  // Topic part and payload point into the receive buffer and are only valid
+  // during the call, the payload is not null terminated.
+  using RfDataCb = std::function<void(const char *topic_part,
+                                      const char *payload, size_t length)>;
+  // RAW messages may arrive in chunks: data are length bytes at offset of a
+  // message of total bytes.
+  using RfRawCb = std::function<void(const uint8_t *data, size_t length,
+                                     size_t offset, size_t total)>;
 
   MqttClient(const Settings &settings, WiFiClient &client);
   ~MqttClient();
   void begin();
   void loop();
   void registerRfDataHandler(const RfDataCb &cb);
+  void registerRfRawHandler(const RfRawCb &cb);
 
+  // Advances the connection to the broker without blocking.
   void reconnect();
-  void publishCode(const String &protocol, const String &payload);
+  void publishCode(const char *protocol, const char *payload);
+  void publishStats(const char *name, const char *payload);
+  void publishAck(const char *protocol, const char *payload);
   bool isConnected();
+  PublishQueue::Stats queueStats() const { return queue.stats(); }
+  InflightWindow::Stats inflightStats() const {
+    return inflight ? inflight->stats() : InflightWindow::Stats();
+  }
 
  private:
+  enum ConnectState { DISCONNECTED, CONNECTING, HANDSHAKING, CONNECTED };
+
+  const char *sendTopicPart(const char *topic);
   void onMessage(char *topic, uint8_t *payload, unsigned int length);
+  void onStreamedMessage(const char *topic, const uint8_t *data, size_t length,
+                         size_t offset, size_t total);
+  bool advanceConnection();
+  void setConnectState(ConnectState state);
+  void sendConnect();
+  void writeField(const String &field);
+  void receiveConnack();
+  void connectFailed(const __FlashStringHelper *reason);
+  void onConnected();
+  bool publish(const char *protocol, const char *payload);
+  void publishBatch();
+  void publishQueued();
+  bool publishMessage(const PublishQueue::Message &message);
+  bool publishPayload(const char *prefix, size_t prefixLength,
+                      const char *payload, size_t length);
+  void onPuback(uint16_t packetId);
+  void publishQueueStats();
+  bool isPingTopic(const char *topic) const;
+  void probeLatency();
+  void sendPing();
+  void onPing(const uint8_t *payload, unsigned int length);
+  void publishLatencyStats();
   bool connect();
   bool subsrcibe();
+  bool subscribe(const String &topic);
 
   const Settings &settings;
   RfDataCb onRfDataCallback = nullptr;
+  RfRawCb onRfRawCallback = nullptr;
 
+  MqttConnection connection;
   PubSubClient mqttClient;
-  unsigned long lastConnectAttempt;
+  ConnectState connectState = DISCONNECTED;
+  unsigned long connectStateSince = 0;
+  // delay before the next attempt and its upper bound, growing with every
+  // failed attempt
+  unsigned long retryDelay = 0;
+  unsigned long connectBackoff = 0;
+  PublishQueue queue;
+  PacketIdCounter packetIds;
+  // QoS 1 messages waiting for their PUBACK, only allocated with mqttQos > 0
+  InflightWindow *inflight = nullptr;
+  // only allocated with mqttCoalesceWindow > 0
+  PublishCoalescer *coalescer = nullptr;
+  unsigned long lastQueuedPublish = 0;
+  // from receiving a code to writing it to the socket, and of the pings
+  LatencyHistogram publishLatency;
+  LatencyHistogram roundTrip;
+  unsigned long pingSent = 0;  // micros() sent as ping payload
+  bool pingPending = false;
+  size_t pingsLost = 0;
+  unsigned long lastPing = 0;
+  unsigned long lastLatencyReport = 0;
+  // streamed message being received, accepted if its topic starts with the
+  // send topic, and being collected
+  bool streamAccepted = false;
+  char *streamBuffer = nullptr;
+  // reused for every published code to keep the publish path allocation free
+  char topic[MQTT_TOPIC_BUFFER_SIZE];
 };
 
 #endif  // MQTTCLIENT_H
@@ -0,0 +1,365 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include <PubSubClient.h>
+
+#include "MqttConnection.h"
+
+#ifdef ESP8266
+#include <lwip/dns.h>
+#include <lwip/tcp.h>
+
+#include <include/ClientContext.h>
+
+// Hands an established lwIP connection to a WiFiClient, like WiFiServer does
+// for accepted ones.
+class EstablishedClient : public WiFiClient {
+ public:
+  explicit EstablishedClient(ClientContext *context) : WiFiClient(context) {}
+};
+
+MqttConnection *MqttConnection::lookupPending = nullptr;
+#endif
+
+MqttConnection::~MqttConnection() { stop(); }
+
+#ifdef ESP8266
+void MqttConnection::open(const char *host, uint16_t port) {
+  stop();
+  this->port = port;
+  state = OPENING;
+
+  ip_addr_t address;
+  lookupPending = this;
+  err_t err = dns_gethostbyname(host, &address, &MqttConnection::onResolved,
+                                this);
+  if (err == ERR_INPROGRESS) {
+    return;
+  }
+  lookupPending = nullptr;
+  if (err == ERR_OK) {
+    connectTo(&address);
+  } else {
+    state = FAILED;
+  }
+}
+
+void MqttConnection::onResolved(const char *, const ip_addr_t *address,
+                                void *arg) {
+  if (arg != lookupPending) {
+    // stopped or deleted while the lookup was running
+    return;
+  }
+  lookupPending = nullptr;
+  MqttConnection *connection = static_cast<MqttConnection *>(arg);
+  if (address) {
+    connection->connectTo(address);
+  } else {
+    connection->state = FAILED;
+  }
+}
+
+void MqttConnection::connectTo(const ip_addr_t *address) {
+  pcb = tcp_new();
+  if (!pcb) {
+    state = FAILED;
+    return;
+  }
+  tcp_arg(pcb, this);
+  tcp_err(pcb, &MqttConnection::onError);
+  if (tcp_connect(pcb, address, port, &MqttConnection::onConnected) !=
+      ERR_OK) {
+    tcp_arg(pcb, nullptr);
+    tcp_err(pcb, nullptr);
+    tcp_abort(pcb);
+    pcb = nullptr;
+    state = FAILED;
+  }
+}
+
+err_t MqttConnection::onConnected(void *arg, tcp_pcb *pcb, err_t) {
+  MqttConnection *connection = static_cast<MqttConnection *>(arg);
+  connection->pcb = nullptr;
+  // ClientContext takes over the pcb and its callbacks
+  connection->socket =
+      EstablishedClient(new ClientContext(pcb, nullptr, nullptr));
+  connection->state = OPEN;
+  return ERR_OK;
+}
+
+void MqttConnection::onError(void *arg, err_t) {
+  // lwIP has already freed the pcb
+  MqttConnection *connection = static_cast<MqttConnection *>(arg);
+  connection->pcb = nullptr;
+  connection->state = FAILED;
+}
+#else
+// Other targets, like the native bench, connect synchronously.
+void MqttConnection::open(const char *host, uint16_t port) {
+  stop();
+  this->port = port;
+  state = socket.connect(host, port) ? OPEN : FAILED;
+}
+#endif
+
+void MqttConnection::replay(const uint8_t *packet, size_t length) {
+  replayLength = std::min(length, sizeof(replayBuffer));
+  replayPosition = 0;
+  memcpy(replayBuffer, packet, replayLength);
+  sessionOpen = true;
+}
+
+int MqttConnection::connect(IPAddress ip, uint16_t port) {
+  return socket.connect(ip, port);
+}
+
+int MqttConnection::connect(const char *host, uint16_t port) {
+  return socket.connect(host, port);
+}
+
+size_t MqttConnection::write(uint8_t data) {
+  return replaying() ? 1 : socket.write(data);
+}
+
+size_t MqttConnection::write(const uint8_t *buffer, size_t size) {
+  return replaying() ? size : socket.write(buffer, size);
+}
+
+int MqttConnection::available() {
+  if (replaying()) {
+    return replayLength - replayPosition;
+  }
+  if (!sessionOpen) {
+    return socket.available();
+  }
+  return readAhead() ? headerLength - headerPosition + socket.available() : 0;
+}
+
+int MqttConnection::read() {
+  if (replaying()) {
+    return replayBuffer[replayPosition++];
+  }
+  if (headerPending()) {
+    return header[headerPosition++];
+  }
+  const int data = socket.read();
+  if (data >= 0) {
+    inspect(data);
+  }
+  return data;
+}
+
+int MqttConnection::read(uint8_t *buffer, size_t size) {
+  if (headerPending() && !replaying()) {
+    size = std::min(size, headerLength - headerPosition);
+    memcpy(buffer, header + headerPosition, size);
+    headerPosition += size;
+    return size;
+  }
+  if (!replaying()) {
+    const int length = socket.read(buffer, size);
+    for (int i = 0; i < length; i++) {
+      inspect(buffer[i]);
+    }
+    return length;
+  }
+  size = std::min(size, replayLength - replayPosition);
+  memcpy(buffer, replayBuffer + replayPosition, size);
+  replayPosition += size;
+  return size;
+}
+
+int MqttConnection::peek() {
+  if (replaying()) {
+    return replayBuffer[replayPosition];
+  }
+  return headerPending() ? header[headerPosition] : socket.peek();
+}
+
+void MqttConnection::flush() { socket.flush(); }
+
+void MqttConnection::stop() {
+#ifdef ESP8266
+  if (lookupPending == this) {
+    lookupPending = nullptr;
+  }
+  if (pcb) {
+    tcp_arg(pcb, nullptr);
+    tcp_err(pcb, nullptr);
+    tcp_abort(pcb);
+    pcb = nullptr;
+  }
+#endif
+  socket.stop();
+  state = CLOSED;
+  replayLength = replayPosition = 0;
+  sessionOpen = false;
+  headerLength = headerPosition = 0;
+  readState = PACKET_TYPE;
+}
+
+void MqttConnection::inspect(uint8_t data) {
+  switch (readState) {
+    case PACKET_TYPE:
+      packetType = data & 0xf0;
+      remainingLength = 0;
+      lengthShift = 0;
+      bodyRead = 0;
+      readState = REMAINING_LENGTH;
+      return;
+    case REMAINING_LENGTH:
+      remainingLength |= static_cast<size_t>(data & 0x7f) << lengthShift;
+      lengthShift += 7;
+      if (data & 0x80) {
+        return;
+      }
+      break;
+    case PACKET_BODY:
+      if (bodyRead < 2) {
+        packetId = packetId << 8 | data;
+      }
+      ++bodyRead;
+      break;
+    case STREAM_TOPIC:
+    case STREAM_PAYLOAD:
+      // consumed by receiveStream()
+      return;
+  }
+  if (bodyRead < remainingLength) {
+    readState = PACKET_BODY;
+    return;
+  }
+  readState = PACKET_TYPE;
+  if (packetType == MQTTPUBACK && remainingLength == 2 && onPubackCallback) {
+    onPubackCallback(packetId);
+  }
+}
+
+// Reads the fixed header of the next packet before PubSubClient does and
+// streams PUBLISH packets too large for it.  Returns true if PubSubClient may
+// read: a complete header is pending or a packet body is passed through.
+bool MqttConnection::readAhead() {
+  while (true) {
+    switch (readState) {
+      case PACKET_BODY:
+        return true;
+      case STREAM_TOPIC:
+      case STREAM_PAYLOAD:
+        if (!receiveStream()) {
+          return false;
+        }
+        continue;
+      case PACKET_TYPE:
+        if (headerPending()) {
+          // a packet without body, e.g., PINGRESP
+          return true;
+        }
+        headerLength = headerPosition = 0;
+        break;
+      case REMAINING_LENGTH:
+        break;
+    }
+
+    const int data = socket.available() > 0 ? socket.read() : -1;
+    if (data < 0) {
+      return false;
+    }
+    if (headerLength < sizeof(header)) {
+      header[headerLength++] = data;
+    }
+    inspect(data);
+    if (readState == REMAINING_LENGTH) {
+      continue;
+    }
+    if (packetType == MQTTPUBLISH &&
+        headerLength + remainingLength > MQTT_MAX_PACKET_SIZE) {
+      beginStream();
+    }
+  }
+}
+
+void MqttConnection::beginStream() {
+  // QoS 1 and 2 packets carry a packet identifier after the topic
+  const bool hasPacketId = (header[0] & 0x06) != 0;
+  headerLength = headerPosition = 0;
+  bodyRead = 0;
+  streamTopicLength = 0;
+  streamPayloadStart = hasPacketId ? 4 : 2;
+  readState = STREAM_TOPIC;
+}
+
+// Consumes the received part of a streamed packet, returns true once the
+// packet is complete.
+bool MqttConnection::receiveStream() {
+  while (bodyRead < remainingLength) {
+    const int available = socket.available();
+    if (available <= 0) {
+      return false;
+    }
+    if (readState == STREAM_TOPIC) {
+      const int data = socket.read();
+      if (bodyRead < 2) {
+        // topic length
+        streamTopicLength = streamTopicLength << 8 | data;
+        streamPayloadStart += data << (bodyRead == 0 ? 8 : 0);
+      } else if (bodyRead - 2 < streamTopicLength &&
+                 bodyRead - 2 < sizeof(streamTopic)) {
+        streamTopic[bodyRead - 2] = data;
+      }
+      if (++bodyRead == streamPayloadStart) {
+        streamTopic[std::min(streamTopicLength, sizeof(streamTopic) - 1)] = 0;
+        readState = STREAM_PAYLOAD;
+      }
+      continue;
+    }
+
+    uint8_t chunk[MQTT_STREAM_CHUNK_SIZE];
+    const int length = socket.read(
+        chunk, std::min(std::min(sizeof(chunk), remainingLength - bodyRead),
+                        static_cast<size_t>(available)));
+    if (length <= 0) {
+      return false;
+    }
+    // a truncated topic would be misleading, such packets are skipped
+    if (onStreamCallback && streamTopicLength < sizeof(streamTopic)) {
+      onStreamCallback(streamTopic, chunk, length,
+                       bodyRead - streamPayloadStart,
+                       remainingLength - streamPayloadStart);
+    }
+    bodyRead += length;
+  }
+  readState = PACKET_TYPE;
+  return true;
+}
+
+uint8_t MqttConnection::connected() { return socket.connected(); }
+
+MqttConnection::operator bool() { return connected() || available(); }
@@ -0,0 +1,171 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef MQTTCONNECTION_H
+#define MQTTCONNECTION_H
+
+#include <functional>
+
+#include <WiFiClient.h>
+
+#ifdef ESP8266
+#include <lwip/err.h>
+#include <lwip/ip_addr.h>
+
+struct tcp_pcb;
+#endif
+
+// Maximal length of a packet handed to PubSubClient by replay()
+#ifndef MQTT_REPLAY_SIZE
+#define MQTT_REPLAY_SIZE 8
+#endif
+
+// PUBLISH packets larger than MQTT_MAX_PACKET_SIZE are received in chunks of
+// at most MQTT_STREAM_CHUNK_SIZE bytes, their topic must be shorter than
+// MQTT_STREAM_TOPIC_SIZE
+#ifndef MQTT_STREAM_CHUNK_SIZE
+#define MQTT_STREAM_CHUNK_SIZE 128
+#endif
+
+#ifndef MQTT_STREAM_TOPIC_SIZE
+#define MQTT_STREAM_TOPIC_SIZE 128
+#endif
+
+// Broker connection that is opened without blocking the main loop.
+//
+// open() starts the DNS lookup and the TCP connect in the background, on
+// the ESP8266 both run in lwIP callbacks; status() tells when the socket is
+// established.  The MQTT handshake is then done by the caller, who hands
+// the received CONNACK to replay(): PubSubClient::connect() skips the TCP
+// connect on an established socket, its CONNECT is swallowed and the
+// replayed CONNACK is read back without waiting.  Everything else passes
+// through to the WiFiClient.
+//
+// PubSubClient ignores PUBACK packets, so the received packets are followed
+// while PubSubClient reads them and every PUBACK is reported.
+//
+// PubSubClient drops packets larger than its buffer.  Once replay() handed
+// the session over, the fixed header of every packet is therefore read
+// ahead: a PUBLISH packet exceeding MQTT_MAX_PACKET_SIZE is kept from
+// PubSubClient and its payload is handed to the stream handler chunk by
+// chunk as it arrives, without buffering the packet.
+//
+// This depends on internals that platformio.ini pins: the established
+// socket is handed over with the core private include/ClientContext.h and
+// the protected WiFiClient(ClientContext *) constructor of the ESP8266
+// Arduino core 2.7 (platform espressif8266 2.6), and the handshake relies
+// on PubSubClient 2.8 or later not connecting an already connected client.
+class MqttConnection : public Client {
+ public:
+  enum Status { CLOSED, OPENING, OPEN, FAILED };
+  using PubackCb = std::function<void(uint16_t packetId)>;
+  // data are length bytes at offset of a payload of total bytes
+  using StreamCb =
+      std::function<void(const char *topic, const uint8_t *data, size_t length,
+                         size_t offset, size_t total)>;
+
+  explicit MqttConnection(WiFiClient &socket) : socket(socket) {}
+  ~MqttConnection();
+
+  // Starts connecting to host, a host name or an IP address.
+  void open(const char *host, uint16_t port);
+  Status status() const { return state; }
+  // Serves packet to the next reads and drops the writes until it is read.
+  void replay(const uint8_t *packet, size_t length);
+  void registerPubackHandler(const PubackCb &cb) { onPubackCallback = cb; }
+  void registerStreamHandler(const StreamCb &cb) { onStreamCallback = cb; }
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char *host, uint16_t port) override;
+  size_t write(uint8_t data) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  int available() override;
+  int read() override;
+  int read(uint8_t *buffer, size_t size) override;
+  int peek() override;
+  void flush() override;
+  void stop() override;
+  uint8_t connected() override;
+  operator bool() override;
+
+ private:
+  enum ReadState {
+    PACKET_TYPE,
+    REMAINING_LENGTH,
+    PACKET_BODY,
+    STREAM_TOPIC,
+    STREAM_PAYLOAD
+  };
+
+  bool replaying() const { return replayPosition < replayLength; }
+  bool headerPending() const { return headerPosition < headerLength; }
+  void inspect(uint8_t data);
+  bool readAhead();
+  void beginStream();
+  bool receiveStream();
+
+#ifdef ESP8266
+  void connectTo(const ip_addr_t *address);
+  static void onResolved(const char *name, const ip_addr_t *address,
+                         void *arg);
+  static err_t onConnected(void *arg, tcp_pcb *pcb, err_t err);
+  static void onError(void *arg, err_t err);
+
+  // connection waiting for the DNS lookup, which cannot be cancelled
+  static MqttConnection *lookupPending;
+  tcp_pcb *pcb = nullptr;
+#endif
+
+  WiFiClient &socket;
+  Status state = CLOSED;
+  uint16_t port = 0;
+  uint8_t replayBuffer[MQTT_REPLAY_SIZE];
+  size_t replayLength = 0;
+  size_t replayPosition = 0;
+  PubackCb onPubackCallback = nullptr;
+  StreamCb onStreamCallback = nullptr;
+  // fixed header read ahead, once the session is handed to PubSubClient
+  bool sessionOpen = false;
+  uint8_t header[5];
+  size_t headerLength = 0;
+  size_t headerPosition = 0;
+  // framing of the received packets
+  ReadState readState = PACKET_TYPE;
+  uint8_t packetType = 0;
+  size_t remainingLength = 0;
+  uint8_t lengthShift = 0;
+  size_t bodyRead = 0;
+  uint16_t packetId = 0;
+  // topic and payload position of the streamed packet
+  char streamTopic[MQTT_STREAM_TOPIC_SIZE];
+  size_t streamTopicLength = 0;
+  size_t streamPayloadStart = 0;
+};
+
+#endif  // MQTTCONNECTION_H
@@ -0,0 +1,80 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "PublishCoalescer.h"
+
+bool PublishCoalescer::add(const char *protocol, const char *message) {
+  const bool json = *message == '{' || *message == '[';
+  if (!json && strpbrk(message, "\"\\") != nullptr) {
+    // would need escaping
+    return false;
+  }
+  // one byte is left for the closing bracket
+  const size_t space = sizeof(buffer) - 1 - used;
+  const char *format = json ? "%s{\"protocol\":\"%s\",\"message\":%s}"
+                            : "%s{\"protocol\":\"%s\",\"message\":\"%s\"}";
+  const int length = snprintf(buffer + used, space, format,
+                              count == 0 ? "" : ",", protocol, message);
+  if (length < 0 || static_cast<size_t>(length) >= space) {
+    buffer[used] = 0;
+    return false;
+  }
+  used += length;
+  lastAdded = millis();
+  if (count++ == 0) {
+    firstAdded = lastAdded;
+  }
+  return true;
+}
+
+bool PublishCoalescer::isDue(unsigned long window) const {
+  const unsigned long now = millis();
+  return count > 0 && (now - lastAdded >= window ||
+                       now - firstAdded >= MQTT_COALESCE_MAX_LATENCY);
+}
+
+unsigned long PublishCoalescer::age() const { return millis() - firstAdded; }
+
+const char *PublishCoalescer::payload() {
+  buffer[used] = ']';
+  buffer[used + 1] = 0;
+  return buffer;
+}
+
+void PublishCoalescer::clear() {
+  buffer[0] = '[';
+  buffer[1] = 0;
+  used = 1;
+  count = 0;
+}
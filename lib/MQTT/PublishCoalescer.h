@@ -0,0 +1,78 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PUBLISHCOALESCER_H
+#define PUBLISHCOALESCER_H
+
+#include <stddef.h>
+
+// Codes published together to <mqttReceiveTopic>batch
+#define MQTT_COALESCE_TOPIC "batch"
+
+#ifndef MQTT_COALESCE_SIZE
+// Maximal payload of a batch
+#define MQTT_COALESCE_SIZE 512
+#endif
+
+#ifndef MQTT_COALESCE_MAX_LATENCY
+// A batch is published at the latest this many milliseconds after its first
+// code, even if codes keep arriving
+#define MQTT_COALESCE_MAX_LATENCY 1000
+#endif
+
+// Collects received codes into one JSON array of
+// {"protocol": ..., "message": ...} objects, the format of transmit batches.
+// JSON messages are embedded as they are, others as strings.
+class PublishCoalescer {
+ public:
+  PublishCoalescer() { clear(); }
+
+  // Appends a code, returns false if it does not fit.
+  bool add(const char *protocol, const char *message);
+  // True once no code was added for window milliseconds or the first code
+  // waits MQTT_COALESCE_MAX_LATENCY milliseconds.
+  bool isDue(unsigned long window) const;
+  bool empty() const { return count == 0; }
+  size_t size() const { return count; }
+  // Milliseconds since the first code was added
+  unsigned long age() const;
+  // The JSON array, valid until the next add() or clear()
+  const char *payload();
+  size_t length() const { return used + 1; }
+  void clear();
+
+ private:
+  char buffer[MQTT_COALESCE_SIZE + 1];
+  size_t used;  // without the closing bracket
+  size_t count;
+  unsigned long firstAdded = 0;
+  unsigned long lastAdded = 0;
+};
+
+#endif  // PUBLISHCOALESCER_H
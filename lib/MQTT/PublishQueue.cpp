@@ -0,0 +1,231 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <ArduinoSimpleLogging.h>
+
+#include "PublishQueue.h"
+
+PublishQueue::PublishQueue(bool spill) : spillEnabled(spill) {
+  // the queue times of a previous run are meaningless
+  SPIFFS.remove(FPSTR(MQTT_QUEUE_FILE));
+}
+
+PublishQueue::~PublishQueue() {
+  clearSpilled();
+  release();
+}
+
+bool PublishQueue::allocate() {
+  if (!buffer) {
+    buffer = static_cast<uint8_t *>(malloc(MQTT_QUEUE_SIZE));
+    if (!buffer) {
+      Logger.error.println(F("No memory for the MQTT queue!"));
+    }
+  }
+  return buffer != nullptr;
+}
+
+void PublishQueue::release() {
+  free(buffer);
+  buffer = nullptr;
+  head = used = 0;
+}
+
+size_t PublishQueue::messageSize(const uint8_t *header) {
+  return HEADER_SIZE + (header[4] | header[5] << 8) + header[6];
+}
+
+bool PublishQueue::add(const char *protocol, const char *payload) {
+  const size_t protocolLength = strlen(protocol);
+  const size_t payloadLength = strlen(payload);
+  const uint32_t now = millis();
+  const uint8_t header[HEADER_SIZE] = {
+      static_cast<uint8_t>(now),
+      static_cast<uint8_t>(now >> 8),
+      static_cast<uint8_t>(now >> 16),
+      static_cast<uint8_t>(now >> 24),
+      static_cast<uint8_t>(payloadLength),
+      static_cast<uint8_t>(payloadLength >> 8),
+      static_cast<uint8_t>(protocolLength)};
+
+  // a message that is read back from flash must fit into the buffer
+  const bool fits = protocolLength <= 0xff &&
+                    HEADER_SIZE + protocolLength + payloadLength <=
+                        MQTT_QUEUE_SIZE;
+  // once messages are spilled, later ones follow them to keep the order
+  const bool added =
+      fits && ((spillCount == 0 && addToBuffer(header, protocol, payload)) ||
+               (spillEnabled && spill(header, protocol, payload)));
+  if (!added) {
+    ++dropped;
+    return false;
+  }
+  ++queued;
+  maxDepth = std::max(maxDepth, buffered + spillCount);
+  return true;
+}
+
+bool PublishQueue::addToBuffer(const uint8_t *header, const char *protocol,
+                               const char *payload) {
+  if (!allocate()) {
+    return false;
+  }
+  const size_t size = messageSize(header);
+  if (used + size > MQTT_QUEUE_SIZE) {
+    if (used - head + size > MQTT_QUEUE_SIZE) {
+      return false;
+    }
+    memmove(buffer, buffer + head, used - head);
+    used -= head;
+    head = 0;
+  }
+  uint8_t *message = buffer + used;
+  memcpy(message, header, HEADER_SIZE);
+  memcpy(message + HEADER_SIZE, protocol, header[6]);
+  memcpy(message + HEADER_SIZE + header[6], payload,
+         size - HEADER_SIZE - header[6]);
+  used += size;
+  ++buffered;
+  return true;
+}
+
+bool PublishQueue::spill(const uint8_t *header, const char *protocol,
+                         const char *payload) {
+  const size_t size = messageSize(header);
+  if (spillSize + size > MQTT_QUEUE_SPILL_SIZE) {
+    return false;
+  }
+  File file = SPIFFS.open(FPSTR(MQTT_QUEUE_FILE), "a");
+  if (!file) {
+    Logger.error.println(F("Open MQTT queue file for write failed!"));
+    return false;
+  }
+  const size_t protocolLength = header[6];
+  const size_t payloadLength = size - HEADER_SIZE - protocolLength;
+  const bool written =
+      file.write(header, HEADER_SIZE) == HEADER_SIZE &&
+      file.write(reinterpret_cast<const uint8_t *>(protocol),
+                 protocolLength) == protocolLength &&
+      file.write(reinterpret_cast<const uint8_t *>(payload), payloadLength) ==
+          payloadLength;
+  file.close();
+  if (!written) {
+    // a partly written message ends the readable part of the file
+    Logger.error.println(F("Writing MQTT queue file failed, stop spilling!"));
+    spillEnabled = false;
+    return false;
+  }
+  spillSize += size;
+  ++spillCount;
+  ++spilled;
+  return true;
+}
+
+bool PublishQueue::peek(Message &message) {
+  if (buffered == 0) {
+    loadSpilled();
+    if (buffered == 0) {
+      return false;
+    }
+  }
+  const uint8_t *header = buffer + head;
+  message.queued = static_cast<uint32_t>(header[0]) |
+                   static_cast<uint32_t>(header[1]) << 8 |
+                   static_cast<uint32_t>(header[2]) << 16 |
+                   static_cast<uint32_t>(header[3]) << 24;
+  message.protocolLength = header[6];
+  message.payloadLength = messageSize(header) - HEADER_SIZE - header[6];
+  message.protocol = reinterpret_cast<const char *>(header + HEADER_SIZE);
+  message.payload = message.protocol + message.protocolLength;
+  return true;
+}
+
+void PublishQueue::pop() {
+  if (buffered == 0) {
+    return;
+  }
+  head += messageSize(buffer + head);
+  if (--buffered == 0) {
+    head = used = 0;
+    if (spillCount == 0) {
+      release();
+    }
+  }
+}
+
+void PublishQueue::loadSpilled() {
+  if (spillCount == 0 || !allocate()) {
+    return;
+  }
+  File file = SPIFFS.open(FPSTR(MQTT_QUEUE_FILE), "r");
+  size_t length = 0;
+  if (file && file.seek(spillRead, SeekSet)) {
+    length = file.read(
+        buffer, std::min<size_t>(MQTT_QUEUE_SIZE, spillSize - spillRead));
+  }
+  if (file) {
+    file.close();
+  }
+
+  size_t loaded = 0;
+  while (loaded < spillCount && used + HEADER_SIZE <= length &&
+         used + messageSize(buffer + used) <= length) {
+    used += messageSize(buffer + used);
+    ++loaded;
+  }
+  if (loaded == 0) {
+    Logger.error.println(F("Reading MQTT queue file failed!"));
+    dropped += spillCount;
+    clearSpilled();
+    release();
+    return;
+  }
+  buffered = loaded;
+  spillRead += used;
+  spillCount -= loaded;
+  if (spillCount == 0) {
+    clearSpilled();
+  }
+}
+
+void PublishQueue::clearSpilled() {
+  if (spillSize > 0) {
+    SPIFFS.remove(FPSTR(MQTT_QUEUE_FILE));
+  }
+  spillSize = spillRead = spillCount = 0;
+}
+
+PublishQueue::Stats PublishQueue::stats() const {
+  return {queued, spilled, dropped, buffered + spillCount, maxDepth};
+}
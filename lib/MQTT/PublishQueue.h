@@ -0,0 +1,122 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PUBLISHQUEUE_H
+#define PUBLISHQUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <FS.h>
+
+const char PROGMEM MQTT_QUEUE_FILE[] = "/mqttqueue.bin";
+
+#ifndef MQTT_QUEUE_SIZE
+// Bytes of RAM for messages waiting for the broker
+#define MQTT_QUEUE_SIZE 4096
+#endif
+
+#ifndef MQTT_QUEUE_SPILL_SIZE
+// Bytes of flash used when the RAM is full and spilling is enabled
+#define MQTT_QUEUE_SPILL_SIZE 32768
+#endif
+
+// Messages published while the broker is not reachable.
+//
+// Messages are stored back to back in the order of arrival in a buffer of
+// MQTT_QUEUE_SIZE bytes, each with the time it was queued.  The buffer is
+// only allocated while messages are waiting, a gateway that stays connected
+// never holds it.  When
+// the buffer is full and spilling is enabled, further messages are appended
+// to MQTT_QUEUE_FILE up to MQTT_QUEUE_SPILL_SIZE bytes.  The file is read
+// back into the buffer once the buffer ran empty, so the order is kept.
+// Messages that fit in neither are dropped.
+class PublishQueue {
+ public:
+  struct Message {
+    unsigned long queued;  // millis() when the message was added
+    const char *protocol;
+    size_t protocolLength;
+    const char *payload;
+    size_t payloadLength;
+  };
+
+  struct Stats {
+    size_t queued;
+    size_t spilled;  // written to flash
+    size_t dropped;  // did not fit
+    size_t depth;    // messages waiting, in RAM and on flash
+    size_t maxDepth;
+  };
+
+  explicit PublishQueue(bool spill);
+  ~PublishQueue();
+
+  bool add(const char *protocol, const char *payload);
+  // The oldest message, false if none is waiting.  The pointers stay valid
+  // until the next call of a non-const method.
+  bool peek(Message &message);
+  // Removes the message returned by the last peek().
+  void pop();
+  bool empty() const { return buffered == 0 && spillCount == 0; }
+  Stats stats() const;
+
+ private:
+  // every message starts with the time it was queued, the length of the
+  // payload and the length of the protocol, followed by both strings
+  static const size_t HEADER_SIZE = 7;
+
+  static size_t messageSize(const uint8_t *header);
+
+  bool allocate();
+  void release();
+  bool addToBuffer(const uint8_t *header, const char *protocol,
+                   const char *payload);
+  bool spill(const uint8_t *header, const char *protocol,
+             const char *payload);
+  void loadSpilled();
+  void clearSpilled();
+
+  bool spillEnabled;
+  uint8_t *buffer = nullptr;  // MQTT_QUEUE_SIZE bytes while not empty
+  size_t head = 0;  // offset of the oldest message
+  size_t used = 0;  // end of the last message
+  size_t buffered = 0;
+  // size of the spill file, the part already read back and the number of
+  // messages left in it
+  size_t spillSize = 0;
+  size_t spillRead = 0;
+  size_t spillCount = 0;
+  size_t maxDepth = 0;
+  size_t queued = 0;
+  size_t spilled = 0;
+  size_t dropped = 0;
+};
+
+#endif  // PUBLISHQUEUE_H
@@ -0,0 +1,144 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <algorithm>
+
+#include "ProtocolStats.h"
+
+static_assert(RF_PROTOCOL_STATS_SIZE < 255,
+              "RF_PROTOCOL_STATS_SIZE must fit into uint8_t indices");
+
+static const int OTHER = RF_PROTOCOL_STATS_SIZE;
+
+static size_t histogramBucket(unsigned long decodeMicros) {
+  size_t bucket = 0;
+  for (unsigned long limit = 64;
+       decodeMicros >= limit && bucket < RF_DECODE_HISTOGRAM_BUCKETS - 1;
+       limit <<= 1) {
+    bucket++;
+  }
+  return bucket;
+}
+
+static void clearCounters(uint32_t &hits, uint32_t *histogram) {
+  hits = 0;
+  std::fill_n(histogram, RF_DECODE_HISTOGRAM_BUCKETS, 0);
+}
+
+ProtocolStats::ProtocolStats() : used(0) {
+  other.protocol = F("other");
+  unknown.protocol = F("unknown");
+  reset();
+}
+
+int ProtocolStats::indexOf(const String &protocol) {
+  for (size_t i = 0; i < used; i++) {
+    if (entries[i].protocol == protocol) {
+      return i;
+    }
+  }
+  if (used < RF_PROTOCOL_STATS_SIZE) {
+    entries[used].protocol = protocol;
+    clearCounters(entries[used].hits, entries[used].histogram);
+    return used++;
+  }
+  return OTHER;
+}
+
+void ProtocolStats::record(int index, unsigned long decodeMicros) {
+  Entry &entry = index == UNKNOWN ? unknown
+                                  : (index == OTHER ? other : entries[index]);
+  entry.hits++;
+  entry.histogram[histogramBucket(decodeMicros)]++;
+}
+
+void ProtocolStats::reset() {
+  clearCounters(other.hits, other.histogram);
+  clearCounters(unknown.hits, unknown.histogram);
+  for (size_t i = 0; i < used; i++) {
+    clearCounters(entries[i].hits, entries[i].histogram);
+  }
+}
+
+size_t ProtocolStats::sortedIndices(uint8_t *indices) const {
+  size_t count = 0;
+  for (size_t i = 0; i < used; i++) {
+    if (entries[i].hits > 0) {
+      indices[count++] = i;
+    }
+  }
+  std::sort(indices, indices + count, [this](uint8_t a, uint8_t b) {
+    return entries[a].hits > entries[b].hits;
+  });
+  return count;
+}
+
+void ProtocolStats::printEntry(Print &output, const Entry &entry) {
+  output.print(F("RF decode "));
+  output.print(entry.protocol);
+  output.print(F(": hits="));
+  output.print(entry.hits);
+  unsigned long limit = 64;
+  for (size_t i = 0; i < RF_DECODE_HISTOGRAM_BUCKETS; i++, limit <<= 1) {
+    if (entry.histogram[i] == 0) continue;
+    output.print(i < RF_DECODE_HISTOGRAM_BUCKETS - 1 ? F(" <") : F(" >="));
+    output.print(i < RF_DECODE_HISTOGRAM_BUCKETS - 1 ? limit : limit >> 1);
+    output.print(F("us:"));
+    output.print(entry.histogram[i]);
+  }
+  output.println();
+}
+
+void ProtocolStats::print(Print &output) const {
+  uint8_t indices[RF_PROTOCOL_STATS_SIZE];
+  size_t count = sortedIndices(indices);
+  for (size_t i = 0; i < count; i++) {
+    printEntry(output, entries[indices[i]]);
+  }
+  if (other.hits > 0) {
+    printEntry(output, other);
+  }
+  if (unknown.hits > 0) {
+    printEntry(output, unknown);
+  }
+}
+
+String ProtocolStats::protocolsByHits() const {
+  uint8_t indices[RF_PROTOCOL_STATS_SIZE];
+  size_t count = sortedIndices(indices);
+  String result("[");
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0) result += ',';
+    result += '"';
+    result += entries[indices[i]].protocol;
+    result += '"';
+  }
+  result += ']';
+  return result;
+}
@@ -0,0 +1,87 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PROTOCOLSTATS_H
+#define PROTOCOLSTATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Print.h>
+#include <WString.h>
+
+#ifndef RF_PROTOCOL_STATS_SIZE
+#define RF_PROTOCOL_STATS_SIZE 16
+#endif
+
+// Buckets are powers of two, starting with <64us and ending with >=4096us.
+#define RF_DECODE_HISTOGRAM_BUCKETS 8
+
+// Per-protocol decode hits and decode time histogram.
+//
+// The stats only observe the decoding.  ESPiLight runs every enabled
+// decoder on every pulse train and all matching protocols report their
+// code, so trying frequent protocols first would not save any time.  The
+// protocols ordered by hits are meant to choose the rfProtocols limitation,
+// which removes the decoders that never match.
+//
+// Pulse trains that are not decoded by any protocol are accounted to the
+// `unknown` entry.  Protocols beyond RF_PROTOCOL_STATS_SIZE are accounted
+// to the `other` entry.
+class ProtocolStats {
+ public:
+  static const int UNKNOWN = -1;
+
+  ProtocolStats();
+
+  // Index of the entry for protocol, to be passed to record().
+  int indexOf(const String &protocol);
+  void record(int index, unsigned long decodeMicros);
+  void reset();
+  void print(Print &output) const;
+  // JSON array of the decoded protocols, most frequent first.
+  String protocolsByHits() const;
+
+ private:
+  struct Entry {
+    String protocol;
+    uint32_t hits;
+    uint32_t histogram[RF_DECODE_HISTOGRAM_BUCKETS];
+  };
+
+  static void printEntry(Print &output, const Entry &entry);
+  size_t sortedIndices(uint8_t *indices) const;
+
+  Entry entries[RF_PROTOCOL_STATS_SIZE];
+  size_t used;
+  Entry other;
+  Entry unknown;
+};
+
+#endif  // PROTOCOLSTATS_H
@@ -0,0 +1,201 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <atomic>
+
+#include <Arduino.h>
+
+#include <ESPiLight.h>
+
+#include "PulseCapture.h"
+
+static_assert((RF_CAPTURE_BUFFER_SIZE & (RF_CAPTURE_BUFFER_SIZE - 1)) == 0,
+              "RF_CAPTURE_BUFFER_SIZE must be a power of two");
+static_assert(RF_CAPTURE_BUFFER_SIZE <= 32768,
+              "RF_CAPTURE_BUFFER_SIZE must fit the 16 bit ring indices");
+
+static const uint16_t BUFFER_MASK = RF_CAPTURE_BUFFER_SIZE - 1;
+
+void PulseCapture::begin(int8_t pin, uint16_t minPulseLength,
+                         uint16_t maxPulseLength) {
+  end();
+  this->minPulseLength = minPulseLength;
+  this->maxPulseLength = maxPulseLength;
+  receiverPin = pin;
+  reset();
+  enable();
+  interrupt = digitalPinToInterrupt(pin);
+  if (interrupt >= 0) {
+    attachInterruptArg(interrupt, interruptHandler, this, CHANGE);
+  }
+}
+
+void PulseCapture::end() {
+  if (interrupt >= 0) {
+    detachInterrupt(interrupt);
+    interrupt = -1;
+  }
+  enabled = false;
+}
+
+void PulseCapture::enable() {
+  noInterrupts();
+  // drop the pulse train that was interrupted by disable()
+  trainLength = 0;
+  trainOverflow = false;
+  lastChange = micros();
+  enabled = true;
+  interrupts();
+}
+
+void PulseCapture::disable() { enabled = false; }
+
+void PulseCapture::reset() {
+  noInterrupts();
+  tail = head;
+  trainLength = 0;
+  trainOverflow = false;
+  lastChange = micros();
+  interrupts();
+}
+
+size_t PulseCapture::receivePulseTrain(uint16_t *pulses) {
+  const uint16_t start = tail;
+  if (start == head) {
+    return 0;
+  }
+  // the pulse train is complete before head was advanced
+  std::atomic_signal_fence(std::memory_order_acquire);
+  const uint16_t length = buffer[start & BUFFER_MASK];
+  for (uint16_t i = 0; i < length; i++) {
+    pulses[i] = buffer[(start + 1 + i) & BUFFER_MASK];
+  }
+  std::atomic_signal_fence(std::memory_order_release);
+  tail = start + 1 + length;
+  return length;
+}
+
+bool PulseCapture::isReceiving(uint16_t minPulses,
+                               unsigned long idleMicros) const {
+  if (!enabled) {
+    return false;
+  }
+  const unsigned long now = micros();
+  if (now - lastTrainEnd < idleMicros) {
+    return true;
+  }
+  return trainLength >= minPulses && (now - lastChange) < idleMicros;
+}
+
+PulseCapture::Stats PulseCapture::stats() const {
+  return {captured, dropped, highWaterMark, RF_CAPTURE_BUFFER_SIZE,
+          rejectedShort, rejectedLong};
+}
+
+void PulseCapture::resetStats() {
+  noInterrupts();
+  captured = 0;
+  dropped = 0;
+  highWaterMark = 0;
+  rejectedShort = 0;
+  rejectedLong = 0;
+  interrupts();
+}
+
+void ICACHE_RAM_ATTR PulseCapture::pushPulse(uint16_t pulse) {
+  if (trainLength >= MAXPULSESTREAMLENGTH) {
+    // too long for any protocol, start over
+    trainLength = 0;
+    trainOverflow = false;
+    lastTrainEnd = lastChange;
+  }
+  // slot at head is reserved for the length of the pulse train
+  const uint16_t pos = head + 1 + trainLength;
+  if (static_cast<uint16_t>(pos - tail) >= RF_CAPTURE_BUFFER_SIZE) {
+    trainOverflow = true;
+  } else {
+    buffer[pos & BUFFER_MASK] = pulse;
+  }
+  trainLength++;
+}
+
+void ICACHE_RAM_ATTR PulseCapture::commitPulseTrain() {
+  if (trainOverflow) {
+    dropped++;
+    return;
+  }
+  const uint16_t start = head;
+  buffer[start & BUFFER_MASK] = trainLength;
+  std::atomic_signal_fence(std::memory_order_release);
+  head = start + 1 + trainLength;
+  captured++;
+  lastTrainEnd = lastChange;
+
+  const uint16_t used = head - tail;
+  if (used > highWaterMark) {
+    highWaterMark = used;
+  }
+}
+
+void ICACHE_RAM_ATTR PulseCapture::interruptHandler(void *capture) {
+  static_cast<PulseCapture *>(capture)->handleInterrupt();
+}
+
+void ICACHE_RAM_ATTR PulseCapture::handleInterrupt() {
+  if (!enabled) {
+    return;
+  }
+  const unsigned long now = micros();
+  const unsigned long duration = now - lastChange;
+
+  // glitches are merged into the following pulse
+  if (duration < minPulseLength) {
+    rejectedShort++;
+    return;
+  }
+  lastChange = now;
+  if (duration > maxPulseLength) {
+    rejectedLong++;
+    trainLength = 0;
+    trainOverflow = false;
+    return;
+  }
+
+  pushPulse(duration);
+  // the footer pulse terminates a pulse train, same limits as ESPiLight
+  if (duration > ESPiLight::mingaplen) {
+    if (duration < ESPiLight::maxgaplen &&
+        trainLength >= ESPiLight::minrawlen &&
+        trainLength <= ESPiLight::maxrawlen) {
+      commitPulseTrain();
+    }
+    trainLength = 0;
+    trainOverflow = false;
+  }
+}
@@ -0,0 +1,126 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PULSECAPTURE_H
+#define PULSECAPTURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef RF_CAPTURE_BUFFER_SIZE
+// Number of pulses the capture ring of every receiver can hold, must be a
+// power of two.  It takes two pulse trains of MAXPULSESTREAMLENGTH pulses,
+// with typical pulses of 300 to 1000 us loop() may stall for over 100 ms.
+#define RF_CAPTURE_BUFFER_SIZE 512
+#endif
+
+// Default limits of the glitch filter in microseconds, the configured ones
+// are passed to begin()
+#ifndef RF_CAPTURE_MIN_PULSELENGTH
+#define RF_CAPTURE_MIN_PULSELENGTH 40
+#endif
+
+#ifndef RF_CAPTURE_MAX_PULSELENGTH
+// pulses are stored as 16 bit values
+#define RF_CAPTURE_MAX_PULSELENGTH 65535
+#endif
+
+// Interrupt driven capture of pulse trains from one receiver pin.
+//
+// The interrupt handler measures the pulses on the receiver pin, frames them
+// into pulse trains by their footer gap and stores complete trains into a
+// single-producer/single-consumer ring.  The ring is drained from loop() by
+// receivePulseTrain().  Pulse trains that do not fit into the ring are
+// dropped and counted.  Pulses shorter than the minimum pulse length are
+// glitches and merged into the following pulse, pulses longer than the
+// maximum abort the current pulse train.  Both are rejected before any other
+// work is done and counted.
+class PulseCapture {
+ public:
+  struct Stats {
+    size_t captured;
+    size_t dropped;
+    size_t highWaterMark;  // in pulses
+    size_t capacity;       // in pulses
+    size_t rejectedShort;  // pulses below the minimum pulse length
+    size_t rejectedLong;   // pulses above the maximum pulse length
+  };
+
+  PulseCapture() = default;
+  PulseCapture(const PulseCapture &) = delete;
+  PulseCapture &operator=(const PulseCapture &) = delete;
+  ~PulseCapture() { end(); }
+
+  void begin(int8_t pin, uint16_t minPulseLength = RF_CAPTURE_MIN_PULSELENGTH,
+             uint16_t maxPulseLength = RF_CAPTURE_MAX_PULSELENGTH);
+  void end();
+  void enable();
+  void disable();
+  void reset();
+  bool isEnabled() const { return enabled; }
+  int8_t pin() const { return receiverPin; }
+  // True while something is on air: a pulse train ended less than
+  // idleMicros ago or at least minPulses pulses of a pulse train are
+  // received and its last edge is less than idleMicros ago.
+  bool isReceiving(uint16_t minPulses, unsigned long idleMicros) const;
+
+  // Copy the oldest pulse train to pulses, which must hold at least
+  // MAXPULSESTREAMLENGTH entries.  Returns 0 if the ring is empty.
+  size_t receivePulseTrain(uint16_t *pulses);
+  Stats stats() const;
+  void resetStats();
+
+ private:
+  static void interruptHandler(void *capture);
+  void handleInterrupt();
+  void pushPulse(uint16_t pulse);
+  void commitPulseTrain();
+
+  uint16_t buffer[RF_CAPTURE_BUFFER_SIZE];
+  // free running indices, masked on access
+  volatile uint16_t head = 0;
+  volatile uint16_t tail = 0;
+  volatile uint16_t trainLength = 0;
+  bool trainOverflow = false;
+  volatile unsigned long lastChange = 0;
+  volatile unsigned long lastTrainEnd = 0;
+  volatile bool enabled = false;
+  int8_t receiverPin = -1;
+  int8_t interrupt = -1;
+  uint16_t minPulseLength = RF_CAPTURE_MIN_PULSELENGTH;
+  uint16_t maxPulseLength = RF_CAPTURE_MAX_PULSELENGTH;
+
+  volatile size_t captured = 0;
+  volatile size_t dropped = 0;
+  volatile size_t highWaterMark = 0;
+  volatile size_t rejectedShort = 0;
+  volatile size_t rejectedLong = 0;
+};
+
+#endif  // PULSECAPTURE_H
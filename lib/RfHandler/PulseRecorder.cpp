@@ -0,0 +1,158 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <ArduinoSimpleLogging.h>
+
+#include "PulseRecorder.h"
+
+PulseRecorder::PulseRecorder() : lastFlush(millis()) {}
+
+PulseRecorder::~PulseRecorder() { flush(); }
+
+void PulseRecorder::record(const uint16_t *pulses, size_t length) {
+  unsigned long now = millis();
+  uint32_t gap = recorded ? now - lastRecord : 0;
+  if (!buffer.appendRecord(gap, pulses, length)) {
+    flush();
+    buffer.appendRecord(gap, pulses, length);
+  }
+  lastRecord = now;
+  recorded = true;
+}
+
+void PulseRecorder::loop() {
+  if ((millis() - lastFlush) > RF_RECORD_FLUSH_INTERVAL) {
+    flush();
+  }
+}
+
+void PulseRecorder::flush() {
+  lastFlush = millis();
+  if (buffer.size() == 0) return;
+
+  File file = SPIFFS.open(FPSTR(RF_RECORD_FILE), "a");
+  if (!file) {
+    Logger.error.println(F("Open RF recording file for write failed!"));
+    buffer.clear();
+    return;
+  }
+  if (file.write(buffer.data(), buffer.size()) != buffer.size()) {
+    Logger.error.println(F("Writing RF recording failed!"));
+  }
+  size_t size = file.size();
+  file.close();
+  buffer.clear();
+
+  if (size >= RF_RECORD_MAX_SIZE / 2) {
+    SPIFFS.remove(FPSTR(RF_RECORD_OLD_FILE));
+    SPIFFS.rename(FPSTR(RF_RECORD_FILE), FPSTR(RF_RECORD_OLD_FILE));
+  }
+}
+
+void PulseRecorder::download(Print &output) {
+  uint8_t chunk[256];
+  for (const char *path : {RF_RECORD_OLD_FILE, RF_RECORD_FILE}) {
+    File file = SPIFFS.open(FPSTR(path), "r");
+    if (!file) continue;
+    size_t length;
+    while ((length = file.read(chunk, sizeof(chunk))) > 0) {
+      output.write(chunk, length);
+    }
+    file.close();
+  }
+}
+
+void PulseRecorder::clear() {
+  SPIFFS.remove(FPSTR(RF_RECORD_OLD_FILE));
+  SPIFFS.remove(FPSTR(RF_RECORD_FILE));
+}
+
+PulseReplay::PulseReplay() : lastReplay(millis()) { openNextFile(); }
+
+PulseReplay::~PulseReplay() {
+  if (file) file.close();
+}
+
+bool PulseReplay::openNextFile() {
+  if (file) file.close();
+  while (nextFile < 2) {
+    const char *path = nextFile++ == 0 ? RF_RECORD_OLD_FILE : RF_RECORD_FILE;
+    file = SPIFFS.open(FPSTR(path), "r");
+    if (file) return true;
+  }
+  return false;
+}
+
+void PulseReplay::refill() {
+  if (!file) return;
+  memmove(buffer, buffer + pos, used - pos);
+  used -= pos;
+  pos = 0;
+  int length = file.read(buffer + used, sizeof(buffer) - used);
+  if (length > 0) used += length;
+}
+
+bool PulseReplay::decodeNext() {
+  while (true) {
+    // the recorder only writes whole records to a file, so a record that
+    // does not decode after a refill is corrupted
+    refill();
+    PulseStreamDecoder decoder(buffer + pos, used - pos);
+    pendingLength =
+        decoder.nextRecord(pendingGap, pending, MAXPULSESTREAMLENGTH);
+    if (pendingLength > 0) {
+      pos += decoder.position();
+      return true;
+    }
+    if (pendingLength < 0) {
+      Logger.error.println(F("RF recording is corrupted!"));
+      return false;
+    }
+    if (!openNextFile()) return false;
+  }
+}
+
+int PulseReplay::next(uint16_t *pulses) {
+  if (pendingLength <= 0 && !decodeNext()) {
+    return -1;
+  }
+  if ((millis() - lastReplay) <
+      std::min<uint32_t>(pendingGap, RF_REPLAY_MAX_GAP)) {
+    return 0;
+  }
+  lastReplay = millis();
+  memcpy(pulses, pending, pendingLength * sizeof(pending[0]));
+  int length = pendingLength;
+  pendingLength = 0;
+  return length;
+}
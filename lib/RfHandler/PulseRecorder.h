@@ -0,0 +1,112 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PULSERECORDER_H
+#define PULSERECORDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <FS.h>
+#include <Print.h>
+
+#include <ESPiLight.h>
+
+#include "PulseStream.h"
+
+const char PROGMEM RF_RECORD_FILE[] = "/rfrecord.bin";
+const char PROGMEM RF_RECORD_OLD_FILE[] = "/rfrecord.old";
+
+// Size of both recording files together
+#ifndef RF_RECORD_MAX_SIZE
+#define RF_RECORD_MAX_SIZE 65536
+#endif
+
+#ifndef RF_RECORD_FLUSH_INTERVAL
+#define RF_RECORD_FLUSH_INTERVAL 2000
+#endif
+
+// Longer gaps between recorded pulse trains are shortened on replay
+#ifndef RF_REPLAY_MAX_GAP
+#define RF_REPLAY_MAX_GAP 1000
+#endif
+
+// Records received pulse trains to SPIFFS.
+//
+// The recording is a sequence of PulseStreamEncoder records.  It is bounded
+// by rotating RF_RECORD_FILE to RF_RECORD_OLD_FILE when it exceeds half of
+// RF_RECORD_MAX_SIZE, so the most recent pulse trains are always kept.
+class PulseRecorder {
+ public:
+  PulseRecorder();
+  ~PulseRecorder();
+
+  void record(const uint16_t *pulses, size_t length);
+  void loop();
+
+  // Writes the recording, oldest pulse trains first.
+  static void download(Print &output);
+  static void clear();
+
+ private:
+  void flush();
+
+  PulseStreamEncoder buffer;
+  unsigned long lastRecord = 0;
+  unsigned long lastFlush;
+  bool recorded = false;
+};
+
+// Replays a recording made by PulseRecorder with its original timing.
+class PulseReplay {
+ public:
+  PulseReplay();
+  ~PulseReplay();
+
+  // Copies the next pulse train to pulses once it is due.  Returns its
+  // length, 0 if it is not due yet and -1 at the end of the recording.
+  int next(uint16_t *pulses);
+
+ private:
+  bool openNextFile();
+  void refill();
+  bool decodeNext();
+
+  File file;
+  uint8_t nextFile = 0;
+  uint8_t buffer[RF_STREAM_BUFFER_SIZE];
+  size_t used = 0;
+  size_t pos = 0;
+  uint16_t pending[MAXPULSESTREAMLENGTH];
+  int pendingLength = 0;
+  uint32_t pendingGap = 0;
+  unsigned long lastReplay;
+};
+
+#endif  // PULSERECORDER_H
@@ -0,0 +1,157 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <ESPiLight.h>
+
+#include "PulseStream.h"
+
+static_assert(RF_STREAM_BUFFER_SIZE >=
+                  PulseStreamEncoder::maxFrameSize(MAXPULSESTREAMLENGTH),
+              "RF_STREAM_BUFFER_SIZE must hold the longest pulse train");
+
+namespace {
+
+// The two most recent pulses of both levels, the most recent one first.
+// Codes mostly use a short and a long pulse per level, so one of both is
+// close to the next pulse of the same level.
+class PulsePredictor {
+ public:
+  // Slot of the reference closer to pulse, index is the pulse position.
+  uint8_t slot(size_t index, uint16_t pulse) const {
+    const uint16_t *level = recent[index & 1];
+    return distance(pulse, level[1]) < distance(pulse, level[0]) ? 1 : 0;
+  }
+  uint16_t reference(size_t index, uint8_t slot) const {
+    return recent[index & 1][slot];
+  }
+  void update(size_t index, uint8_t slot, uint16_t pulse) {
+    uint16_t *level = recent[index & 1];
+    if (slot == 1) {
+      level[1] = level[0];
+    }
+    level[0] = pulse;
+  }
+
+ private:
+  static uint16_t distance(uint16_t a, uint16_t b) {
+    return a > b ? a - b : b - a;
+  }
+
+  uint16_t recent[2][2] = {};
+};
+
+}  // namespace
+
+bool PulseStreamEncoder::append(const uint16_t *pulses, size_t length) {
+  if (used + maxFrameSize(length) > RF_STREAM_BUFFER_SIZE) {
+    return false;
+  }
+  putVarint(length);
+  PulsePredictor predictor;
+  for (size_t i = 0; i < length; i++) {
+    const uint8_t slot = predictor.slot(i, pulses[i]);
+    int32_t delta = static_cast<int32_t>(pulses[i]) -
+                    static_cast<int32_t>(predictor.reference(i, slot));
+    uint32_t zigzag = (static_cast<uint32_t>(delta) << 1) ^ (delta >> 31);
+    putVarint(zigzag << 1 | slot);
+    predictor.update(i, slot, pulses[i]);
+  }
+  return true;
+}
+
+bool PulseStreamEncoder::appendRecord(uint32_t gapMillis,
+                                      const uint16_t *pulses, size_t length) {
+  if (used + maxRecordSize(length) > RF_STREAM_BUFFER_SIZE) {
+    return false;
+  }
+  putVarint(gapMillis);
+  return append(pulses, length);
+}
+
+void PulseStreamEncoder::putVarint(uint32_t value) {
+  while (value >= 0x80) {
+    buffer[used++] = (value & 0x7f) | 0x80;
+    value >>= 7;
+  }
+  buffer[used++] = value;
+}
+
+int PulseStreamDecoder::next(uint16_t *pulses, size_t maxlength) {
+  if (pos >= size) return 0;
+  size_t start = pos;
+  uint32_t length;
+  if (!getVarint(length) || length == 0 || length > maxlength) {
+    pos = start;
+    return -1;
+  }
+  PulsePredictor predictor;
+  for (size_t i = 0; i < length; i++) {
+    uint32_t value;
+    if (!getVarint(value)) {
+      pos = start;
+      return -1;
+    }
+    const uint8_t slot = value & 1;
+    const uint32_t zigzag = value >> 1;
+    int32_t pulse = predictor.reference(i, slot) +
+                    static_cast<int32_t>((zigzag >> 1) ^ -(zigzag & 1));
+    if (pulse < 0 || pulse > UINT16_MAX) {
+      pos = start;
+      return -1;
+    }
+    pulses[i] = pulse;
+    predictor.update(i, slot, pulse);
+  }
+  return length;
+}
+
+int PulseStreamDecoder::nextRecord(uint32_t &gapMillis, uint16_t *pulses,
+                                   size_t maxlength) {
+  if (pos >= size) return 0;
+  size_t start = pos;
+  int length = -1;
+  if (getVarint(gapMillis)) {
+    length = next(pulses, maxlength);
+  }
+  if (length <= 0) {
+    pos = start;
+    return -1;
+  }
+  return length;
+}
+
+bool PulseStreamDecoder::getVarint(uint32_t &value) {
+  value = 0;
+  for (uint8_t shift = 0; shift < 32 && pos < size; shift += 7) {
+    uint8_t byte = data[pos++];
+    value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+    if (byte < 0x80) return true;
+  }
+  return false;
+}
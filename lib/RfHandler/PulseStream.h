@@ -0,0 +1,106 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PULSESTREAM_H
+#define PULSESTREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef RF_STREAM_BUFFER_SIZE
+#define RF_STREAM_BUFFER_SIZE 1024
+#endif
+
+// Compact binary encoding of pulse trains for raw streaming.
+//
+// Every pulse train is encoded as a frame: the number of pulses followed by
+// one value per pulse, all as unsigned LEB128 varints.  Each level (even
+// and odd pulses) keeps its two most recent pulses as references, both 0 at
+// the start of a frame.  A pulse is encoded as the zigzag encoded
+// difference to the closer reference shifted left by one, the lowest bit
+// selects the reference (0 the most recent one).  The pulse then becomes
+// the most recent reference of its level.  Codes mostly use a short and a
+// long pulse per level that differ from their reference by a few
+// microseconds, so most pulses take a single byte and, unlike RAW strings,
+// keep their exact length.  With receiver jitter this is about 1.1 to 1.3
+// bytes per pulse, close to the RAW string, but it takes a fraction of the
+// time to build on the device.  Frames are collected until the buffer is
+// full or flushed.
+// scripts/rawstream.py decodes the stream back into RAW strings.
+class PulseStreamEncoder {
+ public:
+  // Upper bound of the encoded size of a pulse train with length pulses.
+  static constexpr size_t maxFrameSize(size_t length) {
+    return 3 + 3 * length;
+  }
+
+  // Upper bound of the encoded size of a record with length pulses.
+  static constexpr size_t maxRecordSize(size_t length) {
+    return 5 + maxFrameSize(length);
+  }
+
+  // Returns false and leaves the buffer untouched if the frame does not fit.
+  bool append(const uint16_t *pulses, size_t length);
+  // Like append(), but preceded by the milliseconds since the previous
+  // pulse train, as used by recordings.
+  bool appendRecord(uint32_t gapMillis, const uint16_t *pulses,
+                    size_t length);
+  void clear() { used = 0; }
+  const uint8_t *data() const { return buffer; }
+  size_t size() const { return used; }
+
+ private:
+  void putVarint(uint32_t value);
+
+  uint8_t buffer[RF_STREAM_BUFFER_SIZE];
+  size_t used = 0;
+};
+
+// Decodes frames or records written by PulseStreamEncoder.
+class PulseStreamDecoder {
+ public:
+  PulseStreamDecoder(const uint8_t *data, size_t size)
+      : data(data), size(size) {}
+
+  // Decodes the next frame into pulses.  Returns the number of pulses, 0 at
+  // the end of the data and -1 for a truncated or invalid frame.
+  int next(uint16_t *pulses, size_t maxlength);
+  // Decodes the next record into gapMillis and pulses, returns like next().
+  int nextRecord(uint32_t &gapMillis, uint16_t *pulses, size_t maxlength);
+  size_t position() const { return pos; }
+
+ private:
+  bool getVarint(uint32_t &value);
+
+  const uint8_t *data;
+  size_t size;
+  size_t pos = 0;
+};
+
+#endif  // PULSESTREAM_H
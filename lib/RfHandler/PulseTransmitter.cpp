@@ -0,0 +1,189 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <atomic>
+
+#include <Arduino.h>
+
+#include "PulseTransmitter.h"
+
+static_assert((RF_TRANSMIT_BUFFER_SIZE & (RF_TRANSMIT_BUFFER_SIZE - 1)) == 0,
+              "RF_TRANSMIT_BUFFER_SIZE must be a power of two");
+static_assert(RF_TRANSMIT_BUFFER_SIZE <= 32768,
+              "RF_TRANSMIT_BUFFER_SIZE must fit the 16 bit queue indices");
+
+static const uint16_t BUFFER_MASK = RF_TRANSMIT_BUFFER_SIZE - 1;
+
+// timer1 runs with 80 MHz / 16
+static const uint32_t TICKS_PER_MICROSECOND = 5;
+// delay until the interrupt starts the first pulse train
+static const uint32_t START_TICKS = 10 * TICKS_PER_MICROSECOND;
+
+PulseTransmitter *PulseTransmitter::active = nullptr;
+
+void PulseTransmitter::begin(int8_t pin) {
+  end();
+  outputPin = pin;
+  if (outputPin < 0) {
+    return;
+  }
+  pinMode(outputPin, OUTPUT);
+  digitalWrite(outputPin, LOW);
+  active = this;
+  timer1_attachInterrupt(timerHandler);
+  timer1_enable(TIM_DIV16, TIM_EDGE, TIM_SINGLE);
+}
+
+void PulseTransmitter::end() {
+  if (active != this) {
+    return;
+  }
+  timer1_disable();
+  timer1_detachInterrupt();
+  active = nullptr;
+  transmitting = false;
+  if (outputPin >= 0) {
+    digitalWrite(outputPin, LOW);
+  }
+  // drop everything not yet on air
+  head = sent;
+}
+
+bool PulseTransmitter::send(const uint16_t *pulses, size_t length,
+                            uint16_t repeats) {
+  if (active != this || length == 0 || repeats == 0) {
+    return false;
+  }
+  const uint16_t start = head;
+  const uint16_t used = start - tail;
+  if (used + HEADER_SIZE + length > RF_TRANSMIT_BUFFER_SIZE) {
+    dropped++;
+    return false;
+  }
+  buffer[start & BUFFER_MASK] = length;
+  buffer[(start + 1) & BUFFER_MASK] = repeats;
+  for (size_t i = 0; i < length; i++) {
+    buffer[(start + HEADER_SIZE + i) & BUFFER_MASK] = pulses[i];
+  }
+  std::atomic_signal_fence(std::memory_order_release);
+  head = start + HEADER_SIZE + length;
+  queued++;
+  if (static_cast<uint16_t>(head - tail) > highWaterMark) {
+    highWaterMark = static_cast<uint16_t>(head - tail);
+  }
+  return true;
+}
+
+bool PulseTransmitter::canSend(size_t length) const {
+  const uint16_t used = head - tail;
+  return active == this &&
+         used + HEADER_SIZE + length <= RF_TRANSMIT_BUFFER_SIZE;
+}
+
+void PulseTransmitter::start() {
+  if (active != this) {
+    return;
+  }
+  noInterrupts();
+  if (!transmitting && sent != head) {
+    // the interrupt handler stopped, sent points to the next pulse train
+    transmitting = true;
+    loadPulseTrain();
+    timer1_write(START_TICKS);
+  }
+  interrupts();
+}
+
+bool PulseTransmitter::nextCompleted(Completion &completion) {
+  const uint16_t start = tail;
+  if (start == sent) {
+    return false;
+  }
+  std::atomic_signal_fence(std::memory_order_acquire);
+  completion.length = buffer[start & BUFFER_MASK];
+  completion.repeats = buffer[(start + 1) & BUFFER_MASK];
+  completion.onAirMicros =
+      buffer[(start + 2) & BUFFER_MASK] |
+      static_cast<uint32_t>(buffer[(start + 3) & BUFFER_MASK]) << 16;
+  tail = start + HEADER_SIZE + completion.length;
+  transmitted++;
+  return true;
+}
+
+PulseTransmitter::Stats PulseTransmitter::stats() const {
+  return {transmitted, dropped, highWaterMark, RF_TRANSMIT_BUFFER_SIZE};
+}
+
+void PulseTransmitter::resetStats() {
+  transmitted = 0;
+  dropped = 0;
+  highWaterMark = 0;
+}
+
+void ICACHE_RAM_ATTR PulseTransmitter::timerHandler() {
+  if (active) {
+    active->handleTimer();
+  }
+}
+
+void ICACHE_RAM_ATTR PulseTransmitter::loadPulseTrain() {
+  length = buffer[sent & BUFFER_MASK];
+  repeats = buffer[(sent + 1) & BUFFER_MASK];
+  repeat = 0;
+  index = 0;
+  started = micros();
+}
+
+void ICACHE_RAM_ATTR PulseTransmitter::handleTimer() {
+  if (!transmitting) {
+    return;
+  }
+  if (index == length) {
+    index = 0;
+    if (++repeat == repeats) {
+      digitalWrite(outputPin, LOW);
+      const uint32_t onAir = micros() - started;
+      buffer[(sent + 2) & BUFFER_MASK] = onAir;
+      buffer[(sent + 3) & BUFFER_MASK] = onAir >> 16;
+      std::atomic_signal_fence(std::memory_order_release);
+      sent = sent + HEADER_SIZE + length;
+      completed++;
+      if (sent == head) {
+        // the timer is single shot, it stays stopped until start()
+        transmitting = false;
+        return;
+      }
+      loadPulseTrain();
+    }
+  }
+  digitalWrite(outputPin, (index & 1) ? LOW : HIGH);
+  timer1_write(buffer[(sent + HEADER_SIZE + index) & BUFFER_MASK] *
+               TICKS_PER_MICROSECOND);
+  index++;
+}
@@ -0,0 +1,129 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef PULSETRANSMITTER_H
+#define PULSETRANSMITTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef RF_TRANSMIT_BUFFER_SIZE
+// Number of 16 bit words the transmit queue can hold, must be a power of two.
+#define RF_TRANSMIT_BUFFER_SIZE 1024
+#endif
+
+#ifndef RF_TRANSMIT_REPEATS
+// Same default as ESPiLight::send()
+#define RF_TRANSMIT_REPEATS 10
+#endif
+
+// Interrupt driven transmission of pulse trains.
+//
+// send() copies a pulse train into a queue and returns immediately, start()
+// begins the transmission of the queue.  The pulses are emitted by the timer1
+// interrupt, which toggles the transmitter
+// pin like ESPiLight::sendPulseTrain() does: high for the even and low for
+// the odd pulses, every pulse train repeated the requested number of times.
+// Pulse trains queued during a transmission follow without another start().
+// Finished transmissions stay in the queue with their measured on-air time
+// until they are collected by nextCompleted() from loop().  As timer1 has a
+// single interrupt handler, only one instance can be active.
+class PulseTransmitter {
+ public:
+  struct Stats {
+    size_t transmitted;    // pulse trains
+    size_t dropped;        // queue full
+    size_t highWaterMark;  // in words
+    size_t capacity;       // in words
+  };
+
+  struct Completion {
+    uint16_t length;
+    uint16_t repeats;
+    uint32_t onAirMicros;
+  };
+
+  PulseTransmitter() = default;
+  PulseTransmitter(const PulseTransmitter &) = delete;
+  PulseTransmitter &operator=(const PulseTransmitter &) = delete;
+  ~PulseTransmitter() { end(); }
+
+  void begin(int8_t pin);
+  void end();
+  // Returns false if the pulse train does not fit into the queue.
+  bool send(const uint16_t *pulses, size_t length,
+            uint16_t repeats = RF_TRANSMIT_REPEATS);
+  // True if a pulse train with length pulses fits into the queue.
+  bool canSend(size_t length) const;
+  // Starts the transmission of the queued pulse trains if idle.
+  void start();
+  bool isBusy() const { return transmitting; }
+  // True if queued pulse trains wait for their transmission.
+  bool isPending() const { return head != sent; }
+  // Number of queued pulse trains, including the one on air.
+  size_t depth() const { return queued - completed; }
+  // Returns false if no transmission finished since the last call.
+  bool nextCompleted(Completion &completion);
+  Stats stats() const;
+  void resetStats();
+
+ private:
+  static void timerHandler();
+  void handleTimer();
+  void loadPulseTrain();
+
+  // every queued pulse train starts with length, repeats and the on-air
+  // time (two words) followed by the pulses
+  static const uint16_t HEADER_SIZE = 4;
+  static PulseTransmitter *active;
+
+  uint16_t buffer[RF_TRANSMIT_BUFFER_SIZE];
+  // free running indices, masked on access: the loop appends at head, the
+  // interrupt transmits at sent, the loop collects completions at tail
+  volatile uint16_t head = 0;
+  volatile uint16_t sent = 0;
+  uint16_t tail = 0;
+  int8_t outputPin = -1;
+  volatile bool transmitting = false;
+
+  // state of the interrupt handler
+  uint16_t length = 0;
+  uint16_t repeats = 0;
+  uint16_t repeat = 0;
+  uint16_t index = 0;
+  unsigned long started = 0;
+
+  size_t queued = 0;
+  volatile size_t completed = 0;
+  size_t dropped = 0;
+  size_t highWaterMark = 0;
+  size_t transmitted = 0;
+};
+
+#endif  // PULSETRANSMITTER_H
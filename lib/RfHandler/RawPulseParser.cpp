@@ -0,0 +1,146 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include "RawPulseParser.h"
+
+void RawPulseParser::reset() {
+  length = 0;
+  typeCount = 0;
+  value = 0;
+  hasValue = false;
+  hasCodes = false;
+  hasTypes = false;
+  state = SECTION;
+  error = 0;
+}
+
+void RawPulseParser::parse(const uint8_t *data, size_t size) {
+  for (size_t i = 0; i < size && state != DONE && !error; i++) {
+    parseChar(static_cast<char>(data[i]));
+  }
+}
+
+void RawPulseParser::parseChar(char c) {
+  switch (state) {
+    case SECTION:
+      if (c == '@') {
+        state = DONE;
+      } else if (c != ';' && c != ' ' && c != '\r' && c != '\n') {
+        section = c;
+        state = SECTION_COLON;
+      }
+      break;
+    case SECTION_COLON:
+      if (c != ':') {
+        state = SKIP;
+      } else if (section == 'c') {
+        hasCodes = true;
+        length = 0;
+        state = CODES;
+      } else if (section == 'p') {
+        hasTypes = true;
+        typeCount = 0;
+        state = PULSE_TYPES;
+      } else {
+        state = SKIP;
+      }
+      break;
+    case CODES:
+      if (c == ';' || c == '@') {
+        endSection(c);
+      } else if (c < '0' || c > '9') {
+        error = ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_TYPE;
+      } else if (length < maxLength) {
+        pulses[length++] = c - '0';
+      }
+      break;
+    case PULSE_TYPES:
+      if (c >= '0' && c <= '9') {
+        value = value * 10 + (c - '0');
+        if (value > UINT16_MAX) {
+          value = UINT16_MAX;
+        }
+        hasValue = true;
+      } else if (c == ',') {
+        addPulseType();
+      } else if (c == ';' || c == '@') {
+        addPulseType();
+        endSection(c);
+      } else {
+        error = ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_P;
+      }
+      break;
+    case SKIP:
+      if (c == ';' || c == '@') {
+        endSection(c);
+      }
+      break;
+    case DONE:
+      break;
+  }
+}
+
+void RawPulseParser::endSection(char c) {
+  state = c == '@' ? DONE : SECTION;
+}
+
+void RawPulseParser::addPulseType() {
+  if (!hasValue) {
+    error = ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_P;
+  } else if (typeCount == MAX_PULSE_TYPES) {
+    error = ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_TYPE;
+  } else {
+    types[typeCount++] = value;
+  }
+  value = 0;
+  hasValue = false;
+}
+
+int RawPulseParser::finish() {
+  if (error) {
+    return error;
+  }
+  if (state == PULSE_TYPES || state == SECTION_COLON) {
+    // like stringToPulseTrain(), the pulse types must be terminated
+    return ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_END;
+  }
+  if (!hasCodes || length == 0) {
+    return ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_C;
+  }
+  if (!hasTypes || typeCount == 0) {
+    return ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_P;
+  }
+  for (size_t i = 0; i < length; i++) {
+    if (pulses[i] >= typeCount) {
+      return ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_TYPE;
+    }
+    pulses[i] = types[pulses[i]];
+  }
+  return length;
+}
@@ -0,0 +1,82 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef RAWPULSEPARSER_H
+#define RAWPULSEPARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ESPiLight.h>
+
+// Incremental parser of RAW pulse train messages like
+// "c:0101010102;p:300,900,10000@", the format of
+// ESPiLight::stringToPulseTrain().
+//
+// The message can be fed in arbitrary chunks straight from the received
+// bytes, no copy of the message is needed.  The pulse type indices of the
+// "c:" section are stored in the output buffer while parsing and replaced by
+// the pulse lengths of the "p:" section by finish(), so the sections may come
+// in any order.  Other sections, e.g. "r:", are skipped, everything after
+// '@' is ignored.  Like stringToPulseTrain(), codes beyond the buffer size
+// are dropped.
+class RawPulseParser {
+ public:
+  RawPulseParser(uint16_t *pulses, size_t maxLength)
+      : pulses(pulses), maxLength(maxLength) {}
+
+  void reset();
+  void parse(const uint8_t *data, size_t length);
+  // Returns the number of pulses or one of the
+  // ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_* codes.  The parser must be
+  // reset() before the next message.
+  int finish();
+
+ private:
+  enum State { SECTION, SECTION_COLON, CODES, PULSE_TYPES, SKIP, DONE };
+
+  void parseChar(char c);
+  void endSection(char c);
+  void addPulseType();
+
+  uint16_t *pulses;
+  size_t maxLength;
+  size_t length = 0;
+  uint16_t types[MAX_PULSE_TYPES];
+  uint8_t typeCount = 0;
+  uint32_t value = 0;
+  bool hasValue = false;
+  bool hasCodes = false;
+  bool hasTypes = false;
+  char section = 0;
+  State state = SECTION;
+  int error = 0;
+};
+
+#endif  // RAWPULSEPARSER_H
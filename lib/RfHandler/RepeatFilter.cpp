@@ -0,0 +1,149 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <Arduino.h>
+
+#include "RepeatFilter.h"
+
+static_assert((RF_REPEAT_CACHE_SIZE & (RF_REPEAT_CACHE_SIZE - 1)) == 0,
+              "RF_REPEAT_CACHE_SIZE must be a power of two");
+static_assert(RF_REPEAT_CACHE_PROBES <= RF_REPEAT_CACHE_SIZE,
+              "RF_REPEAT_CACHE_PROBES exceeds RF_REPEAT_CACHE_SIZE");
+
+static const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+// FNV-1a, the terminating zero is hashed to separate the fields
+static uint32_t hashString(uint32_t hash, const String &str) {
+  const char *c = str.c_str();
+  do {
+    hash = (hash ^ static_cast<uint8_t>(*c)) * FNV_PRIME;
+  } while (*c++);
+  return hash;
+}
+
+static uint32_t nonZero(uint32_t hash) { return hash ? hash : 1; }
+
+RepeatFilter::RepeatFilter(uint16_t window, uint16_t heartbeat)
+    : window(window), heartbeat(heartbeat * 1000UL), codes(), devices() {
+  resetStats();
+}
+
+void RepeatFilter::resetStats() { _stats = {0, 0, 0}; }
+
+RepeatFilter::Entry &RepeatFilter::lookup(Entry *cache, uint32_t key,
+                                          unsigned long now,
+                                          unsigned long maxAge) {
+  Entry *candidate = nullptr;
+  bool candidateFree = false;
+  for (size_t i = 0; i < RF_REPEAT_CACHE_PROBES; i++) {
+    Entry &entry = cache[(key + i) & (RF_REPEAT_CACHE_SIZE - 1)];
+    if (entry.key == key) {
+      return entry;
+    }
+    if (candidateFree) {
+      continue;
+    }
+    // prefer empty or expired slots, otherwise evict the oldest entry
+    const bool reusable = entry.key == 0 || (now - entry.published) > maxAge;
+    if (reusable || !candidate ||
+        (now - entry.published) > (now - candidate->published)) {
+      candidate = &entry;
+      candidateFree = reusable;
+    }
+  }
+  if (!candidateFree) {
+    _stats.evictions++;
+  }
+  candidate->key = key;
+  candidate->value = 0;
+  candidate->published = now - maxAge - 1;
+  return *candidate;
+}
+
+bool RepeatFilter::check(const String &protocol, const String &deviceID,
+                         const String &message) {
+  if (!isEnabled()) {
+    return true;
+  }
+  const unsigned long now = millis();
+  const uint32_t deviceHash =
+      hashString(hashString(FNV_OFFSET_BASIS, protocol), deviceID);
+  const uint32_t messageHash = nonZero(hashString(FNV_OFFSET_BASIS, message));
+  bool publish = true;
+
+  Entry *code = nullptr;
+  if (window > 0) {
+    code = &lookup(codes, nonZero(hashString(deviceHash, message)), now,
+                   window);
+    if ((now - code->published) < window) {
+      publish = false;
+    }
+  }
+  Entry *device = nullptr;
+  if (heartbeat > 0) {
+    device = &lookup(devices, nonZero(deviceHash), now, heartbeat);
+    if (device->value == messageHash &&
+        (now - device->published) < heartbeat) {
+      publish = false;
+    }
+  }
+
+  if (publish) {
+    _stats.misses++;
+    if (code) code->published = now;
+    if (device) {
+      device->value = messageHash;
+      device->published = now;
+    }
+  } else {
+    _stats.hits++;
+  }
+  return publish;
+}
+
+PilightRepeatStatus_t RepeatCounter::check(const String &protocol,
+                                           const String &message) {
+  const unsigned long now = millis();
+  const uint32_t key =
+      nonZero(hashString(hashString(FNV_OFFSET_BASIS, protocol), message));
+  Entry *oldest = &entries[0];
+  for (Entry &entry : entries) {
+    if (entry.key == key && (now - entry.received) < RF_REPEAT_COUNTER_WINDOW) {
+      entry.received = now;
+      entry.repeats++;
+      return entry.repeats == 1 ? VALID : KNOWN;
+    }
+    if (entry.key == 0 || (now - entry.received) > (now - oldest->received)) {
+      oldest = &entry;
+    }
+  }
+  *oldest = {key, now, 0};
+  return FIRST;
+}
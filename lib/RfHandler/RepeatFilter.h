@@ -0,0 +1,125 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef REPEATFILTER_H
+#define REPEATFILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <WString.h>
+
+#include <ESPiLight.h>
+
+#ifndef RF_REPEAT_CACHE_SIZE
+// Number of entries per cache, must be a power of two.
+#define RF_REPEAT_CACHE_SIZE 32
+#endif
+
+#ifndef RF_REPEAT_CACHE_PROBES
+#define RF_REPEAT_CACHE_PROBES 8
+#endif
+
+#ifndef RF_REPEAT_COUNTER_SIZE
+#define RF_REPEAT_COUNTER_SIZE 4
+#endif
+
+// Maximal time in milliseconds between two receptions of a repeated code
+#ifndef RF_REPEAT_COUNTER_WINDOW
+#define RF_REPEAT_COUNTER_WINDOW 500
+#endif
+
+// Suppresses repeated publishing of received codes.
+//
+// Identical codes (same protocol, deviceID and message) are suppressed
+// within `window` milliseconds after they were published.  If `heartbeat`
+// is set, a device's code is also suppressed as long as its message did not
+// change, but at least once every `heartbeat` seconds it is published.
+// Both caches are fixed-size open-addressing hash tables; when no slot is
+// free, the oldest probed entry is evicted.
+class RepeatFilter {
+ public:
+  struct Stats {
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+  };
+
+  RepeatFilter(uint16_t window, uint16_t heartbeat);
+
+  // Returns true if the code should be published.
+  bool check(const String &protocol, const String &deviceID,
+             const String &message);
+  bool isEnabled() const { return window > 0 || heartbeat > 0; }
+  const Stats &stats() const { return _stats; }
+  void resetStats();
+
+ private:
+  struct Entry {
+    uint32_t key;  // 0 marks an empty slot
+    uint32_t value;
+    unsigned long published;
+  };
+
+  Entry &lookup(Entry *cache, uint32_t key, unsigned long now,
+                unsigned long maxAge);
+
+  const unsigned long window;
+  const unsigned long heartbeat;
+  Entry codes[RF_REPEAT_CACHE_SIZE];
+  Entry devices[RF_REPEAT_CACHE_SIZE];
+  Stats _stats;
+};
+
+// Repeat detection of a single receiver.
+//
+// ESPiLight tracks the repeats of a code per protocol, shared by everything
+// that is decoded.  With multiple receivers, the repeats are counted per
+// receiver instead, so a code is only valid if one receiver got it twice.
+// The last RF_REPEAT_COUNTER_SIZE codes are remembered, because a pulse train
+// can be decoded by more than one protocol.
+class RepeatCounter {
+ public:
+  RepeatCounter() : entries() {}
+
+  // Returns FIRST for a new code, VALID for its first repeat and KNOWN for
+  // further repeats, like ESPiLight does.
+  PilightRepeatStatus_t check(const String &protocol, const String &message);
+
+ private:
+  struct Entry {
+    uint32_t key;  // 0 marks an empty slot
+    unsigned long received;
+    size_t repeats;
+  };
+
+  Entry entries[RF_REPEAT_COUNTER_SIZE];
+};
+
+#endif  // REPEATFILTER_H
@@ -26,94 +26,855 @@
   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
   SOFTWARE.
 */
+#include <algorithm>
+
 #include <ArduinoSimpleLogging.h>
 
 #include "RfHandler.h"
 
+// Copy of a message that is not null terminated
+class MessageString : public String {
+ public:
+  MessageString(const char *data, size_t length) : String() {
+    if (reserve(length)) {
+      setLen(length);
+      memcpy(wbuffer(), data, length);
+      wbuffer()[length] = 0;
+    }
+  }
+};
+
+// Returns true if the JSON array protocols contains protocol, an empty array
+// contains all protocols.
+static bool containsProtocol(const String &protocols, const String &protocol) {
+  if (protocols.length() <= 2) {
+    return true;
+  }
+  const size_t length = protocol.length();
+  const char *found = protocols.c_str();
+  // the array starts with '[', so found[-1] is always valid
+  while ((found = strstr(found, protocol.c_str())) != nullptr) {
+    if (found[-1] == '"' && found[length] == '"') {
+      return true;
+    }
+    found += length;
+  }
+  return false;
+}
+
 RfHandler::RfHandler(const Settings &settings)
-    : settings(settings), rf(settings.rfTransmitterPin) {
+    : settings(settings),
+      repeatFilter(settings.rfRepeatWindow, settings.rfRepeatHeartbeat),
+      airtime(settings.rfDutyCycle),
+      rf(settings.rfTransmitterPin) {
   rf.setErrorOutput(Logger.error);
+  if (settings.rfTransmitterPin >= 0) {
+    transmitter = new PulseTransmitter();
+    scheduler = new TransmitScheduler();
+    setTransmitPriorities(settings.rfTransmitPriorities);
+  }
+  if (settings.rfUnknownInterval > 0) {
+    unknownSignals = new UnknownSignals();
+  }
+  if (0 < settings.rfReceiverPin) {
+    addReceiver(settings.rfReceiverPin, settings.rfReceiverPinPullUp,
+                settings.rfProtocols);
+    hasPrimaryReceiver = true;
+  }
+  addReceivers(settings.rfReceivers);
+  if (receiverCount > 1) {
+    receiverMerge = new RepeatFilter(RF_RECEIVER_MERGE_WINDOW, 0);
+  }
 }
 
-RfHandler::~RfHandler() { rf.initReceiver(-1); }
+RfHandler::~RfHandler() {
+  for (size_t i = 0; i < receiverCount; i++) {
+    delete receivers[i];
+  }
+  delete receiverMerge;
+  delete recorder;
+  delete replay;
+  delete unknownSignals;
+  delete verifier;
+  delete macro;
+  delete scheduler;
+  delete transmitter;
+  delete transmitCache;
+  delete rawStream;
+}
 
-void RfHandler::transmitCode(const String &protocol, const String &message) {
-  int result = 0;
+void RfHandler::addReceiver(int8_t pin, bool pullUp, const String &protocols) {
+  if (receiverCount == RF_MAX_RECEIVERS) {
+    Logger.error.print(F("Too many RF receivers, ignore receiver on pin "));
+    Logger.error.println(pin);
+    return;
+  }
+  for (size_t i = 0; i < receiverCount; i++) {
+    if (receivers[i]->pin == pin) {
+      Logger.error.print(F("RF receiver pin used twice: "));
+      Logger.error.println(pin);
+      return;
+    }
+  }
+  Receiver *receiver = new Receiver();
+  receiver->pin = pin;
+  receiver->pullUp = pullUp;
+  receiver->protocols = protocols;
+  receivers[receiverCount++] = receiver;
+}
+
+void RfHandler::addReceivers(const String &config) {
+  DynamicJsonDocument jsonDoc(RF_RECEIVERS_JSON_DOC_SIZE);
+  DeserializationError error = deserializeJson(jsonDoc, config);
+  if (error) {
+    Logger.error.print(F("Invalid rfReceivers: "));
+    Logger.error.println(error.c_str());
+    return;
+  }
+  for (JsonObject receiver : jsonDoc.as<JsonArray>()) {
+    int8_t pin = receiver["pin"] | -1;
+    if (pin <= 0) {
+      Logger.error.println(F("Ignore RF receiver without valid pin."));
+      continue;
+    }
+    String protocols(FPSTR(DEFAULT_RF_PROTOCOLS));
+    if (!receiver["protocols"].isNull()) {
+      protocols = "";
+      serializeJson(receiver["protocols"], protocols);
+    }
+    addReceiver(pin, receiver["pullUp"] | false, protocols);
+  }
+}
+
+void RfHandler::setTransmitPriorities(const String &config) {
+  DynamicJsonDocument jsonDoc(RF_PRIORITIES_JSON_DOC_SIZE);
+  DeserializationError error = deserializeJson(jsonDoc, config);
+  if (error) {
+    Logger.error.print(F("Invalid rfTransmitPriorities: "));
+    Logger.error.println(error.c_str());
+    return;
+  }
+  for (JsonPair priority : jsonDoc.as<JsonObject>()) {
+    if (!scheduler->setPriority(priority.key().c_str(),
+                               std::min(std::max(priority.value() | 0, 0),
+                                        255))) {
+      Logger.error.print(F("Too many transmit priorities, ignore "));
+      Logger.error.println(priority.key().c_str());
+    }
+  }
+}
+
+// Without a transmitter there is no scheduler, nothing gets transmitted.
+uint8_t RfHandler::transmitPriority(const char *protocol) const {
+  return scheduler ? scheduler->priority(protocol) : 0;
+}
+
+// ESPiLight decodes the protocols of all receivers, the codes are filtered
+// per receiver in onRfCode().
+String RfHandler::decodedProtocols() const {
+  String result('[');
+  for (size_t i = 0; i < receiverCount; i++) {
+    const String &protocols = receivers[i]->protocols;
+    if (protocols.length() <= 2) {
+      return FPSTR(DEFAULT_RF_PROTOCOLS);
+    }
+    int start;
+    int end = -1;
+    while ((start = protocols.indexOf('"', end + 1)) >= 0 &&
+           (end = protocols.indexOf('"', start + 1)) > start) {
+      String name = protocols.substring(start, end + 1);
+      if (result.indexOf(name) < 0) {
+        if (result.length() > 1) {
+          result += ',';
+        }
+        result += name;
+      }
+    }
+  }
+  result += ']';
+  return result;
+}
+
+// Add the receiver pin as first member to the JSON object message
+bool RfHandler::tagMessage(const String &message) {
+  if (message.length() < 2 || message[0] != '{') {
+    return false;
+  }
+  const char *members = message.c_str() + 1;
+  int length =
+      snprintf(taggedMessage, sizeof(taggedMessage), "{\"receiver\":%d%s%s",
+               currentReceiver->pin, *members == '}' ? "" : ",", members);
+  return length >= 0 && static_cast<size_t>(length) < sizeof(taggedMessage);
+}
+
+void RfHandler::transmitCode(const char *protocol, const char *message,
+                             size_t length) {
+  if (strcmp_P(protocol, PSTR(RF_BATCH_PROTOCOL)) == 0) {
+    transmitBatch(message, length);
+    return;
+  }
+  const uint8_t priority = transmitPriority(protocol);
+  const size_t prefixLength = strlen(RF_MACRO_PREFIX);
+  if (strncmp_P(protocol, PSTR(RF_MACRO_PREFIX), prefixLength) == 0) {
+    playMacro(protocol + prefixLength, priority);
+    return;
+  }
 
   Logger.info.print(F("transmit rf signal "));
-  Logger.info.print(message);
+  Logger.info.write(reinterpret_cast<const uint8_t *>(message), length);
   Logger.info.print(F(" with protocol "));
   Logger.info.println(protocol);
+  const int pulses = encodePulseTrain(protocol, message, length);
+  const uint32_t key =
+      pulses > 0 ? scheduleTransmit(transmitPulses, pulses, priority) : 0;
+  if (verifier) {
+    verifier->expect(key, protocol, message, length);
+  }
+  if (key != 0) {
+    releaseScheduled();
+  }
+}
+
+// Reads a {"protocol": ..., "message": ...} object of a batch or macro,
+// returns the protocol or nullptr if one of both is missing.
+static const char *readTransmitCommand(JsonObject command, String &message) {
+  const char *protocol = command["protocol"] | "";
+  JsonVariant content = command["message"];
+  if (!*protocol || content.isNull()) {
+    return nullptr;
+  }
+  message = "";
+  if (content.is<const char *>()) {
+    message = content.as<const char *>();
+  } else {
+    serializeJson(content, message);
+  }
+  return protocol;
+}
+
+// A batch is a JSON array of {"protocol": ..., "message": ...} objects with
+// an optional "priority".  All codes are scheduled at once, so they follow
+// each other on air without gaps other than their footers and the receiver
+// is suspended only once.  The last code is tagged with the pending batch
+// to time the completion.
+void RfHandler::transmitBatch(const char *batch, size_t length) {
+  const unsigned long start = millis();
+  DynamicJsonDocument jsonDoc(RF_BATCH_JSON_DOC_SIZE);
+  DeserializationError error = deserializeJson(jsonDoc, batch, length);
+  if (error) {
+    Logger.error.print(F("invalid transmit batch: "));
+    Logger.error.println(error.c_str());
+    return;
+  }
+  JsonArray entries = jsonDoc.as<JsonArray>();
+  if (entries.isNull()) {
+    Logger.error.println(F("invalid transmit batch: not a JSON array"));
+    return;
+  }
 
-  if (protocol == F("RAW")) {
-    uint16_t rawpulses[MAXPULSESTREAMLENGTH];
-    int rawlen =
-        rf.stringToPulseTrain(message, rawpulses, MAXPULSESTREAMLENGTH);
-    if (rawlen > 0) {
-      rf.sendPulseTrain(rawpulses, rawlen);
-      result = rawlen;
+  String message;
+  uint32_t lastKey = 0;
+  size_t queued = 0;
+  size_t failed = 0;
+  for (JsonObject entry : entries) {
+    const char *protocol = readTransmitCommand(entry, message);
+    if (!protocol || strcmp_P(protocol, PSTR(RF_BATCH_PROTOCOL)) == 0) {
+      Logger.error.println(
+          F("transmit batch entry without protocol or message"));
+      failed++;
+      continue;
+    }
+    Logger.info.print(F("transmit rf signal "));
+    Logger.info.print(message);
+    Logger.info.print(F(" with protocol "));
+    Logger.info.println(protocol);
+    const int priority =
+        entry["priority"] | static_cast<int>(transmitPriority(protocol));
+    const int pulses =
+        encodePulseTrain(protocol, message.c_str(), message.length());
+    const uint32_t key =
+        pulses > 0 ? scheduleTransmit(transmitPulses, pulses,
+                                      std::min(std::max(priority, 0), 255))
+                   : 0;
+    if (verifier) {
+      verifier->expect(key, protocol, message.c_str(), message.length());
+    }
+    if (key == 0) {
+      failed++;
     } else {
-      Logger.error.print(F("invalid pulse train message: "));
-      switch (rawlen) {
-        case ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_C:
-          Logger.error.println(F("'c' not found in string, or has no data"));
-          break;
-        case ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_P:
-          Logger.error.println(F("'p' not found in string, or has no data"));
-          break;
-        case ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_END:
-          Logger.error.println(F("';' or '@' not found in data string"));
-          break;
-        case ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_TYPE:
-          Logger.error.println(F("pulse type not defined"));
-          break;
+      queued++;
+      lastKey = key;
+    }
+  }
+
+  Logger.info.print(F("queued transmit batch of "));
+  Logger.info.print(queued);
+  Logger.info.print(F(" codes, "));
+  Logger.info.print(failed);
+  Logger.info.println(F(" failed"));
+  if (queued == 0) {
+    return;
+  }
+  size_t slot = 0;
+  while (slot < RF_PENDING_BATCHES && pendingBatches[slot].codes > 0) {
+    slot++;
+  }
+  // the last code may be merged into a code of another batch
+  if (slot == RF_PENDING_BATCHES || !scheduler->tag(lastKey, slot + 1)) {
+    Logger.debug.println(F("transmit batch completion not timed"));
+  } else {
+    PendingBatch &pending = pendingBatches[slot];
+    pending.started = start;
+    pending.codes = queued;
+    pending.released = false;
+    pendingBatchCount++;
+  }
+  releaseScheduled();
+}
+
+bool RfHandler::storeMacro(const String &name, const String &definition) {
+  if (!MacroStore::isValidName(name)) {
+    Logger.error.print(F("Invalid transmit macro name: "));
+    Logger.error.println(name);
+    return false;
+  }
+  DynamicJsonDocument jsonDoc(RF_BATCH_JSON_DOC_SIZE);
+  DeserializationError error = deserializeJson(jsonDoc, definition);
+  if (error) {
+    Logger.error.print(F("Invalid transmit macro: "));
+    Logger.error.println(error.c_str());
+    return false;
+  }
+  JsonArray steps = jsonDoc.as<JsonArray>();
+  if (steps.isNull() || steps.size() == 0) {
+    Logger.error.println(F("Invalid transmit macro: no steps"));
+    return false;
+  }
+
+  MacroStore store(name, definition);
+  String message;
+  for (JsonObject step : steps) {
+    const char *protocol = readTransmitCommand(step, message);
+    if (!protocol) {
+      Logger.error.println(
+          F("Invalid transmit macro: step without protocol or message"));
+      return false;
+    }
+    const int delayMillis = step["delay"] | 0;
+    const int length =
+        encodePulseTrain(protocol, message.c_str(), message.length());
+    if (length <= 0 ||
+        !store.addStep(std::min(std::max(delayMillis, 0), 65535),
+                       transmitPulses, length)) {
+      Logger.error.print(F("Cannot store transmit macro step: "));
+      Logger.error.println(message);
+      return false;
+    }
+  }
+  if (!store.commit()) {
+    Logger.error.println(F("Cannot store transmit macro."));
+    return false;
+  }
+  Logger.info.print(F("Stored transmit macro "));
+  Logger.info.print(name);
+  Logger.info.print(F(" with "));
+  Logger.info.print(steps.size());
+  Logger.info.println(F(" steps."));
+  return true;
+}
+
+void RfHandler::playMacro(const String &name, uint8_t priority) {
+  delete macro;
+  macro = nullptr;
+  if (settings.rfTransmitterPin < 0) {
+    Logger.error.println(F("transmitting failed: no transmitter pin"));
+    return;
+  }
+  MacroPlayer *player =
+      MacroStore::isValidName(name) ? new MacroPlayer(name) : nullptr;
+  if (!player || !player->isValid()) {
+    Logger.error.print(F("Unknown transmit macro: "));
+    Logger.error.println(name);
+    delete player;
+    return;
+  }
+  Logger.info.print(F("play transmit macro "));
+  Logger.info.println(name);
+  macro = player;
+  macroPriority = priority;
+  macroIdleSince = millis();
+  handleMacro();
+}
+
+// Steps are scheduled as soon as they fit into the scheduler, a step with a
+// delay once the codes before are transmitted and the delay passed.
+void RfHandler::handleMacro() {
+  while (macro) {
+    if (macro->delayMillis() > 0) {
+      if (transmitter->depth() > 0 || scheduler->depth() > 0) {
+        macroIdleSince = millis();
+        return;
+      }
+      if (millis() - macroIdleSince < macro->delayMillis()) {
+        return;
       }
+    }
+    if (!scheduler->canAdd(macro->pulseCount())) {
       return;
     }
+    scheduleTransmit(macro->pulses(), macro->pulseCount(), macroPriority);
+    releaseScheduled();
+    if (!macro->next()) {
+      Logger.debug.println(F("transmit macro finished"));
+      delete macro;
+      macro = nullptr;
+    }
+  }
+}
+
+String RfHandler::downloadMacro(const String &name) {
+  if (name.length() == 0) {
+    return MacroStore::list();
+  }
+  return MacroStore::isValidName(name) ? MacroStore::definition(name)
+                                       : String();
+}
+
+bool RfHandler::removeMacro(const String &name) {
+  Logger.info.print(F("Remove transmit macro "));
+  Logger.info.println(name);
+  return MacroStore::remove(name);
+}
+
+void RfHandler::transmitRaw(const uint8_t *data, size_t length,
+                            size_t offset, size_t total) {
+  if (offset == 0) {
+    Logger.info.print(F("transmit rf signal "));
+    rawParser.reset();
+  }
+  Logger.info.write(data, length);
+  rawParser.parse(data, length);
+  if (offset + length < total) {
+    return;
+  }
+  Logger.info.println(F(" with protocol RAW"));
+
+  const int result = finishRawPulseTrain();
+  const uint32_t key =
+      result > 0 && checkPulseTrain(result) > 0
+          ? scheduleTransmit(transmitPulses, result, transmitPriority("RAW"))
+          : 0;
+  if (verifier) {
+    // only a message received at once is at hand for the acknowledgement
+    verifier->expect(key, "RAW",
+                     offset == 0 ? reinterpret_cast<const char *>(data) : "",
+                     offset == 0 ? length : 0);
+  }
+  if (key != 0) {
+    releaseScheduled();
+  }
+}
+
+// Encodes into transmitPulses, returns the number of pulses or 0 on errors.
+int RfHandler::encodePulseTrain(const char *protocol, const char *message,
+                                size_t length) {
+  int result;
+  if (strcmp_P(protocol, PSTR("RAW")) == 0) {
+    // parsing is as fast as a cache lookup
+    result =
+        parseRawPulseTrain(reinterpret_cast<const uint8_t *>(message), length);
+    return result > 0 ? checkPulseTrain(result) : 0;
+  }
+
+  // without a transmitter pin the encoding fails anyway, nothing to cache
+  if (!transmitCache && settings.rfTransmitterPin >= 0) {
+    transmitCache = new TransmitCache();
+  }
+  const uint32_t cacheKey = TransmitCache::key(protocol, message, length);
+  const unsigned long start = micros();
+  result = transmitCache ? transmitCache->lookup(cacheKey, transmitPulses) : 0;
+  if (result > 0) {
+    Logger.debug.println(F("pulse train taken from transmit cache"));
   } else {
-    result = rf.send(protocol, message);
+    // ESPiLight takes Strings, only a cache miss pays for the copies
+    result = rf.createPulseTrain(transmitPulses, String(protocol),
+                                 MessageString(message, length));
+    if (result > 0 && transmitCache) {
+      transmitCache->insert(cacheKey, transmitPulses, result,
+                            micros() - start);
+    }
+  }
+  return checkPulseTrain(result);
+}
+
+// Parses into transmitPulses, returns the number of pulses or 0 on errors.
+int RfHandler::parseRawPulseTrain(const uint8_t *data, size_t length) {
+  rawParser.reset();
+  rawParser.parse(data, length);
+  return finishRawPulseTrain();
+}
+
+int RfHandler::finishRawPulseTrain() {
+  const int result = rawParser.finish();
+  if (result > 0) {
+    return result;
+  }
+  Logger.error.print(F("invalid pulse train message: "));
+  switch (result) {
+    case ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_C:
+      Logger.error.println(F("'c' not found in string, or has no data"));
+      break;
+    case ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_P:
+      Logger.error.println(F("'p' not found in string, or has no data"));
+      break;
+    case ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_END:
+      Logger.error.println(F("';' or '@' not found in data string"));
+      break;
+    case ESPiLight::ERROR_INVALID_PULSETRAIN_MSG_TYPE:
+      Logger.error.println(F("pulse type not defined"));
+      break;
   }
+  return 0;
+}
 
+// Returns the length of a transmittable pulse train, otherwise logs the error
+// and returns 0.
+int RfHandler::checkPulseTrain(int result) {
+  if (result > 0 && settings.rfTransmitterPin < 0) {
+    result = ESPiLight::ERROR_NO_OUTPUT_PIN;
+  }
   if (result > 0) {
-    Logger.debug.print(F("transmitted pulse train with "));
-    Logger.debug.print(result);
-    Logger.debug.println(F(" pulses"));
+    return result;
+  }
+  Logger.error.print(F("transmitting failed: "));
+  switch (result) {
+    case ESPiLight::ERROR_UNAVAILABLE_PROTOCOL:
+      Logger.error.println(F("protocol is not avaiable"));
+      break;
+    case ESPiLight::ERROR_INVALID_PILIGHT_MSG:
+      Logger.error.println(F("message is invalid"));
+      break;
+    case ESPiLight::ERROR_INVALID_JSON:
+      Logger.error.println(F("message is not a proper json object"));
+      break;
+    case ESPiLight::ERROR_NO_OUTPUT_PIN:
+      Logger.error.println(F("no transmitter pin"));
+      break;
+  }
+  return 0;
+}
+
+// Returns the key of the scheduled pulse train or 0 if it was dropped.
+uint32_t RfHandler::scheduleTransmit(const uint16_t *pulses, size_t length,
+                                     uint8_t priority) {
+  const size_t waiting = scheduler->depth();
+  const uint32_t key = scheduler->add(pulses, length, priority);
+  if (key == 0) {
+    Logger.error.println(F("transmit scheduler full, rf signal dropped"));
+  } else if (scheduler->depth() == waiting) {
+    Logger.debug.println(F("rf signal merged into an identical waiting one"));
+  }
+  return key;
+}
+
+// Hands scheduled pulse trains to the transmitter while the airtime budget
+// allows, the budget is charged with the estimated airtime.
+void RfHandler::releaseScheduled() {
+  uint8_t tag;
+  while (scheduler->expire(tag)) {
+    Logger.error.println(F("rf signal waited too long, dropped"));
+    if (tag > 0) {
+      releaseBatch(tag, false);
+    }
+  }
+  size_t length;
+  const uint16_t *pulses;
+  while (transmitter->depth() < RF_SCHEDULER_TRANSMIT_DEPTH &&
+         (pulses = scheduler->peek(length, tag)) != nullptr) {
+    const uint32_t estimate =
+        AirtimeBudget::estimate(pulses, length, RF_TRANSMIT_REPEATS);
+    if (!airtime.allows(estimate)) {
+      if (!airtimeExhausted) {
+        airtimeExhausted = true;
+        Logger.warning.println(
+            F("rf airtime budget exhausted, transmissions delayed"));
+        publishAirtime();
+      }
+      return;
+    }
+    airtimeExhausted = false;
+    const bool queued = queuePulseTrain(pulses, length);
+    if (queued) {
+      airtime.add(estimate);
+      if (verifier) {
+        verifier->transmitting(transmitSequence, pulses, length);
+      }
+    }
+    if (tag > 0) {
+      releaseBatch(tag, queued);
+    }
+    scheduler->pop();
+  }
+}
+
+// The last code of the batch tagged with tag left the scheduler, the
+// completion is not timed if it was dropped.
+void RfHandler::releaseBatch(uint8_t tag, bool queued) {
+  PendingBatch &pending = pendingBatches[tag - 1];
+  if (queued) {
+    pending.released = true;
+    pending.lastSequence = transmitSequence;
   } else {
-    Logger.error.print(F("transmitting failed: "));
-    switch (result) {
-      case ESPiLight::ERROR_UNAVAILABLE_PROTOCOL:
-        Logger.error.println(F("protocol is not avaiable"));
-        break;
-      case ESPiLight::ERROR_INVALID_PILIGHT_MSG:
-        Logger.error.println(F("message is invalid"));
-        break;
-      case ESPiLight::ERROR_INVALID_JSON:
-        Logger.error.println(F("message is not a proper json object"));
-        break;
-      case ESPiLight::ERROR_NO_OUTPUT_PIN:
-        Logger.error.println(F("no transmitter pin"));
-        break;
+    pending.codes = 0;
+    pendingBatchCount--;
+  }
+}
+
+bool RfHandler::queuePulseTrain(const uint16_t *pulses, size_t length) {
+  if (!transmitter->send(pulses, length)) {
+    Logger.error.println(F("transmit queue full, rf signal dropped"));
+    return false;
+  }
+  transmitSequence++;
+  Logger.debug.print(F("queued pulse train with "));
+  Logger.debug.print(length);
+  Logger.debug.print(F(" pulses, transmit queue depth "));
+  Logger.debug.println(transmitter->depth());
+  if (transmitActive) {
+    // the channel is ours until the queue ran empty
+    transmitter->start();
+  } else if (!transmitDeferred) {
+    startTransmitter();
+  }
+  return true;
+}
+
+bool RfHandler::isChannelBusy() const {
+  for (size_t i = 0; i < receiverCount; i++) {
+    if (receivers[i]->capture.isReceiving(RF_LBT_MIN_PULSES,
+                                          RF_LBT_IDLE_TIME)) {
+      return true;
     }
   }
+  return false;
+}
+
+void RfHandler::startTransmitter() {
+  const unsigned long now = millis();
+  if (settings.rfListenBeforeTalk && isChannelBusy()) {
+    if (!transmitDeferred) {
+      transmitDeferred = true;
+      transmitWaitStart = now;
+    }
+    if (now - transmitWaitStart < RF_LBT_MAX_WAIT) {
+      transmitDeferrals++;
+      transmitBackoffUntil =
+          now + random(RF_LBT_BACKOFF_MIN, RF_LBT_BACKOFF_MAX + 1);
+      Logger.debug.println(F("rf channel busy, transmission deferred"));
+      return;
+    }
+    transmitForced++;
+    Logger.warning.println(F("rf channel still busy, transmitting anyway"));
+  }
+  if (transmitDeferred) {
+    transmitDeferred = false;
+    transmitWaitMillis += now - transmitWaitStart;
+  }
+  // the receiver stays suspended until the queue ran empty
+  receiverStateBeforeTransmit = suspendReceiver();
+  transmitActive = true;
+  transmitter->start();
+}
+
+void RfHandler::handleTransmitter() {
+  if (!transmitter) {
+    return;
+  }
+  PulseTransmitter::Completion completion;
+  while (transmitter->nextCompleted(completion)) {
+    Logger.debug.print(F("transmitted pulse train with "));
+    Logger.debug.print(completion.length);
+    Logger.debug.print(F(" pulses "));
+    Logger.debug.print(completion.repeats);
+    Logger.debug.print(F(" times, on air "));
+    Logger.debug.print(completion.onAirMicros / 1000);
+    Logger.debug.println(F(" ms"));
+    completedSequence++;
+    if (verifier) {
+      verifier->transmitted(completedSequence);
+    }
+    if (pendingBatchCount > 0) {
+      completeBatch();
+    }
+  }
+  if (transmitActive && !transmitter->isBusy()) {
+    if (transmitter->isPending()) {
+      // queued while the interrupt handler stopped
+      transmitter->start();
+    } else {
+      transmitActive = false;
+      resumeReceiver(receiverStateBeforeTransmit);
+    }
+  }
+  if (transmitDeferred &&
+      static_cast<long>(millis() - transmitBackoffUntil) >= 0) {
+    startTransmitter();
+  }
+}
+
+// A batch is complete with the transmission of its last code.
+void RfHandler::completeBatch() {
+  for (PendingBatch &pending : pendingBatches) {
+    if (pending.codes == 0 || !pending.released ||
+        pending.lastSequence != completedSequence) {
+      continue;
+    }
+    const unsigned long duration = millis() - pending.started;
+    Logger.info.print(F("transmit batch of "));
+    Logger.info.print(pending.codes);
+    Logger.info.print(F(" codes completed in "));
+    Logger.info.print(duration);
+    Logger.info.println(F(" ms"));
+    batchesTransmitted++;
+    batchMillisTotal += duration;
+    if (duration > batchMillisMax) {
+      batchMillisMax = duration;
+    }
+    pending.codes = 0;
+    pendingBatchCount--;
+    return;
+  }
+}
+
+// Publishes {"message": ..., "verified": true, "latency": <ms>} or
+// {"message": ..., "verified": false} as ack of the protocol per command.
+void RfHandler::publishVerifications() {
+  TransmitVerifier::Result result;
+  char payload[RF_VERIFY_MESSAGE_SIZE + 64];
+  while (verifier->nextResult(result)) {
+    int length;
+    if (*result.message == '{' || *result.message == '[') {
+      length = snprintf(payload, sizeof(payload), "{\"message\":%s",
+                        result.message);
+    } else if (*result.message && !strpbrk(result.message, "\"\\")) {
+      length = snprintf(payload, sizeof(payload), "{\"message\":\"%s\"",
+                        result.message);
+    } else {
+      length = snprintf(payload, sizeof(payload), "{\"message\":null");
+    }
+    if (result.verified) {
+      snprintf(payload + length, sizeof(payload) - length,
+               ",\"verified\":true,\"latency\":%lu}", result.latency);
+      Logger.debug.print(F("rf transmission verified: "));
+      Logger.debug.println(payload);
+    } else {
+      snprintf(payload + length, sizeof(payload) - length,
+               ",\"verified\":false}");
+      Logger.warning.print(F("rf transmission not verified: "));
+      Logger.warning.println(payload);
+    }
+    if (onAckCallback) {
+      onAckCallback(result.protocol, payload);
+    }
+  }
+}
+
+void RfHandler::publishAirtime() {
+  const uint32_t used = airtime.used();
+  char payload[96];
+  snprintf(payload, sizeof(payload),
+           "{\"used\":%lu,\"budget\":%lu,\"window\":%u,\"waiting\":%u}",
+           static_cast<unsigned long>(used),
+           static_cast<unsigned long>(airtime.budget()),
+           static_cast<unsigned>(RF_AIRTIME_WINDOW),
+           static_cast<unsigned>(scheduler ? scheduler->depth() : 0));
+  Logger.debug.print(F("rf airtime: "));
+  Logger.debug.println(payload);
+  reportedAirtime = used;
+  lastAirtimeReport = millis();
+  if (onStatsCallback) {
+    onStatsCallback("airtime", payload);
+  }
+}
+
+bool RfHandler::suspendReceiver() {
+  bool receiverState = receiverCount > 0 && receivers[0]->capture.isEnabled();
+  // like ESPiLight, only receive the own transmission for echo or to verify it
+  if (!echoEnabled && !verifier) {
+    disableReceiver();
+  }
+  return receiverState;
+}
+
+void RfHandler::resumeReceiver(bool receiverState) {
+  if (receiverState) {
+    enableReceiver();
+  }
 }
 
 void RfHandler::onRfCode(const String &protocol, const String &message,
                          int status, size_t repeats, const String &deviceID) {
+  if (statsMode && decodedProtocol == ProtocolStats::UNKNOWN) {
+    decodedProtocol = protocolStats.indexOf(protocol);
+  }
   if (!onReceiveCallback) return;
 
+  const bool multipleReceivers = currentReceiver && receiverCount > 1;
+  if (multipleReceivers) {
+    if (!containsProtocol(currentReceiver->protocols, protocol)) {
+      return;
+    }
+    // the repeats counted by ESPiLight mix all receivers
+    status = currentReceiver->repeats.check(protocol, message);
+  }
+
   if (status == VALID) {
+    if (!repeatFilter.check(protocol, deviceID, message)) {
+      Logger.debug.print(F("rf signal suppressed as repeat: "));
+      Logger.debug.print(message);
+      Logger.debug.print(F(" with protocol "));
+      Logger.debug.println(protocol);
+      return;
+    }
+    if (receiverMerge && !receiverMerge->check(protocol, deviceID, message)) {
+      Logger.debug.print(F("rf signal merged with other receiver: "));
+      Logger.debug.print(message);
+      Logger.debug.print(F(" with protocol "));
+      Logger.debug.println(protocol);
+      return;
+    }
     Logger.info.print(F("rf signal received: "));
     Logger.info.print(message);
     Logger.info.print(F(" with protocol "));
     Logger.info.print(protocol);
+    int length;
     if (deviceID != nullptr) {
       Logger.info.print(F(" deviceID="));
       Logger.info.println(deviceID);
-      onReceiveCallback(protocol + "/" + deviceID, message);
+      length = snprintf(topicPart, sizeof(topicPart), "%s/%s",
+                        protocol.c_str(), deviceID.c_str());
     } else {
       Logger.info.println(deviceID);
-      onReceiveCallback(protocol, message);
+      length = snprintf(topicPart, sizeof(topicPart), "%s", protocol.c_str());
+    }
+    if (length < 0 || static_cast<size_t>(length) >= sizeof(topicPart)) {
+      Logger.error.print(F("rf signal dropped, protocol/deviceID exceeds "));
+      Logger.error.print(sizeof(topicPart) - 1);
+      Logger.error.println(F(" characters"));
+      return;
+    }
+    const char *payload = message.c_str();
+    if (multipleReceivers) {
+      if (!tagMessage(message)) {
+        Logger.error.print(F("rf signal dropped, message with receiver "
+                             "exceeds "));
+        Logger.error.print(sizeof(taggedMessage) - 1);
+        Logger.error.println(F(" characters"));
+        return;
+      }
+      payload = taggedMessage;
     }
+    onReceiveCallback(topicPart, payload);
   } else {
     Logger.debug.print(F("rf signal received: "));
     Logger.debug.print(message);
@@ -129,6 +890,10 @@ void RfHandler::onRfCode(const String &protocol, const String &message,
 }
 
 void RfHandler::onRfRaw(const uint16_t *pulses, size_t length) {
+  if (rawStream && !rawStream->append(pulses, length)) {
+    flushRawStream();
+    rawStream->append(pulses, length);
+  }
   if (rawMode) {
     String data = rf.pulseTrainToString(pulses, length);
     if (data.length() > 0) {
@@ -140,35 +905,405 @@ void RfHandler::onRfRaw(const uint16_t *pulses, size_t length) {
   }
 }
 
+void RfHandler::flushRawStream() {
+  if (rawStream->size() > 0 && onRawStreamCallback) {
+    onRawStreamCallback(rawStream->data(), rawStream->size());
+  }
+  rawStream->clear();
+}
+
 void RfHandler::begin() {
-  if (0 < settings.rfReceiverPin) {
+  if (receiverCount > 0) {
     using namespace std::placeholders;
-    if (settings.rfReceiverPinPullUp) {
+    rf.setCallback([this](const String &protocol, const String &message,
+                          int status, size_t repeats, const String &deviceID) {
+      unsigned long start = micros();
+      decoded = true;
+      onRfCode(protocol, message, status, repeats, deviceID);
+      callbackMicros += micros() - start;
+    });
+    rf.setPulseTrainCallBack(std::bind(&RfHandler::onRfRaw, this, _1, _2));
+  }
+  if (transmitter) {
+    transmitter->begin(settings.rfTransmitterPin);
+  }
+  for (size_t i = 0; i < receiverCount; i++) {
+    Receiver *receiver = receivers[i];
+    if (receiver->pullUp) {
       // 5V protection with reverse diode needs pullup
-      pinMode(settings.rfReceiverPin, INPUT_PULLUP);
+      pinMode(receiver->pin, INPUT_PULLUP);
     }
-    rf.setCallback(std::bind(&RfHandler::onRfCode, this, _1, _2, _3, _4, _5));
-    rf.setPulseTrainCallBack(std::bind(&RfHandler::onRfRaw, this, _1, _2));
-    rf.initReceiver(settings.rfReceiverPin);
+    receiver->capture.begin(receiver->pin, settings.rfReceiverPulseMin,
+                            settings.rfReceiverPulseMax);
+  }
+}
+
+void RfHandler::enableReceiver() {
+  for (size_t i = 0; i < receiverCount; i++) {
+    receivers[i]->capture.enable();
+  }
+}
+
+void RfHandler::disableReceiver() {
+  for (size_t i = 0; i < receiverCount; i++) {
+    receivers[i]->capture.disable();
+  }
+}
+
+void RfHandler::setEchoEnabled(bool enabled) {
+  echoEnabled = enabled;
+  rf.setEchoEnabled(enabled);
+}
+
+void RfHandler::setVerifyEnabled(bool enabled) {
+  if (enabled && !verifier) {
+    Logger.info.println(F("Verify RF transmissions."));
+    verifier = new TransmitVerifier();
+  } else if (!enabled && verifier) {
+    delete verifier;
+    verifier = nullptr;
+  }
+}
+
+void RfHandler::setRawStreamMode(bool mode) {
+  if (mode && !rawStream) {
+    rawStream = new PulseStreamEncoder();
+  } else if (!mode && rawStream) {
+    delete rawStream;
+    rawStream = nullptr;
   }
 }
 
-void RfHandler::enableReceiver() { rf.enableReceiver(); }
+void RfHandler::setRecordMode(bool mode) {
+  if (mode && !recorder) {
+    if (replay) {
+      Logger.warning.println(F("Cannot record RF signals during replay."));
+      return;
+    }
+    Logger.info.println(F("Start recording RF signals."));
+    recorder = new PulseRecorder();
+  } else if (!mode && recorder) {
+    Logger.info.println(F("Stop recording RF signals."));
+    delete recorder;
+    recorder = nullptr;
+  }
+}
+
+void RfHandler::startReplay() {
+  setRecordMode(false);
+  delete replay;
+  Logger.info.println(F("Start replaying recorded RF signals."));
+  replay = new PulseReplay();
+}
+
+void RfHandler::downloadRecording(Print &output) {
+  PulseRecorder::download(output);
+}
 
-void RfHandler::disableReceiver() { rf.disableReceiver(); }
+void RfHandler::clearRecording() {
+  Logger.info.println(F("Clear RF recording."));
+  PulseRecorder::clear();
+}
 
-void RfHandler::setEchoEnabled(bool enabled) { rf.setEchoEnabled(enabled); }
+void RfHandler::setStatsMode(bool mode) {
+  statsMode = mode;
+  lastStats = millis();
+  for (size_t i = 0; i < receiverCount; i++) {
+    receivers[i]->capture.resetStats();
+  }
+  if (transmitter) {
+    transmitter->resetStats();
+  }
+  transmitDeferrals = 0;
+  batchesTransmitted = 0;
+  batchMillisTotal = 0;
+  batchMillisMax = 0;
+  transmitForced = 0;
+  transmitWaitMillis = 0;
+  if (transmitCache) {
+    transmitCache->resetStats();
+  }
+  if (scheduler) {
+    scheduler->resetStats();
+  }
+  if (verifier) {
+    verifier->resetStats();
+  }
+  repeatFilter.resetStats();
+  if (receiverMerge) {
+    receiverMerge->resetStats();
+  }
+  protocolStats.reset();
+}
 
 void RfHandler::filterProtocols(const String &protocols) {
-  rf.limitProtocols(protocols);
+  if (hasPrimaryReceiver) {
+    receivers[0]->protocols = protocols;
+  }
+  rf.limitProtocols(receiverCount > 0 ? decodedProtocols() : protocols);
+}
+
+PulseCapture::Stats RfHandler::captureStats() const {
+  PulseCapture::Stats sum = {0, 0, 0, RF_CAPTURE_BUFFER_SIZE, 0, 0};
+  for (size_t i = 0; i < receiverCount; i++) {
+    const PulseCapture::Stats stats = receivers[i]->capture.stats();
+    sum.captured += stats.captured;
+    sum.dropped += stats.dropped;
+    sum.highWaterMark = std::max(sum.highWaterMark, stats.highWaterMark);
+    sum.rejectedShort += stats.rejectedShort;
+    sum.rejectedLong += stats.rejectedLong;
+  }
+  return sum;
 }
 
 String RfHandler::availableProtocols() {
   return ESPiLight::availableProtocols();
 }
 
-void RfHandler::loop() { rf.loop(); }
+void RfHandler::loop() {
+  size_t length;
+  // drain the capture rings, pulse trains may pile up while loop() was busy
+  for (size_t i = 0; i < receiverCount; i++) {
+    currentReceiver = receivers[i];
+    PulseCapture &capture = receivers[i]->capture;
+    while ((length = capture.receivePulseTrain(receivedPulses)) > 0) {
+      if (recorder) {
+        recorder->record(receivedPulses, length);
+      }
+      // the own transmission is only decoded for echo
+      if (verifier &&
+          (verifier->match(receivedPulses, length) || transmitActive) &&
+          !echoEnabled) {
+        continue;
+      }
+      parsePulseTrain(receivedPulses, length);
+    }
+  }
+  currentReceiver = nullptr;
+  if (replay) {
+    int replayed = replay->next(receivedPulses);
+    if (replayed > 0) {
+      parsePulseTrain(receivedPulses, replayed);
+    } else if (replayed < 0) {
+      Logger.info.println(F("RF replay finished."));
+      delete replay;
+      replay = nullptr;
+    }
+  }
+  handleTransmitter();
+  if (macro) {
+    handleMacro();
+  }
+  if (scheduler && scheduler->depth() > 0) {
+    releaseScheduled();
+  }
+  if (verifier) {
+    publishVerifications();
+  }
+  if (millis() - lastAirtimeReport > RF_AIRTIME_REPORT_INTERVAL &&
+      airtime.used() != reportedAirtime) {
+    publishAirtime();
+  }
+  if (rawStream) {
+    flushRawStream();
+  }
+  if (recorder) {
+    recorder->loop();
+  }
+
+  if (unknownSignals && (millis() - lastUnknownReport) >
+                            settings.rfUnknownInterval * 1000UL) {
+    publishUnknownSignals();
+    lastUnknownReport = millis();
+  }
+
+  if (statsMode && (millis() - lastStats) > RF_STATS_INTERVAL) {
+    logStats();
+    lastStats = millis();
+  }
+}
+
+void RfHandler::parsePulseTrain(uint16_t *pulses, size_t length) {
+  decoded = false;
+  if (statsMode) {
+    // the decode time of a pulse train, without the time spent in the
+    // callbacks, is accounted to the first protocol reporting a code
+    decodedProtocol = ProtocolStats::UNKNOWN;
+    callbackMicros = 0;
+    unsigned long start = micros();
+    rf.parsePulseTrain(pulses, length);
+    protocolStats.record(decodedProtocol, micros() - start - callbackMicros);
+  } else {
+    rf.parsePulseTrain(pulses, length);
+  }
+  if (!decoded && unknownSignals) {
+    unknownSignals->add(pulses, length);
+  }
+}
+
+void RfHandler::publishUnknownSignals() {
+  char name[16];
+  char payload[RF_UNKNOWN_PAYLOAD_SIZE];
+  for (size_t rank = 0; rank < RF_UNKNOWN_TOP_N; rank++) {
+    if (!unknownSignals->describe(rank, payload, sizeof(payload))) {
+      continue;
+    }
+    snprintf(name, sizeof(name), "unknown/%u",
+             static_cast<unsigned>(rank + 1));
+    Logger.debug.print(F("unknown rf signal: "));
+    Logger.debug.println(payload);
+    if (onStatsCallback) {
+      onStatsCallback(name, payload);
+    }
+  }
+}
+
+void RfHandler::logStats() {
+  for (size_t i = 0; i < receiverCount; i++) {
+    const PulseCapture::Stats capture = receivers[i]->capture.stats();
+    Logger.info.print(F("RF capture pin "));
+    Logger.info.print(receivers[i]->pin);
+    Logger.info.print(F(": captured="));
+    Logger.info.print(capture.captured);
+    Logger.info.print(F(" dropped="));
+    Logger.info.print(capture.dropped);
+    Logger.info.print(F(" high water mark="));
+    Logger.info.print(capture.highWaterMark);
+    Logger.info.print(F("/"));
+    Logger.info.print(capture.capacity);
+    Logger.info.print(F(" pulses, rejected pulses: short="));
+    Logger.info.print(capture.rejectedShort);
+    Logger.info.print(F(" long="));
+    Logger.info.println(capture.rejectedLong);
+  }
+  if (receiverMerge) {
+    Logger.info.print(F("RF receivers: merged duplicates="));
+    Logger.info.println(receiverMerge->stats().hits);
+  }
+
+  if (transmitter) {
+    const PulseTransmitter::Stats transmit = transmitter->stats();
+    Logger.info.print(F("RF transmit queue: transmitted="));
+    Logger.info.print(transmit.transmitted);
+    Logger.info.print(F(" dropped="));
+    Logger.info.print(transmit.dropped);
+    Logger.info.print(F(" depth="));
+    Logger.info.print(transmitter->depth());
+    Logger.info.print(F(" high water mark="));
+    Logger.info.print(transmit.highWaterMark);
+    Logger.info.print(F("/"));
+    Logger.info.print(transmit.capacity);
+    Logger.info.println(F(" words"));
+  }
+
+  if (scheduler) {
+    const TransmitScheduler::Stats schedule = scheduler->stats();
+    Logger.info.print(F("RF transmit scheduler: scheduled="));
+    Logger.info.print(schedule.scheduled);
+    Logger.info.print(F(" merged="));
+    Logger.info.print(schedule.merged);
+    Logger.info.print(F(" dropped="));
+    Logger.info.print(schedule.dropped);
+    Logger.info.print(F(" expired="));
+    Logger.info.print(schedule.expired);
+    Logger.info.print(F(" waiting="));
+    Logger.info.print(scheduler->depth());
+    Logger.info.print(F(" used="));
+    Logger.info.print(schedule.used);
+    Logger.info.print(F("/"));
+    Logger.info.print(schedule.capacity);
+    Logger.info.println(F(" bytes"));
+  }
+  Logger.info.print(F("RF airtime: used="));
+  Logger.info.print(airtime.used());
+  Logger.info.print(F(" budget="));
+  Logger.info.print(airtime.budget());
+  Logger.info.print(F(" ms within "));
+  Logger.info.print(RF_AIRTIME_WINDOW);
+  Logger.info.println(F(" s"));
+
+  if (verifier) {
+    const TransmitVerifier::Stats verify = verifier->stats();
+    Logger.info.print(F("RF transmit verification: verified="));
+    Logger.info.print(verify.verified);
+    Logger.info.print(F(" failed="));
+    Logger.info.print(verify.failed);
+    Logger.info.print(F(" untracked="));
+    Logger.info.print(verify.untracked);
+    Logger.info.print(F(" latency average="));
+    Logger.info.print(verify.verified > 0
+                          ? verify.latencyTotal / verify.verified
+                          : 0);
+    Logger.info.print(F(" ms max="));
+    Logger.info.print(verify.latencyMax);
+    Logger.info.println(F(" ms"));
+  }
+
+  if (batchesTransmitted > 0) {
+    Logger.info.print(F("RF transmit batches: completed="));
+    Logger.info.print(batchesTransmitted);
+    Logger.info.print(F(" average="));
+    Logger.info.print(batchMillisTotal / batchesTransmitted);
+    Logger.info.print(F(" ms max="));
+    Logger.info.print(batchMillisMax);
+    Logger.info.println(F(" ms"));
+  }
+
+  if (settings.rfListenBeforeTalk) {
+    Logger.info.print(F("RF listen before talk: deferrals="));
+    Logger.info.print(transmitDeferrals);
+    Logger.info.print(F(" forced="));
+    Logger.info.print(transmitForced);
+    Logger.info.print(F(" waited="));
+    Logger.info.print(transmitWaitMillis);
+    Logger.info.println(F(" ms"));
+  }
+
+  if (transmitCache) {
+    const TransmitCache::Stats cache = transmitCache->stats();
+    const size_t lookups = cache.hits + cache.misses;
+    Logger.info.print(F("RF transmit cache: hits="));
+    Logger.info.print(cache.hits);
+    Logger.info.print(F(" misses="));
+    Logger.info.print(cache.misses);
+    Logger.info.print(F(" hit rate="));
+    Logger.info.print(lookups > 0 ? cache.hits * 100 / lookups : 0);
+    Logger.info.print(F("% saved="));
+    Logger.info.print(cache.hits > 0 ? cache.savedMicros / cache.hits : 0);
+    Logger.info.print(F(" us/hit evictions="));
+    Logger.info.print(cache.evictions);
+    Logger.info.print(F(" used="));
+    Logger.info.print(cache.used);
+    Logger.info.print(F("/"));
+    Logger.info.print(cache.capacity);
+    Logger.info.println(F(" bytes"));
+  }
+
+  if (repeatFilter.isEnabled()) {
+    const RepeatFilter::Stats &repeats = repeatFilter.stats();
+    Logger.info.print(F("RF repeat filter: hits="));
+    Logger.info.print(repeats.hits);
+    Logger.info.print(F(" misses="));
+    Logger.info.print(repeats.misses);
+    Logger.info.print(F(" evictions="));
+    Logger.info.println(repeats.evictions);
+  }
+
+  protocolStats.print(Logger.info);
+  Logger.info.print(F("RF protocols by decode hits: "));
+  Logger.info.println(protocolStats.protocolsByHits());
+}
 
 void RfHandler::registerReceiveHandler(const ReceiveCb &cb) {
   onReceiveCallback = cb;
 }
+
+void RfHandler::registerRawStreamHandler(const RawStreamCb &cb) {
+  onRawStreamCallback = cb;
+}
+
+void RfHandler::registerStatsHandler(const StatsCb &cb) {
+  onStatsCallback = cb;
+}
+
+void RfHandler::registerAckHandler(const AckCb &cb) { onAckCallback = cb; }
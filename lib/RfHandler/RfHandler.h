@@ -38,34 +38,276 @@
 
 #include <Settings.h>
 
+#include "ProtocolStats.h"
+#include "PulseCapture.h"
+#include "PulseRecorder.h"
+#include "PulseStream.h"
+#include "PulseTransmitter.h"
+#include "RawPulseParser.h"
+#include "RepeatFilter.h"
+#include "TransmitCache.h"
+#include "TransmitMacro.h"
+#include "TransmitScheduler.h"
+#include "TransmitVerifier.h"
+#include "UnknownSignals.h"
+
+#ifndef RF_STATS_INTERVAL
+#define RF_STATS_INTERVAL 1000
+#endif
+
+// Maximal length of "protocol/deviceID" handed to the receive handler
+#ifndef RF_TOPIC_PART_SIZE
+#define RF_TOPIC_PART_SIZE 64
+#endif
+
+// Receiver pin and additional receivers configured by rfReceivers
+#ifndef RF_MAX_RECEIVERS
+#define RF_MAX_RECEIVERS 4
+#endif
+
+#ifndef RF_RECEIVERS_JSON_DOC_SIZE
+#define RF_RECEIVERS_JSON_DOC_SIZE 1024
+#endif
+
+// Identical codes received by different receivers within this many
+// milliseconds are published once
+#ifndef RF_RECEIVER_MERGE_WINDOW
+#define RF_RECEIVER_MERGE_WINDOW 1000
+#endif
+
+// Maximal length of a message tagged with its receiver
+#ifndef RF_TAGGED_MESSAGE_SIZE
+#define RF_TAGGED_MESSAGE_SIZE 256
+#endif
+
+// Listen before talk: the channel is busy while a receiver gets at least
+// RF_LBT_MIN_PULSES pulses of a pulse train or ended one less than
+// RF_LBT_IDLE_TIME microseconds ago
+#ifndef RF_LBT_MIN_PULSES
+#define RF_LBT_MIN_PULSES 16
+#endif
+
+#ifndef RF_LBT_IDLE_TIME
+#define RF_LBT_IDLE_TIME 10000
+#endif
+
+// Random backoff in milliseconds while the channel is busy
+#ifndef RF_LBT_BACKOFF_MIN
+#define RF_LBT_BACKOFF_MIN 10
+#endif
+
+#ifndef RF_LBT_BACKOFF_MAX
+#define RF_LBT_BACKOFF_MAX 50
+#endif
+
+// Transmit anyway after waiting this many milliseconds for a free channel
+#ifndef RF_LBT_MAX_WAIT
+#define RF_LBT_MAX_WAIT 1000
+#endif
+
+// Codes sent to <mqttSendTopic>batch are a JSON array of transmit commands
+#define RF_BATCH_PROTOCOL "batch"
+
+// Codes sent to <mqttSendTopic>macro/<name> play a stored macro
+#define RF_MACRO_PREFIX "macro/"
+
+#ifndef RF_BATCH_JSON_DOC_SIZE
+#define RF_BATCH_JSON_DOC_SIZE 2048
+#endif
+
+// Batches waiting for their last code to be transmitted
+#ifndef RF_PENDING_BATCHES
+#define RF_PENDING_BATCHES 4
+#endif
+
+#ifndef RF_PRIORITIES_JSON_DOC_SIZE
+#define RF_PRIORITIES_JSON_DOC_SIZE 512
+#endif
+
+// Scheduled pulse trains handed to the transmitter at once, including the
+// one on air.  Two keep the codes back to back, later ones can still be
+// overtaken by a higher priority.
+#ifndef RF_SCHEDULER_TRANSMIT_DEPTH
+#define RF_SCHEDULER_TRANSMIT_DEPTH 2
+#endif
+
+// Airtime usage is reported as "airtime" stats at most this often in
+// milliseconds
+#ifndef RF_AIRTIME_REPORT_INTERVAL
+#define RF_AIRTIME_REPORT_INTERVAL 60000
+#endif
+
 class RfHandler {
  public:
-  using ReceiveCb = std::function<void(const String &, const String &)>;
+  using ReceiveCb =
+      std::function<void(const char *topic_part, const char *payload)>;
+  using RawStreamCb = std::function<void(const uint8_t *data, size_t length)>;
+  // Reports about the gateway itself rather than received codes
+  using StatsCb = std::function<void(const char *name, const char *payload)>;
+  // Results of verified transmissions, one per command
+  using AckCb = std::function<void(const char *protocol, const char *payload)>;
 
   RfHandler(const Settings &settings);
   ~RfHandler();
   void begin();
   void loop();
   void registerReceiveHandler(const ReceiveCb &cb);
+  void registerRawStreamHandler(const RawStreamCb &cb);
+  void registerStatsHandler(const StatsCb &cb);
+  void registerAckHandler(const AckCb &cb);
 
-  void transmitCode(const String &protocol, const String &message);
+  // Transmits a message of length characters, which need not be null
+  // terminated.  Nothing is kept after the call returns.
+  void transmitCode(const char *protocol, const char *message, size_t length);
+  // Transmits a RAW message straight from the received bytes.  The message
+  // may come in consecutive chunks, data are length bytes at offset of a
+  // message of total bytes.
+  void transmitRaw(const uint8_t *data, size_t length, size_t offset,
+                   size_t total);
   void setRawMode(bool mode) { rawMode = mode; }
   bool isRawModeEnabled() const { return rawMode; }
+  void setRawStreamMode(bool mode);
+  bool isRawStreamModeEnabled() const { return rawStream != nullptr; }
+  void setStatsMode(bool mode);
+  bool isStatsModeEnabled() const { return statsMode; }
+  void setRecordMode(bool mode);
+  bool isRecordModeEnabled() const { return recorder != nullptr; }
+  void startReplay();
   void enableReceiver();
   void disableReceiver();
   void setEchoEnabled(bool enabled);
+  // Verifies transmissions by their echo and publishes an ack per command.
+  void setVerifyEnabled(bool enabled);
+  bool isVerifyEnabled() const { return verifier != nullptr; }
   void filterProtocols(const String &protocols);
+  // Encodes and stores a macro defined as JSON array of transmit commands.
+  bool storeMacro(const String &name, const String &definition);
+  // capture statistics summed over all receivers
+  PulseCapture::Stats captureStats() const;
 
   static String availableProtocols();
+  static void downloadRecording(Print &output);
+  static void clearRecording();
+  // Definition of a macro or, for an empty name, the list of macros
+  static String downloadMacro(const String &name);
+  static bool removeMacro(const String &name);
 
  private:
+  struct PendingBatch {
+    unsigned long started;
+    size_t codes;  // 0 for an unused slot
+    // set when the last code of the batch is handed to the transmitter
+    bool released;
+    uint32_t lastSequence;
+  };
+
+  struct Receiver {
+    int8_t pin;
+    bool pullUp;
+    String protocols;  // JSON array of the published protocols, [] for all
+    PulseCapture capture;
+    RepeatCounter repeats;
+  };
+
+  void addReceiver(int8_t pin, bool pullUp, const String &protocols);
+  void addReceivers(const String &config);
+  String decodedProtocols() const;
+  bool tagMessage(const String &message);
   void onRfCode(const String &protocol, const String &message, int status,
                 size_t repeats, const String &deviceID);
   void onRfRaw(const uint16_t *pulses, size_t length);
+  void logStats();
+  void publishUnknownSignals();
+  void flushRawStream();
+  void setTransmitPriorities(const String &config);
+  uint8_t transmitPriority(const char *protocol) const;
+  void transmitBatch(const char *batch, size_t length);
+  void playMacro(const String &name, uint8_t priority);
+  void handleMacro();
+  int encodePulseTrain(const char *protocol, const char *message,
+                       size_t length);
+  int parseRawPulseTrain(const uint8_t *data, size_t length);
+  int finishRawPulseTrain();
+  int checkPulseTrain(int result);
+  uint32_t scheduleTransmit(const uint16_t *pulses, size_t length,
+                            uint8_t priority);
+  void releaseScheduled();
+  void releaseBatch(uint8_t tag, bool queued);
+  bool queuePulseTrain(const uint16_t *pulses, size_t length);
+  void handleTransmitter();
+  void completeBatch();
+  void publishAirtime();
+  void publishVerifications();
+  bool isChannelBusy() const;
+  void startTransmitter();
+  void parsePulseTrain(uint16_t *pulses, size_t length);
+  bool suspendReceiver();
+  void resumeReceiver(bool receiverState);
 
   const Settings &settings;
   ReceiveCb onReceiveCallback = nullptr;
+  RawStreamCb onRawStreamCallback = nullptr;
+  StatsCb onStatsCallback = nullptr;
+  AckCb onAckCallback = nullptr;
   bool rawMode = false;
+  bool echoEnabled = false;
+  bool statsMode = false;
+  unsigned long lastStats = 0;
+  RepeatFilter repeatFilter;
+  ProtocolStats protocolStats;
+  int decodedProtocol = ProtocolStats::UNKNOWN;
+  bool decoded = false;
+  unsigned long callbackMicros = 0;
+  // reused for every received code to keep the receive path allocation free
+  char topicPart[RF_TOPIC_PART_SIZE];
+  char taggedMessage[RF_TAGGED_MESSAGE_SIZE];
+  Receiver *receivers[RF_MAX_RECEIVERS] = {};
+  size_t receiverCount = 0;
+  bool hasPrimaryReceiver = false;
+  // received or replayed pulse train being decoded, kept off the stack
+  uint16_t receivedPulses[MAXPULSESTREAMLENGTH];
+  // receiver of the pulse train being decoded, nullptr for echo and replay
+  Receiver *currentReceiver = nullptr;
+  RepeatFilter *receiverMerge = nullptr;
+  PulseStreamEncoder *rawStream = nullptr;
+  PulseRecorder *recorder = nullptr;
+  PulseReplay *replay = nullptr;
+  UnknownSignals *unknownSignals = nullptr;
+  unsigned long lastUnknownReport = 0;
+  // only with a transmitter pin
+  PulseTransmitter *transmitter = nullptr;
+  // encoded pulse train to transmit, kept off the stack
+  uint16_t transmitPulses[MAXPULSESTREAMLENGTH];
+  RawPulseParser rawParser{transmitPulses, MAXPULSESTREAMLENGTH};
+  // allocated with the first transmit command
+  TransmitCache *transmitCache = nullptr;
+  // only with a transmitter pin
+  TransmitScheduler *scheduler = nullptr;
+  AirtimeBudget airtime;
+  bool airtimeExhausted = false;
+  uint32_t reportedAirtime = 0;
+  unsigned long lastAirtimeReport = 0;
+  bool transmitActive = false;
+  bool receiverStateBeforeTransmit = false;
+  // listen before talk
+  bool transmitDeferred = false;
+  unsigned long transmitWaitStart = 0;
+  unsigned long transmitBackoffUntil = 0;
+  size_t transmitDeferrals = 0;
+  size_t transmitForced = 0;
+  unsigned long transmitWaitMillis = 0;
+  TransmitVerifier *verifier = nullptr;
+  MacroPlayer *macro = nullptr;
+  uint8_t macroPriority = 0;
+  unsigned long macroIdleSince = 0;
+  // pulse trains queued and completed, to find the end of a batch
+  uint32_t transmitSequence = 0;
+  uint32_t completedSequence = 0;
+  PendingBatch pendingBatches[RF_PENDING_BATCHES] = {};
+  size_t pendingBatchCount = 0;
+  size_t batchesTransmitted = 0;
+  unsigned long batchMillisTotal = 0;
+  unsigned long batchMillisMax = 0;
 
   ESPiLight rf;
 };
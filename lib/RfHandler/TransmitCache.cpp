@@ -0,0 +1,125 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "TransmitCache.h"
+
+static const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+// FNV-1a
+static uint32_t hashBytes(uint32_t hash, const char *data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<uint8_t>(data[i])) * FNV_PRIME;
+  }
+  return hash;
+}
+
+uint32_t TransmitCache::key(const char *protocol, const char *message,
+                            size_t length) {
+  // the terminating zero of the protocol separates the fields
+  return hashBytes(
+      hashBytes(FNV_OFFSET_BASIS, protocol, strlen(protocol) + 1), message,
+      length);
+}
+
+size_t TransmitCache::lookup(uint32_t key, uint16_t *pulses) {
+  const unsigned long start = micros();
+  size_t offset = 0;
+  while (offset < used) {
+    const size_t length = entries[offset + 2];
+    const size_t size = HEADER_SIZE + length;
+    if (entries[offset] == (key >> 16) &&
+        entries[offset + 1] == (key & 0xffff)) {
+      const uint16_t encodeMicros = entries[offset + 3];
+      memcpy(pulses, &entries[offset + HEADER_SIZE],
+             length * sizeof(uint16_t));
+      // move the entry to the end, the most recently used position
+      remove(offset, size);
+      entries[used] = key >> 16;
+      entries[used + 1] = key & 0xffff;
+      entries[used + 2] = length;
+      entries[used + 3] = encodeMicros;
+      memcpy(&entries[used + HEADER_SIZE], pulses, length * sizeof(uint16_t));
+      used += size;
+      hits++;
+      const unsigned long elapsed = micros() - start;
+      if (encodeMicros > elapsed) {
+        savedMicros += encodeMicros - elapsed;
+      }
+      return length;
+    }
+    offset += size;
+  }
+  misses++;
+  return 0;
+}
+
+void TransmitCache::insert(uint32_t key, const uint16_t *pulses,
+                           size_t length, unsigned long encodeMicros) {
+  const size_t size = HEADER_SIZE + length;
+  if (size > CAPACITY) {
+    return;
+  }
+  while (used + size > CAPACITY) {
+    remove(0, HEADER_SIZE + entries[2]);
+    evictions++;
+  }
+  entries[used] = key >> 16;
+  entries[used + 1] = key & 0xffff;
+  entries[used + 2] = length;
+  entries[used + 3] = encodeMicros < UINT16_MAX ? encodeMicros : UINT16_MAX;
+  memcpy(&entries[used + HEADER_SIZE], pulses, length * sizeof(uint16_t));
+  used += size;
+}
+
+void TransmitCache::remove(size_t offset, size_t size) {
+  memmove(&entries[offset], &entries[offset + size],
+          (used - offset - size) * sizeof(uint16_t));
+  used -= size;
+}
+
+TransmitCache::Stats TransmitCache::stats() const {
+  return {hits,
+          misses,
+          evictions,
+          savedMicros,
+          used * sizeof(uint16_t),
+          CAPACITY * sizeof(uint16_t)};
+}
+
+void TransmitCache::resetStats() {
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+  savedMicros = 0;
+}
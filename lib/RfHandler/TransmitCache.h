@@ -0,0 +1,91 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef TRANSMITCACHE_H
+#define TRANSMITCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <WString.h>
+
+#ifndef RF_TRANSMIT_CACHE_SIZE
+// Bytes used for cached pulse trains, 0 disables the cache.
+#define RF_TRANSMIT_CACHE_SIZE 2048
+#endif
+
+// Least recently used cache of encoded pulse trains for transmitting.
+//
+// Encoding a code with ESPiLight parses the JSON message and runs the
+// protocol encoder every time.  The cache keeps the resulting pulse trains,
+// keyed by a hash of protocol and message, in a fixed buffer of
+// RF_TRANSMIT_CACHE_SIZE bytes.  Entries are stored back to back from the
+// least to the most recently used one, so a hit moves its entry to the end
+// and an insert evicts from the front until the new entry fits.
+class TransmitCache {
+ public:
+  struct Stats {
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+    unsigned long savedMicros;  // encode time saved by all hits
+    size_t used;                // in bytes
+    size_t capacity;            // in bytes
+  };
+
+  TransmitCache() : entries() { resetStats(); }
+
+  static uint32_t key(const char *protocol, const char *message,
+                      size_t length);
+  // Copies the cached pulse train to pulses and returns its length, 0 if
+  // it is not cached.
+  size_t lookup(uint32_t key, uint16_t *pulses);
+  // Caches a pulse train that took encodeMicros to encode.
+  void insert(uint32_t key, const uint16_t *pulses, size_t length,
+              unsigned long encodeMicros);
+  Stats stats() const;
+  void resetStats();
+
+ private:
+  // every entry starts with the key (two words), the length and the encode
+  // time followed by the pulses
+  static const size_t HEADER_SIZE = 4;
+  static const size_t CAPACITY = RF_TRANSMIT_CACHE_SIZE / sizeof(uint16_t);
+
+  void remove(size_t offset, size_t size);
+
+  uint16_t entries[CAPACITY > 0 ? CAPACITY : 1];
+  size_t used = 0;  // in words
+  size_t hits;
+  size_t misses;
+  size_t evictions;
+  unsigned long savedMicros;
+};
+
+#endif  // TRANSMITCACHE_H
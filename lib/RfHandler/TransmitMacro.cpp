@@ -0,0 +1,178 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <ctype.h>
+
+#include <ArduinoSimpleLogging.h>
+
+#include "TransmitMacro.h"
+
+MacroStore::MacroStore(const String &name, const String &definition)
+    : name(name) {
+  file = SPIFFS.open(FPSTR(RF_MACRO_NEW_FILE), "w");
+  if (!file) {
+    failed = true;
+    return;
+  }
+  const uint16_t header[] = {MAGIC,
+                             static_cast<uint16_t>(definition.length())};
+  failed = !writeWords(header, 2) ||
+           file.write(reinterpret_cast<const uint8_t *>(definition.c_str()),
+                      definition.length()) != definition.length();
+}
+
+MacroStore::~MacroStore() {
+  if (file) {
+    file.close();
+    SPIFFS.remove(FPSTR(RF_MACRO_NEW_FILE));
+  }
+}
+
+bool MacroStore::addStep(uint16_t delayMillis, const uint16_t *pulses,
+                         size_t length) {
+  const uint16_t header[] = {delayMillis, static_cast<uint16_t>(length)};
+  failed = failed || !writeWords(header, 2) || !writeWords(pulses, length);
+  return !failed;
+}
+
+bool MacroStore::commit() {
+  if (!file) {
+    return false;
+  }
+  file.close();
+  if (failed) {
+    SPIFFS.remove(FPSTR(RF_MACRO_NEW_FILE));
+    return false;
+  }
+  const String target = path(name);
+  SPIFFS.remove(target);
+  return SPIFFS.rename(String(FPSTR(RF_MACRO_NEW_FILE)), target);
+}
+
+bool MacroStore::writeWords(const uint16_t *words, size_t count) {
+  const size_t size = count * sizeof(uint16_t);
+  return file.write(reinterpret_cast<const uint8_t *>(words), size) == size;
+}
+
+bool MacroStore::isValidName(const String &name) {
+  if (name.length() == 0 || name.length() > RF_MACRO_NAME_LENGTH) {
+    return false;
+  }
+  for (unsigned int i = 0; i < name.length(); i++) {
+    const char c = name[i];
+    if (!isalnum(c) && c != '_' && c != '-') {
+      return false;
+    }
+  }
+  return true;
+}
+
+String MacroStore::path(const String &name) {
+  String result(FPSTR(RF_MACRO_DIR));
+  result += name;
+  return result;
+}
+
+String MacroStore::list() {
+  const size_t dirLength = strlen_P(RF_MACRO_DIR);
+  String result('[');
+  Dir dir = SPIFFS.openDir(FPSTR(RF_MACRO_DIR));
+  while (dir.next()) {
+    const String name = dir.fileName().substring(dirLength);
+    if (!isValidName(name)) {
+      continue;  // RF_MACRO_NEW_FILE
+    }
+    if (result.length() > 1) {
+      result += ',';
+    }
+    result += '"';
+    result += name;
+    result += '"';
+  }
+  result += ']';
+  return result;
+}
+
+String MacroStore::definition(const String &name) {
+  String result;
+  File file = SPIFFS.open(path(name), "r");
+  if (!file) {
+    return result;
+  }
+  uint16_t header[2];
+  if (file.read(reinterpret_cast<uint8_t *>(header), sizeof(header)) ==
+          sizeof(header) &&
+      header[0] == MAGIC && result.reserve(header[1])) {
+    int c;
+    for (uint16_t i = 0; i < header[1] && (c = file.read()) >= 0; i++) {
+      result += static_cast<char>(c);
+    }
+  }
+  file.close();
+  return result;
+}
+
+bool MacroStore::remove(const String &name) {
+  return isValidName(name) && SPIFFS.remove(path(name));
+}
+
+MacroPlayer::MacroPlayer(const String &name) {
+  file = SPIFFS.open(MacroStore::path(name), "r");
+  uint16_t header[2];
+  if (!file || !readWords(header, 2) || header[0] != MacroStore::MAGIC ||
+      !file.seek(header[1], SeekCur)) {
+    return;
+  }
+  next();
+}
+
+MacroPlayer::~MacroPlayer() {
+  if (file) file.close();
+}
+
+bool MacroPlayer::next() {
+  uint16_t header[2];
+  length = 0;
+  if (!file || !readWords(header, 2)) {
+    return false;
+  }
+  if (header[1] == 0 || header[1] > MAXPULSESTREAMLENGTH ||
+      !readWords(stepPulses, header[1])) {
+    Logger.error.println(F("Corrupted transmit macro."));
+    return false;
+  }
+  delay = header[0];
+  length = header[1];
+  return true;
+}
+
+bool MacroPlayer::readWords(uint16_t *words, size_t count) {
+  const size_t size = count * sizeof(uint16_t);
+  return file.read(reinterpret_cast<uint8_t *>(words), size) == size;
+}
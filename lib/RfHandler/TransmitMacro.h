@@ -0,0 +1,107 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef TRANSMITMACRO_H
+#define TRANSMITMACRO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <FS.h>
+#include <Print.h>
+#include <WString.h>
+
+#include <ESPiLight.h>
+
+const char PROGMEM RF_MACRO_DIR[] = "/macro/";
+const char PROGMEM RF_MACRO_NEW_FILE[] = "/macro/.new";
+
+// SPIFFS file names are limited to 31 characters including the directory
+#ifndef RF_MACRO_NAME_LENGTH
+#define RF_MACRO_NAME_LENGTH 20
+#endif
+
+// Stores a named transmit macro with its pre-encoded pulse trains on SPIFFS.
+//
+// A macro file starts with a magic word and the JSON definition, kept for
+// downloads, followed by the steps up to the end of the file: the delay in
+// milliseconds before the step, the number of pulses and the pulses, all as
+// 16 bit words.  The file is written to RF_MACRO_NEW_FILE and only replaces
+// a macro of the same name when commit() succeeds.
+class MacroStore {
+ public:
+  static const uint16_t MAGIC = 0x4d31;
+
+  MacroStore(const String &name, const String &definition);
+  ~MacroStore();
+
+  bool addStep(uint16_t delayMillis, const uint16_t *pulses, size_t length);
+  bool commit();
+
+  // Names consist of up to RF_MACRO_NAME_LENGTH letters, digits, '_' or '-'.
+  static bool isValidName(const String &name);
+  static String path(const String &name);
+  // JSON array of the stored macro names
+  static String list();
+  // Definition of the macro, empty if it does not exist
+  static String definition(const String &name);
+  static bool remove(const String &name);
+
+ private:
+  bool writeWords(const uint16_t *words, size_t count);
+
+  File file;
+  String name;
+  bool failed = false;
+};
+
+// Reads the steps of a stored macro one by one.
+class MacroPlayer {
+ public:
+  explicit MacroPlayer(const String &name);
+  ~MacroPlayer();
+
+  // False if the macro does not exist, is corrupted or has no steps.
+  bool isValid() const { return length > 0; }
+  // Reads the next step, returns false at the end of the macro.
+  bool next();
+  const uint16_t *pulses() const { return stepPulses; }
+  size_t pulseCount() const { return length; }
+  uint16_t delayMillis() const { return delay; }
+
+ private:
+  bool readWords(uint16_t *words, size_t count);
+
+  File file;
+  uint16_t stepPulses[MAXPULSESTREAMLENGTH];
+  size_t length = 0;
+  uint16_t delay = 0;
+};
+
+#endif  // TRANSMITMACRO_H
@@ -0,0 +1,254 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "TransmitScheduler.h"
+
+static const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+static uint32_t hashBytes(const uint8_t *data, size_t length) {
+  uint32_t hash = FNV_OFFSET_BASIS;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ data[i]) * FNV_PRIME;
+  }
+  return hash;
+}
+
+bool TransmitScheduler::setPriority(const char *name, uint8_t priority) {
+  const uint32_t nameKey =
+      hashBytes(reinterpret_cast<const uint8_t *>(name), strlen(name));
+  for (size_t i = 0; i < priorityCount; i++) {
+    if (priorityKeys[i] == nameKey) {
+      priorities[i] = priority;
+      return true;
+    }
+  }
+  if (priorityCount == RF_TRANSMIT_PRIORITIES) {
+    return false;
+  }
+  priorityKeys[priorityCount] = nameKey;
+  priorities[priorityCount++] = priority;
+  return true;
+}
+
+uint8_t TransmitScheduler::priority(const char *name) const {
+  if (priorityCount == 0) {
+    return 0;
+  }
+  const uint32_t nameKey =
+      hashBytes(reinterpret_cast<const uint8_t *>(name), strlen(name));
+  for (size_t i = 0; i < priorityCount; i++) {
+    if (priorityKeys[i] == nameKey) {
+      return priorities[i];
+    }
+  }
+  return 0;
+}
+
+// 0 marks a failed add(), so it is never used as key
+uint32_t TransmitScheduler::key(const uint16_t *pulses, size_t length) {
+  const uint32_t hash = hashBytes(reinterpret_cast<const uint8_t *>(pulses),
+                                  length * sizeof(uint16_t));
+  return hash != 0 ? hash : 1;
+}
+
+uint32_t TransmitScheduler::add(const uint16_t *pulses, size_t length,
+                                uint8_t priority) {
+  const uint32_t pulsesKey = key(pulses, length);
+  size_t offset = 0;
+  while (offset < used) {
+    const size_t entryLength = entries[offset];
+    if (entries[offset + 2] == (pulsesKey >> 16) &&
+        entries[offset + 3] == (pulsesKey & 0xffff) &&
+        entryLength == length &&
+        memcmp(&entries[offset + HEADER_SIZE], pulses,
+               length * sizeof(uint16_t)) == 0) {
+      if ((entries[offset + 1] & 0xff) < priority) {
+        entries[offset + 1] = (entries[offset + 1] & 0xff00) | priority;
+      }
+      merged++;
+      return pulsesKey;
+    }
+    offset += HEADER_SIZE + entryLength;
+  }
+
+  if (!canAdd(length)) {
+    dropped++;
+    return 0;
+  }
+  const unsigned long now = millis();
+  entries[used] = length;
+  entries[used + 1] = priority;
+  entries[used + 2] = pulsesKey >> 16;
+  entries[used + 3] = pulsesKey & 0xffff;
+  entries[used + 4] = now >> 16;
+  entries[used + 5] = now & 0xffff;
+  memcpy(&entries[used + HEADER_SIZE], pulses, length * sizeof(uint16_t));
+  used += HEADER_SIZE + length;
+  count++;
+  scheduled++;
+  return pulsesKey;
+}
+
+bool TransmitScheduler::canAdd(size_t length) const {
+  return used + HEADER_SIZE + length <= CAPACITY;
+}
+
+bool TransmitScheduler::tag(uint32_t key, uint8_t tag) {
+  size_t offset = 0;
+  while (offset < used) {
+    if (entries[offset + 2] == (key >> 16) &&
+        entries[offset + 3] == (key & 0xffff)) {
+      if (entries[offset + 1] >> 8) {
+        return false;
+      }
+      entries[offset + 1] |= tag << 8;
+      return true;
+    }
+    offset += HEADER_SIZE + entries[offset];
+  }
+  return false;
+}
+
+const uint16_t *TransmitScheduler::peek(size_t &length, uint8_t &tag) {
+  if (count == 0) {
+    return nullptr;
+  }
+  // entries are in the order of arrival, so the first one of the highest
+  // priority is the oldest
+  size_t offset = 0;
+  int highest = -1;
+  while (offset < used) {
+    const int entryPriority = entries[offset + 1] & 0xff;
+    if (entryPriority > highest) {
+      highest = entryPriority;
+      peeked = offset;
+    }
+    offset += HEADER_SIZE + entries[offset];
+  }
+  length = entries[peeked];
+  tag = entries[peeked + 1] >> 8;
+  return &entries[peeked + HEADER_SIZE];
+}
+
+void TransmitScheduler::pop() {
+  if (count > 0) {
+    remove(peeked);
+  }
+}
+
+bool TransmitScheduler::expire(uint8_t &tag) {
+  const unsigned long now = millis();
+  size_t offset = 0;
+  while (offset < used) {
+    const unsigned long since =
+        (static_cast<unsigned long>(entries[offset + 4]) << 16) |
+        entries[offset + 5];
+    if (now - since > RF_SCHEDULER_MAX_WAIT) {
+      tag = entries[offset + 1] >> 8;
+      remove(offset);
+      expired++;
+      return true;
+    }
+    offset += HEADER_SIZE + entries[offset];
+  }
+  return false;
+}
+
+void TransmitScheduler::remove(size_t offset) {
+  const size_t size = HEADER_SIZE + entries[offset];
+  memmove(&entries[offset], &entries[offset + size],
+          (used - offset - size) * sizeof(uint16_t));
+  used -= size;
+  count--;
+}
+
+TransmitScheduler::Stats TransmitScheduler::stats() const {
+  return {scheduled,
+          merged,
+          dropped,
+          expired,
+          used * sizeof(uint16_t),
+          CAPACITY * sizeof(uint16_t)};
+}
+
+void TransmitScheduler::resetStats() {
+  scheduled = 0;
+  merged = 0;
+  dropped = 0;
+  expired = 0;
+}
+
+AirtimeBudget::AirtimeBudget(uint16_t dutyCycle)
+    : slotStart(millis()),
+      limit(RF_AIRTIME_WINDOW * static_cast<uint32_t>(dutyCycle)) {}
+
+uint32_t AirtimeBudget::estimate(const uint16_t *pulses, size_t length,
+                                 uint16_t repeats) {
+  uint32_t micros = 0;
+  for (size_t i = 0; i < length; i++) {
+    micros += pulses[i];
+  }
+  return (micros * repeats + 999) / 1000;
+}
+
+void AirtimeBudget::add(uint32_t airtime) {
+  advance();
+  slots[slot] += airtime;
+  total += airtime;
+}
+
+bool AirtimeBudget::allows(uint32_t airtime) {
+  return limit == 0 || used() + airtime <= limit;
+}
+
+uint32_t AirtimeBudget::used() {
+  advance();
+  return total;
+}
+
+void AirtimeBudget::advance() {
+  const unsigned long now = millis();
+  size_t forgotten = 0;
+  while (now - slotStart >= SLOT_MILLIS) {
+    if (forgotten++ == RF_AIRTIME_SLOTS) {
+      // idle for longer than the window
+      slotStart = now;
+      break;
+    }
+    slotStart += SLOT_MILLIS;
+    slot = (slot + 1) % RF_AIRTIME_SLOTS;
+    total -= slots[slot];
+    slots[slot] = 0;
+  }
+}
@@ -0,0 +1,167 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef TRANSMITSCHEDULER_H
+#define TRANSMITSCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef RF_SCHEDULER_BUFFER_SIZE
+// Bytes used for pulse trains waiting for the transmitter, the longest pulse
+// train takes about half of it, typical codes of up to 100 pulses fit four
+// times behind the two handed to the transmitter.
+#define RF_SCHEDULER_BUFFER_SIZE 1024
+#endif
+
+#ifndef RF_SCHEDULER_MAX_WAIT
+// Pulse trains waiting longer than this many milliseconds are dropped.
+#define RF_SCHEDULER_MAX_WAIT 60000
+#endif
+
+#ifndef RF_TRANSMIT_PRIORITIES
+// Number of names a priority can be configured for
+#define RF_TRANSMIT_PRIORITIES 16
+#endif
+
+#ifndef RF_AIRTIME_WINDOW
+// Rolling window of the airtime budget in seconds
+#define RF_AIRTIME_WINDOW 3600
+#endif
+
+#ifndef RF_AIRTIME_SLOTS
+// The window moves in steps of RF_AIRTIME_WINDOW / RF_AIRTIME_SLOTS
+#define RF_AIRTIME_SLOTS 60
+#endif
+
+// Orders pulse trains waiting for the transmitter.
+//
+// Every pulse train is scheduled with a priority, the oldest one of the
+// highest priority is transmitted next.  A pulse train identical to a
+// waiting one is merged into it, keeping the higher priority, so controllers
+// repeating a command do not queue it several times.  The entries are
+// stored back to back in the order of arrival in a fixed buffer of
+// RF_SCHEDULER_BUFFER_SIZE bytes.  Pulse trains can carry a tag, which the
+// caller gets back when the pulse train leaves the scheduler.
+class TransmitScheduler {
+ public:
+  struct Stats {
+    size_t scheduled;
+    size_t merged;    // identical to a waiting pulse train
+    size_t dropped;   // did not fit
+    size_t expired;   // waited longer than RF_SCHEDULER_MAX_WAIT
+    size_t used;      // in bytes
+    size_t capacity;  // in bytes
+  };
+
+  TransmitScheduler() : entries() { resetStats(); }
+
+  // Sets the priority of the commands sent to name, which is a protocol,
+  // RAW or macro/<name>.  Higher priorities are transmitted first.
+  bool setPriority(const char *name, uint8_t priority);
+  // Priority of the commands sent to name, 0 if none is configured.
+  uint8_t priority(const char *name) const;
+
+  // Identifies identical pulse trains, never 0.
+  static uint32_t key(const uint16_t *pulses, size_t length);
+  // Schedules a pulse train, returns its key or 0 if it does not fit.
+  uint32_t add(const uint16_t *pulses, size_t length, uint8_t priority);
+  // True if a pulse train with length pulses fits.
+  bool canAdd(size_t length) const;
+  // Tags the waiting pulse train with key, returns false if it is missing
+  // or already tagged.
+  bool tag(uint32_t key, uint8_t tag);
+  // The pulse train to transmit next, nullptr if none is waiting.
+  const uint16_t *peek(size_t &length, uint8_t &tag);
+  // Removes the pulse train returned by the last peek().
+  void pop();
+  // Removes the oldest pulse train waiting too long, returns false if
+  // there is none.
+  bool expire(uint8_t &tag);
+  // Number of waiting pulse trains
+  size_t depth() const { return count; }
+  Stats stats() const;
+  void resetStats();
+
+ private:
+  // every entry starts with the length, the priority and tag, the key and
+  // the time of scheduling (two words each) followed by the pulses
+  static const size_t HEADER_SIZE = 6;
+  static const size_t CAPACITY = RF_SCHEDULER_BUFFER_SIZE / sizeof(uint16_t);
+
+  void remove(size_t offset);
+
+  uint16_t entries[CAPACITY > 0 ? CAPACITY : 1];
+  size_t used = 0;  // in words
+  size_t count = 0;
+  size_t peeked = 0;
+  uint32_t priorityKeys[RF_TRANSMIT_PRIORITIES];
+  uint8_t priorities[RF_TRANSMIT_PRIORITIES];
+  size_t priorityCount = 0;
+  size_t scheduled;
+  size_t merged;
+  size_t dropped;
+  size_t expired;
+};
+
+// Airtime used by the transmitter within a rolling window of
+// RF_AIRTIME_WINDOW seconds, against a budget of a duty cycle in per mille
+// of the window.  The window moves in RF_AIRTIME_SLOTS steps, airtime older
+// than the window is forgotten slot by slot.
+class AirtimeBudget {
+ public:
+  // A duty cycle of 0 disables the budget.
+  explicit AirtimeBudget(uint16_t dutyCycle);
+
+  // Estimated airtime of a pulse train repeated repeats times in
+  // milliseconds
+  static uint32_t estimate(const uint16_t *pulses, size_t length,
+                           uint16_t repeats);
+  void add(uint32_t airtime);
+  // True if airtime milliseconds fit into the budget now.
+  bool allows(uint32_t airtime);
+  // Airtime in milliseconds used within the window
+  uint32_t used();
+  // Airtime in milliseconds allowed within the window, 0 for no limit
+  uint32_t budget() const { return limit; }
+
+ private:
+  static const unsigned long SLOT_MILLIS =
+      RF_AIRTIME_WINDOW * 1000UL / RF_AIRTIME_SLOTS;
+
+  void advance();
+
+  uint32_t slots[RF_AIRTIME_SLOTS] = {};
+  size_t slot = 0;
+  unsigned long slotStart;
+  uint32_t total = 0;
+  uint32_t limit;
+};
+
+#endif  // TRANSMITSCHEDULER_H
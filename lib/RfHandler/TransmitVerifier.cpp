@@ -0,0 +1,212 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "TransmitScheduler.h"
+#include "TransmitVerifier.h"
+
+void TransmitVerifier::expect(uint32_t key, const char *protocol,
+                              const char *message, size_t messageLength) {
+  Command *command = nullptr;
+  for (Command &candidate : commands) {
+    if (candidate.state == FREE) {
+      command = &candidate;
+      break;
+    }
+  }
+  if (!command) {
+    untracked++;
+    return;
+  }
+  command->state = key != 0 ? WAITING : FAILED;
+  command->key = key;
+  command->received = millis();
+  command->latency = 0;
+  strncpy(command->protocol, protocol, sizeof(command->protocol) - 1);
+  command->protocol[sizeof(command->protocol) - 1] = 0;
+  if (messageLength < sizeof(command->message)) {
+    memcpy(command->message, message, messageLength);
+    command->message[messageLength] = 0;
+  } else {
+    command->message[0] = 0;
+  }
+  if (key == 0) {
+    failed++;
+  }
+}
+
+void TransmitVerifier::transmitting(uint32_t sequence, const uint16_t *pulses,
+                                    size_t length) {
+  Train *train = nullptr;
+  for (Train &candidate : trains) {
+    if (candidate.length == 0) {
+      train = &candidate;
+      break;
+    }
+    // otherwise replace the oldest one
+    if (!train ||
+        static_cast<int32_t>(candidate.sequence - train->sequence) < 0) {
+      train = &candidate;
+    }
+  }
+  if (train->length > 0 && !train->echoed) {
+    settle(*train, FAILED, 0);
+  }
+  train->length = length;
+  train->key = TransmitScheduler::key(pulses, length);
+  train->sequence = sequence;
+  train->started = millis();
+  train->ended = false;
+  train->echoed = false;
+  memcpy(train->pulses, pulses, length * sizeof(uint16_t));
+}
+
+void TransmitVerifier::transmitted(uint32_t sequence) {
+  for (Train &train : trains) {
+    if (train.length > 0 && train.sequence == sequence) {
+      train.ended = true;
+      train.endedAt = millis();
+      return;
+    }
+  }
+}
+
+bool TransmitVerifier::match(const uint16_t *pulses, size_t length) {
+  for (Train &train : trains) {
+    if (!isEcho(train, pulses, length)) {
+      continue;
+    }
+    if (!train.echoed) {
+      train.echoed = true;
+      unsigned long echoMicros = 0;
+      for (size_t i = 0; i < length; i++) {
+        echoMicros += pulses[i];
+      }
+      settle(train, VERIFIED, millis() - echoMicros / 1000);
+    }
+    return true;
+  }
+  return false;
+}
+
+bool TransmitVerifier::isEcho(const Train &train, const uint16_t *pulses,
+                              size_t length) const {
+  if (train.length != length) {
+    return false;
+  }
+  for (size_t i = 0; i < length; i++) {
+    const uint16_t sent = train.pulses[i];
+    const uint16_t deviation =
+        pulses[i] > sent ? pulses[i] - sent : sent - pulses[i];
+    if (deviation > RF_VERIFY_MIN_TOLERANCE &&
+        deviation > sent * static_cast<uint32_t>(RF_VERIFY_TOLERANCE) / 100) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Settles the commands of a pulse train, a command received after the
+// transmission started waits for the next transmission of the same code.
+void TransmitVerifier::settle(const Train &train, State state,
+                              unsigned long onAir) {
+  for (Command &command : commands) {
+    if (command.state != WAITING || command.key != train.key ||
+        static_cast<long>(command.received - train.started) > 0) {
+      continue;
+    }
+    command.state = state;
+    if (state == VERIFIED) {
+      command.latency = static_cast<long>(onAir - command.received) > 0
+                            ? onAir - command.received
+                            : 0;
+      verified++;
+      latencyTotal += command.latency;
+      if (command.latency > latencyMax) {
+        latencyMax = command.latency;
+      }
+    } else {
+      failed++;
+    }
+  }
+}
+
+void TransmitVerifier::expire() {
+  const unsigned long now = millis();
+  for (Train &train : trains) {
+    if (train.length > 0 && train.ended &&
+        now - train.endedAt > RF_VERIFY_TIMEOUT) {
+      if (!train.echoed) {
+        settle(train, FAILED, 0);
+      }
+      train.length = 0;
+    }
+  }
+  for (Command &command : commands) {
+    if (command.state == WAITING &&
+        now - command.received > RF_VERIFY_COMMAND_TIMEOUT) {
+      command.state = FAILED;
+      failed++;
+    }
+  }
+}
+
+bool TransmitVerifier::nextResult(Result &result) {
+  if (reported) {
+    reported->state = FREE;
+    reported = nullptr;
+  }
+  expire();
+  for (Command &command : commands) {
+    if (command.state == VERIFIED || command.state == FAILED) {
+      reported = &command;
+      result.protocol = command.protocol;
+      result.message = command.message;
+      result.verified = command.state == VERIFIED;
+      result.latency = command.latency;
+      return true;
+    }
+  }
+  return false;
+}
+
+TransmitVerifier::Stats TransmitVerifier::stats() const {
+  return {verified, failed, untracked, latencyTotal, latencyMax};
+}
+
+void TransmitVerifier::resetStats() {
+  verified = 0;
+  failed = 0;
+  untracked = 0;
+  latencyTotal = 0;
+  latencyMax = 0;
+}
@@ -0,0 +1,156 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef TRANSMITVERIFIER_H
+#define TRANSMITVERIFIER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ESPiLight.h>
+
+#ifndef RF_VERIFY_COMMANDS
+// Transmit commands waiting for the echo of their pulse train
+#define RF_VERIFY_COMMANDS 16
+#endif
+
+#ifndef RF_VERIFY_TRAINS
+// Transmitted pulse trains kept to match their echo
+#define RF_VERIFY_TRAINS 3
+#endif
+
+#ifndef RF_VERIFY_TOLERANCE
+// Maximal deviation of an echoed pulse in percent of the sent pulse, but at
+// least RF_VERIFY_MIN_TOLERANCE microseconds
+#define RF_VERIFY_TOLERANCE 30
+#endif
+
+#ifndef RF_VERIFY_MIN_TOLERANCE
+#define RF_VERIFY_MIN_TOLERANCE 100
+#endif
+
+#ifndef RF_VERIFY_TIMEOUT
+// A pulse train not echoed this many milliseconds after its transmission
+// ended failed
+#define RF_VERIFY_TIMEOUT 200
+#endif
+
+#ifndef RF_VERIFY_COMMAND_TIMEOUT
+// A command whose pulse train never got transmitted failed after this many
+// milliseconds
+#define RF_VERIFY_COMMAND_TIMEOUT 65000
+#endif
+
+#ifndef RF_VERIFY_MESSAGE_SIZE
+#define RF_VERIFY_MESSAGE_SIZE 96
+#endif
+
+// Verifies transmissions by their echo on the local receivers.
+//
+// Transmit commands are remembered with the key of their pulse train by
+// expect(), the pulse trains handed to the transmitter are copied by
+// transmitting().  Every received pulse train is compared against the
+// copies by match(), pulse by pulse within RF_VERIFY_TOLERANCE.  The first
+// echo verifies all commands of the pulse train received before its
+// transmission started, a pulse train without echo fails them.  Verified
+// and failed commands are collected by nextResult() from loop().
+class TransmitVerifier {
+ public:
+  struct Result {
+    const char *protocol;
+    const char *message;  // empty if it was too long
+    bool verified;
+    // milliseconds from receiving the command to the start of the echo
+    unsigned long latency;
+  };
+
+  struct Stats {
+    size_t verified;
+    size_t failed;
+    size_t untracked;  // too many waiting commands
+    unsigned long latencyTotal;
+    unsigned long latencyMax;
+  };
+
+  TransmitVerifier() { resetStats(); }
+
+  // Remembers a command scheduled as pulse train key, a key of 0 fails it.
+  void expect(uint32_t key, const char *protocol, const char *message,
+              size_t messageLength);
+  // Keeps a pulse train handed to the transmitter as sequence.
+  void transmitting(uint32_t sequence, const uint16_t *pulses, size_t length);
+  // The transmission of sequence ended.
+  void transmitted(uint32_t sequence);
+  // True if pulses are the echo of a transmitted pulse train.
+  bool match(const uint16_t *pulses, size_t length);
+  // Returns false if no command was verified or failed since the last call.
+  // The result is valid until the next call.
+  bool nextResult(Result &result);
+  Stats stats() const;
+  void resetStats();
+
+ private:
+  enum State : uint8_t { FREE, WAITING, VERIFIED, FAILED };
+
+  struct Command {
+    State state = FREE;
+    uint32_t key;
+    unsigned long received;
+    unsigned long latency;
+    char protocol[32];
+    char message[RF_VERIFY_MESSAGE_SIZE];
+  };
+
+  struct Train {
+    size_t length = 0;  // 0 for an unused slot
+    uint32_t key;
+    uint32_t sequence;
+    unsigned long started;
+    bool ended;
+    unsigned long endedAt;
+    bool echoed;
+    uint16_t pulses[MAXPULSESTREAMLENGTH];
+  };
+
+  bool isEcho(const Train &train, const uint16_t *pulses,
+              size_t length) const;
+  void settle(const Train &train, State state, unsigned long onAir);
+  void expire();
+
+  Command commands[RF_VERIFY_COMMANDS];
+  Train trains[RF_VERIFY_TRAINS];
+  Command *reported = nullptr;
+  size_t verified;
+  size_t failed;
+  size_t untracked;
+  unsigned long latencyTotal;
+  unsigned long latencyMax;
+};
+
+#endif  // TRANSMITVERIFIER_H
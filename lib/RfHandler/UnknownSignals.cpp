@@ -0,0 +1,150 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "UnknownSignals.h"
+
+static const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+static uint32_t fnv1a(uint32_t hash, uint8_t data) {
+  return (hash ^ data) * FNV_PRIME;
+}
+
+static uint8_t quantize(uint16_t pulse, uint16_t base, uint8_t max) {
+  uint32_t ratio = (pulse + base / 2) / base;
+  return ratio > max ? max : ratio;
+}
+
+UnknownSignals::UnknownSignals() : used(0) {}
+
+void UnknownSignals::add(const uint16_t *pulses, size_t length) {
+  if (length < 2) return;
+  size_t bodyLength = length - 1;
+  uint16_t base = *std::min_element(pulses, pulses + bodyLength);
+  if (base == 0) return;
+
+  uint8_t ratios[sizeof(Entry::ratios)] = {};
+  uint32_t hash = fnv1a(FNV_OFFSET_BASIS, length);
+  for (size_t i = 0; i < bodyLength; i++) {
+    uint8_t ratio = quantize(pulses[i], base, MAX_RATIO);
+    ratios[i / 2] |= ratio << (i % 2 ? 4 : 0);
+    hash = fnv1a(hash, ratio);
+  }
+  hash = fnv1a(hash, quantize(pulses[bodyLength], base, UINT8_MAX));
+
+  Entry *least = nullptr;
+  for (size_t i = 0; i < used; i++) {
+    if (entries[i].hash == hash && entries[i].length == length) {
+      entries[i].count++;
+      return;
+    }
+    if (!least || entries[i].count < least->count) {
+      least = &entries[i];
+    }
+  }
+
+  Entry *entry;
+  uint32_t count = 1;
+  if (used < RF_UNKNOWN_TABLE_SIZE) {
+    entry = &entries[used++];
+  } else {
+    entry = least;
+    count = least->count + 1;
+  }
+  entry->hash = hash;
+  entry->count = count;
+  entry->base = base;
+  entry->footer = pulses[bodyLength];
+  entry->length = length;
+  memcpy(entry->ratios, ratios, sizeof(ratios));
+}
+
+bool UnknownSignals::describe(size_t rank, char *buffer, size_t size) const {
+  if (rank >= used) return false;
+  const Entry *ranked[RF_UNKNOWN_TABLE_SIZE];
+  for (size_t i = 0; i < used; i++) {
+    ranked[i] = &entries[i];
+  }
+  std::sort(ranked, ranked + used, [](const Entry *a, const Entry *b) {
+    return a->count > b->count;
+  });
+  const Entry &entry = *ranked[rank];
+
+  int written = snprintf(buffer, size, "{\"count\":%u,\"pulses\":%u",
+                         static_cast<unsigned>(entry.count),
+                         static_cast<unsigned>(entry.length));
+  // leave room for the closing brace
+  if (written < 0 || static_cast<size_t>(written) + 1 >= size) return false;
+  size_t pos = written;
+  size_t end = appendRaw(entry, buffer, pos, size - 1);
+  if (end == 0) {
+    // publish at least the count if the sample does not fit
+    end = pos;
+  }
+  buffer[end++] = '}';
+  buffer[end] = 0;
+  return true;
+}
+
+size_t UnknownSignals::appendRaw(const Entry &entry, char *buffer, size_t pos,
+                                 size_t size) {
+  // RAW sample like ESPiLight::pulseTrainToString(), the footer is kept as
+  // its own pulse type
+  uint8_t types[MAX_PULSE_TYPES];
+  size_t typeCount = 0;
+  int written = snprintf(buffer + pos, size - pos, ",\"raw\":\"c:");
+  if (written < 0 || pos + written >= size) return 0;
+  pos += written;
+  for (size_t i = 0; i < entry.length; i++) {
+    // ratio 0 marks the footer, the body never quantizes to 0
+    uint8_t ratio = i + 1 < entry.length ? entry.ratio(i) : 0;
+    size_t type = std::find(types, types + typeCount, ratio) - types;
+    if (type == typeCount) {
+      if (typeCount == MAX_PULSE_TYPES) return 0;
+      types[typeCount++] = ratio;
+    }
+    if (pos + 1 >= size) return 0;
+    buffer[pos++] = '0' + type;
+  }
+  for (size_t i = 0; i < typeCount; i++) {
+    unsigned pulse = types[i] ? entry.base * types[i] : entry.footer;
+    written =
+        snprintf(buffer + pos, size - pos, "%s%u", i ? "," : ";p:", pulse);
+    if (written < 0 || pos + written >= size) return 0;
+    pos += written;
+  }
+  written = snprintf(buffer + pos, size - pos, "@\"");
+  if (written < 0 || pos + written >= size) return 0;
+  return pos + written;
+}
@@ -0,0 +1,94 @@
+/**
+  MQTT433gateway - MQTT 433.92 MHz radio gateway utilizing ESPiLight
+  Project home: https://github.com/puuu/MQTT433gateway/
+
+  The MIT License (MIT)
+
+  Copyright (c) 2026 agent
+
+  Permission is hereby granted, free of charge, to any person
+  obtaining a copy of this software and associated documentation files
+  (the "Software"), to deal in the Software without restriction,
+  including without limitation the rights to use, copy, modify, merge,
+  publish, distribute, sublicense, and/or sell copies of the Software,
+  and to permit persons to whom the Software is furnished to do so,
+  subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be
+  included in all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+  ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+  CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#ifndef UNKNOWNSIGNALS_H
+#define UNKNOWNSIGNALS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ESPiLight.h>
+
+#ifndef RF_UNKNOWN_TABLE_SIZE
+#define RF_UNKNOWN_TABLE_SIZE 16
+#endif
+
+#ifndef RF_UNKNOWN_TOP_N
+#define RF_UNKNOWN_TOP_N 3
+#endif
+
+// Fits into a MQTT_MAX_PACKET_SIZE of 256 together with the topic
+#ifndef RF_UNKNOWN_PAYLOAD_SIZE
+#define RF_UNKNOWN_PAYLOAD_SIZE 192
+#endif
+
+// Counts the signatures of pulse trains that no protocol decodes.
+//
+// A signature consists of the pulse count, the ratio of every pulse to the
+// shortest pulse (rounded, at most MAX_RATIO) and the ratio of
+// the footer.  Jitter does not change the signature, so repeated frames of
+// the same device end up in the same entry.  The table keeps the most
+// frequent signatures with the space-saving algorithm: a new signature
+// replaces the least frequent one and inherits its count.
+class UnknownSignals {
+ public:
+  static const uint8_t MAX_RATIO = 15;
+
+  UnknownSignals();
+
+  void add(const uint16_t *pulses, size_t length);
+  // Writes the rank-th most frequent signature (starting at 0) as JSON
+  // object with count, pulse count and, if it fits, a RAW sample into
+  // buffer.  Returns false if there is no such signature.
+  bool describe(size_t rank, char *buffer, size_t size) const;
+
+ private:
+  struct Entry {
+    uint32_t hash;
+    uint32_t count;
+    uint16_t base;
+    uint16_t footer;
+    uint8_t length;
+    // pulse ratios of the first sample, two per byte, footer excluded
+    uint8_t ratios[(MAXPULSESTREAMLENGTH + 1) / 2];
+
+    uint8_t ratio(size_t index) const {
+      return (ratios[index / 2] >> (index % 2 ? 4 : 0)) & 0x0f;
+    }
+  };
+
+  // Returns the end of the appended RAW sample, 0 if it does not fit.
+  static size_t appendRaw(const Entry &entry, char *buffer, size_t pos,
+                          size_t size);
+
+  Entry entries[RF_UNKNOWN_TABLE_SIZE];
+  size_t used;
+};
+
+#endif  // UNKNOWNSIGNALS_H
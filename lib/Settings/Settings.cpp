@@ -44,14 +44,28 @@ char mqttBrokerPort[] = "mqttBrokerPort";
 char mqttUser[] = "mqttUser";
 char mqttPassword[] = "mqttPassword";
 char mqttRetain[] = "mqttRetain";
+char mqttQueueSpill[] = "mqttQueueSpill";
+char mqttQos[] = "mqttQos";
+char mqttCoalesceWindow[] = "mqttCoalesceWindow";
+char mqttLatencyInterval[] = "mqttLatencyInterval";
 char mqttReceiveTopic[] = "mqttReceiveTopic";
 char mqttSendTopic[] = "mqttSendTopic";
 char mqttStateTopic[] = "mqttStateTopic";
 char mqttVersionTopic[] = "mqttVersionTopic";
 char rfEchoMessages[] = "rfEchoMessages";
+char rfVerifyTransmit[] = "rfVerifyTransmit";
 char rfReceiverPin[] = "rfReceiverPin";
 char rfTransmitterPin[] = "rfTransmitterPin";
+char rfListenBeforeTalk[] = "rfListenBeforeTalk";
+char rfDutyCycle[] = "rfDutyCycle";
+char rfTransmitPriorities[] = "rfTransmitPriorities";
 char rfReceiverPinPullUp[] = "rfReceiverPinPullUp";
+char rfReceiverPulseMin[] = "rfReceiverPulseMin";
+char rfReceiverPulseMax[] = "rfReceiverPulseMax";
+char rfReceivers[] = "rfReceivers";
+char rfRepeatWindow[] = "rfRepeatWindow";
+char rfRepeatHeartbeat[] = "rfRepeatHeartbeat";
+char rfUnknownInterval[] = "rfUnknownInterval";
 char rfProtocols[] = "rfProtocols";
 char serialLogLevel[] = "serialLogLevel";
 char webLogLevel[] = "webLogLevel";
@@ -76,6 +90,21 @@ std::function<bool(const T &)> notZero() {
   return [](const T &val) { return val != 0; };
 }
 
+template <typename T>
+std::function<bool(const T &)> atMost(T max) {
+  return [max](const T &val) { return val <= max; };
+}
+
+template <typename T>
+std::function<bool(const T &)> below(T max) {
+  return [max](const T &val) { return val < max; };
+}
+
+template <typename T>
+std::function<bool(const T &)> above(T min) {
+  return [min](const T &val) { return val > min; };
+}
+
 static void logInvalidWarning(const String &key) {
   Logger.warning.print(F("Setting "));
   Logger.warning.print(key);
@@ -164,14 +193,28 @@ void Settings::doSerialize(JsonDocument &root, bool sensible) const {
   root[JsonKey::mqttBrokerPort] = this->mqttBrokerPort;
   root[JsonKey::mqttUser] = this->mqttUser;
   root[JsonKey::mqttRetain] = this->mqttRetain;
+  root[JsonKey::mqttQueueSpill] = this->mqttQueueSpill;
+  root[JsonKey::mqttQos] = this->mqttQos;
+  root[JsonKey::mqttCoalesceWindow] = this->mqttCoalesceWindow;
+  root[JsonKey::mqttLatencyInterval] = this->mqttLatencyInterval;
   root[JsonKey::mqttReceiveTopic] = this->mqttReceiveTopic;
   root[JsonKey::mqttSendTopic] = this->mqttSendTopic;
   root[JsonKey::mqttStateTopic] = this->mqttStateTopic;
   root[JsonKey::mqttVersionTopic] = this->mqttVersionTopic;
   root[JsonKey::rfEchoMessages] = this->rfEchoMessages;
+  root[JsonKey::rfVerifyTransmit] = this->rfVerifyTransmit;
   root[JsonKey::rfReceiverPin] = this->rfReceiverPin;
   root[JsonKey::rfTransmitterPin] = this->rfTransmitterPin;
+  root[JsonKey::rfListenBeforeTalk] = this->rfListenBeforeTalk;
+  root[JsonKey::rfDutyCycle] = this->rfDutyCycle;
+  root[JsonKey::rfTransmitPriorities] = serialized(this->rfTransmitPriorities);
   root[JsonKey::rfReceiverPinPullUp] = this->rfReceiverPinPullUp;
+  root[JsonKey::rfReceiverPulseMin] = this->rfReceiverPulseMin;
+  root[JsonKey::rfReceiverPulseMax] = this->rfReceiverPulseMax;
+  root[JsonKey::rfReceivers] = serialized(this->rfReceivers);
+  root[JsonKey::rfRepeatWindow] = this->rfRepeatWindow;
+  root[JsonKey::rfRepeatHeartbeat] = this->rfRepeatHeartbeat;
+  root[JsonKey::rfUnknownInterval] = this->rfUnknownInterval;
   root[JsonKey::rfProtocols] = serialized(this->rfProtocols);
   root[JsonKey::serialLogLevel] = this->serialLogLevel;
   root[JsonKey::webLogLevel] = this->webLogLevel;
@@ -216,6 +259,14 @@ Settings::SettingTypeSet Settings::applyJson(JsonDocument &parsedSettings) {
                  setIfPresent(parsedSettings, JsonKey::mqttPassword,
                               mqttPassword, notEmpty()),
                  setIfPresent(parsedSettings, JsonKey::mqttRetain, mqttRetain),
+                 setIfPresent(parsedSettings, JsonKey::mqttQueueSpill,
+                              mqttQueueSpill),
+                 setIfPresent(parsedSettings, JsonKey::mqttQos, mqttQos,
+                              atMost<uint8_t>(1)),
+                 setIfPresent(parsedSettings, JsonKey::mqttCoalesceWindow,
+                              mqttCoalesceWindow),
+                 setIfPresent(parsedSettings, JsonKey::mqttLatencyInterval,
+                              mqttLatencyInterval),
                  setIfPresent(parsedSettings, JsonKey::mqttReceiveTopic,
                               mqttReceiveTopic, notEmpty()),
                  setIfPresent(parsedSettings, JsonKey::mqttSendTopic,
@@ -224,15 +275,53 @@ Settings::SettingTypeSet Settings::applyJson(JsonDocument &parsedSettings) {
                               mqttStateTopic, notEmpty()),
                  setIfPresent(parsedSettings, JsonKey::mqttVersionTopic,
                               mqttVersionTopic, notEmpty())}));
-  changed.set(RF_ECHO, (setIfPresent(parsedSettings, JsonKey::rfEchoMessages,
-                                     rfEchoMessages)));
+  changed.set(
+      RF_ECHO,
+      any({setIfPresent(parsedSettings, JsonKey::rfEchoMessages,
+                        rfEchoMessages),
+           setIfPresent(parsedSettings, JsonKey::rfVerifyTransmit,
+                        rfVerifyTransmit)}));
+  // the pulse length limits are only applied as a valid pair
+  const uint16_t pulseMin =
+      parsedSettings[JsonKey::rfReceiverPulseMin] | rfReceiverPulseMin;
+  const uint16_t pulseMax =
+      parsedSettings[JsonKey::rfReceiverPulseMax] | rfReceiverPulseMax;
   changed.set(
       RF_CONFIG,
       any({setIfPresent(parsedSettings, JsonKey::rfReceiverPin, rfReceiverPin),
            setIfPresent(parsedSettings, JsonKey::rfTransmitterPin,
                         rfTransmitterPin),
+           setIfPresent(parsedSettings, JsonKey::rfListenBeforeTalk,
+                        rfListenBeforeTalk),
+           setIfPresent(parsedSettings, JsonKey::rfDutyCycle, rfDutyCycle),
            setIfPresent(parsedSettings, JsonKey::rfReceiverPinPullUp,
-                        rfReceiverPinPullUp)}));
+                        rfReceiverPinPullUp),
+           setIfPresent(parsedSettings, JsonKey::rfReceiverPulseMin,
+                        rfReceiverPulseMin, below(pulseMax)),
+           setIfPresent(parsedSettings, JsonKey::rfReceiverPulseMax,
+                        rfReceiverPulseMax, above(pulseMin)),
+           setIfPresent(parsedSettings, JsonKey::rfRepeatWindow,
+                        rfRepeatWindow),
+           setIfPresent(parsedSettings, JsonKey::rfRepeatHeartbeat,
+                        rfRepeatHeartbeat),
+           setIfPresent(parsedSettings, JsonKey::rfUnknownInterval,
+                        rfUnknownInterval)}));
+  if (!parsedSettings[JsonKey::rfReceivers].isNull()) {
+    String buff;
+    serializeJson(parsedSettings[JsonKey::rfReceivers], buff);
+    if (buff != rfReceivers) {
+      rfReceivers = buff;
+      changed.set(RF_CONFIG, true);
+    }
+  }
+  if (!parsedSettings[JsonKey::rfTransmitPriorities].isNull()) {
+    String buff;
+    serializeJson(parsedSettings[JsonKey::rfTransmitPriorities], buff);
+    if (buff != rfTransmitPriorities) {
+      rfTransmitPriorities = buff;
+      changed.set(RF_CONFIG, true);
+    }
+  }
   if (!parsedSettings[JsonKey::rfProtocols].isNull()) {
     String buff;
     serializeJson(parsedSettings[JsonKey::rfProtocols], buff);
@@ -48,6 +48,8 @@ const char PROGMEM DEFAULT_SEND_TOPIC_SUFFIX[] = "/send/";
 const char PROGMEM DEFAULT_STATE_TOPIC_SUFFIX[] = "/state";
 const char PROGMEM DEFAULT_VERSION_TOPIC_SUFFIX[] = "/version";
 const char PROGMEM DEFAULT_RF_PROTOCOLS[] = "[]";
+const char PROGMEM DEFAULT_RF_RECEIVERS[] = "[]";
+const char PROGMEM DEFAULT_RF_TRANSMIT_PRIORITIES[] = "{}";
 const char PROGMEM DEFAULT_SERIAL_LOG_LEVEL[] = "debug";
 const char PROGMEM DEFAULT_WEB_LOG_LEVEL[] = "info";
 
@@ -79,14 +81,28 @@ class Settings {
         mqttUser(""),
         mqttPassword(""),
         mqttRetain(true),
+        mqttQueueSpill(false),
+        mqttQos(0),
+        mqttCoalesceWindow(0),
+        mqttLatencyInterval(0),
         mqttReceiveTopic(deviceName + FPSTR(DEFAULT_RECEIVE_TOPIC_SUFFIX)),
         mqttSendTopic(deviceName + FPSTR(DEFAULT_SEND_TOPIC_SUFFIX)),
         mqttStateTopic(deviceName + FPSTR(DEFAULT_STATE_TOPIC_SUFFIX)),
         mqttVersionTopic(deviceName + FPSTR(DEFAULT_VERSION_TOPIC_SUFFIX)),
         rfEchoMessages(false),
+        rfVerifyTransmit(false),
         rfReceiverPin(12),  // avoid 0, 2, 15, 16
         rfTransmitterPin(4),
+        rfListenBeforeTalk(false),
+        rfDutyCycle(10),  // per mille, 1%
+        rfTransmitPriorities(FPSTR(DEFAULT_RF_TRANSMIT_PRIORITIES)),
         rfReceiverPinPullUp(true),
+        rfReceiverPulseMin(40),
+        rfReceiverPulseMax(65535),
+        rfReceivers(FPSTR(DEFAULT_RF_RECEIVERS)),
+        rfRepeatWindow(0),
+        rfRepeatHeartbeat(0),
+        rfUnknownInterval(0),
         rfProtocols(FPSTR(DEFAULT_RF_PROTOCOLS)),
         serialLogLevel(FPSTR(DEFAULT_SERIAL_LOG_LEVEL)),
         webLogLevel(FPSTR(DEFAULT_WEB_LOG_LEVEL)),
@@ -122,14 +138,28 @@ class Settings {
   String mqttUser;
   String mqttPassword;
   bool mqttRetain;
+  bool mqttQueueSpill;
+  uint8_t mqttQos;
+  uint16_t mqttCoalesceWindow;
+  uint16_t mqttLatencyInterval;
   String mqttReceiveTopic;
   String mqttSendTopic;
   String mqttStateTopic;
   String mqttVersionTopic;
   bool rfEchoMessages;
+  bool rfVerifyTransmit;
   int8_t rfReceiverPin;
   int8_t rfTransmitterPin;
+  bool rfListenBeforeTalk;
+  uint16_t rfDutyCycle;
+  String rfTransmitPriorities;
   bool rfReceiverPinPullUp;
+  uint16_t rfReceiverPulseMin;
+  uint16_t rfReceiverPulseMax;
+  String rfReceivers;
+  uint16_t rfRepeatWindow;
+  uint16_t rfRepeatHeartbeat;
+  uint16_t rfUnknownInterval;
   String rfProtocols;
   String serialLogLevel;
   String webLogLevel;
@@ -42,6 +42,7 @@ const char PROGMEM PLAIN[] = "plain";
 const char PROGMEM TEXT_PLAIN[] = "text/plain";
 const char PROGMEM TEXT_HTML[] = "text/html";
 const char PROGMEM APPLICATION_JSON[] = "application/json";
+const char PROGMEM APPLICATION_OCTET_STREAM[] = "application/octet-stream";
 
 const char PROGMEM URL_ROOT[] = "/";
 const char PROGMEM URL_SYSTEM[] = "/system";
@@ -49,6 +50,25 @@ const char PROGMEM URL_CONFIG[] = "/config";
 const char PROGMEM URL_PROTOCOLS[] = "/protocols";
 const char PROGMEM URL_DEBUG[] = "/debug";
 const char PROGMEM URL_FIRMWARE[] = "/firmware";
+const char PROGMEM URL_RFRECORD[] = "/rfrecord";
+const char PROGMEM URL_MACROS[] = "/macros";
+const char PROGMEM NAME[] = "name";
+
+// Sends everything printed as chunks of the current response
+class ContentPrint : public Print {
+ public:
+  explicit ContentPrint(ESP8266WebServer& server) : server(server) {}
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* buffer, size_t size) override {
+    // sendContent_P() works on RAM as well and avoids a String copy
+    server.sendContent_P(reinterpret_cast<const char*>(buffer), size);
+    return size;
+  }
+
+ private:
+  ESP8266WebServer& server;
+};
 
 void ConfigWebServer::begin() {
   server.on(FPSTR(URL_ROOT), authenticated([this]() {
@@ -103,6 +123,20 @@ void ConfigWebServer::begin() {
               server.send(200, FPSTR(APPLICATION_JSON), fwJsonVersion(true));
             }));
 
+  server.on(
+      FPSTR(URL_RFRECORD), HTTP_GET,
+      authenticated(std::bind(&::ConfigWebServer::onRecordingGet, this)));
+
+  server.on(FPSTR(URL_MACROS), HTTP_GET,
+            authenticated(std::bind(&::ConfigWebServer::onMacroGet, this)));
+
+  server.on(FPSTR(URL_MACROS), HTTP_PUT,
+            authenticated(std::bind(&::ConfigWebServer::onMacroPut, this)));
+
+  server.on(
+      FPSTR(URL_MACROS), HTTP_DELETE,
+      authenticated(std::bind(&::ConfigWebServer::onMacroDelete, this)));
+
   server.on(
       FPSTR(URL_FIRMWARE), HTTP_POST,
       authenticated(std::bind(&::ConfigWebServer::onFirmwareFinish, this)),
@@ -193,6 +227,55 @@ void ConfigWebServer::onDebugFlagGet() {
   server.send(200, FPSTR(APPLICATION_JSON), result);
 }
 
+void ConfigWebServer::onRecordingGet() {
+  Logger.debug.println(F("Webserver: rfrecord GET"));
+  if (!recordingProvider) {
+    server.send_P(404, TEXT_PLAIN, PSTR("No recording available"));
+    return;
+  }
+  server.sendHeader(F("Content-Disposition"),
+                    F("attachment; filename=\"rfrecord.bin\""));
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, FPSTR(APPLICATION_OCTET_STREAM), "");
+  ContentPrint output(server);
+  recordingProvider(output);
+  server.sendContent("");
+}
+
+void ConfigWebServer::onMacroGet() {
+  Logger.debug.println(F("Webserver: macros GET"));
+  if (!macroProvider) {
+    server.send_P(404, TEXT_PLAIN, PSTR("No macros available"));
+    return;
+  }
+  const String result = macroProvider(server.arg(FPSTR(NAME)));
+  if (result.length() == 0) {
+    server.send_P(404, TEXT_PLAIN, PSTR("Unknown macro"));
+    return;
+  }
+  server.send(200, FPSTR(APPLICATION_JSON), result);
+}
+
+void ConfigWebServer::onMacroPut() {
+  Logger.debug.println(F("Webserver: macros PUT"));
+  if (!macroStore ||
+      !macroStore(server.arg(FPSTR(NAME)), server.arg(FPSTR(PLAIN)))) {
+    server.send_P(400, TEXT_PLAIN,
+                  PSTR("Cannot store macro, see log for details!"));
+    return;
+  }
+  onMacroGet();
+}
+
+void ConfigWebServer::onMacroDelete() {
+  Logger.debug.println(F("Webserver: macros DELETE"));
+  if (!macroRemove || !macroRemove(server.arg(FPSTR(NAME)))) {
+    server.send_P(404, TEXT_PLAIN, PSTR("Unknown macro"));
+    return;
+  }
+  server.send_P(200, TEXT_PLAIN, PSTR("Macro removed"));
+}
+
 void ConfigWebServer::onFirmwareFinish() {
   server.sendHeader(F("Connection"), F("close"));
 
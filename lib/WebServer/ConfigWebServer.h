@@ -45,9 +45,13 @@ class ConfigWebServer {
  public:
   using SystemCommandCb = std::function<void()>;
   using ProtocolProviderCb = std::function<String()>;
+  using RecordingProviderCb = std::function<void(Print&)>;
   using OtaHookCb = std::function<void()>;
   using DebugFlagGetCb = std::function<bool()>;
   using DebugFlagSetCb = std::function<void(bool)>;
+  using MacroProviderCb = std::function<String(const String&)>;
+  using MacroStoreCb = std::function<bool(const String&, const String&)>;
+  using MacroRemoveCb = std::function<bool(const String&)>;
 
   ConfigWebServer(Settings& settings)
       : settings(settings), server(80), wsLogTarget(81) {}
@@ -60,11 +64,24 @@ class ConfigWebServer {
   void registerProtocolProvider(const ProtocolProviderCb& cb) {
     protocolProvider = cb;
   }
+  void registerRecordingProvider(const RecordingProviderCb& cb) {
+    recordingProvider = cb;
+  }
   void registerOtaHook(const OtaHookCb& cb) { otaHook = cb; }
+  void registerMacroHandler(const MacroProviderCb& provider,
+                            const MacroStoreCb& store,
+                            const MacroRemoveCb& remove) {
+    macroProvider = provider;
+    macroStore = store;
+    macroRemove = remove;
+  }
   void registerDebugFlagHandler(const String& state,
                                 const DebugFlagGetCb& getState,
                                 const DebugFlagSetCb& setState);
   Print& logTarget();
+  void broadcastBinary(const uint8_t* data, size_t length) {
+    wsLogTarget.broadcastBinary(data, length);
+  }
 
  private:
   struct SystemCommandHandler {
@@ -91,6 +108,10 @@ class ConfigWebServer {
   void onSystemCommand();
   void onDebugFlagGet();
   void onDebugFlagSet();
+  void onRecordingGet();
+  void onMacroGet();
+  void onMacroPut();
+  void onMacroDelete();
   void onFirmwareFinish();
   void onFirmwareUpload();
 
@@ -99,7 +120,11 @@ class ConfigWebServer {
   WebSocketLogTarget wsLogTarget;
   std::forward_list<SystemCommandHandler> systemCommandHandlers;
   ProtocolProviderCb protocolProvider;
+  RecordingProviderCb recordingProvider;
   OtaHookCb otaHook;
+  MacroProviderCb macroProvider;
+  MacroStoreCb macroStore;
+  MacroRemoveCb macroRemove;
   std::forward_list<DebugFlagHandler> debugFlagHandlers;
   String password;
 };
@@ -42,6 +42,9 @@ class WebSocketLogTarget : public LineBufferProxy<64> {
 
   void loop() { server.loop(); }
   void begin();
+  void broadcastBinary(const uint8_t* data, size_t length) {
+    server.broadcastBIN(data, length);
+  }
 
  protected:
   void flush(const char* data) override;
@@ -0,0 +1,202 @@
+#!/usr/bin/env python
+
+"""MQTT433gateway raw pulse stream decoder
+
+Project home: https://github.com/puuu/MQTT433gateway/
+
+Receives the binary pulse train stream of a gateway with the
+protocolRawStream debug flag enabled from its websocket (port 81) and prints
+every pulse train as ESPiLight RAW string, as logged with the protocolRaw
+debug flag.  A stream saved with --save can be decoded again with --file,
+a recording downloaded from /rfrecord with --recording.
+
+Stream format: per pulse train the number of pulses followed by one value
+per pulse, all as unsigned LEB128 varints.  Even and odd pulses keep their
+two most recent pulses as references (both 0 at the start of a pulse
+train).  The lowest bit of a value selects the reference (0 the most recent
+one), the remaining bits are the zigzag encoded difference of the pulse to
+it; the pulse then becomes the most recent reference.  In recordings every
+pulse train is preceded by the milliseconds since the previous one.
+"""
+
+import argparse
+import base64
+import os
+import socket
+import struct
+import sys
+
+MAX_PULSE_TYPES = 10
+
+WS_OPCODE_TEXT = 0x1
+WS_OPCODE_BINARY = 0x2
+WS_OPCODE_CLOSE = 0x8
+WS_OPCODE_PING = 0x9
+WS_OPCODE_PONG = 0xA
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(data):
+            raise ValueError("truncated varint")
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7f) << shift
+        if byte < 0x80:
+            return value, pos
+        shift += 7
+
+
+def decode_frames(data, recording=False):
+    """Yield the pulse trains (lists of pulse lengths in us) of a stream."""
+    pos = 0
+    while pos < len(data):
+        if recording:
+            _, pos = read_varint(data, pos)
+        length, pos = read_varint(data, pos)
+        pulses = []
+        recent = [[0, 0], [0, 0]]
+        for index in range(length):
+            value, pos = read_varint(data, pos)
+            level = recent[index % 2]
+            slot = value & 1
+            zigzag = value >> 1
+            pulse = level[slot] + ((zigzag >> 1) ^ -(zigzag & 1))
+            if slot == 1:
+                level[1] = level[0]
+            level[0] = pulse
+            pulses.append(pulse)
+        yield pulses
+
+
+def pulse_train_to_string(pulses):
+    """Same as ESPiLight::pulseTrainToString(), None for too many types."""
+    types = []
+    codes = []
+    for pulse in pulses:
+        for index, known in enumerate(types):
+            # compare with a tolerance of 100us, like the library does
+            if -2 <= known // 50 - pulse // 50 <= 2:
+                break
+        else:
+            if len(types) == MAX_PULSE_TYPES:
+                return None
+            index = len(types)
+            types.append(pulse)
+        codes.append(str(index))
+    return "c:{};p:{}@".format("".join(codes),
+                               ",".join(str(t) for t in types))
+
+
+class WebSocketClient(object):
+    """Minimal RFC 6455 client, just enough for the gateway websocket."""
+
+    def __init__(self, host, port):
+        self.sock = socket.create_connection((host, port))
+        key = base64.b64encode(os.urandom(16)).decode()
+        request = ("GET / HTTP/1.1\r\n"
+                   "Host: {}:{}\r\n"
+                   "Upgrade: websocket\r\n"
+                   "Connection: Upgrade\r\n"
+                   "Sec-WebSocket-Key: {}\r\n"
+                   "Sec-WebSocket-Version: 13\r\n\r\n").format(host, port, key)
+        self.sock.sendall(request.encode())
+        response = b""
+        while b"\r\n\r\n" not in response:
+            chunk = self.sock.recv(1024)
+            if not chunk:
+                raise IOError("connection closed during handshake")
+            response += chunk
+        if b" 101 " not in response.split(b"\r\n", 1)[0]:
+            raise IOError("websocket handshake failed")
+        self.pending = bytearray(response.split(b"\r\n\r\n", 1)[1])
+
+    def _read(self, length):
+        while len(self.pending) < length:
+            chunk = self.sock.recv(4096)
+            if not chunk:
+                raise IOError("connection closed")
+            self.pending += chunk
+        data = bytes(self.pending[:length])
+        del self.pending[:length]
+        return data
+
+    def _send(self, opcode, payload):
+        mask = os.urandom(4)
+        header = bytearray([0x80 | opcode])
+        if len(payload) < 126:
+            header.append(0x80 | len(payload))
+        else:
+            header.append(0x80 | 126)
+            header += struct.pack("!H", len(payload))
+        masked = bytearray(b ^ mask[i % 4] for i, b in enumerate(payload))
+        self.sock.sendall(bytes(header) + mask + bytes(masked))
+
+    def receive(self):
+        """Return (opcode, payload) of the next data message."""
+        while True:
+            first, second = bytearray(self._read(2))
+            opcode = first & 0x0f
+            length = second & 0x7f
+            if length == 126:
+                length, = struct.unpack("!H", self._read(2))
+            elif length == 127:
+                length, = struct.unpack("!Q", self._read(8))
+            payload = self._read(length)
+            if opcode == WS_OPCODE_PING:
+                self._send(WS_OPCODE_PONG, payload)
+            elif opcode == WS_OPCODE_CLOSE:
+                raise IOError("connection closed by gateway")
+            elif opcode in (WS_OPCODE_TEXT, WS_OPCODE_BINARY):
+                return opcode, payload
+
+
+def print_pulse_trains(data, recording=False):
+    for pulses in decode_frames(bytearray(data), recording):
+        raw = pulse_train_to_string(pulses)
+        if raw is None:
+            sys.stderr.write("skip pulse train with more than {} pulse types\n"
+                             .format(MAX_PULSE_TYPES))
+        else:
+            print(raw)
+    sys.stdout.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("host", nargs="?", help="gateway host name or IP")
+    source.add_argument("--file", help="decode a stream saved with --save")
+    source.add_argument("--recording", help="decode a recording")
+    parser.add_argument("--port", type=int, default=81,
+                        help="websocket port (default: 81)")
+    parser.add_argument("--save", help="append the binary stream to a file")
+    args = parser.parse_args()
+
+    if args.file or args.recording:
+        with open(args.file or args.recording, "rb") as stream:
+            print_pulse_trains(stream.read(), bool(args.recording))
+        return
+
+    client = WebSocketClient(args.host, args.port)
+    save = open(args.save, "ab") if args.save else None
+    try:
+        while True:
+            opcode, payload = client.receive()
+            if opcode != WS_OPCODE_BINARY:
+                continue  # log messages
+            if save:
+                save.write(payload)
+                save.flush()
+            print_pulse_trains(payload)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if save:
+            save.close()
+
+
+if __name__ == "__main__":
+    main()
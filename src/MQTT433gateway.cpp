@@ -72,8 +72,12 @@ void setupMqtt(const Settings &) {
 
   mqttClient = new MqttClient(settings, wifi);
   mqttClient->registerRfDataHandler(
-      [](const String &protocol, const String &data) {
-        if (rf) rf->transmitCode(protocol, data);
+      [](const char *protocol, const char *data, size_t length) {
+        if (rf) rf->transmitCode(protocol, data, length);
+      });
+  mqttClient->registerRfRawHandler(
+      [](const uint8_t *data, size_t length, size_t offset, size_t total) {
+        if (rf) rf->transmitRaw(data, length, offset, total);
       });
   mqttClient->begin();
   Logger.info.println(F("MQTT instance created."));
@@ -92,12 +96,28 @@ void setupRf(const Settings &) {
   }
 
   rf = new RfHandler(settings);
-  rf->registerReceiveHandler([](const String &protocol, const String &data) {
+  rf->registerReceiveHandler([](const char *protocol, const char *data) {
     if (mqttClient) {
       mqttClient->publishCode(protocol, data);
     }
   });
+  rf->registerRawStreamHandler([](const uint8_t *data, size_t length) {
+    if (webServer) {
+      webServer->broadcastBinary(data, length);
+    }
+  });
+  rf->registerStatsHandler([](const char *name, const char *payload) {
+    if (mqttClient) {
+      mqttClient->publishStats(name, payload);
+    }
+  });
+  rf->registerAckHandler([](const char *protocol, const char *payload) {
+    if (mqttClient) {
+      mqttClient->publishAck(protocol, payload);
+    }
+  });
   rf->setEchoEnabled(settings.rfEchoMessages);
+  rf->setVerifyEnabled(settings.rfVerifyTransmit);
   rf->filterProtocols(settings.rfProtocols);
   rf->begin();
   Logger.info.println(F("RfHandler Instance created."));
@@ -134,7 +154,19 @@ void setupWebServer() {
     delay(100);
     ESP.restart();
   });
+  webServer->registerSystemCommandHandler(F("rf_replay"), []() {
+    if (rf) rf->startReplay();
+  });
+  webServer->registerSystemCommandHandler(F("rf_record_clear"),
+                                          RfHandler::clearRecording);
   webServer->registerProtocolProvider(RfHandler::availableProtocols);
+  webServer->registerRecordingProvider(RfHandler::downloadRecording);
+  webServer->registerMacroHandler(
+      RfHandler::downloadMacro,
+      [](const String &name, const String &definition) {
+        return rf && rf->storeMacro(name, definition);
+      },
+      RfHandler::removeMacro);
   webServer->registerOtaHook([]() {
     Logger.debug.println(F("Prepare for oat update."));
     if (statusLED) statusLED->setState(StatusLED::ota);
@@ -154,6 +186,22 @@ void setupWebServer() {
       [](bool state) {
         if (rf) rf->setRawMode(state);
       });
+  webServer->registerDebugFlagHandler(
+      F("protocolRawStream"),
+      []() { return rf && rf->isRawStreamModeEnabled(); },
+      [](bool state) {
+        if (rf) rf->setRawStreamMode(state);
+      });
+  webServer->registerDebugFlagHandler(
+      F("rfRecord"), []() { return rf && rf->isRecordModeEnabled(); },
+      [](bool state) {
+        if (rf) rf->setRecordMode(state);
+      });
+  webServer->registerDebugFlagHandler(
+      F("rfStats"), []() { return rf && rf->isStatsModeEnabled(); },
+      [](bool state) {
+        if (rf) rf->setStatsMode(state);
+      });
   webServer->registerDebugFlagHandler(
       F("systemLoad"), []() { return systemLoad != nullptr; },
       [](bool state) {
@@ -240,6 +288,7 @@ void setup() {
     Logger.debug.println(F("Configure rfEchoMessages."));
     if (rf) {
       rf->setEchoEnabled(s.rfEchoMessages);
+      rf->setVerifyEnabled(s.rfVerifyTransmit);
     } else {
       Logger.warning.println(F("No Rf instance available"));
     }
@@ -41,6 +41,10 @@ $(function () {
         new ConfigItem("mqttUser", inputFieldFactory, inputApply, inputGet, "MQTT username (optional)"),
         new ConfigItem("mqttPassword", passwordFieldFactory, inputApply, inputGet, "MQTT password (optional)"),
         new ConfigItem("mqttRetain", checkboxFactory, checkboxApply, checkboxGet, "Retain MQTT messages"),
+        new ConfigItem("mqttQos", qosInputFactory, inputApply, inputGetInt, "QoS of published codes: 0 (at most once) or 1 (at least once, acknowledged by the broker)"),
+        new ConfigItem("mqttCoalesceWindow", uint16InputFactory, inputApply, inputGetInt, "Publish codes received within this many milliseconds of each other as one JSON array to <mqttReceiveTopic>batch (0 to disable)"),
+        new ConfigItem("mqttLatencyInterval", uint16InputFactory, inputApply, inputGetInt, "Ping the broker and publish the publish and round-trip latencies to <mqttStateTopic>/latency every this many seconds (0 to disable)"),
+        new ConfigItem("mqttQueueSpill", checkboxFactory, checkboxApply, checkboxGet, "Keep messages received while MQTT is offline on flash when the RAM queue is full"),
 
         new GroupItem("MQTT Topic Config", legendFactory),
         new ConfigItem("mqttReceiveTopic", mqttTopicInputFactory, inputApply, inputGet, "Topic to publish received signal"),
@@ -50,9 +54,19 @@ $(function () {
 
         new GroupItem("433MHz RF Config", legendFactory),
         new ConfigItem("rfEchoMessages", checkboxFactory, checkboxApply, checkboxGet, "Echo sent rf messages back"),
+        new ConfigItem("rfVerifyTransmit", checkboxFactory, checkboxApply, checkboxGet, "Verify sent rf messages by their echo and publish an ack per message"),
         new ConfigItem("rfReceiverPin", pinNumberInputFactory, inputApply, inputGetInt, "The GPIO pin used for the rf receiver"),
         new ConfigItem("rfReceiverPinPullUp", checkboxFactory, checkboxApply, checkboxGet, "Activate pullup on rf receiver pin (required for 5V protection with reverse diode)"),
+        new ConfigItem("rfReceiverPulseMin", uint16InputFactory, inputApply, inputGetInt, "Ignore received pulses shorter than this many microseconds (glitch filter)"),
+        new ConfigItem("rfReceiverPulseMax", uint16InputFactory, inputApply, inputGetInt, "Abort received pulse trains at pulses longer than this many microseconds"),
+        new ConfigItem("rfReceivers", inputFieldFactory, jsonApply, jsonGet, "Additional receivers as JSON array, e.g. [{\"pin\":13,\"pullUp\":false,\"protocols\":[\"tcm\"]}]"),
+        new ConfigItem("rfRepeatWindow", uint16InputFactory, inputApply, inputGetInt, "Suppress identical received codes for this many milliseconds after publishing (0 to disable)"),
+        new ConfigItem("rfRepeatHeartbeat", uint16InputFactory, inputApply, inputGetInt, "Publish unchanged codes of a device only every this many seconds (0 to disable)"),
+        new ConfigItem("rfUnknownInterval", uint16InputFactory, inputApply, inputGetInt, "Publish the most frequent undecoded signals every this many seconds (0 to disable)"),
         new ConfigItem("rfTransmitterPin", pinNumberInputFactory, inputApply, inputGetInt, "The GPIO pin used for the RF transmitter"),
+        new ConfigItem("rfListenBeforeTalk", checkboxFactory, checkboxApply, checkboxGet, "Defer transmissions while the receivers get a signal"),
+        new ConfigItem("rfDutyCycle", uint16InputFactory, inputApply, inputGetInt, "Airtime budget in per mille of an hour, e.g. 10 for 1% (0 to disable)"),
+        new ConfigItem("rfTransmitPriorities", inputFieldFactory, jsonApply, jsonGet, "Transmit priorities as JSON object, higher first, e.g. {\"elro_800_switch\":1,\"macro/alarm\":9}"),
 
         new GroupItem("Enabled RF protocols", legendFactory),
         new ConfigItem("rfProtocols", protocolInputField, protocolApply, protocolGet, ""),
@@ -71,6 +85,9 @@ $(function () {
 
     var DEBUG_FLAGS = {
         protocolRaw: "Enable Raw RF message logging",
+        protocolRawStream: "Stream raw RF pulse trains as binary frames over the websocket (decode with scripts/rawstream.py)",
+        rfRecord: "Record received RF pulse trains to flash (download and replay below)",
+        rfStats: "Show RF receive statistics (capture ring usage, dropped pulse trains, repeat filter) every second",
         systemLoad: "Show the processed loop() iterations for each second",
         freeHeap: "Show the free heap memory every second"
     };
@@ -89,6 +106,10 @@ $(function () {
             body.empty();
             body.append("<p>Devices WIFI settings where cleared!</p><p>Please reconfigure it.</p>");
         },
+        rf_replay: function () {
+        },
+        rf_record_clear: function () {
+        },
         reset_config: function () {
             var body = $("body");
             body.empty();
@@ -199,6 +220,14 @@ $(function () {
         return inputFieldNumberFactory(item, 1, 65535);
     }
 
+    function uint16InputFactory(item) {
+        return inputFieldNumberFactory(item, 0, 65535);
+    }
+
+    function qosInputFactory(item) {
+        return inputFieldNumberFactory(item, 0, 1);
+    }
+
     function pinNumberInputFactory(item) {
         return inputFieldNumberFactory(item, 0, 16);
     }
@@ -317,6 +346,10 @@ $(function () {
         $('#cfg-' + itemName).val(data);
     }
 
+    function jsonApply(itemName, data) {
+        $('#cfg-' + itemName).val(JSON.stringify(data));
+    }
+
     function devicePasswordApply(itemName, data) {
         $('#cfg-' + itemName).val(data);
         $('#cfg-' + itemName + '-confirm').val(data);
@@ -350,6 +383,14 @@ $(function () {
         return parseInt(inputGet(element));
     }
 
+    function jsonGet(element) {
+        try {
+            return JSON.parse(inputGet(element));
+        } catch (e) {
+            return undefined;
+        }
+    }
+
     function checkboxGet(element) {
         return element.prop("checked");
     }
@@ -576,6 +617,10 @@ $(function () {
         webSocket.onmessage = function (event) {
             var message = event.data;
 
+            if (typeof message !== "string") {
+                // binary raw pulse stream, not meant for the log
+                return;
+            }
             if (message === "__PONG__") {
                 ping();
                 return;